@@ -16,6 +16,7 @@
 using namespace std;
 
 using namespace exageostat::kernels;
+using namespace exageostat::dataunits;
 using namespace exageostat::generators;
 using namespace exageostat::dataLoader::csv;
 using namespace exageostat::configurations;
@@ -55,21 +56,20 @@ int main(int argc, char **argv) {
     unique_ptr<DataGenerator<double>> synthetic_generator = DataGenerator<double>::CreateGenerator(configurations);
     auto data = synthetic_generator->CreateData(configurations, *kernel);
 
-    // Read csv file using data loader
-    vector<double> measurements_vector;
-    vector<double> x_locations;
-    vector<double> y_locations;
-    vector<double> z_locations;
-
+    // Read csv file using data loader, the first pass counts the locations to allocate the destination.
     auto loader = CSVLoader<double>::GetInstance();
-    loader->ReadData(configurations, measurements_vector, x_locations, y_locations, z_locations, kernel_variables);
+    loader->CountLocations(configurations, kernel_variables);
+    int locations_number = configurations.GetProblemSize() / kernel_variables;
+    Locations<double> locations(locations_number, configurations.GetDimension());
+    vector<double> measurements_vector(configurations.GetProblemSize());
+    loader->ReadData(configurations, locations, measurements_vector.data(), kernel_variables);
 
     // Print loaded data
     LOGGER("Data Loaded:")
-    for (int i = 0; i < x_locations.size(); i++) {
-        LOGGER_PRECISION("X: " << x_locations[i] << " Y: " << y_locations[i], 18)
+    for (int i = 0; i < locations_number; i++) {
+        LOGGER_PRECISION("X: " << locations.GetLocationX()[i] << " Y: " << locations.GetLocationY()[i], 18)
         if (configurations.GetDimension() != exageostat::common::Dimension2D) {
-            LOGGER_PRECISION(" Z: " << z_locations[i], 18)
+            LOGGER_PRECISION(" Z: " << locations.GetLocationZ()[i], 18)
         }
         LOGGER_PRECISION(" z: " << measurements_vector[i] << "\n", 18)
     }
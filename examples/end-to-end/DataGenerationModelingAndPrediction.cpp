@@ -15,8 +15,27 @@
 #include <api/ExaGeoStat.hpp>
 
 using namespace exageostat::api;
+using namespace exageostat::common;
 using namespace exageostat::configurations;
 
+/**
+ * @brief Runs data generation, modeling and prediction in the given precision.
+ * @tparam T Data Type: float or double
+ * @param[in] aConfigurations The configurations of the run.
+ * @return void
+ *
+ */
+template<typename T>
+void RunPipeline(Configurations &aConfigurations) {
+    // Load data by either read from file or create synthetic data.
+    std::unique_ptr<ExaGeoStatData<T>> data;
+    ExaGeoStat<T>::ExaGeoStatLoadData(aConfigurations, data);
+    // Modeling module.
+    ExaGeoStat<T>::ExaGeoStatDataModeling(aConfigurations, data);
+    // Prediction module
+    ExaGeoStat<T>::ExaGeoStatPrediction(aConfigurations, data);
+}
+
 /**
  * @brief Main entry point for the Data Generation & Data Modeling program.
  * @details This function either generates synthetic data using the ExaGeoStat library, or reads an CSV file containing real data, models it, and predicts missing values.
@@ -35,13 +54,12 @@ int main(int argc, char **argv) {
     auto hardware = ExaGeoStatHardware(configurations.GetComputation(), configurations.GetCoresNumber(),
                                        configurations.GetGPUsNumbers(), configurations.GetPGrid(),
                                        configurations.GetQGrid());
-    // Load data by either read from file or create synthetic data.
-    std::unique_ptr<ExaGeoStatData<double>> data;
-    ExaGeoStat<double>::ExaGeoStatLoadData(configurations, data);
-    // Modeling module.
-    ExaGeoStat<double>::ExaGeoStatDataModeling(configurations, data);
-    // Prediction module
-    ExaGeoStat<double>::ExaGeoStatPrediction(configurations, data);
+    // Single precision runs the whole pipeline in float, double and mixed precision keep double data.
+    if (configurations.GetPrecision() == SINGLE) {
+        RunPipeline<float>(configurations);
+    } else {
+        RunPipeline<double>(configurations);
+    }
 
     return 0;
 }
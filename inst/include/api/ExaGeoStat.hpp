@@ -56,7 +56,7 @@ namespace exageostat::api {
          * @brief Objective function used in optimization, and following the NLOPT objective function format.
          * @param[in] aTheta An array of length n containing the current point in the parameter space.
          * @param[in] aGrad  An array of length n where you can optionally return the gradient of the objective function.
-         * @param[in] apInfo pointer containing needed configurations and data.
+         * @param[in] apInfo pointer to the ModelingSession of the fit.
          * @return double MLE results.
          *
          */
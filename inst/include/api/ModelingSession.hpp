@@ -0,0 +1,118 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ModelingSession.hpp
+ * @brief Contains the definition of the ModelingSession class, which holds the state of one MLE fit.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_MODELINGSESSION_HPP
+#define EXAGEOSTATCPP_MODELINGSESSION_HPP
+
+#include <configurations/Configurations.hpp>
+#include <data-units/ExaGeoStatData.hpp>
+#include <helpers/MLECheckpoint.hpp>
+#include <kernels/Kernel.hpp>
+#include <linear-algebra-solvers/LinearAlgebraMethods.hpp>
+
+namespace exageostat::api {
+
+    /**
+     * @class ModelingSession
+     * @brief Holds everything an MLE fit needs across its evaluations: the kernel, the linear algebra solver, the
+     * checkpoint, and the descriptors, sequence and request kept in the data.
+     * @details The session is created once per fit, so that each evaluation of the objective only pushes a new theta
+     * through the solver. The descriptors and the runtime sequence are created by the first evaluation and reused by
+     * the next ones.
+     * @tparam T Data Type: float or double
+     *
+     */
+    template<typename T>
+    class ModelingSession {
+
+    public:
+
+        /**
+         * @brief Creates the kernel, the solver and the checkpoint of a fit.
+         * @param[in] aConfigurations Reference to Configurations object containing user input data.
+         * @param[in] aData Reference to an ExaGeoStatData<T> object containing needed descriptors, and locations.
+         * @param[in] apMeasurementsMatrix Pointer to the user input measurements matrix.
+         * @throws std::runtime_error if the solver of the computation is not available, or the checkpoint file does
+         * not match the fit.
+         *
+         */
+        ModelingSession(configurations::Configurations &aConfigurations, std::unique_ptr<ExaGeoStatData<T>> &aData,
+                        T *apMeasurementsMatrix);
+
+        /**
+         * @brief Default destructor.
+         *
+         */
+        ~ModelingSession() = default;
+
+        ModelingSession(const ModelingSession &) = delete;
+
+        ModelingSession &operator=(const ModelingSession &) = delete;
+
+        /**
+         * @brief Evaluates the log-likelihood, and its gradient if requested, at a new theta.
+         * @param[in] apTheta The theta values, in double precision as given by the optimizer.
+         * @param[out] apGradient The gradient of the log-likelihood, nullptr if not requested.
+         * @return The log-likelihood.
+         * @details The evaluations recorded by a previous run of the fit are replayed from the checkpoint.
+         *
+         */
+        double Evaluate(const double *apTheta, double *apGradient);
+
+        /**
+         * @brief Get the kernel of the fit.
+         * @return Reference to the kernel.
+         *
+         */
+        kernels::Kernel<T> &GetKernel();
+
+        /**
+         * @brief Get the linear algebra solver of the fit.
+         * @return Reference to the solver.
+         *
+         */
+        linearAlgebra::LinearAlgebraMethods<T> &GetLinearAlgebraSolver();
+
+    private:
+
+        /**
+         * @brief Computes the checksum of the locations and the measurements of the fit.
+         * @details The call is collective, the measurements held by the descriptors are gathered by the first process.
+         * @return The checksum, only meaningful on the first process.
+         *
+         */
+        uint64_t GetDataChecksum();
+
+        //// Configurations of the fit.
+        configurations::Configurations &mConfigurations;
+        //// Data holding the locations, the descriptors and the runtime sequence.
+        std::unique_ptr<ExaGeoStatData<T>> &mData;
+        //// User input measurements matrix.
+        T *mpMeasurementsMatrix;
+        //// Kernel resolved once from the plugin registry.
+        std::unique_ptr<kernels::Kernel<T>> mpKernel;
+        //// Solver of the computation, created once from the factory.
+        std::unique_ptr<linearAlgebra::LinearAlgebraMethods<T>> mpLinearAlgebraSolver;
+        //// Checkpoint of the evaluations, nullptr without recovery file.
+        std::unique_ptr<helpers::MLECheckpoint> mpCheckpoint;
+    };
+
+    /**
+     * @brief Instantiates the ModelingSession class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(ModelingSession)
+}
+
+#endif //EXAGEOSTATCPP_MODELINGSESSION_HPP
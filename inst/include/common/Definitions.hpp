@@ -124,6 +124,43 @@ namespace exageostat::common {
         GREAT_CIRCLE_DISTANCE = 1
     };
 
+    /**
+     * @enum Optimizer
+     * @brief Enum denoting the NLOPT algorithm used to maximize the likelihood.
+     *
+     */
+    enum Optimizer {
+        BOBYQA = 0,
+        LBFGS = 1,
+        SLSQP = 2
+    };
+
+    /**
+     * @enum Ordering
+     * @brief Enum denoting the space-filling curve the locations are reordered along.
+     * @details The default ordering keeps the historical behaviour, which sorts the synthetic 2D and 3D locations
+     * along a 16-bit Morton curve and keeps the loaded locations in the order of the file.
+     *
+     */
+    enum Ordering {
+        DEFAULT_ORDERING = 0,
+        NO_ORDERING = 1,
+        MORTON_ORDERING = 2,
+        HILBERT_ORDERING = 3
+    };
+
+    /**
+     * @enum RandomGenerator
+     * @brief Enum denoting the random number generator of the synthetic data.
+     * @details The LAPACK generator draws the whole vector in one sequential stream. The Philox generator computes
+     * every value from the seed and its index only, so the values do not depend on the tiles or the processes.
+     *
+     */
+    enum RandomGenerator {
+        LAPACK_GENERATOR = 0,
+        PHILOX_GENERATOR = 1
+    };
+
     /**
      * @enum Descriptor Type
      * @brief Enum denoting the Descriptor Type.
@@ -141,7 +178,8 @@ namespace exageostat::common {
      */
     enum DataSourceType {
         SYNTHETIC = 0,
-        CSV_FILE = 1
+        CSV_FILE = 1,
+        BINARY_FILE = 2
     };
 
     /**
@@ -205,6 +243,21 @@ namespace exageostat::common {
         DESCRIPTOR_SUM = 52,
         DESCRIPTOR_R = 53,
         DESCRIPTOR_R_COPY = 54,
+        DESCRIPTOR_DISTANCE = 55,
+        DESCRIPTOR_C_SINGLE = 56,
+        DESCRIPTOR_CL = 57,
+        DESCRIPTOR_CM = 58,
+        DESCRIPTOR_C_INVERSE = 59,
+        DESCRIPTOR_Z_SOLVED = 60,
+        DESCRIPTOR_Z_DERIVATIVE = 61,
+        DESCRIPTOR_PROBES = 62,
+        DESCRIPTOR_PROBES_CROSS = 63,
+        DESCRIPTOR_PROBES_DERIVATIVE_1 = 64,
+        DESCRIPTOR_PROBES_DERIVATIVE_2 = 65,
+        DESCRIPTOR_PROBES_DERIVATIVE_3 = 66,
+        DESCRIPTOR_PROBES_DERIVATIVE_4 = 67,
+        DESCRIPTOR_KRIGING_VARIANCE = 68,
+        DESCRIPTOR_C_PANEL = 69,
     };
 
     /**
@@ -231,6 +284,7 @@ namespace exageostat::common {
         EXACT_DENSE = 0,
         DIAGONAL_APPROX = 1,
         TILE_LOW_RANK = 2,
+        VECCHIA_APPROX = 3,
     };
 
     /**
@@ -203,6 +203,14 @@ namespace exageostat::configurations {
 
         CREATE_GETTER_FUNCTION(ApproximationMode, int, "ApproximationMode")
 
+        CREATE_SETTER_FUNCTION(IsDeterministic, bool, aIsDeterministic, "Deterministic")
+
+        CREATE_GETTER_FUNCTION(IsDeterministic, bool, "Deterministic")
+
+        CREATE_SETTER_FUNCTION(IsRetainFactor, bool, aIsRetainFactor, "RetainFactor")
+
+        CREATE_GETTER_FUNCTION(IsRetainFactor, bool, "RetainFactor")
+
         CREATE_SETTER_FUNCTION(Logger, bool, aLogger, "Logger")
 
         CREATE_GETTER_FUNCTION(Logger, bool, "Logger")
@@ -251,6 +259,18 @@ namespace exageostat::configurations {
 
         CREATE_GETTER_FUNCTION(DataPath, std::string, "DataPath")
 
+        CREATE_SETTER_FUNCTION(Ordering, common::Ordering, aOrdering, "Ordering")
+
+        CREATE_GETTER_FUNCTION(Ordering, common::Ordering, "Ordering")
+
+        CREATE_SETTER_FUNCTION(RandomGenerator, common::RandomGenerator, aRandomGenerator, "RandomGenerator")
+
+        CREATE_GETTER_FUNCTION(RandomGenerator, common::RandomGenerator, "RandomGenerator")
+
+        CREATE_SETTER_FUNCTION(DataFormat, common::DataSourceType, aDataFormat, "DataFormat")
+
+        CREATE_GETTER_FUNCTION(DataFormat, common::DataSourceType, "DataFormat")
+
         /** END OF THE DATA GENERATION MODULES. **/
         /** START OF THE DATA MODELING MODULES. **/
 
@@ -268,6 +288,18 @@ namespace exageostat::configurations {
 
         CREATE_GETTER_FUNCTION(DistanceMetric, common::DistanceMetric, "DistanceMetric")
 
+        void SetSmoothnessTolerance(double aSmoothnessTolerance);
+
+        CREATE_GETTER_FUNCTION(SmoothnessTolerance, double, "SmoothnessTolerance")
+
+        void SetBesselTableTolerance(double aBesselTableTolerance);
+
+        CREATE_GETTER_FUNCTION(BesselTableTolerance, double, "BesselTableTolerance")
+
+        CREATE_SETTER_FUNCTION(TraceProbesNumber, int, aTraceProbesNumber, "TraceProbesNumber")
+
+        CREATE_GETTER_FUNCTION(TraceProbesNumber, int, "TraceProbesNumber")
+
         CREATE_SETTER_FUNCTION(MaxMleIterations, int, aMaxMleIterations, "MaxMleIterations")
 
         CREATE_GETTER_FUNCTION(MaxMleIterations, int, "MaxMleIterations")
@@ -280,6 +312,18 @@ namespace exageostat::configurations {
 
         CREATE_GETTER_FUNCTION(Tolerance, double, "Tolerance")
 
+        CREATE_SETTER_FUNCTION(DistanceCacheBudget, int, aDistanceCacheBudget, "DistanceCacheBudget")
+
+        CREATE_GETTER_FUNCTION(DistanceCacheBudget, int, "DistanceCacheBudget")
+
+        CREATE_SETTER_FUNCTION(VecchiaNeighborsNumber, int, aVecchiaNeighborsNumber, "VecchiaNeighborsNumber")
+
+        CREATE_GETTER_FUNCTION(VecchiaNeighborsNumber, int, "VecchiaNeighborsNumber")
+
+        CREATE_SETTER_FUNCTION(Optimizer, common::Optimizer, aOptimizer, "Optimizer")
+
+        CREATE_GETTER_FUNCTION(Optimizer, common::Optimizer, "Optimizer")
+
         /** END OF THE DATA MODELING MODULES. **/
         /** START OF THE DATA PREDICTION MODULES. **/
 
@@ -295,6 +339,22 @@ namespace exageostat::configurations {
 
         CREATE_GETTER_FUNCTION(IsIDW, bool, "IsIDW")
 
+        CREATE_SETTER_FUNCTION(IDWNeighborsNumber, int, aIDWNeighborsNumber, "IDWNeighborsNumber")
+
+        CREATE_GETTER_FUNCTION(IDWNeighborsNumber, int, "IDWNeighborsNumber")
+
+        CREATE_SETTER_FUNCTION(IDWRadius, double, aIDWRadius, "IDWRadius")
+
+        CREATE_GETTER_FUNCTION(IDWRadius, double, "IDWRadius")
+
+        CREATE_SETTER_FUNCTION(IDWPower, double, aIDWPower, "IDWPower")
+
+        CREATE_GETTER_FUNCTION(IDWPower, double, "IDWPower")
+
+        CREATE_SETTER_FUNCTION(IsKrigingVariance, bool, aIsKrigingVariance, "IsKrigingVariance")
+
+        CREATE_GETTER_FUNCTION(IsKrigingVariance, bool, "IsKrigingVariance")
+
         CREATE_SETTER_FUNCTION(IsMLOEMMOM, bool, aIsMLOEMMOM, "IsMLOEMMOM")
 
         CREATE_GETTER_FUNCTION(IsMLOEMMOM, bool, "IsMLOEMMOM")
@@ -317,6 +377,14 @@ namespace exageostat::configurations {
          */
         static int CheckNumericalValue(const std::string &aValue);
 
+        /**
+         * @brief Check if input value is a decimal number.
+         * @param[in] aValue The input from the user side.
+         * @return The double casted value.
+         *
+         */
+        static double CheckDecimalValue(const std::string &aValue);
+
         /**
          * @brief Checks the value of the dimension parameter.
          * @param[in] aDimension A string represents the dimension.
@@ -397,6 +465,42 @@ namespace exageostat::configurations {
          */
         void ParseDistanceMetric(const std::string &aDistanceMetric);
 
+        /**
+         * @brief parse user's input to the MLE optimizer.
+         * @param[in] aOptimizer string specifying the used optimizer.
+         * @throws std::range_error if the input string is not bobyqa, lbfgs or slsqp.
+         * @return void
+         *
+         */
+        void ParseOptimizer(const std::string &aOptimizer);
+
+        /**
+         * @brief parse user's input to the locations ordering.
+         * @param[in] aOrdering string specifying the space-filling curve used to order the locations.
+         * @throws std::range_error if the input string is not morton, hilbert or none.
+         * @return void
+         *
+         */
+        void ParseOrdering(const std::string &aOrdering);
+
+        /**
+         * @brief parse user's input to the random number generator of the synthetic data.
+         * @param[in] aRandomGenerator string specifying the used random number generator.
+         * @throws std::range_error if the input string is not lapack or philox.
+         * @return void
+         *
+         */
+        void ParseRandomGenerator(const std::string &aRandomGenerator);
+
+        /**
+         * @brief parse user's input to the file format of the written synthetic data.
+         * @param[in] aDataFormat string specifying the format of the written data files.
+         * @throws std::range_error if the input string is not csv or binary.
+         * @return void
+         *
+         */
+        void ParseDataFormat(const std::string &aDataFormat);
+
     private:
 
         /**
@@ -14,6 +14,8 @@
 #ifndef EXAGEOSTATCPP_LOCATIONGENERATOR_HPP
 #define EXAGEOSTATCPP_LOCATIONGENERATOR_HPP
 
+#include <vector>
+
 #include <data-units/Locations.hpp>
 
 namespace exageostat::generators {
@@ -36,11 +38,20 @@ namespace exageostat::generators {
          * @param[in] aTimeSlot The time slot.
          * @param[in] aDimension The dimension of the locations.
          * @param[out] aLocations Reference to the Locations object where the generated data will be stored.
-         * @return void
+         * @param[in] aOrdering The space-filling curve the generated locations are sorted along.
+         * @param[in] aRandomGenerator The generator of the jitter, rand() or the counter-based generator.
+         * @param[in] aSeed The seed of the counter-based generator.
+         * @param[in] aThreadsNumber The number of threads reordering the locations along a space-filling curve.
+         * @return The generation index of every location when they were reordered along a space-filling curve, an
+         * empty vector otherwise.
          *
          */
-        static void GenerateLocations(const int &aN, const int &aTimeSlot, const common::Dimension &aDimension,
-                                      dataunits::Locations<T> &aLocations);
+        static std::vector<int>
+        GenerateLocations(const int &aN, const int &aTimeSlot, const common::Dimension &aDimension,
+                          dataunits::Locations<T> &aLocations,
+                          const common::Ordering &aOrdering = common::DEFAULT_ORDERING,
+                          const common::RandomGenerator &aRandomGenerator = common::LAPACK_GENERATOR,
+                          const int &aSeed = 0, const int &aThreadsNumber = 1);
 
         /**
          * @brief Generate uniform distribution between rangeLow , rangeHigh.
@@ -52,7 +63,8 @@ namespace exageostat::generators {
         static T UniformDistribution(const T &aRangeLow, const T &aRangeHigh);
 
         /**
-         * @brief Sort locations in Morton order (input points must be in [0;1]x[0;1] square]).
+         * @brief Sort locations in 16-bit Morton order (input points must be in [0;1]x[0;1] square]).
+         * @details The locations are replaced by their quantized values, this is the default ordering of synthetic data.
          * @param[in] aN The problem size divided by P-Grid.
          * @param[in] aDimension Dimension of locations.
          * @param[in,out] aLocations Locations to be sorted.
@@ -38,27 +38,37 @@ namespace exageostat::dataLoader {
         std::unique_ptr<ExaGeoStatData<T>>
         CreateData(configurations::Configurations &aConfigurations, kernels::Kernel<T> &aKernel) override;
 
+        /**
+         * @brief Counts the records of the external source and sets the problem size accordingly.
+         * @details This first pass lets the caller allocate the destination of ReadData() with its exact size.
+         * @param[in,out] aConfigurations Configuration settings for data loading, the problem size is updated.
+         * @param[in] aP Number of measurements per location.
+         * @return The number of records.
+         *
+         */
+        virtual int CountLocations(configurations::Configurations &aConfigurations, const int &aP) = 0;
+
         /**
          * @brief Reads data from external sources into ExaGeoStat format.
-         * @param aConfigurations Configuration settings for data loading.
-         * @param aMeasurementsMatrix Vector to store measurement values.
-         * @param aXLocations Vector to store X coordinates of locations.
-         * @param aYLocations Vector to store Y coordinates of locations.
-         * @param aZLocations Vector to store Z coordinates of locations (if applicable).
-         * @param aP Partition index for distributed data loading.
+         * @details The first problem size / P locations and the first problem size measurements are written in place.
+         * @param[in] aConfigurations Configuration settings for data loading.
+         * @param[out] aLocations Locations to fill, allocated with problem size / P locations.
+         * @param[out] apMeasurements Contiguous array to fill with the P consecutive measurements of every location.
+         * @param[in] aP Number of measurements per location.
          * @return void
          *
          */
         virtual void
-        ReadData(configurations::Configurations &aConfigurations, std::vector<T> &aMeasurementsMatrix,
-                 std::vector<T> &aXLocations,
-                 std::vector<T> &aYLocations, std::vector<T> &aZLocations, const int &aP) = 0;
+        ReadData(configurations::Configurations &aConfigurations, dataunits::Locations<T> &aLocations,
+                 T *apMeasurements, const int &aP) = 0;
 
         /**
         * @brief Writes a matrix of vectors to disk.
+        * @details Every MPI process writes its own block of locations at its offset of the file, so all the processes
+        * must call it with the whole data.
         * @param[in] aMatrixPointer A Reference to the matrix data.
         * @param[in] aProblemSize The size of the problem.
-        * @param[in] aP The number of processes.
+        * @param[in] aP The number of measurements per location.
         * @param[in] aLoggerPath The path to the logger file.
         * @param[in] aLocations A Reference to the Locations object.
         * @return void
@@ -67,6 +77,22 @@ namespace exageostat::dataLoader {
         virtual void
         WriteData(const T &aMatrixPointer, const int &aProblemSize, const int &aP, std::string &aLoggerPath,
                   exageostat::dataunits::Locations<T> &aLocations) = 0;
+
+    protected:
+
+        /**
+         * @brief Creates the directory of the generated data files and names the next file to write.
+         * @details The first process creates the directory and chooses the name, all the processes must call it.
+         * @param[in,out] aLoggerPath The logger path, completed with the synthetic_ds directory.
+         * @param[in] aLocationsNumber The number of locations, part of the file name.
+         * @return The path of the file to write, without extension.
+         * @throws std::runtime_error on every process if the first one cannot create the directory.
+         *
+         */
+        static std::string GetOutputFilePath(std::string &aLoggerPath, const int &aLocationsNumber);
+
+        //// The ordering the locations of the last counted source are already sorted with.
+        common::Ordering mDataOrdering = common::DEFAULT_ORDERING;
     };
 
     /**
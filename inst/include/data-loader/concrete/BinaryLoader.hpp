@@ -0,0 +1,192 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file BinaryLoader.hpp
+ * @brief A class for reading and writing the binary columnar data files.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_BINARYLOADER_HPP
+#define EXAGEOSTATCPP_BINARYLOADER_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <data-loader/DataLoader.hpp>
+
+namespace exageostat::dataLoader::binary {
+
+    /**
+     * @struct BinaryHeader
+     * @brief Header at the beginning of a binary data file.
+     * @details The header is followed by the column blocks, each one starting at a multiple of 64 bytes:
+     * the X coordinates, the Y coordinates, the Z or time coordinates when present, then the P measurements of every
+     * location, stored consecutively as in the Z descriptor. All the values are stored in the native byte order with
+     * the precision of the header.
+     *
+     */
+    struct BinaryHeader {
+        //// File signature, "EXAGEOST".
+        char mMagic[8];
+        //// Version of the format.
+        uint32_t mVersion;
+        //// Size in bytes of a stored value, 4 for float or 8 for double.
+        uint32_t mPrecision;
+        //// Number of spatial coordinates, 2 or 3.
+        uint32_t mSpatialDimension;
+        //// 1 if a time column follows the spatial columns, 0 otherwise.
+        uint32_t mHasTime;
+        //// Number of measurements per location.
+        uint32_t mVariablesNumber;
+        //// The common::Ordering the locations are sorted with.
+        uint32_t mOrdering;
+        //// Number of locations.
+        uint64_t mLocationsNumber;
+        //// Offsets in bytes of the X, Y, Z or time and measurements blocks, 0 for an absent block.
+        uint64_t mOffsets[4];
+    };
+
+    /**
+     * @struct MeasurementsBlock
+     * @brief A block of consecutive measurements held by the calling process.
+     * @tparam T Data Type: float or double
+     *
+     */
+    template<typename T>
+    struct MeasurementsBlock {
+        //// Index in the measurements vector of the first value of the block.
+        uint64_t mBegin;
+        //// The values of the block.
+        const T *mpValues;
+        //// Number of values in the block.
+        size_t mCount;
+    };
+
+    /**
+     * @class BinaryLoader
+     * @brief A class for creating data by memory-mapping binary columnar files.
+     * @tparam T Data Type: float or double
+     *
+     */
+    template<typename T>
+    class BinaryLoader : public DataLoader<T> {
+    public:
+
+        //// Version of the written files.
+        static constexpr uint32_t FORMAT_VERSION = 1;
+        //// Alignment in bytes of the column blocks.
+        static constexpr uint64_t BLOCK_ALIGNMENT = 64;
+
+        /**
+         * @brief Get a pointer to the singleton instance of the BinaryLoader class.
+         * @return A pointer to the instance of the BinaryLoader class.
+         *
+         */
+        static BinaryLoader<T> *GetInstance();
+
+        /**
+         * @brief Checks whether a file starts with the signature of the binary data files.
+         * @param[in] aPath The path of the file.
+         * @return true if the file is a binary data file, false otherwise.
+         *
+         */
+        static bool IsBinaryFile(const std::string &aPath);
+
+        /**
+         * @brief Reads the number of locations from the header of the binary file.
+         * @copydoc DataLoader::CountLocations()
+         * @throws std::runtime_error if the file is not a valid binary data file or does not match the configurations.
+         *
+         */
+        int CountLocations(configurations::Configurations &aConfigurations, const int &aP) override;
+
+        /**
+         * @brief Reads data from external sources into ExaGeoStat format.
+         * @details The column blocks are copied from the mapped file without any parsing, and only converted if the
+         * file precision differs from T.
+         * @copydoc DataLoader::ReadData()
+         *
+         */
+        void ReadData(configurations::Configurations &aConfigurations, dataunits::Locations<T> &aLocations,
+                      T *apMeasurements, const int &aP) override;
+
+        /**
+        * @brief Writes a matrix of vectors to disk, as locations with default ordering.
+        * @copydoc DataLoader::WriteData()
+        *
+        */
+        void
+        WriteData(const T &aMatrixPointer, const int &aProblemSize, const int &aP, std::string &aLoggerPath,
+                  exageostat::dataunits::Locations<T> &aLocations) override;
+
+        /**
+        * @brief Writes a matrix of vectors to disk, in a binary file with the .bin extension.
+        * @copydoc DataLoader::WriteData()
+        * @param[in] aOrdering The ordering the locations are sorted with, recorded in the header.
+        * @throws std::runtime_error if the file cannot be written.
+        *
+        */
+        void
+        WriteData(const T &aMatrixPointer, const int &aProblemSize, const int &aP, std::string &aLoggerPath,
+                  exageostat::dataunits::Locations<T> &aLocations, const common::Ordering &aOrdering);
+
+        /**
+         * @brief Writes a vector of measurements distributed between the processes to disk, in a binary file.
+         * @details Every process writes its own blocks of measurements at their offsets, and its share of the
+         * locations, which all the processes hold. The call is collective.
+         * @param[in] aBlocks The blocks of measurements held by the calling process.
+         * @param[in] aProblemSize The size of the whole measurements vector.
+         * @param[in] aP The number of measurements per location.
+         * @param[in] aLoggerPath The path of the logger directory.
+         * @param[in] aLocations The locations of the measurements.
+         * @param[in] aOrdering The ordering the locations are sorted with, recorded in the header.
+         * @return void
+         * @throws std::runtime_error if the file cannot be written.
+         *
+         */
+        void WriteData(const std::vector<MeasurementsBlock<T>> &aBlocks, const int &aProblemSize, const int &aP,
+                       std::string &aLoggerPath, exageostat::dataunits::Locations<T> &aLocations,
+                       const common::Ordering &aOrdering);
+
+        /**
+         * @brief Release the singleton instance of the BinaryLoader class.
+         * @return void
+         *
+         */
+        static void ReleaseInstance();
+
+    private:
+        /**
+         * @brief Constructor for the BinaryLoader class.
+         * @return void
+         *
+         */
+        BinaryLoader() = default;
+
+        /**
+         * @brief Default destructor.
+         *
+         */
+        ~BinaryLoader() override = default;
+
+        /**
+         * @brief Pointer to the singleton instance of the BinaryLoader class.
+         *
+         */
+        static BinaryLoader<T> *mpInstance;
+
+    };
+
+    /**
+     * @brief Instantiates the Binary Loader class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(BinaryLoader)
+}
+#endif //EXAGEOSTATCPP_BINARYLOADER_HPP
@@ -35,17 +35,27 @@ namespace exageostat::dataLoader::csv {
          */
         static CSVLoader<T> *GetInstance();
 
+        /**
+         * @brief Counts the non-empty lines of the CSV file.
+         * @copydoc DataLoader::CountLocations()
+         *
+         */
+        int CountLocations(configurations::Configurations &aConfigurations, const int &aP) override;
+
         /**
          * @brief Reads data from external sources into ExaGeoStat format.
+         * @details The file is memory-mapped and split into newline-aligned chunks, which are parsed in parallel by
+         * one thread per core.
          * @copydoc DataLoader::ReadData()
          *
          */
-        void ReadData(configurations::Configurations &aConfigurations, std::vector<T> &aMeasurementsMatrix,
-                      std::vector<T> &aXLocations, std::vector<T> &aYLocations, std::vector<T> &aZLocations,
-                      const int &aP) override;
+        void ReadData(configurations::Configurations &aConfigurations, dataunits::Locations<T> &aLocations,
+                      T *apMeasurements, const int &aP) override;
 
         /**
         * @brief Writes a matrix of vectors to disk.
+        * @details The lines are formatted with to_chars by one thread per core, into buffers written one after the
+        * other.
         * @copydoc DataLoader::WriteData()
         *
         */
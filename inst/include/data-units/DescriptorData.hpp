@@ -91,7 +91,7 @@ namespace exageostat::dataunits {
 
         /**
          * @brief Set the request.
-         * @param[in] apRequest Pointer to the request.
+         * @param[in] apRequest Pointer to an array of two requests, copied so that it may live on the caller stack.
          * @return void
          *
          */
@@ -183,6 +183,8 @@ namespace exageostat::dataunits {
         void *mpSequence = nullptr;
         //// Used request
         void *mpRequest = nullptr;
+        //// Storage of the used requests, kept for all the evaluations that share the sequence.
+        RUNTIME_request_t mRequest[2] = {RUNTIME_REQUEST_INITIALIZER, RUNTIME_REQUEST_INITIALIZER};
         //// Specifies whether the descriptors have been initiated.
         bool mIsDescriptorInitiated = false;
     };
@@ -15,6 +15,8 @@
 #ifndef EXAGEOSTATCPP_EXAGEOSTATDATA_HPP
 #define EXAGEOSTATCPP_EXAGEOSTATDATA_HPP
 
+#include <vector>
+
 #include <data-units/DescriptorData.hpp>
 #include <data-units/Locations.hpp>
 
@@ -92,6 +94,36 @@ public:
      */
     int GetMleIterations();
 
+    /**
+     * @brief Setter for the parameters the Cholesky factor held by the covariance descriptor was computed at.
+     * @param[in] aFactorTheta The parameters of the factor, an empty vector when the descriptor holds no exact factor.
+     * @return void
+     *
+     */
+    void SetFactorTheta(const std::vector<T> &aFactorTheta);
+
+    /**
+     * @brief Get the parameters the Cholesky factor held by the covariance descriptor was computed at.
+     * @return Reference to the parameters, empty when there is no reusable factor.
+     *
+     */
+    std::vector<T> &GetFactorTheta();
+
+    /**
+     * @brief Setter for the index every location had before the locations were reordered.
+     * @param[in] aOriginalIndices The former index of every location, an empty vector when they were not reordered.
+     * @return void
+     *
+     */
+    void SetOriginalIndices(const std::vector<int> &aOriginalIndices);
+
+    /**
+     * @brief Get the index every location had before the locations were reordered, i.e. the inverse permutation.
+     * @return Reference to the former indices, empty when the locations keep their input order.
+     *
+     */
+    std::vector<int> &GetOriginalIndices();
+
     /**
      * @brief Calculates Median Locations.
      * @param[in] aKernelName Name of the Kernel used.
@@ -108,6 +140,10 @@ private:
     exageostat::dataunits::Locations<T> *mpLocations = nullptr;
     //// Current number of performed MLE iterations.
     int mMleIterations = 0;
+    //// Parameters of the exact Cholesky factor currently held by the covariance descriptor.
+    std::vector<T> mFactorTheta;
+    //// Former index of every location, when the locations were reordered along a space-filling curve.
+    std::vector<int> mOriginalIndices;
 };
 
 /**
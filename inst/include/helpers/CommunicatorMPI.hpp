@@ -38,6 +38,13 @@ namespace exageostat::helpers {
          */
         [[nodiscard]] int GetRank() const;
 
+        /**
+         * @brief Get the number of MPI processes.
+         * @return The number of MPI processes, 1 before the hardware initialization.
+         *
+         */
+        [[nodiscard]] int GetSize() const;
+
         /**
          * @brief Set the hardware initialization flag.
          * @details This function sets the flag to indicate that hardware has been initialized.
@@ -64,6 +64,42 @@ namespace exageostat::helpers {
          */
         static T DegreeToRadian(T aDegree);
 
+        /**
+         * @brief Calculates the distances of a whole tile of location pairs into a contiguous buffer.
+         * @details The distance metric and the dimension checks are resolved once per tile instead of once per element,
+         * so that the inner loops are branch-free and can be vectorized by the compiler.
+         * @param[out] apDistances Output buffer of size aRowsNumber * aColumnsNumber, stored in column-major order.
+         * @param[in] aLocations1 Reference to the set of locations indexed by the tile rows.
+         * @param[in] aLocations2 Reference to the set of locations indexed by the tile columns.
+         * @param[in] aRowsNumber The number of rows in the tile.
+         * @param[in] aColumnsNumber The number of columns in the tile.
+         * @param[in] aRowOffset Index of the first location of the tile rows in the first set.
+         * @param[in] aColumnOffset Index of the first location of the tile columns in the second set.
+         * @param[in] aDistanceMetric Flag indicating the distance metric to use (0 for Euclidean distance, 1 for Great Circle distance).
+         * @param[in] aFlagZ Flag indicating whether the points are in 2D or 3D space (0 for 2D, 1 for 3D).
+         * @return void
+         *
+         */
+        static void CalculateTileDistances(T *apDistances, exageostat::dataunits::Locations<T> &aLocations1,
+                                           exageostat::dataunits::Locations<T> &aLocations2, const int &aRowsNumber,
+                                           const int &aColumnsNumber, const int &aRowOffset,
+                                           const int &aColumnOffset, const int &aDistanceMetric, const int &aFlagZ);
+
+        /**
+         * @brief Calculates an upper bound of the distance between any two points of two sets of locations.
+         * @details The bound is the diagonal of the bounding box of both sets for the Euclidean distance, and half the
+         * Earth circumference for the Great Circle distance.
+         * @param[in] aLocations1 Reference to the first set of locations.
+         * @param[in] aLocations2 Reference to the second set of locations.
+         * @param[in] aDistanceMetric Flag indicating the distance metric to use (0 for Euclidean distance, 1 for Great Circle distance).
+         * @param[in] aFlagZ Flag indicating whether the points are in 2D or 3D space (0 for 2D, 1 for 3D).
+         * @return The upper bound of the distances.
+         *
+         */
+        static T CalculateMaximumDistance(exageostat::dataunits::Locations<T> &aLocations1,
+                                          exageostat::dataunits::Locations<T> &aLocations2,
+                                          const int &aDistanceMetric, const int &aFlagZ);
+
     };
     /**
       * @brief Instantiates the PredictionHelpers class for float and double types.
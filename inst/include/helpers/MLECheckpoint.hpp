@@ -0,0 +1,243 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file MLECheckpoint.hpp
+ * @brief Contains the definition of the MLECheckpoint class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_MLECHECKPOINT_HPP
+#define EXAGEOSTATCPP_MLECHECKPOINT_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace exageostat::helpers {
+
+    /**
+     * @struct CheckpointProblem
+     * @brief Description of the fit recorded by a checkpoint file, a file of another fit is not replayed.
+     *
+     */
+    struct CheckpointProblem {
+        //// Number of measurements of the fit.
+        uint64_t mProblemSize = 0;
+        //// Name of the kernel.
+        std::string mKernelName;
+        //// Computation used to evaluate the likelihood.
+        uint32_t mComputation = 0;
+        //// Lower bounds of the optimizer.
+        std::vector<double> mLowerBounds;
+        //// Upper bounds of the optimizer.
+        std::vector<double> mUpperBounds;
+        //// Starting point of the optimizer.
+        std::vector<double> mStartingTheta;
+        //// Checksum of the locations and the measurements, computed with MLECheckpoint::GetChecksum().
+        uint64_t mDataChecksum = 0;
+    };
+
+    /**
+     * @struct CheckpointHeader
+     * @brief Header at the beginning of a binary MLE checkpoint file.
+     * @details The header is followed by the lower bounds, the upper bounds and the starting point of the optimizer,
+     * then by one record per evaluation: the theta values, the log-likelihood, then the gradient values for the
+     * gradient-based optimizers, all stored as doubles in the native byte order.
+     *
+     */
+    struct CheckpointHeader {
+        //// File signature, "EXAGEOCK".
+        char mMagic[8];
+        //// Version of the format.
+        uint32_t mVersion;
+        //// Number of theta values of a record.
+        uint32_t mParametersNumber;
+        //// 1 if the records hold the gradient, 0 otherwise.
+        uint32_t mHasGradient;
+        //// Computation used to evaluate the likelihood.
+        uint32_t mComputation;
+        //// Number of measurements of the fit.
+        uint64_t mProblemSize;
+        //// Checksum of the locations and the measurements.
+        uint64_t mDataChecksum;
+        //// Name of the kernel, padded with zeros.
+        char mKernelName[64];
+        //// Number of complete records, updated after every record is written.
+        uint64_t mEvaluationsNumber;
+        //// Index of the record with the highest log-likelihood.
+        uint64_t mBestEvaluation;
+    };
+
+    /**
+     * @class MLECheckpoint
+     * @brief Records every evaluation of the MLE objective, so that a restarted fit replays them instead of computing
+     * them again.
+     * @details The optimizers are deterministic, so a restarted optimizer asks again for the recorded points in the
+     * same order. Each one is answered from the file until the first point that differs, then the fit goes on with
+     * real evaluations, which are appended to the file.
+     *
+     */
+    class MLECheckpoint {
+
+    public:
+
+        //// Version of the written files.
+        static constexpr uint32_t FORMAT_VERSION = 2;
+
+        /**
+         * @brief Opens a checkpoint file, or creates it if it does not exist.
+         * @details The constructor is collective. The first process loads the file and drops the end of an
+         * interrupted record, then shares the records with the other processes, so that they all leave the recorded
+         * path at the same evaluation.
+         * @param[in] aPath The path of the file.
+         * @param[in] aParametersNumber The number of theta values.
+         * @param[in] aProblem The description of the fit.
+         * @param[in] aHasGradient Whether the optimizer uses the gradient of the objective.
+         * @param[in] aIsWriter Whether this process writes the file, only the first process can write it.
+         * @throws std::runtime_error on all the processes if the file cannot be opened, or was recorded for another
+         * fit or optimizer.
+         *
+         */
+        MLECheckpoint(const std::string &aPath, const int &aParametersNumber, const CheckpointProblem &aProblem,
+                      const bool &aHasGradient, const bool &aIsWriter = true);
+
+        /**
+         * @brief Closes the file.
+         *
+         */
+        ~MLECheckpoint();
+
+        MLECheckpoint(const MLECheckpoint &) = delete;
+
+        MLECheckpoint &operator=(const MLECheckpoint &) = delete;
+
+        /**
+         * @brief Answers an evaluation from the next record, if it was made at the same point.
+         * @param[in] apTheta The point to evaluate.
+         * @param[out] aLogLik The recorded log-likelihood.
+         * @param[out] apGradient The recorded gradient, nullptr if not requested.
+         * @return true if the evaluation is replayed, false if it has to be computed.
+         * @details The records after the first differing point are dropped.
+         *
+         */
+        bool Replay(const double *apTheta, double &aLogLik, double *apGradient);
+
+        /**
+         * @brief Appends a computed evaluation to the file.
+         * @param[in] apTheta The evaluated point.
+         * @param[in] aLogLik The log-likelihood at this point.
+         * @param[in] apGradient The gradient at this point, ignored without gradient.
+         * @return void
+         * @throws std::runtime_error if the record cannot be written.
+         *
+         */
+        void Save(const double *apTheta, const double &aLogLik, const double *apGradient);
+
+        /**
+         * @brief Get the number of recorded evaluations.
+         * @return The number of evaluations.
+         *
+         */
+        [[nodiscard]] int GetEvaluationsNumber() const;
+
+        /**
+         * @brief Get the number of evaluations replayed so far.
+         * @return The number of replayed evaluations.
+         *
+         */
+        [[nodiscard]] int GetReplayedNumber() const;
+
+        /**
+         * @brief Get the recorded point with the highest log-likelihood.
+         * @return The theta values, empty without records.
+         *
+         */
+        [[nodiscard]] std::vector<double> GetBestTheta() const;
+
+        /**
+         * @brief Get the highest recorded log-likelihood.
+         * @return The log-likelihood.
+         *
+         */
+        [[nodiscard]] double GetBestLogLik() const;
+
+        /**
+         * @brief Accumulates the bytes of a buffer into a checksum, with the 64-bit FNV-1a hash.
+         * @param[in] apData The buffer.
+         * @param[in] aSize The size of the buffer in bytes.
+         * @param[in] aChecksum The checksum of the previous buffers.
+         * @return The checksum including the buffer.
+         *
+         */
+        static uint64_t GetChecksum(const void *apData, const size_t &aSize,
+                                    const uint64_t &aChecksum = 14695981039346656037ULL);
+
+    private:
+
+        /**
+         * @brief Loads the complete records of a previous run, and checks that they belong to the same fit.
+         * @param[in] aProblem The description of the fit.
+         * @return void
+         * @throws std::runtime_error if the file is invalid, or was recorded for another fit or optimizer.
+         *
+         */
+        void Load(const CheckpointProblem &aProblem);
+
+        /**
+         * @brief Drops the end of an interrupted record, and opens the file to append the next records.
+         * @return void
+         * @throws std::runtime_error if the file cannot be opened.
+         *
+         */
+        void Open();
+
+        /**
+         * @brief Sends the header and the records of the first process to the other processes.
+         * @return void
+         *
+         */
+        void ShareRecords();
+
+        /**
+         * @brief Finds the record with the highest log-likelihood.
+         * @return void
+         *
+         */
+        void UpdateBestEvaluation();
+
+        /**
+         * @brief Writes the header at the beginning of the file.
+         * @return void
+         *
+         */
+        void WriteHeader();
+
+        //// Path of the file, used in the error messages.
+        std::string mPath;
+        //// Handle of the file, nullptr for the processes that do not write it.
+        FILE *mpFile = nullptr;
+        //// Header of the file.
+        CheckpointHeader mHeader{};
+        //// Lower bounds, upper bounds and starting point of the optimizer, written after the header.
+        std::vector<double> mProblemValues;
+        //// Offset of the first record in the file.
+        size_t mRecordsOffset = 0;
+        //// Number of doubles of a record.
+        size_t mRecordSize = 0;
+        //// The records, one after the other.
+        std::vector<double> mRecords;
+        //// Number of evaluations replayed so far.
+        size_t mReplayedNumber = 0;
+        //// Whether a point differed from its record, after which the evaluations are computed.
+        bool mIsReplayOver = false;
+    };
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_MLECHECKPOINT_HPP
@@ -0,0 +1,79 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file MappedFile.hpp
+ * @brief Contains the definition of the MappedFile class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_MAPPEDFILE_HPP
+#define EXAGEOSTATCPP_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace exageostat::helpers {
+
+    /**
+     * @class MappedFile
+     * @brief Read-only memory mapping of a whole file, released with the object.
+     *
+     */
+    class MappedFile {
+
+    public:
+
+        /**
+         * @brief Maps a file in memory.
+         * @param[in] aPath The path of the file.
+         * @throws std::runtime_error if the file cannot be opened or mapped.
+         *
+         */
+        explicit MappedFile(const std::string &aPath);
+
+        /**
+         * @brief Unmaps the file.
+         *
+         */
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        /**
+         * @brief Get the beginning of the mapped file.
+         * @return Pointer to the first byte, nullptr for an empty file.
+         *
+         */
+        const char *Begin() const;
+
+        /**
+         * @brief Get the end of the mapped file.
+         * @return Pointer past the last byte.
+         *
+         */
+        const char *End() const;
+
+        /**
+         * @brief Get the size of the mapped file.
+         * @return The size in bytes.
+         *
+         */
+        size_t GetSize() const;
+
+    private:
+        //// Beginning of the mapping, nullptr for an empty file.
+        const char *mpData = nullptr;
+        //// Size of the file in bytes.
+        size_t mSize = 0;
+    };
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_MAPPEDFILE_HPP
@@ -0,0 +1,163 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file MaternInterpolationTable.hpp
+ * @brief Contains the definition of the MaternInterpolationTable class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_MATERNINTERPOLATIONTABLE_HPP
+#define EXAGEOSTATCPP_MATERNINTERPOLATIONTABLE_HPP
+
+#include <vector>
+
+#include <common/Definitions.hpp>
+
+namespace exageostat::helpers {
+
+    /**
+     * @class MaternInterpolationTable
+     * @brief Interpolation table of x^nu K_nu(x) for a fixed smoothness nu.
+     * @details The table stores g(s) = e^x x^nu K_nu(x), with x = e^s, on a grid uniform in s, which is smooth at both
+     * ends of the range, and evaluates it with cubic Lagrange interpolation. The grid is refined at construction until
+     * a bound of the relative interpolation error is below the requested tolerance on every interval.
+     *
+     * The error over an interval of step h is at most 9/16 h^4 max|g^(4)| / 4! over its four nodes stencil. By the
+     * Cauchy estimates, |g^(4)| / 4! is at most M / r^4, with M the largest |g| on the discs of radius r < pi / 2
+     * around the stencil. For a real nu and Re(z) > 0, the integral K_nu(z) = int_0^inf e^(-z cosh u) cosh(nu u) du
+     * gives |e^z z^nu K_nu(z)| <= (|z| / Re(z))^nu g(log(Re(z))). Since the derivative of e^x x^nu K_nu(x) is
+     * e^x x^nu (K_nu(x) - K_|nu - 1|(x)), this function is monotonic, so M and the smallest value over the interval
+     * are given by the ends of their ranges. The bound holds up to the accuracy of the GSL node values.
+     * Distances outside the tabulated range are evaluated exactly.
+     * @tparam T Data Type: float or double
+     *
+     */
+    template<typename T>
+    class MaternInterpolationTable {
+
+    public:
+
+        /**
+         * @brief Builds the table of x^nu K_nu(x) over (0, aMaxDistance].
+         * @param[in] aNu The smoothness parameter.
+         * @param[in] aMaxDistance The largest scaled distance to tabulate.
+         * @param[in] aRelativeTolerance The bound of the relative error of the interpolated values.
+         *
+         */
+        MaternInterpolationTable(const T &aNu, const T &aMaxDistance, const double &aRelativeTolerance);
+
+        /**
+         * @brief Default destructor.
+         *
+         */
+        ~MaternInterpolationTable() = default;
+
+        /**
+         * @brief Checks whether the requested tolerance was reached within the maximum table size.
+         * @return True if the table can be used, false otherwise.
+         *
+         */
+        [[nodiscard]] bool IsValid() const;
+
+        /**
+         * @brief Getter for the smoothness parameter of the table.
+         * @return The smoothness parameter.
+         *
+         */
+        [[nodiscard]] T GetNu() const;
+
+        /**
+         * @brief Getter for the largest tabulated distance.
+         * @return The largest tabulated scaled distance.
+         *
+         */
+        [[nodiscard]] T GetMaxDistance() const;
+
+        /**
+         * @brief Getter for the relative tolerance the table was built with.
+         * @return The relative tolerance.
+         *
+         */
+        [[nodiscard]] double GetRelativeTolerance() const;
+
+        /**
+         * @brief Evaluates x^nu K_nu(x) for a positive scaled distance.
+         * @param[in] aDistance The scaled distance.
+         * @return The interpolated value when the distance is tabulated, the exact value otherwise.
+         *
+         */
+        [[nodiscard]] T Evaluate(const T &aDistance) const;
+
+        /**
+         * @brief Evaluates the Matern covariance over a contiguous buffer of scaled distances in place.
+         * @param[in,out] apDistances The buffer of scaled distances, overwritten with the covariance values.
+         * @param[in] aSize The number of elements in the buffer.
+         * @param[in] aConstant The constant multiplying x^nu K_nu(x).
+         * @param[in] aZeroValue The value assigned to zero distances.
+         * @return void
+         *
+         */
+        void EvaluateTile(T *apDistances, const size_t &aSize, const T &aConstant, const T &aZeroValue) const;
+
+    private:
+
+        /**
+         * @brief Computes e^x x^nu K_nu(x) exactly through GSL.
+         * @param[in] aNu The smoothness parameter.
+         * @param[in] aDistance The scaled distance.
+         * @return The scaled Matern value.
+         *
+         */
+        static double ExactScaledValue(const double &aNu, const double &aDistance);
+
+        /**
+         * @brief Bounds the relative error of the interpolation over an interval of the grid.
+         * @param[in] aInterval The index of the interval.
+         * @param[in] aStep The step of the grid in log space.
+         * @return The bound of the relative error, the smallest over the radii of the Cauchy estimates.
+         *
+         */
+        [[nodiscard]] double GetErrorBound(const int &aInterval, const double &aStep) const;
+
+        /**
+         * @brief Interpolates e^x x^nu K_nu(x) at a position of the log grid.
+         * @param[in] aGridPosition The position, in units of grid intervals.
+         * @return The interpolated scaled value.
+         *
+         */
+        [[nodiscard]] double Interpolate(const double &aGridPosition) const;
+
+        //// Used smoothness parameter.
+        T mNu;
+        //// Used smallest tabulated distance.
+        double mMinDistance;
+        //// Used largest tabulated distance.
+        double mMaxDistance;
+        //// Used log of the smallest tabulated distance.
+        double mLogMinDistance;
+        //// Used inverse of the grid step in log space.
+        double mInverseStep;
+        //// Used number of intervals of the grid.
+        int mIntervalsNumber = 0;
+        //// Used relative tolerance.
+        double mRelativeTolerance;
+        //// Used flag for whether the tolerance was reached.
+        bool mIsValid = false;
+        //// Used scaled values at the grid nodes, with one extra node on each side.
+        std::vector<double> mValues;
+    };
+
+    /**
+      * @brief Instantiates the MaternInterpolationTable class for float and double types.
+      * @tparam T Data Type: float or double
+      *
+      */
+    EXAGEOSTAT_INSTANTIATE_CLASS(MaternInterpolationTable)
+}
+
+#endif //EXAGEOSTATCPP_MATERNINTERPOLATIONTABLE_HPP
@@ -0,0 +1,49 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ParallelBlocks.hpp
+ * @brief Contains the definition of the ParallelBlocks class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_PARALLELBLOCKS_HPP
+#define EXAGEOSTATCPP_PARALLELBLOCKS_HPP
+
+#include <functional>
+
+namespace exageostat::helpers {
+
+    /**
+     * @class ParallelBlocks
+     * @brief Runs the host-side loops of the package on a number of threads, outside the StarPU runtime.
+     *
+     */
+    class ParallelBlocks {
+
+    public:
+
+        /**
+         * @brief Runs a function on consecutive blocks of items, handed out on demand to a number of threads.
+         * @details The calling thread is one of the threads. The other threads stop taking blocks once a block
+         * has thrown.
+         * @param[in] aItemsNumber The number of items.
+         * @param[in] aBlockSize The number of items of a block, the last block can be smaller.
+         * @param[in] aThreadsNumber The number of threads, never more than the number of blocks.
+         * @param[in] aFunction The function, called with the index of a block, its first item and the item after its
+         * last one.
+         * @return void
+         * @throws The first exception thrown by a block.
+         *
+         */
+        static void ForEachBlock(const int &aItemsNumber, const int &aBlockSize, const int &aThreadsNumber,
+                                 const std::function<void(const int &, const int &, const int &)> &aFunction);
+    };
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_PARALLELBLOCKS_HPP
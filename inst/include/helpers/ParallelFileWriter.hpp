@@ -0,0 +1,110 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ParallelFileWriter.hpp
+ * @brief Contains the definition of the ParallelFileWriter class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_PARALLELFILEWRITER_HPP
+#define EXAGEOSTATCPP_PARALLELFILEWRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef USE_MPI
+
+#include <mpi.h>
+
+#endif
+
+namespace exageostat::helpers {
+
+    /**
+     * @class ParallelFileWriter
+     * @brief Writes a file shared by all the MPI processes, each one writing its own block at its own offsets.
+     * @details With a single process, the file is written with positioned writes and no MPI call is made. The
+     * constructor and GetOffset() are collective and must be called by all the processes.
+     *
+     */
+    class ParallelFileWriter {
+
+    public:
+
+        /**
+         * @brief Creates or truncates a file.
+         * @param[in] aPath The path of the file.
+         * @throws std::runtime_error if the file cannot be created.
+         *
+         */
+        explicit ParallelFileWriter(const std::string &aPath);
+
+        /**
+         * @brief Closes the file.
+         *
+         */
+        ~ParallelFileWriter();
+
+        ParallelFileWriter(const ParallelFileWriter &) = delete;
+
+        ParallelFileWriter &operator=(const ParallelFileWriter &) = delete;
+
+        /**
+         * @brief Splits a number of records evenly between the processes.
+         * @param[in] aRecordsNumber The number of records.
+         * @param[out] aBegin The first record of the calling process.
+         * @param[out] aEnd Past the last record of the calling process.
+         * @return void
+         *
+         */
+        static void GetBlock(const size_t &aRecordsNumber, size_t &aBegin, size_t &aEnd);
+
+        /**
+         * @brief Shares the name of the file chosen by the first process with all the processes.
+         * @param[in] aPath The path chosen by the calling process, only the path of the first process is used.
+         * @return The path of the first process.
+         *
+         */
+        static std::string SharePath(const std::string &aPath);
+
+        /**
+         * @brief Gets the offset of the block of the calling process, the blocks following the ranks order.
+         * @param[in] aBytesNumber The size in bytes of the block of the calling process.
+         * @return The total size of the blocks of the previous ranks.
+         *
+         */
+        uint64_t GetOffset(const uint64_t &aBytesNumber) const;
+
+        /**
+         * @brief Writes a buffer at an offset of the file.
+         * @param[in] aOffset The offset in bytes.
+         * @param[in] apBuffer The buffer to write.
+         * @param[in] aSize The size of the buffer in bytes.
+         * @return void
+         * @throws std::runtime_error if the buffer cannot be written.
+         *
+         */
+        void WriteAt(const uint64_t &aOffset, const char *apBuffer, const size_t &aSize);
+
+    private:
+        //// Path of the file, used in the error messages.
+        std::string mPath;
+        //// Whether the file is shared by several processes.
+        bool mIsShared = false;
+        //// Descriptor of the file when written by a single process.
+        int mFileDescriptor = -1;
+#ifdef USE_MPI
+        //// Handle of the file shared by the processes.
+        MPI_File mFile;
+#endif
+    };
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_PARALLELFILEWRITER_HPP
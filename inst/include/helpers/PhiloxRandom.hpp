@@ -0,0 +1,96 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file PhiloxRandom.hpp
+ * @brief Contains the definition of the PhiloxRandom class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_PHILOXRANDOM_HPP
+#define EXAGEOSTATCPP_PHILOXRANDOM_HPP
+
+#include <cstdint>
+
+#include <common/Definitions.hpp>
+
+namespace exageostat::helpers {
+
+    /**
+     * @class PhiloxRandom
+     * @brief Counter-based random number generator, built on the Philox4x32-10 bijection.
+     * @details A value is a pure function of the seed, its stream and its index. Any tile or process can draw its
+     * own values without the others, and the results do not depend on the tile size, the number of threads or the
+     * process grid.
+     * @tparam T Data Type: float or double
+     *
+     */
+    template<typename T>
+    class PhiloxRandom {
+
+    public:
+
+        /// Stream of the normal vector of the synthetic observations.
+        static constexpr uint32_t OBSERVATIONS_STREAM = 0;
+        /// Stream of the jitter of the first synthetic location axis, the next axes follow.
+        static constexpr uint32_t LOCATIONS_STREAM = 1;
+
+        /**
+         * @brief Applies the ten rounds of Philox4x32 to a counter.
+         * @param[in] apCounter The four counter words.
+         * @param[in] apKey The two key words.
+         * @param[out] apOutput The four random words.
+         * @return void
+         *
+         */
+        static void Philox4x32(const uint32_t *apCounter, const uint32_t *apKey, uint32_t *apOutput);
+
+        /**
+         * @brief Draws a uniform value in [0, 1).
+         * @param[in] aSeed The seed of the generator.
+         * @param[in] aStream The stream of the value, so that different quantities do not share values.
+         * @param[in] aIndex The index of the value in its stream.
+         * @return The uniform value.
+         *
+         */
+        static T Uniform(const uint32_t &aSeed, const uint32_t &aStream, const uint64_t &aIndex);
+
+        /**
+         * @brief Draws a standard normal value, with the Box-Muller transform.
+         * @param[in] aSeed The seed of the generator.
+         * @param[in] aStream The stream of the value, so that different quantities do not share values.
+         * @param[in] aIndex The index of the value in its stream.
+         * @return The normal value.
+         *
+         */
+        static T Normal(const uint32_t &aSeed, const uint32_t &aStream, const uint64_t &aIndex);
+
+        /**
+         * @brief Fills a vector with consecutive standard normal values of a stream.
+         * @param[in] aSeed The seed of the generator.
+         * @param[in] aStream The stream of the values.
+         * @param[in] aOffset The index of the first value in its stream.
+         * @param[in] aSize The number of values.
+         * @param[out] apOutput The vector to fill.
+         * @return void
+         *
+         */
+        static void
+        NormalVector(const uint32_t &aSeed, const uint32_t &aStream, const uint64_t &aOffset, const int &aSize,
+                     T *apOutput);
+    };
+
+    /**
+     * @brief Instantiates the PhiloxRandom class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(PhiloxRandom)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_PHILOXRANDOM_HPP
@@ -0,0 +1,93 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file SpaceFillingCurve.hpp
+ * @brief Contains the definition of the SpaceFillingCurve class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_SPACEFILLINGCURVE_HPP
+#define EXAGEOSTATCPP_SPACEFILLINGCURVE_HPP
+
+#include <vector>
+
+#include <data-units/Locations.hpp>
+
+namespace exageostat::helpers {
+
+    /**
+     * @class SpaceFillingCurve
+     * @brief Reorders locations along a Morton or a Hilbert curve, so that close locations end up in the same tiles.
+     * @details Every axis is quantized to 21 bits, which fits the keys of 2D, 3D and space-time locations in 64 bits.
+     * The spatial axes share one scale so that the curve follows the geometry, the time axis is scaled on its own.
+     * @tparam T Data Type: float or double
+     *
+     */
+    template<typename T>
+    class SpaceFillingCurve {
+
+    public:
+
+        /**
+         * @brief Computes the order of the locations along a space-filling curve.
+         * @param[in] aN The number of locations.
+         * @param[in] aLocations The locations to order, the Z coordinate holds the time of space-time locations.
+         * @param[in] aOrdering The curve to follow, either MORTON_ORDERING or HILBERT_ORDERING.
+         * @param[in] aThreadsNumber The number of threads computing and sorting the keys.
+         * @return The permutation, element i is the index of the location that comes at position i.
+         * @throws std::invalid_argument if aOrdering is not a space-filling curve.
+         *
+         */
+        static std::vector<int>
+        GetPermutation(const int &aN, dataunits::Locations<T> &aLocations, const common::Ordering &aOrdering,
+                       const int &aThreadsNumber = 1);
+
+        /**
+         * @brief Reorders the locations in place along a space-filling curve, along with their measurements.
+         * @param[in] aN The number of locations.
+         * @param[in,out] aLocations The locations to reorder.
+         * @param[in,out] apMeasurements The aP consecutive measurements of every location, or nullptr.
+         * @param[in] aP The number of measurements per location.
+         * @param[in] aOrdering The curve to follow, either MORTON_ORDERING or HILBERT_ORDERING.
+         * @param[in] aThreadsNumber The number of threads ordering and moving the locations.
+         * @return The applied permutation, element i is the former index of the location now at position i.
+         *
+         */
+        static std::vector<int>
+        Reorder(const int &aN, dataunits::Locations<T> &aLocations, T *apMeasurements, const int &aP,
+                const common::Ordering &aOrdering, const int &aThreadsNumber = 1);
+
+        /**
+         * @brief Computes the Morton key of quantized coordinates, the first axis holds the lowest bit of each level.
+         * @param[in] apCoordinates The 21-bit coordinates.
+         * @param[in] aAxesNumber The number of axes, 2 or 3.
+         * @return The Morton key.
+         *
+         */
+        static uint64_t MortonKey(const uint32_t *apCoordinates, const int &aAxesNumber);
+
+        /**
+         * @brief Computes the Hilbert key of quantized coordinates, with Skilling's transpose algorithm.
+         * @param[in] apCoordinates The 21-bit coordinates.
+         * @param[in] aAxesNumber The number of axes, 2 or 3.
+         * @return The Hilbert key.
+         *
+         */
+        static uint64_t HilbertKey(const uint32_t *apCoordinates, const int &aAxesNumber);
+    };
+
+    /**
+     * @brief Instantiates the SpaceFillingCurve class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(SpaceFillingCurve)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_SPACEFILLINGCURVE_HPP
@@ -0,0 +1,202 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file SpatialIndex.hpp
+ * @brief Contains the definition of the SpatialIndex class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_SPATIALINDEX_HPP
+#define EXAGEOSTATCPP_SPATIALINDEX_HPP
+
+#include <vector>
+
+#include <data-units/Locations.hpp>
+
+namespace exageostat::helpers {
+
+    /**
+     * @class SpatialIndex
+     * @brief A k-d tree over a set of locations, answering k nearest neighbors and radius queries in O(log N) per query.
+     * @details The tree is stored as flat arrays, built in parallel by splitting the widest axis of every node at its
+     * median. The Euclidean distance is computed over X and Y, and over Z for 3D locations. The time of space-time
+     * locations is treated as a third coordinate, multiplied by a time scale. For the Great Circle distance, the
+     * locations (X the latitude and Y the longitude, in degrees) are indexed as points of the unit sphere, whose chord
+     * distance grows with the great-circle distance.
+     * Neighbors are ordered by increasing distance, then by increasing index, so the results match a brute-force search.
+     * @tparam T Data Type: float or double
+     *
+     */
+    template<typename T>
+    class SpatialIndex {
+
+    public:
+
+        /**
+         * @brief Builds the index over the first aN locations.
+         * @param[in] aLocations The locations to index, they are copied.
+         * @param[in] aN The number of locations.
+         * @param[in] aDistanceMetric The distance metric of the queries.
+         * @param[in] aThreadsNumber The number of threads building the tree.
+         * @param[in] aTimeScale The factor the time of space-time locations is multiplied by.
+         * @throws std::runtime_error if the Great Circle distance is used with 3D or space-time locations.
+         *
+         */
+        SpatialIndex(dataunits::Locations<T> &aLocations, const int &aN,
+                     const common::DistanceMetric &aDistanceMetric = common::EUCLIDEAN_DISTANCE,
+                     const int &aThreadsNumber = 1, const T &aTimeScale = 1);
+
+        /**
+         * @brief Default destructor.
+         *
+         */
+        ~SpatialIndex() = default;
+
+        /**
+         * @brief Finds the k nearest indexed locations of every query location.
+         * @param[in] aQueries The query locations, with the dimension of the indexed locations.
+         * @param[in] aQueriesNumber The number of query locations.
+         * @param[in] aNeighborsNumber The number of neighbors k of a query.
+         * @param[out] apIndices The k neighbors of every query, stored contiguously and padded with -1 when fewer
+         * locations are indexed. Size aQueriesNumber * aNeighborsNumber.
+         * @param[out] apDistances The distances to the neighbors, padded with infinity, or nullptr.
+         * @param[in] aThreadsNumber The number of threads answering the queries.
+         * @return void
+         *
+         */
+        void KNearestNeighbors(dataunits::Locations<T> &aQueries, const int &aQueriesNumber,
+                               const int &aNeighborsNumber, int *apIndices, T *apDistances,
+                               const int &aThreadsNumber = 1) const;
+
+        /**
+         * @brief Finds, for every indexed location, its k nearest indexed locations among the ones preceding it.
+         * @details This gives the conditioning sets of ordered approximations such as Vecchia's.
+         * @param[in] aNeighborsNumber The number of neighbors k of a location.
+         * @param[out] apIndices The k neighbors of every location, stored contiguously and padded with -1 for the
+         * first locations. Size N * aNeighborsNumber.
+         * @param[in] aThreadsNumber The number of threads answering the queries.
+         * @return void
+         *
+         */
+        void KNearestPrecedingNeighbors(const int &aNeighborsNumber, int *apIndices,
+                                        const int &aThreadsNumber = 1) const;
+
+        /**
+         * @brief Finds the indexed locations within a radius of every query location.
+         * @param[in] aQueries The query locations, with the dimension of the indexed locations.
+         * @param[in] aQueriesNumber The number of query locations.
+         * @param[in] aRadius The radius, in the unit of the distance metric.
+         * @param[out] aOffsets The neighbors of query i are at positions [aOffsets[i], aOffsets[i + 1]) of aIndices.
+         * Size aQueriesNumber + 1.
+         * @param[out] aIndices The neighbors of all the queries, stored contiguously.
+         * @param[out] apDistances The distances to the neighbors, in the layout of aIndices, or nullptr.
+         * @param[in] aThreadsNumber The number of threads answering the queries.
+         * @return void
+         *
+         */
+        void RadiusNeighbors(dataunits::Locations<T> &aQueries, const int &aQueriesNumber, const T &aRadius,
+                             std::vector<int> &aOffsets, std::vector<int> &aIndices, std::vector<T> *apDistances,
+                             const int &aThreadsNumber = 1) const;
+
+        /**
+         * @brief Gets the number of indexed locations.
+         * @return The number of locations.
+         *
+         */
+        int GetSize() const;
+
+    private:
+
+        /**
+         * @brief A node of the tree, covering a range of the tree order.
+         *
+         */
+        struct Node {
+            //// First position of the node in the tree order.
+            int mBegin;
+            //// Position after the last one of the node.
+            int mEnd;
+            //// Index of the right child, the left child follows the node.
+            int mRight;
+            //// Smallest location index in the node.
+            int mMinimumIndex;
+            //// Lower corner of the bounding box.
+            T mLower[3];
+            //// Upper corner of the bounding box.
+            T mUpper[3];
+        };
+
+        /**
+         * @brief Converts locations to the coordinates the tree is built on.
+         * @param[in] aLocations The locations.
+         * @param[in] aN The number of locations.
+         * @param[out] aCoordinates The aN coordinates of every axis, one axis after the other.
+         * @return void
+         *
+         */
+        void ToCoordinates(dataunits::Locations<T> &aLocations, const int &aN, std::vector<T> &aCoordinates) const;
+
+        /**
+         * @brief Converts a squared coordinate distance to a distance in the unit of the metric.
+         * @param[in] aSquaredDistance The squared distance between the coordinates.
+         * @return The distance.
+         *
+         */
+        T ToDistance(const T &aSquaredDistance) const;
+
+        /**
+         * @brief Builds the subtree of a range of the tree order.
+         * @param[in] aNode The index of the subtree root.
+         * @param[in] aBegin The first position of the range.
+         * @param[in] aEnd The position after the last one of the range.
+         * @param[in] aThreadsNumber The number of threads building the subtree.
+         * @return void
+         *
+         */
+        void Build(const int &aNode, const int &aBegin, const int &aEnd, const int &aThreadsNumber);
+
+        /**
+         * @brief Finds the k nearest locations of a point among the locations of index lower than a bound.
+         * @param[in] apPoint The coordinates of the point.
+         * @param[in] aNeighborsNumber The number of neighbors k.
+         * @param[in] aIndexBound Only locations of index lower than the bound are considered.
+         * @param[out] aHeap A max-heap of the neighbors, as (squared distance, index).
+         * @return void
+         *
+         */
+        void Search(const T *apPoint, const int &aNeighborsNumber, const int &aIndexBound,
+                    std::vector<std::pair<T, int>> &aHeap) const;
+
+        //// Number of indexed locations.
+        int mSize;
+        //// Number of coordinates of a location.
+        int mAxesNumber;
+        //// Distance metric of the queries.
+        common::DistanceMetric mDistanceMetric;
+        //// Factor applied to the time of space-time locations.
+        T mTimeScale;
+        //// Dimension of the indexed locations.
+        common::Dimension mDimension;
+        //// Coordinates in the tree order, one axis after the other.
+        std::vector<T> mCoordinates;
+        //// Location index at every position of the tree order.
+        std::vector<int> mIndices;
+        //// Nodes of the tree, every subtree is contiguous and starts with its root.
+        std::vector<Node> mNodes;
+    };
+
+    /**
+     * @brief Instantiates the SpatialIndex class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(SpatialIndex)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_SPATIALINDEX_HPP
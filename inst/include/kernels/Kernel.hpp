@@ -19,6 +19,8 @@
 #define EXAGEOSTAT_CPP_KERNELS_HPP
 
 #include<cmath>
+#include <memory>
+#include <mutex>
 
 #include <starpu.h>
 
@@ -31,6 +33,7 @@ extern "C" {
 #include <data-units/Locations.hpp>
 #include <helpers/DistanceCalculationHelpers.hpp>
 #include <helpers/BasselFunction.hpp>
+#include <helpers/MaternInterpolationTable.hpp>
 
 /**
  * @def EARTH_RADIUS
@@ -55,6 +58,32 @@ namespace exageostat::kernels {
             static std::unordered_map<std::string, int> mKernelParametersNumbers;
             return mKernelParametersNumbers;
         }
+
+        /**
+         * @brief Returns the static tolerance used to match the smoothness parameter to a half-integer.
+         * @details A smoothness value within this tolerance of 0.5, 1.5 or 2.5 is evaluated with the closed-form Matern.
+         * @return Reference to the static tolerance.
+         */
+        static double &GetSmoothnessTolerance() {
+            /**
+             * @brief Static smoothness tolerance, exact matching by default.
+             */
+            static double mSmoothnessTolerance = 0;
+            return mSmoothnessTolerance;
+        }
+
+        /**
+         * @brief Returns the static relative error bound of the Matern interpolation tables.
+         * @details A zero value disables the tables, and the Bessel function is evaluated exactly.
+         * @return Reference to the static relative error bound.
+         */
+        static double &GetBesselTableTolerance() {
+            /**
+             * @brief Static relative error bound, disabled by default.
+             */
+            static double mBesselTableTolerance = 0;
+            return mBesselTableTolerance;
+        }
     };
 
     /**
@@ -94,6 +123,57 @@ namespace exageostat::kernels {
                                  dataunits::Locations<T> &aLocation2, dataunits::Locations<T> &aLocation3,
                                  T *apLocalTheta, const int &aDistanceMetric) = 0;
 
+        /**
+         * @brief Generates a covariance tile using the batched tile path.
+         * @details This is the entry point used by the dcmg codelet. Kernels that only depend on the distance override it
+         * to compute all the tile distances into the contiguous output tile first, then evaluate the radial function over it in place.
+         * The default implementation falls back to GenerateCovarianceMatrix().
+         * @param[out] apMatrixA The output covariance matrix.
+         * @param[in] aRowsNumber The number of rows in the output matrix.
+         * @param[in] aColumnsNumber The number of columns in the output matrix.
+         * @param[in] aRowOffset The row offset for the input locations.
+         * @param[in] aColumnOffset The column offset for the input locations.
+         * @param[in] apLocation1 The set of input locations 1.
+         * @param[in] apLocation2 The set of input locations 2.
+         * @param[in] apLocation3 The set of input locations 3.
+         * @param[in] aLocalTheta An array of kernel parameters.
+         * @param [in] aDistanceMetric Distance metric to be used (0 = Euclidean, 1 = Great Circle).
+         * @return void
+         *
+         */
+        virtual void
+        GenerateCovarianceTile(T *apMatrixA, const int &aRowsNumber, const int &aColumnsNumber, const int &aRowOffset,
+                               const int &aColumnOffset, dataunits::Locations<T> &aLocation1,
+                               dataunits::Locations<T> &aLocation2, dataunits::Locations<T> &aLocation3,
+                               T *apLocalTheta, const int &aDistanceMetric);
+
+        /**
+         * @brief Checks whether the kernel only depends on the distance between the locations.
+         * @details Only isotropic kernels can generate their tiles from cached distances.
+         * @return True if the kernel supports GenerateCovarianceTileFromDistances(), false otherwise.
+         *
+         */
+        [[nodiscard]] virtual bool IsIsotropic() const;
+
+        /**
+         * @brief Generates a covariance tile from a tile of precomputed distances.
+         * @param[out] apMatrixA The output covariance matrix.
+         * @param[in] apDistances The distances of the tile, stored with the same layout as apMatrixA.
+         * @param[in] aRowsNumber The number of rows in the output matrix.
+         * @param[in] aColumnsNumber The number of columns in the output matrix.
+         * @param[in] aLocation1 The set of input locations 1.
+         * @param[in] aLocation2 The set of input locations 2.
+         * @param[in] apLocalTheta An array of kernel parameters.
+         * @param [in] aDistanceMetric Distance metric the distances were computed with (0 = Euclidean, 1 = Great Circle).
+         * @return void
+         *
+         */
+        virtual void
+        GenerateCovarianceTileFromDistances(T *apMatrixA, const T *apDistances, const int &aRowsNumber,
+                                            const int &aColumnsNumber, dataunits::Locations<T> &aLocation1,
+                                            dataunits::Locations<T> &aLocation2, T *apLocalTheta,
+                                            const int &aDistanceMetric);
+
         /**
          * @brief Returns the value of the parameter P used by the kernel function.
          * @return The value of P (Variables Number).
@@ -117,12 +197,65 @@ namespace exageostat::kernels {
         [[nodiscard]] int GetParametersNumbers() const;
 
     protected:
+
+        /**
+         * @brief Matches the smoothness parameter to one of the half-integers supported by the closed-form Matern.
+         * @param[in] aNu The smoothness parameter.
+         * @return 0, 1 or 2 when nu is within the smoothness tolerance of 0.5, 1.5 or 2.5 respectively, -1 otherwise.
+         *
+         */
+        static int GetHalfIntegerSmoothness(const T &aNu);
+
+        /**
+         * @brief Evaluates the normalized Matern function for a half-integer smoothness in closed form.
+         * @details Equals x^nu K_nu(x) / (2^(nu-1) Gamma(nu)), which is exp(-x) times a polynomial of x when nu is a half-integer.
+         * @param[in] aHalfIntegerOrder The order returned by GetHalfIntegerSmoothness().
+         * @param[in] aDistance The scaled distance.
+         * @return The Matern correlation at the given distance.
+         *
+         */
+        static T HalfIntegerMatern(const int &aHalfIntegerOrder, const T &aDistance);
+
+        /**
+         * @brief Evaluates the closed-form Matern over a contiguous buffer of scaled distances in place.
+         * @param[in,out] apDistances The buffer of scaled distances, overwritten with the covariance values.
+         * @param[in] aSize The number of elements in the buffer.
+         * @param[in] aHalfIntegerOrder The order returned by GetHalfIntegerSmoothness().
+         * @param[in] aSigmaSquare The variance multiplying the correlation.
+         * @return void
+         *
+         */
+        static void HalfIntegerMaternTile(T *apDistances, const size_t &aSize, const int &aHalfIntegerOrder,
+                                          const T &aSigmaSquare);
+
+        /**
+         * @brief Returns the interpolation table of x^nu K_nu(x) for the current theta.
+         * @details The table is built once per smoothness value over the whole range of the dataset, and it is shared by
+         * all the tiles. It is only rebuilt when nu changes or when a tile needs a larger distance range.
+         * @param[in] aNu The smoothness parameter.
+         * @param[in] aRange The range parameter the distances are scaled with.
+         * @param[in] aTileMaxDistance The largest scaled distance of the current tile.
+         * @param[in] aLocation1 The set of input locations 1.
+         * @param[in] aLocation2 The set of input locations 2.
+         * @param[in] aDistanceMetric Distance metric to be used (0 = Euclidean, 1 = Great Circle).
+         * @param[in] aFlagZ Flag indicating whether the points are in 2D or 3D space (0 for 2D, 1 for 3D).
+         * @return Pointer to the table, or nullptr if the tables are disabled or the tolerance can't be reached.
+         *
+         */
+        std::shared_ptr<const helpers::MaternInterpolationTable<T>>
+        GetMaternTable(const T &aNu, const T &aRange, const T &aTileMaxDistance, dataunits::Locations<T> &aLocation1,
+                       dataunits::Locations<T> &aLocation2, const int &aDistanceMetric, const int &aFlagZ);
+
         //// Used P.
         int mP = 1;
         //// Used Variable number which is P multiplied by timeslot
         int mVariablesNumber = 1;
         //// Used number of parameters.
         int mParametersNumber = 3;
+        //// Used interpolation table of the current theta.
+        std::shared_ptr<const helpers::MaternInterpolationTable<T>> mpMaternTable;
+        //// Used mutex to build the interpolation table once when tiles are generated in parallel.
+        std::mutex mMaternTableMutex;
     };
 
     /**
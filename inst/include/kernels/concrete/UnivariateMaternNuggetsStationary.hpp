@@ -57,6 +57,35 @@ namespace exageostat::kernels {
                                  dataunits::Locations<T> &aLocation2, dataunits::Locations<T> &aLocation3,
                                  T *apLocalTheta, const int &aDistanceMetric) override;
 
+        /**
+         * @brief Generates a covariance tile using the batched tile path.
+         * @copydoc Kernel::GenerateCovarianceTile()
+         *
+         */
+        void
+        GenerateCovarianceTile(T *apMatrixA, const int &aRowsNumber, const int &aColumnsNumber, const int &aRowOffset,
+                               const int &aColumnOffset, dataunits::Locations<T> &aLocation1,
+                               dataunits::Locations<T> &aLocation2, dataunits::Locations<T> &aLocation3,
+                               T *apLocalTheta, const int &aDistanceMetric) override;
+
+        /**
+         * @brief Checks whether the kernel only depends on the distance between the locations.
+         * @copydoc Kernel::IsIsotropic()
+         *
+         */
+        [[nodiscard]] bool IsIsotropic() const override;
+
+        /**
+         * @brief Generates a covariance tile from a tile of precomputed distances.
+         * @copydoc Kernel::GenerateCovarianceTileFromDistances()
+         *
+         */
+        void
+        GenerateCovarianceTileFromDistances(T *apMatrixA, const T *apDistances, const int &aRowsNumber,
+                                            const int &aColumnsNumber, dataunits::Locations<T> &aLocation1,
+                                            dataunits::Locations<T> &aLocation2, T *apLocalTheta,
+                                            const int &aDistanceMetric) override;
+
         /**
          * @brief Creates a new UnivariateMaternNuggetsStationary object.
          * @details This method creates a new UnivariateMaternNuggetsStationary object and returns a pointer to it.
@@ -62,6 +62,17 @@ namespace exageostat::kernels {
                                  dataunits::Locations<T> &aLocation2, dataunits::Locations<T> &aLocation3,
                                  T *apLocalTheta, const int &aDistanceMetric) override;
 
+        /**
+         * @brief Generates a covariance tile using the batched tile path.
+         * @copydoc Kernel::GenerateCovarianceTile()
+         *
+         */
+        void
+        GenerateCovarianceTile(T *apMatrixA, const int &aRowsNumber, const int &aColumnsNumber, const int &aRowOffset,
+                               const int &aColumnOffset, dataunits::Locations<T> &aLocation1,
+                               dataunits::Locations<T> &aLocation2, dataunits::Locations<T> &aLocation3,
+                               T *apLocalTheta, const int &aDistanceMetric) override;
+
         /**
          * @brief Creates a new UnivariatePowExpStationary object.
          * @details This method creates a new UnivariatePowExpStationary object and returns a pointer to it.
@@ -63,6 +63,32 @@ namespace exageostat::linearAlgebra {
                                  dataunits::DescriptorData<T> &aDescriptorData,
                                  const int &aP, T *apMeasurementsMatrix = nullptr);
 
+        /**
+         * @brief Initializes the descriptors necessary for the Vecchia likelihood, if not initialized before.
+         * @details Only the measurements, the log determinant and the product descriptors are created, the covariance
+         * matrix is never formed.
+         * @param[in] aConfigurations Configurations object containing relevant settings.
+         * @param[in,out] aDescriptorData Descriptor Data object to be populated with descriptors and data.
+         * @param[in] apMeasurementsMatrix Pointer to the measurement matrix.
+         * @return void
+         *
+         */
+        void InitiateVecchiaDescriptors(configurations::Configurations &aConfigurations,
+                                        dataunits::DescriptorData<T> &aDescriptorData,
+                                        T *apMeasurementsMatrix = nullptr);
+
+        /**
+         * @brief Initializes the descriptor of the cached distance matrix, if it fits in the configured memory budget.
+         * @details The descriptor has the same tiling as DESCRIPTOR_C, and it is only created once.
+         * @param[in] aConfigurations Configurations object containing relevant settings.
+         * @param[in,out] aDescriptorData Descriptor Data object to be populated with descriptors and data.
+         * @param[in] aP the P value of the kernel multiplied by time slot.
+         * @return True if the distance cache descriptor is available, false otherwise.
+         *
+         */
+        bool InitiateDistanceCacheDescriptor(configurations::Configurations &aConfigurations,
+                                             dataunits::DescriptorData<T> &aDescriptorData, const int &aP);
+
         /**
          * @brief Initializes the descriptors necessary for the Fisher prediction function.
          * @param[in] aConfigurations Configurations object containing relevant settings.
@@ -73,16 +99,40 @@ namespace exageostat::linearAlgebra {
         void InitiateFisherDescriptors(configurations::Configurations &aConfigurations,
                                        dataunits::DescriptorData<T> &aDescriptorData);
 
+        /**
+         * @brief Initializes the descriptors necessary for the likelihood gradient, if not initialized before.
+         * @param[in] aConfigurations Configurations object containing relevant settings.
+         * @param[in,out] aDescriptorData Descriptor Data object to be populated with descriptors and data.
+         * @return void
+         *
+         */
+        void InitiateGradientDescriptors(configurations::Configurations &aConfigurations,
+                                         dataunits::DescriptorData<T> &aDescriptorData);
+
+        /**
+         * @brief Initializes the descriptors of the stochastic trace estimator, if not initialized before.
+         * @details The probes and the probe derivatives have one column per probe, plus one for the measurements.
+         * @param[in] aConfigurations Configurations object containing relevant settings.
+         * @param[in,out] aDescriptorData Descriptor Data object to be populated with descriptors and data.
+         * @param[in] aParametersNumber The number of covariance derivatives applied to the probes.
+         * @return void
+         *
+         */
+        void InitiateTraceEstimatorDescriptors(configurations::Configurations &aConfigurations,
+                                               dataunits::DescriptorData<T> &aDescriptorData,
+                                               const int &aParametersNumber);
+
         /**
          * @brief Initializes the descriptors necessary for the Prediction.
          * @details This method initializes the descriptors necessary for the linear algebra solver.
          * @param[in] aConfigurations Configurations object containing relevant settings.
          * @param[in,out] aData DescriptorData object to be populated with descriptors and data.
+         * @param[in] aIsFactorReused Whether the retained Cholesky factor replaces C22, which is then not allocated.
          * @return void
          *
          */
         void InitiatePredictionDescriptors(configurations::Configurations &aConfigurations,
-                                           std::unique_ptr<ExaGeoStatData<T>> &aData);
+                                           std::unique_ptr<ExaGeoStatData<T>> &aData, const bool &aIsFactorReused);
 
         /**
          * @brief Initializes the descriptors necessary for the Prediction Auxiliary function MLE-MLOE-MMOM.
@@ -127,6 +177,21 @@ namespace exageostat::linearAlgebra {
                                    dataunits::Locations<T> *apLocation3, const int &aDistanceMetric,
                                    const kernels::Kernel<T> &aKernel);
 
+        /**
+         * @brief Writes the measurements vector to disk, in the data format of the configurations.
+         * @details With MPI, every process writes the tiles of a binary file it holds, at their offsets. A CSV file
+         * has lines of varying size, so the vector is gathered and broadcast before every process writes its lines.
+         * @param[in] aConfigurations Configurations object containing relevant settings.
+         * @param[in] apDescZ The measurements vector descriptor.
+         * @param[in] aProblemSize The size of the measurements vector.
+         * @param[in] aP The number of measurements per location.
+         * @param[in] aLocations The locations of the measurements.
+         * @return void
+         *
+         */
+        void WriteMeasurementsVector(configurations::Configurations &aConfigurations, void *apDescZ,
+                                     const int &aProblemSize, const int &aP, dataunits::Locations<T> &aLocations);
+
         /**
          * @brief Calculates the log likelihood value of a given value theta.
          * @param[in,out] aData DescriptorData object to be populated with descriptors and data.
@@ -215,6 +280,15 @@ namespace exageostat::linearAlgebra {
          */
         void ExaGeoStatPosvTile(const common::UpperLower &aUpperLower, void *apA, void *apB);
 
+        /**
+         * @brief Computes the inverse of a symmetric positive definite matrix from its Cholesky factor.
+         * @param[in] aUpperLower Specifies whether the factor is upper triangular or lower triangular.
+         * @param[in,out] apA The Cholesky factor, on exit overwritten by the same triangle of the inverse.
+         * @return void
+         *
+         */
+        void ExaGeoStatPotriTile(const common::UpperLower &aUpperLower, void *apA);
+
         /**
          * @brief Predict missing values base on a set of given values and covariance matrix/
          * @param[in] aData Reference to Data containing different MLE inputs.
@@ -224,6 +298,7 @@ namespace exageostat::linearAlgebra {
          * @param[in] apZObs observed values vector (known observations).
          * @param[in] apZActual actual missing values vector (in the case of testing MSPE).
          * @param[in] apZMiss missing values vector (unknown observations).
+         * @param[out] apZMissVariance kriging variance of every missing value, only filled with --kriging_variance.
          * @param[in] aConfigurations Configurations object containing relevant settings.
          * @param[in] aMissLocations Reference to Locations object containing missed locations.
          * @param[in] aObsLocations Reference to Locations object containing observed locations.
@@ -234,6 +309,7 @@ namespace exageostat::linearAlgebra {
         T *ExaGeoStatMLEPredictTile(std::unique_ptr<ExaGeoStatData<T>> &aData, T *apTheta,
                                     const int &aZMissNumber,
                                     const int &aZObsNumber, T *apZObs, T *apZActual, T *apZMiss,
+                                    T *apZMissVariance,
                                     configurations::Configurations &aConfiguration,
                                     exageostat::dataunits::Locations<T> &aMissLocations,
                                     exageostat::dataunits::Locations<T> &aObsLocations,
@@ -253,6 +329,7 @@ namespace exageostat::linearAlgebra {
          * @param[in] aObsLocations Reference to Locations object containing observed locations.
          * @param[in] aKernel Reference to the kernel object to use.
          * @return the prediction Mean Square Error (MSPE).
+         * @throws std::domain_error if the kernel is not univariate.
          *
          */
         T *ExaGeoStatMLENonGaussianPredictTile(std::unique_ptr<ExaGeoStatData<T>> &aData, T *apTheta,
@@ -358,6 +435,73 @@ namespace exageostat::linearAlgebra {
                              std::unique_ptr<ExaGeoStatData<T>> &aData,
                              T *apTheta, const kernels::Kernel<T> &aKernel);
 
+        /**
+         * @brief Calculates the gradient of the log likelihood at the theta of the last likelihood evaluation.
+         * @details The score of each parameter, -1/2 * trace(C^-1 * dC_j) + 1/2 * Z^T * C^-1 * dC_j * C^-1 * Z, is
+         * computed from the Cholesky factor and the solved measurements left by ExaGeoStatMLETile, so it must be
+         * called right after it with the same theta. The traces are exact, or estimated with the configured number of
+         * Rademacher probes. Only the exact dense univariate Matern stationary kernel is supported.
+         * @param[in] aConfigurations Configurations object containing relevant settings.
+         * @param[in,out] aData Descriptor Data object holding the factorized covariance matrix.
+         * @param[in] apTheta Optimization parameter used by NLOPT.
+         * @param[out] apGradient The gradient of the log likelihood, one value per parameter.
+         * @param[in] aKernel Reference to the kernel object to use.
+         * @return void
+         *
+         */
+        void ExaGeoStatMLEGradientTile(configurations::Configurations &aConfigurations,
+                                       std::unique_ptr<ExaGeoStatData<T>> &aData, const double *apTheta,
+                                       double *apGradient, const kernels::Kernel<T> &aKernel);
+
+        /**
+         * @brief Applies the covariance derivatives to Rademacher probes solved against the Cholesky factor of C.
+         * @details The probes block is filled with the Rademacher vectors V followed by apLastColumn, or zeros, and
+         * overwritten by L^-T times itself. Each probe derivative descriptor j then holds dC_j times the solved block,
+         * computed without storing dC_j, so that the mean of v^T * L^-1 * dC_j * L^-T * v estimates trace(C^-1 * dC_j).
+         * @param[in] aConfigurations Configurations object containing relevant settings.
+         * @param[in,out] aData Descriptor Data object holding the factorized covariance matrix.
+         * @param[in] apTheta The kernel parameters the derivatives are taken at.
+         * @param[in] aParametersNumber The number of covariance derivatives to apply.
+         * @param[in] apLastColumn Descriptor of the vector appended to the probes, or nullptr.
+         * @return void
+         *
+         */
+        void ExaGeoStatDerivativeProbesTile(configurations::Configurations &aConfigurations,
+                                            std::unique_ptr<ExaGeoStatData<T>> &aData, T *apTheta,
+                                            const int &aParametersNumber, void *apLastColumn);
+
+        /**
+         * @brief Computes the variance explained by the observations at every missing location.
+         * @details The cross covariance is overwritten by L^-1 times itself, so that c^T * C^-1 * c of every column c
+         * is the squared norm of its solved column, without forming the missing locations covariance matrix.
+         * @param[in] aData Reference to Data holding the kriging variance descriptor.
+         * @param[in] apFactor Descriptor of the Cholesky factor of the observations covariance matrix.
+         * @param[in,out] apCrossCovariance Descriptor of the observations by missing locations covariance matrix.
+         * @param[out] apExplainedVariance The explained variance of every missing location, or nullptr to only keep it
+         * in the kriging variance descriptor.
+         * @return void
+         *
+         */
+        void ExaGeoStatExplainedVarianceTile(std::unique_ptr<ExaGeoStatData<T>> &aData, void *apFactor,
+                                             void *apCrossCovariance, T *apExplainedVariance);
+
+        /**
+         * @brief Checks whether the Cholesky factor retained in DESCRIPTOR_C can replace a new factorization.
+         * @details The factor is reusable when --retain_factor is set, it was computed exactly at apTheta with the
+         * euclidean distance, and the covariance matrix to factorize is built over the same locations, in the same
+         * order, as the modeling one.
+         * @param[in] aConfigurations Configurations object containing relevant settings.
+         * @param[in] aData Reference to Data holding the retained factor and the modeling locations.
+         * @param[in] apTheta The kernel parameters of the covariance matrix to factorize.
+         * @param[in] aParametersNumber The number of kernel parameters.
+         * @param[in] aLocations The locations of the covariance matrix to factorize.
+         * @return true if the triangular solves can use the retained factor.
+         *
+         */
+        bool IsFactorReusable(configurations::Configurations &aConfigurations,
+                              std::unique_ptr<ExaGeoStatData<T>> &aData, const T *apTheta,
+                              const int &aParametersNumber, dataunits::Locations<T> &aLocations);
+
         /**
          * @brief Perform a matrix addition with scaling.
          * @details This function performs a matrix addition with scaling, given the matrices A and B.
@@ -389,16 +533,19 @@ namespace exageostat::linearAlgebra {
                                 void *apDescB);
 
         /**
-         * @brief Recovers theta and log-likelihood from a file.
-         * @param[in] apPath A pointer to the path of the file from which to recover the data.
-         * @param[in] aIterationCount The iteration count to look for in the file.
-         * @param[in,out] apTheta A pointer to the array where the theta values will be stored.
-         * @param[in,out] apLogLik A pointer to the variable where the log-likelihood value will be stored.
-         * @param[in] aNumParams The number of parameters (elements) in the theta array.
-         * @return bool `true` if the specified iteration count is found and successfully parsed, `false` otherwise.
+         * @brief Perform a general matrix multiplication C = alpha * op(A) * op(B) + beta * C.
+         * @param[in] aTransA Specifies whether to transpose matrix A.
+         * @param[in] aTransB Specifies whether to transpose matrix B.
+         * @param[in] aAlpha Scaling factor for the product.
+         * @param[in] apDescA Descriptor for matrix A.
+         * @param[in] apDescB Descriptor for matrix B.
+         * @param[in] aBeta Scaling factor for matrix C.
+         * @param[in,out] apDescC Descriptor for matrix C.
+         * @return void
          *
          */
-        bool Recover(char *apPath, const int &aIterationCount, T *apTheta, T *apLogLik, const int &aNumParams);
+        void ExaGeoStatGemmTile(const common::Trans &aTransA, const common::Trans &aTransB, const T &aAlpha,
+                                void *apDescA, void *apDescB, const T &aBeta, void *apDescC);
     };
 
     /**
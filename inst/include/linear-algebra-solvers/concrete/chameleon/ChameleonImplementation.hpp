@@ -45,6 +45,74 @@ namespace exageostat::linearAlgebra {
          */
         void ExaGeoStatLapackCopyTile(const common::UpperLower &aUpperLower, void *apA, void *apB) override;
 
+        /**
+         * @brief Submits the Cholesky factorization of a symmetric positive definite matrix, without waiting for it.
+         * @param[in] aUpperLower Specifies whether the upper or lower triangular part of the matrix is stored.
+         * @param[in,out] apA Pointer to the matrix descriptor.
+         * @param[in] aBand The diagonal thickness, used by the diagonal super tile approximation only.
+         * @param[in] apSequence The sequence structure to associate the tasks with.
+         * @param[in] apRequest The request structure to associate the tasks with.
+         * @return void
+         *
+         */
+        virtual void ExaGeoStatPotrfTileAsync(const common::UpperLower &aUpperLower, void *apA, const int &aBand,
+                                              void *apSequence, void *apRequest) = 0;
+
+        /**
+         * @brief Submits the Cholesky factorization of a symmetric positive definite matrix in mixed precision, without waiting for it.
+         * @details Tiles within aBand tile diagonals of the main diagonal are held and factored in double precision in
+         * apA, the remaining tiles are held, updated and factored in single precision in apASingle. The off-band tiles
+         * of apA are never used, and the in-band tiles of apASingle only hold single precision copies of the panels.
+         * On completion, the factor is split between apA and apASingle the same way.
+         * @param[in] aUpperLower Specifies whether the upper or lower triangular part of the matrix is stored, only lower is supported.
+         * @param[in,out] apA Pointer to the double precision matrix descriptor.
+         * @param[in,out] apASingle Pointer to the single precision matrix descriptor with the same tiling as apA.
+         * @param[out] apPanel Pointer to a double precision descriptor of one column of tiles, used as workspace.
+         * @param[in] aBand The number of tile diagonals kept in double precision.
+         * @param[in] apSequence The sequence structure to associate the tasks with.
+         * @param[in] apRequest The request structure to associate the tasks with.
+         * @return void
+         *
+         */
+        void ExaGeoStatMixedPrecisionPotrfTileAsync(const common::UpperLower &aUpperLower, void *apA, void *apASingle,
+                                                    void *apPanel, const int &aBand, void *apSequence,
+                                                    void *apRequest);
+
+        /**
+         * @brief Submits the solve of L*X = B with a factor of ExaGeoStatMixedPrecisionPotrfTileAsync, without waiting for it.
+         * @details Every single precision tile of the factor is promoted into the panel before it is applied, so the
+         * solution is accumulated in double precision.
+         * @param[in] apA Pointer to the double precision descriptor of the factor.
+         * @param[in] apASingle Pointer to the single precision descriptor of the factor.
+         * @param[out] apPanel Pointer to a double precision descriptor of one column of tiles, used as workspace.
+         * @param[in,out] apB Pointer to the right hand side descriptor, overwritten with the solution.
+         * @param[in] aBand The number of tile diagonals of the factor held in double precision.
+         * @param[in] apSequence The sequence structure to associate the tasks with.
+         * @param[in] apRequest The request structure to associate the tasks with.
+         * @return void
+         *
+         */
+        void ExaGeoStatMixedPrecisionTrsmTileAsync(void *apA, void *apASingle, void *apPanel, void *apB,
+                                                   const int &aBand, void *apSequence, void *apRequest);
+
+        /**
+         * @brief Submits the solve of op( A )*X = alpha*B, or X*op( A ) = alpha*B, without waiting for it.
+         * @param[in] aSide Specifies whether op(A) appears on the left or on the right of X.
+         * @param[in] aUpperLower Specifies whether the matrix A is upper triangular or lower triangular.
+         * @param[in] aTrans Specifies the form of op( A ) to be used in the matrix multiplication.
+         * @param[in] aDiag Specifies whether or not A is unit triangular.
+         * @param[in] aAlpha Specifies the scalar alpha.
+         * @param[in] apA Pointer to the triangular matrix descriptor.
+         * @param[in,out] apB Pointer to the right hand side descriptor, overwritten by the solution.
+         * @param[in] apSequence The sequence structure to associate the tasks with.
+         * @param[in] apRequest The request structure to associate the tasks with.
+         * @return void
+         *
+         */
+        void ExaGeoStatTrsmTileAsync(const common::Side &aSide, const common::UpperLower &aUpperLower,
+                                     const common::Trans &aTrans, const common::Diag &aDiag, const T &aAlpha,
+                                     void *apA, void *apB, void *apSequence, void *apRequest);
+
         /**
          * @brief  Solves one of the matrix equations op( A )*X = alpha*B, or X*op( A ) = alpha*B.
          * @copydoc LinearAlgebraMethods::ExaGeoStatTrsmTile()
@@ -57,6 +125,8 @@ namespace exageostat::linearAlgebra {
         /**
          * @brief Wait for the completion of a sequence.
          * @copydoc LinearAlgebraMethods::ExaGeoStatSequenceWait()
+         * @details A sequence that failed is reset, so the next evaluations can reuse it.
+         * @throws std::runtime_error if a task failed, reporting a factorization of a matrix that is not positive definite.
          *
          */
         void
@@ -50,6 +50,14 @@ namespace exageostat::linearAlgebra::dense {
         ExaGeoStatPotrfTile(const common::UpperLower &aUpperLower, void *apA, int aBand, void *apCD, void *apCrk,
                             const int &aMaxRank, const int &aAcc) override;
 
+        /**
+         * @brief Submits the Cholesky factorization of a symmetric positive definite matrix, without waiting for it.
+         * @copydoc ChameleonImplementation::ExaGeoStatPotrfTileAsync()
+         *
+         */
+        void ExaGeoStatPotrfTileAsync(const common::UpperLower &aUpperLower, void *apA, const int &aBand,
+                                      void *apSequence, void *apRequest) override;
+
     };
 
     /**
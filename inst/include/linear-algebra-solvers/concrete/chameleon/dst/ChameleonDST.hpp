@@ -47,6 +47,13 @@ namespace exageostat::linearAlgebra::diagonalSuperTile {
         void ExaGeoStatPotrfTile(const common::UpperLower &aUpperLower, void *apA, int aBand, void *apCD, void *apCrk,
                                  const int &aMaxRank, const int &aAcc) override;
 
+        /**
+         * @brief Submits the Cholesky factorization of a symmetric positive definite diagonal super tile matrix, without waiting for it.
+         * @copydoc ChameleonImplementation::ExaGeoStatPotrfTileAsync()
+         */
+        void ExaGeoStatPotrfTileAsync(const common::UpperLower &aUpperLower, void *apA, const int &aBand,
+                                      void *apSequence, void *apRequest) override;
+
         /**
          * @brief Computes the parallel Cholesky factorization of a symmetric positive definite diagonal super tile matrix.
          * @param[in] aUpperLower Whether upper or lower part of the matrix A
@@ -0,0 +1,99 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ChameleonVecchia.hpp
+ * @brief This file contains the declaration of ChameleonVecchia class.
+ * @details ChameleonVecchia is a concrete implementation of LinearAlgebraMethods class for the Vecchia approximation of the likelihood.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_CHAMELEONVECCHIA_HPP
+#define EXAGEOSTATCPP_CHAMELEONVECCHIA_HPP
+
+#include <linear-algebra-solvers/concrete/chameleon/dense/ChameleonDense.hpp>
+
+namespace exageostat::linearAlgebra::vecchia {
+
+    /**
+     * @brief ChameleonVecchia approximates the likelihood by conditioning every location on its nearest previous
+     * locations only.
+     * @details The locations are ordered along a space-filling curve, then the log-likelihood is the sum of the
+     * conditional log densities of the locations given their conditioning neighbors. Each one needs the Cholesky
+     * factorization of a covariance matrix of at most (m + 1) x (m + 1), so an evaluation costs O(N m^3) operations and
+     * O(N m) memory. The other operations of the solver are the dense ones.
+     * @tparam T Data Type: float or double
+     *
+     */
+    template<typename T>
+    class ChameleonVecchia : public dense::ChameleonDense<T> {
+
+    public:
+
+        /**
+         * @brief Default constructor.
+         */
+        explicit ChameleonVecchia() = default;
+
+        /**
+         * @brief Virtual destructor to allow calls to the correct concrete destructor.
+         */
+        ~ChameleonVecchia() override = default;
+
+        /**
+         * @brief Calculates the Vecchia approximation of the log likelihood value of a given value theta.
+         * @copydoc LinearAlgebraMethods::ExaGeoStatMLETile()
+         * @details The ordering and the conditioning neighbors are computed by the first evaluation, and reused by the
+         * next evaluations of the same data.
+         * @throws std::domain_error if the kernel is not univariate, or is non-Gaussian.
+         * @throws std::runtime_error if there are no measurements, or the likelihood cannot be evaluated at this theta.
+         *
+         */
+        T ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T>> &aData,
+                            configurations::Configurations &aConfigurations, const double *theta,
+                            T *apMeasurementsMatrix, const kernels::Kernel<T> &aKernel) override;
+
+        /**
+         * @brief Finds the conditioning neighbors of every location among the locations preceding it.
+         * @param[in] aLocations The ordered locations.
+         * @param[in] aN The number of locations.
+         * @param[in] aNeighborsNumber The number of neighbors m of a location.
+         * @param[in] aDistanceMetric The distance metric of the covariance, the time of space-time locations is
+         * treated as a coordinate.
+         * @param[in] aThreadsNumber The number of threads searching the neighbors.
+         * @return The m nearest previous locations of every location, sorted by distance and padded with -1 for the
+         * first locations.
+         * @throws std::runtime_error if the Great Circle distance is used with 3D or space-time locations.
+         *
+         */
+        static std::vector<int>
+        FindNeighbors(dataunits::Locations<T> &aLocations, const int &aN, const int &aNeighborsNumber,
+                      const common::DistanceMetric &aDistanceMetric, const int &aThreadsNumber);
+
+    private:
+        //// Locations of the fit, used to detect new data.
+        dataunits::Locations<T> *mpSourceLocations = nullptr;
+        //// Number of neighbors the conditioning sets were computed with.
+        int mNeighborsNumber = 0;
+        //// Locations in the order of the conditioning.
+        std::unique_ptr<dataunits::Locations<T>> mpOrderedLocations;
+        //// Measurements in the order of the conditioning.
+        std::vector<T> mOrderedZ;
+        //// Conditioning neighbors of the ordered locations.
+        std::vector<int> mNeighbors;
+    };
+
+    /**
+    * @brief Instantiates the chameleon Vecchia class for float and double types.
+    * @tparam T Data Type: float or double
+    *
+    */
+    EXAGEOSTAT_INSTANTIATE_CLASS(ChameleonVecchia)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_CHAMELEONVECCHIA_HPP
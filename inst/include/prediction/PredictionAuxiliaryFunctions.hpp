@@ -12,6 +12,7 @@
  * @date 2023-06-08
 **/
 
+#include <configurations/Configurations.hpp>
 #include <data-units/Locations.hpp>
 
 #ifndef EXAGEOSTATCPP_PREDICTION_AUXILIARY_FUNCTIONS_HPP
@@ -31,7 +32,11 @@ namespace exageostat::prediction {
         /**
          * @brief  implements the Inverse Distance Weighting (IDW) interpolation method
          * for predicting missing values based on available observed values.
-         * @param[in] apZMiss Pointer to the missed measurements.
+         * @details The missing values are predicted in parallel, with the prediction errors accumulated in the same
+         * pass. With a number of neighbors or a radius, only the nearest observed locations found through a k-d tree
+         * are weighted, otherwise all of them are. A missing location that coincides with observed locations takes the
+         * mean of their values.
+         * @param[out] apZMiss Pointer to the missed measurements.
          * @param[in] apZActual Pointer to the actual measurements.
          * @param[in] apZObs Pointer to the observed measurements.
          * @param[in] aZMissNumber Number of missed measurements.
@@ -39,12 +44,15 @@ namespace exageostat::prediction {
          * @param[in] aMissLocation Reference to the missed locations.
          * @param[in] aObsLocation Reference to the observed locations.
          * @param[out] apMSPE Pointer to be filled with MSPE value.
+         * @param[in] aConfigurations Reference to the configurations, giving the number of neighbors, the radius, the
+         * power, the distance metric and the number of threads.
          * @return T Array provides insight into the accuracy of the IDW-interpolated predictions for missing values
          *
          */
         static void PredictIDW(T *apZMiss, T *apZActual, T *apZObs, const int &aZMissNumber, const int &aZObsNumber,
                                exageostat::dataunits::Locations<T> &aMissLocation,
-                               exageostat::dataunits::Locations<T> &aObsLocation, T *apMSPE);
+                               exageostat::dataunits::Locations<T> &aObsLocation, T *apMSPE,
+                               configurations::Configurations &aConfigurations);
 
     };
 
@@ -93,15 +93,17 @@ namespace exageostat::prediction {
         static void SortArray(uint32_t *aData, int aCount);
 
         /**
-         *@brief Sorts location data and corresponding observation values in-place based on Locations coordinates.
+         *@brief Sorts location data and corresponding observation values in-place along a space-filling curve.
          *
          * @param[in] aN Number of data points (input).
-         * @param[in,out] aLocations Reference to the Locations object containing X and Y coordinates (input/output).
-         * @param[in,out] apZ Pointer to the array containing observation values (input/output).
+         * @param[in,out] aLocations Reference to the Locations object containing the coordinates (input/output).
+         * @param[in,out] apZ Pointer to the array containing observation values, can be nullptr (input/output).
+         * @param[in] aOrdering The curve to sort along, the points are left untouched unless it is morton or hilbert.
          * @return 0 if the sorting is successful.
          *
          */
-        static int SortInplace(int aN, exageostat::dataunits::Locations<T> &aLocations, T *apZ);
+        static int SortInplace(int aN, exageostat::dataunits::Locations<T> &aLocations, T *apZ,
+                               const common::Ordering &aOrdering);
 
     };
 
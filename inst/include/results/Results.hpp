@@ -135,6 +135,13 @@ namespace exageostat::results {
         */
         [[nodiscard]] double GetMMOM() const;
 
+        /**
+         * @brief Get the largest relative standard error of the stochastic trace estimates.
+         * @return The relative standard error of the Hutchinson estimates, or -1 if no trace was estimated.
+         *
+         */
+        [[nodiscard]] double GetTraceEstimatorStandardError() const;
+
         /**
          * @brief Get the Fisher matrix elements.
          * @return the Fisher matrix.
@@ -149,6 +156,13 @@ namespace exageostat::results {
          */
         [[nodiscard]] std::vector<double> GetPredictedMissedValues() const;
 
+        /**
+         * @brief Get the kriging variances of the predicted Z missed elements.
+         * @return the prediction variances, in the order of the predicted values.
+         *
+         */
+        [[nodiscard]] std::vector<double> GetPredictedVariances() const;
+
         /**
          * @brief Set the total modeling FLOPs.
          * @param[in] aTime The total number of FLOPs for data modeling.
@@ -282,6 +296,27 @@ namespace exageostat::results {
          */
         void SetPredictedMissedValues(std::vector<double> aPredictedValues);
 
+        /**
+         * @brief Set the kriging variances of the predicted Z missed elements.
+         * @param aPredictedVariances Prediction variances, in the order of the predicted values.
+         *
+         */
+        void SetPredictedVariances(std::vector<double> aPredictedVariances);
+
+        /**
+         * @brief Set the relative deviation of the mixed-precision log-likelihood from the double-precision one.
+         * @param[in] aDeviation The relative log-likelihood deviation.
+         *
+         */
+        void SetMixedPrecisionDeviation(double aDeviation);
+
+        /**
+         * @brief Set the largest relative standard error of the stochastic trace estimates.
+         * @param[in] aStandardError The relative standard error of the Hutchinson estimates.
+         *
+         */
+        void SetTraceEstimatorStandardError(double aStandardError);
+
         /**
          * @brief Print the end summary of the results.
          *
@@ -345,6 +380,12 @@ namespace exageostat::results {
         std::vector<double> mFisherMatrix;
         /// Z miss values
         std::vector<double> mPredictedMissedValues;
+        /// Z miss kriging variances
+        std::vector<double> mPredictedVariances;
+        /// Used mixed-precision log-likelihood deviation, negative when not measured.
+        double mMixedPrecisionDeviation = -1;
+        /// Used stochastic trace estimator relative standard error, negative when not estimated.
+        double mTraceEstimatorStandardError = -1;
     };
 
 }//namespace exageostat
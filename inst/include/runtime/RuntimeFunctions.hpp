@@ -50,6 +50,88 @@ namespace exageostat::runtime {
                          dataunits::Locations<T> *apLocation3, T *apLocalTheta, const int &aDistanceMetric,
                          const kernels::Kernel<T> *apKernel);
 
+        /**
+         * @brief Computes the covariance matrix from a descriptor of cached distances.
+         * @param[in] aDescriptorData pointer to the DescriptorData object holding descriptors and data.
+         * @param[out] apDescriptor Pointer to the descriptor for the covariance matrix.
+         * @param[in] apDistanceDescriptor Pointer to the descriptor of the cached distances, with the same tiling.
+         * @param[in] aTriangularPart Specifies whether the upper or lower triangular part of the covariance matrix is stored.
+         * @param[in] apLocation1 Pointer to the first set of locations.
+         * @param[in] apLocation2 Pointer to the second set of locations.
+         * @param[in] apLocalTheta Pointer to the local theta values.
+         * @param[in] aDistanceMetric Specifies the distance metric the distances were computed with.
+         * @param[in] apKernel Pointer to the isotropic kernel object to use.
+         * @return void
+         *
+         */
+        static void
+        CovarianceMatrix(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptor, void *apDistanceDescriptor,
+                         const int &aTriangularPart, dataunits::Locations<T> *apLocation1,
+                         dataunits::Locations<T> *apLocation2, T *apLocalTheta, const int &aDistanceMetric,
+                         const kernels::Kernel<T> *apKernel);
+
+        /**
+         * @brief Computes the lower triangular part of a covariance matrix split between two precisions.
+         * @details The tiles within aBand tile diagonals of the main diagonal are generated into apDescriptor, the
+         * others are generated tile by tile in the precision of T and stored straight into apSingleDescriptor.
+         * @param[in] aDescriptorData pointer to the DescriptorData object holding descriptors and data.
+         * @param[out] apDescriptor Pointer to the descriptor of the tiles near the diagonal.
+         * @param[out] apSingleDescriptor Pointer to the single precision descriptor of the other tiles, with the same tiling.
+         * @param[in] apDistanceDescriptor Pointer to the descriptor of the cached distances, or nullptr to compute them.
+         * @param[in] aBand The number of tile diagonals kept in apDescriptor, at least one.
+         * @param[in] apLocation1 Pointer to the first set of locations.
+         * @param[in] apLocation2 Pointer to the second set of locations.
+         * @param[in] apLocation3 Pointer to the third set of locations.
+         * @param[in] apLocalTheta Pointer to the local theta values.
+         * @param[in] aDistanceMetric Specifies the distance metric to use.
+         * @param[in] apKernel Pointer to the kernel object to use.
+         * @return void
+         *
+         */
+        static void
+        MixedPrecisionCovarianceMatrix(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptor,
+                                       void *apSingleDescriptor, void *apDistanceDescriptor, const int &aBand,
+                                       dataunits::Locations<T> *apLocation1, dataunits::Locations<T> *apLocation2,
+                                       dataunits::Locations<T> *apLocation3, T *apLocalTheta,
+                                       const int &aDistanceMetric, const kernels::Kernel<T> *apKernel);
+
+        /**
+         * @brief Multiplies a covariance matrix by a block of vectors without storing the covariance matrix.
+         * @details Each tile of the covariance matrix is generated by the kernel inside the task that uses it.
+         * @param[in] aDescriptorData pointer to the DescriptorData object holding descriptors and data.
+         * @param[in] apDescriptorX Pointer to the descriptor for the block of vectors.
+         * @param[out] apDescriptorY Pointer to the descriptor for the product, with the same tiling as apDescriptorX.
+         * @param[in] apLocation1 Pointer to the first set of locations.
+         * @param[in] apLocation2 Pointer to the second set of locations.
+         * @param[in] apLocation3 Pointer to the third set of locations.
+         * @param[in] apLocalTheta Pointer to the local theta values.
+         * @param[in] aDistanceMetric Specifies the distance metric to use.
+         * @param[in] apKernel Pointer to the kernel object to use.
+         * @return void
+         *
+         */
+        static void
+        CovarianceMatrixProduct(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptorX,
+                                void *apDescriptorY, dataunits::Locations<T> *apLocation1,
+                                dataunits::Locations<T> *apLocation2, dataunits::Locations<T> *apLocation3,
+                                T *apLocalTheta, const int &aDistanceMetric, const kernels::Kernel<T> *apKernel);
+
+        /**
+         * @brief Computes the pairwise distances matrix of two sets of locations.
+         * @param[in] aDescriptorData pointer to the DescriptorData object holding descriptors and data.
+         * @param[out] apDescriptor Pointer to the descriptor for the distances matrix.
+         * @param[in] aTriangularPart Specifies whether the upper or lower triangular part of the matrix is stored.
+         * @param[in] apLocation1 Pointer to the first set of locations.
+         * @param[in] apLocation2 Pointer to the second set of locations.
+         * @param[in] aDistanceMetric Specifies the distance metric to use.
+         * @return void
+         *
+         */
+        static void
+        DistanceMatrix(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptor, const int &aTriangularPart,
+                       dataunits::Locations<T> *apLocation1, dataunits::Locations<T> *apLocation2,
+                       const int &aDistanceMetric);
+
         /**
          * @brief Perform an asynchronous computation of MLE, MLOE, and MMOM for a tile.
          * @details his function performs the computation of Maximum Likelihood Estimation (MLE),
@@ -60,14 +142,34 @@ namespace exageostat::runtime {
          * @param[in] apDescExpr4 Descriptor for expression 4.
          * @param[in] apDescMLOE Descriptor for MLOE.
          * @param[in] apDescMMOM Descriptor for MMOM.
+         * @param[in] aVariablesNumber Number of variables, every block of aVariablesNumber columns of the expressions belongs to one location.
          * @param[in] apSequence Sequence for the computation.
          * @param[in] apRequest Request for the computation.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order, for reproducible results.
          * @return void
          *
          */
         static void
         ExaGeoStatMLETileAsyncMLOEMMOM(void *apDescExpr2, void *apDescExpr3, void *apDescExpr4, void *apDescMLOE,
-                                       void *apDescMMOM, void *apSequence, void *apRequest);
+                                       void *apDescMMOM, const int &aVariablesNumber, void *apSequence,
+                                       void *apRequest, const bool &aIsDeterministic);
+
+        /**
+         * @brief Computes the diagonal blocks of A^T * B, for matrices made of consecutive blocks of columns.
+         * @details Column block j of the result holds the product of column block j of A and column block j of B,
+         * which batches the small products of many right hand sides in one tile-parallel operation.
+         * @param[in] apDescA Descriptor for the N-by-(M*aBlockSize) matrix A.
+         * @param[in] apDescB Descriptor for the N-by-(M*aBlockSize) matrix B, with the same tiling as A.
+         * @param[out] apDescC Descriptor for the aBlockSize-by-(M*aBlockSize) blocks.
+         * @param[in] aBlockSize Number of columns of a block, the tile size must be a multiple of it.
+         * @param[in] apSequence Sequence for the computation.
+         * @param[in] apRequest Request for the computation.
+         * @return void
+         *
+         */
+        static void
+        ExaGeoStatBlockCrossProductTileAsync(void *apDescA, void *apDescB, void *apDescC, const int &aBlockSize,
+                                             void *apSequence, void *apRequest);
 
         /**
         * @brief Calculate mean square prediction error (MSPE) scalar value of the prediction.
@@ -76,12 +178,13 @@ namespace exageostat::runtime {
         * @param[out] apDescError Mean Square Prediction Error (MSPE).
         * @param[in] apSequence Identifies the sequence of function calls that this call belongs to.
         * @param[out] apRequest Identifies this function call (for exception handling purposes).
+        * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order, for reproducible results.
         * @return void
         *
         */
         static void
         ExaGeoStatMLEMSPETileAsync(void *apDescZPredict, void *apDescZMiss, void *apDescError, void *apSequence,
-                                   void *apRequest);
+                                   void *apRequest, const bool &aIsDeterministic);
 
         /**
          * @brief Copies the descriptor data to a double vector.
@@ -95,6 +198,17 @@ namespace exageostat::runtime {
         static void
         CopyDescriptorZ(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptor, T *apDoubleVector);
 
+        /**
+         * @brief Fills a descriptor with standard normal values of the counter-based generator, one task per tile.
+         * @param[in] aDescriptorData pointer to the DescriptorData object holding descriptors and data.
+         * @param[out] apDescriptor Pointer to the descriptor to fill.
+         * @param[in] aSeed The seed of the generator.
+         * @return void
+         *
+         */
+        static void
+        GenerateNormalDescriptor(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptor, const int &aSeed);
+
         /**
         * @brief Converts a Gaussian descriptor to a non-tiled descriptor.
         * @param[in] aDescriptorData DescriptorData struct with the Gaussian descriptor.
@@ -141,12 +255,13 @@ namespace exageostat::runtime {
          * @param[in] apSequence Identifies the sequence of function calls that this call belongs to.
          * @param[in] apRequest Identifies this function call (for exception handling purposes).
          * @param[in] apDescDet determinant value
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order, for reproducible results.
          * @return void
          *
          */
         static void
         ExaGeoStatMeasureDetTileAsync(const common::Computation &aComputation, void *apDescA, void *apSequence,
-                                      void *apRequest, void *apDescDet);
+                                      void *apRequest, void *apDescDet, const bool &aIsDeterministic);
 
         /**
         * @brief Calculate determinant for triangular matrix.
@@ -155,11 +270,60 @@ namespace exageostat::runtime {
         * @param[in] apRequest Pointer to a request structure for tracking the operation's status.
         * @param[out] apDescNum Pointer to the descriptor of the matrix to store the sum of elements.
         * @param[out] apDescTrace Pointer to the descriptor of the matrix to store the trace.
+        * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order, for reproducible results.
         * @return void
         *
         */
         static void ExaGeoStatMLETraceTileAsync(void *apDescA, void *apSequence, void *apRequest, void *apDescNum,
-                                                void *apDescTrace);
+                                                void *apDescTrace, const bool &aIsDeterministic);
+
+        /**
+        * @brief Calculate the terms of the Vecchia log-likelihood, from the conditional density of every location
+        * given its conditioning neighbors.
+        * @details The sum of the logarithms of the conditional standard deviations is accumulated into apDescDet, and
+        * the sum of the squared standardized residuals into apDescProduct.
+        * @param[in] aN The number of locations.
+        * @param[in] aNeighborsNumber The maximum number of conditioning neighbors of a location.
+        * @param[in] apNeighbors The aNeighborsNumber neighbors of every location, padded with -1.
+        * @param[in] apLocations Pointer to the ordered locations.
+        * @param[in] apMedianLocations Pointer to the median locations, used by the non-stationary kernels.
+        * @param[in] apZ Pointer to the measurements of the ordered locations.
+        * @param[in] apLocalTheta Pointer to the local theta value.
+        * @param[in] aDistanceMetric Distance metric to be used (0 = Euclidean, 1 = Great Circle).
+        * @param[in] apKernel Pointer to the univariate kernel.
+        * @param[in] aBlockSize The number of locations evaluated by a task.
+        * @param[in,out] apDescDet Pointer to the descriptor of the log determinant.
+        * @param[in,out] apDescProduct Pointer to the descriptor of the product.
+        * @param[in] apSequence Pointer to a sequence structure for managing asynchronous execution.
+        * @param[in] apRequest Pointer to a request structure for tracking the operation's status.
+        * @param[in] aIsDeterministic Whether the block contributions are reduced in a fixed order, for reproducible results.
+        * @return void
+        *
+        */
+        static void
+        ExaGeoStatVecchiaLogLikelihoodTileAsync(const int &aN, const int &aNeighborsNumber, const int *apNeighbors,
+                                                dataunits::Locations<T> *apLocations,
+                                                dataunits::Locations<T> *apMedianLocations, T *apZ, T *apLocalTheta,
+                                                const int &aDistanceMetric, const kernels::Kernel<T> *apKernel,
+                                                const int &aBlockSize, void *apDescDet, void *apDescProduct,
+                                                void *apSequence, void *apRequest, const bool &aIsDeterministic);
+
+        /**
+        * @brief Calculate the Frobenius inner product trace(A * B) of two symmetric matrices.
+        * @details The product is the sum of the element-wise (Hadamard) product of the matrices, so it is reduced
+        * tile by tile without forming A * B. Only the lower triangular tiles of the matrices are read.
+        * @param[in] apDescA Pointer to the descriptor of the first symmetric matrix.
+        * @param[in] apDescB Pointer to the descriptor of the second symmetric matrix, with the same tiling.
+        * @param[in,out] apDescProduct Pointer to the descriptor of the scalar the product is accumulated into.
+        * @param[in] apSequence Pointer to a sequence structure for managing asynchronous execution.
+        * @param[in] apRequest Pointer to a request structure for tracking the operation's status.
+        * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order, for reproducible results.
+        * @return void
+        *
+        */
+        static void ExaGeoStatFrobeniusProductTileAsync(void *apDescA, void *apDescB, void *apDescProduct,
+                                                        void *apSequence, void *apRequest,
+                                                        const bool &aIsDeterministic);
 
         /**
         * @brief Computes dot product of A.A.
@@ -167,10 +331,12 @@ namespace exageostat::runtime {
         * @param[out] apDescProduct Stores the result of A.A.
         * @param[in] apSequence Identifies the sequence of function calls that this call belongs to.
         * @param[in] apRequest Identifies this function call (for exception handling purposes).
+        * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order, for reproducible results.
         * @return void
         *
         */
-        static void ExaGeoStatDoubleDotProduct(void *apDescA, void *apDescProduct, void *apSequence, void *apRequest);
+        static void ExaGeoStatDoubleDotProduct(void *apDescA, void *apDescProduct, void *apSequence, void *apRequest,
+                                               const bool &aIsDeterministic);
 
         /**
          * @brief Calculate mean square error (MSE) scalar value for Bivariate kernels.
@@ -181,12 +347,14 @@ namespace exageostat::runtime {
          * @param[out] apDescError Mean Square Error (MSE).
          * @param[in] apSequence Sequence for the computation.
          * @param[in] apRequest Request for the computation.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order, for reproducible results.
          * @return void
          *
          */
         static void
         ExaGeoStatMLEMSPEBivariateTileAsync(void *apDescZPre, void *apDescZMiss, void *apDescError1, void *apDescError2,
-                                            void *apDescError, void *apSequence, void *apRequest);
+                                            void *apDescError, void *apSequence, void *apRequest,
+                                            const bool &aIsDeterministic);
 
         /**
          * @brief Calculate the log likelihood of non-Gaussian MLE.
@@ -196,12 +364,14 @@ namespace exageostat::runtime {
          * @param[in] apTheta Pointer to Model parameters.
          * @param[in] apSequence Identifies the sequence of function calls that this call belongs to.
          * @param[out] apRequest Identifies this function call (for exception handling purposes).
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order, for reproducible results.
          * @return void
          *
          */
         static void
         ExaGeoStatNonGaussianLogLikeTileAsync(const common::Computation &aComputation, void *apDescZ, void *apDescSum,
-                                              const T *apTheta, void *apSequence, void *apRequest);
+                                              const T *apTheta, void *apSequence, void *apRequest,
+                                              const bool &aIsDeterministic);
 
         /**
         * @brief Transform the measurements vector inside the non-Gaussian MLE function.
@@ -216,6 +386,22 @@ namespace exageostat::runtime {
         static void
         ExaGeoStatNonGaussianTransformTileAsync(const common::Computation &aComputation, void *apDescZ,
                                                 const T *apTheta, void *apSequence, void *apRequest);
+
+        /**
+        * @brief Maps the Gaussian conditional means of the missing locations to the non-Gaussian predictions.
+        * @param[in] aComputation computation used in configuration.
+        * @param[in,out] apDescZMiss pointer to the conditional means descriptor, overwritten by the predictions.
+        * @param[in] apDescExplainedVariance pointer to the 1-by-M descriptor of the variances explained by the observations.
+        * @param[in] apTheta Pointer to Model parameters.
+        * @param[in] apSequence Identifies the sequence of function calls that this call belongs to.
+        * @param[in] apRequest Identifies this function call (for exception handling purposes).
+        * @return void
+        *
+        */
+        static void
+        ExaGeoStatNonGaussianPredictTileAsync(const common::Computation &aComputation, void *apDescZMiss,
+                                              void *apDescExplainedVariance, const T *apTheta, void *apSequence,
+                                              void *apRequest);
     };
 
     /**
@@ -12,15 +12,23 @@
 **/
 
 #include <runtime/starpu/concrete/dcmg-codelet.hpp>
+#include <runtime/starpu/concrete/dcmm-codelet.hpp>
+#include <runtime/starpu/concrete/dcross-codelet.hpp>
+#include <runtime/starpu/concrete/ddist-codelet.hpp>
 #include <runtime/starpu/concrete/ddotp-codelet.hpp>
+#include <runtime/starpu/concrete/dfrobenius-codelet.hpp>
 #include <runtime/starpu/concrete/dmdet-codelet.hpp>
 #include <runtime/starpu/concrete/dmloe-mmom-codelet.hpp>
 #include <runtime/starpu/concrete/dmse-bivariate-codelet.hpp>
 #include <runtime/starpu/concrete/dmse-codelet.hpp>
+#include <runtime/starpu/concrete/dnormal-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
 #include <runtime/starpu/concrete/dtrace-codelet.hpp>
+#include <runtime/starpu/concrete/dvecchia-codelet.hpp>
 #include <runtime/starpu/concrete/dzcpy-codelet.hpp>
 #include <runtime/starpu/concrete/gaussian-to-non-codelet.hpp>
 #include <runtime/starpu/concrete/non-gaussian-loglike-codelet.hpp>
+#include <runtime/starpu/concrete/non-gaussian-predict-codelet.hpp>
 #include <runtime/starpu/concrete/non-gaussian-transform-codelet.hpp>
 #include <runtime/starpu/concrete/stride-vec-codelet.hpp>
 #include <runtime/starpu/concrete/tri-stride-vec-codelet.hpp>
@@ -60,6 +60,46 @@ namespace exageostat::runtime {
                         dataunits::Locations<T> *apLocation2, dataunits::Locations<T> *apLocation3, T *apLocalTheta,
                         const int &aDistanceMetric, const kernels::Kernel<T> *apKernel);
 
+        /**
+         * @brief Inserts a task for DCMG codelet processing, reading the distances from a cached distance descriptor.
+         * @param[in,out] apDescriptor A pointer to the descriptor containing task information.
+         * @param[in] apDistanceDescriptor A pointer to the descriptor of the cached distances, with the same tiling as apDescriptor.
+         * @param[in] aTriangularPart An integer specifying the triangular part of the matrix (upper or lower).
+         * @param[in] apLocation1 A pointer to the first location object for the matrix elements.
+         * @param[in] apLocation2 A pointer to the second location object for the matrix elements.
+         * @param[in] apLocalTheta A pointer to the local theta value.
+         * @param[in] aDistanceMetric An integer specifying the distance metric to be used.
+         * @param[in] apKernel A pointer to the isotropic kernel function to be applied during the task execution.
+         * @return void
+         *
+         */
+        void InsertTask(void *apDescriptor, void *apDistanceDescriptor, const int &aTriangularPart,
+                        dataunits::Locations<T> *apLocation1, dataunits::Locations<T> *apLocation2, T *apLocalTheta,
+                        const int &aDistanceMetric, const kernels::Kernel<T> *apKernel);
+
+        /**
+         * @brief Inserts the tasks generating the lower triangular part of a matrix split between two precisions.
+         * @details The tiles within aBand tile diagonals of the main diagonal go to apDescriptor, the others are
+         * rounded into the single precision apSingleDescriptor as they are generated.
+         * @param[in,out] apDescriptor A pointer to the descriptor of the tiles near the diagonal.
+         * @param[in,out] apSingleDescriptor A pointer to the single precision descriptor of the other tiles.
+         * @param[in] apDistanceDescriptor A pointer to the descriptor of the cached distances, or nullptr to compute them.
+         * @param[in] aBand The number of tile diagonals kept in apDescriptor, at least one.
+         * @param[in] apLocation1 A pointer to the first location object for the matrix elements.
+         * @param[in] apLocation2 A pointer to the second location object for the matrix elements.
+         * @param[in] apLocation3 A pointer to the third location object for the matrix elements.
+         * @param[in] apLocalTheta A pointer to the local theta value.
+         * @param[in] aDistanceMetric An integer specifying the distance metric to be used.
+         * @param[in] apKernel A pointer to the kernel function to be applied during the task execution.
+         * @return void
+         *
+         */
+        void InsertMixedPrecisionTask(void *apDescriptor, void *apSingleDescriptor, void *apDistanceDescriptor,
+                                      const int &aBand, dataunits::Locations<T> *apLocation1,
+                                      dataunits::Locations<T> *apLocation2, dataunits::Locations<T> *apLocation3,
+                                      T *apLocalTheta, const int &aDistanceMetric,
+                                      const kernels::Kernel<T> *apKernel);
+
     private:
 
         /**
@@ -71,8 +111,44 @@ namespace exageostat::runtime {
          */
         static void cl_dcmg_function(void **apBuffers, void *apCodeletArguments);
 
+        /**
+         * @brief CPU Function used by the cached distances starpu_codelet struct
+         * @param[in] apBuffers An array of pointers to the buffers containing the matrix and distance data.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure
+         * @return void
+         *
+         */
+        static void cl_dcmg_distances_function(void **apBuffers, void *apCodeletArguments);
+
+        /**
+         * @brief CPU Function used by the single precision starpu_codelet struct
+         * @param[in] apBuffers An array of pointers to the buffers containing the single precision matrix data.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure
+         * @return void
+         *
+         */
+        static void cl_dcmg_single_function(void **apBuffers, void *apCodeletArguments);
+
+        /**
+         * @brief CPU Function used by the single precision starpu_codelet struct using cached distances
+         * @param[in] apBuffers An array of pointers to the buffers containing the single precision matrix and distance data.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure
+         * @return void
+         *
+         */
+        static void cl_dcmg_single_distances_function(void **apBuffers, void *apCodeletArguments);
+
         /// starpu_codelet struct
         static struct starpu_codelet cl_dcmg;
+
+        /// starpu_codelet struct using cached distances
+        static struct starpu_codelet cl_dcmg_distances;
+
+        /// starpu_codelet struct storing the tiles in single precision
+        static struct starpu_codelet cl_dcmg_single;
+
+        /// starpu_codelet struct storing the tiles in single precision, using cached distances
+        static struct starpu_codelet cl_dcmg_single_distances;
     };
 
     /**
@@ -0,0 +1,89 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dcmm-codelet.hpp
+ * @brief A class for starpu codelet dcmm.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_DCMM_CODELET_HPP
+#define EXAGEOSTATCPP_DCMM_CODELET_HPP
+
+#include <kernels/Kernel.hpp>
+
+namespace exageostat::runtime {
+
+    /**
+     * @class DCMM Codelet
+     * @brief A class for starpu codelet dcmm.
+     * @tparam T Data Type: float or double
+     * @details This class encapsulates the struct cl_dcmm and its CPU functions.
+     * It multiplies a covariance matrix by a block of vectors, Y = C * X, generating each tile of C in a task workspace
+     * instead of storing the matrix.
+     *
+     */
+    template<typename T>
+    class DCMMCodelet {
+
+    public:
+
+        /**
+         * @brief Default constructor
+         *
+         */
+        DCMMCodelet() = default;
+
+        /**
+         * @brief Default destructor
+         *
+         */
+        ~DCMMCodelet() = default;
+
+        /**
+         * @brief Inserts a task for DCMM codelet processing.
+         * @param[in] apDescX A pointer to the descriptor for the block of vectors.
+         * @param[out] apDescY A pointer to the descriptor for the product, with the same tiling as apDescX.
+         * @param[in] apLocation1 A pointer to the first location object for the matrix elements.
+         * @param[in] apLocation2 A pointer to the second location object for the matrix elements.
+         * @param[in] apLocation3 A pointer to the third location object for the matrix elements.
+         * @param[in] apLocalTheta A pointer to the local theta value.
+         * @param[in] aDistanceMetric An integer specifying the distance metric to be used.
+         * @param[in] apKernel A pointer to the kernel function generating the covariance tiles.
+         * @return void
+         *
+         */
+        void InsertTask(void *apDescX, void *apDescY, dataunits::Locations<T> *apLocation1,
+                        dataunits::Locations<T> *apLocation2, dataunits::Locations<T> *apLocation3, T *apLocalTheta,
+                        const int &aDistanceMetric, const kernels::Kernel<T> *apKernel);
+
+    private:
+
+        /**
+         * @brief Executes the DCMM codelet function, which adds the product of one generated covariance tile.
+         * @param[in] apBuffers An array of pointers to the buffers.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure, which includes the tile dimensions and offsets, whether the output is overwritten, and the kernel inputs.
+         * @return void
+         *
+         */
+        static void cl_dcmm_function(void **apBuffers, void *apCodeletArguments);
+
+        /// starpu_codelet struct
+        static struct starpu_codelet cl_dcmm;
+
+    };
+
+    /**
+     * @brief Instantiates the dcmm codelet class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(DCMMCodelet)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_DCMM_CODELET_HPP
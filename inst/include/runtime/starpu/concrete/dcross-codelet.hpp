@@ -0,0 +1,83 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dcross-codelet.hpp
+ * @brief A class for starpu codelet dcross.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_DCROSS_CODELET_HPP
+#define EXAGEOSTATCPP_DCROSS_CODELET_HPP
+
+#include <common/Definitions.hpp>
+
+namespace exageostat::runtime {
+
+    /**
+     * @class DCROSS Codelet
+     * @brief A class for starpu codelet dcross.
+     * @tparam T Data Type: float or double
+     * @details This class encapsulates the struct cl_dcross and its CPU functions.
+     * Given two N-by-(M*P) matrices A and B, made of M consecutive blocks of P columns each, it computes the M
+     * diagonal P-by-P blocks of A^T * B and stores them side by side in a P-by-(M*P) matrix C.
+     *
+     */
+    template<typename T>
+    class DCROSSCodelet {
+
+    public:
+
+        /**
+         * @brief Default constructor
+         *
+         */
+        DCROSSCodelet() = default;
+
+        /**
+         * @brief Default destructor
+         *
+         */
+        ~DCROSSCodelet() = default;
+
+        /**
+         * @brief Inserts a task for DCROSS codelet processing.
+         * @param[in] apDescA A pointer to the descriptor for the first matrix.
+         * @param[in] apDescB A pointer to the descriptor for the second matrix, with the same tiling as apDescA.
+         * @param[out] apDescC A pointer to the descriptor for the diagonal blocks of the product.
+         * @param[in] aBlockSize The number of columns of a block, the tile size must be a multiple of it.
+         * @return void
+         *
+         */
+        void InsertTask(void *apDescA, void *apDescB, void *apDescC, const int &aBlockSize);
+
+    private:
+
+        /**
+         * @brief Executes the DCROSS codelet function, which adds the contribution of one tile row to the blocks.
+         * @param[in] apBuffers An array of pointers to the buffers.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure, which includes the tile dimensions, the block size and whether the output is overwritten.
+         * @return void
+         *
+         */
+        static void cl_dcross_function(void **apBuffers, void *apCodeletArguments);
+
+        /// starpu_codelet struct
+        static struct starpu_codelet cl_dcross;
+
+    };
+
+    /**
+     * @brief Instantiates the dcross codelet class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(DCROSSCodelet)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_DCROSS_CODELET_HPP
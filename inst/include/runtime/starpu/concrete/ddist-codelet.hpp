@@ -0,0 +1,83 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ddist-codelet.hpp
+ * @brief A class for starpu codelet ddist.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_DDIST_CODELET_HPP
+#define EXAGEOSTATCPP_DDIST_CODELET_HPP
+
+#include <kernels/Kernel.hpp>
+
+namespace exageostat::runtime {
+
+    /**
+     * @class DDIST Codelet
+     * @brief A class for starpu codelet ddist.
+     * @tparam T Data Type: float or double
+     * @details This class encapsulates the struct cl_ddist and its CPU functions, which fill the tiles of a descriptor
+     * with the pairwise distances of two sets of locations.
+     *
+     */
+    template<typename T>
+    class DDISTCodelet {
+
+    public:
+
+        /**
+         * @brief Default constructor
+         *
+         */
+        DDISTCodelet() = default;
+
+        /**
+         * @brief Default destructor
+         *
+         */
+        ~DDISTCodelet() = default;
+
+        /**
+         * @brief Inserts a task for DDIST codelet processing.
+         * @param[out] apDescriptor A pointer to the descriptor of the distance matrix.
+         * @param[in] aTriangularPart An integer specifying the triangular part of the matrix (upper or lower).
+         * @param[in] apLocation1 A pointer to the first location object for the matrix elements.
+         * @param[in] apLocation2 A pointer to the second location object for the matrix elements.
+         * @param[in] aDistanceMetric An integer specifying the distance metric to be used.
+         * @return void
+         *
+         */
+        void InsertTask(void *apDescriptor, const int &aTriangularPart, dataunits::Locations<T> *apLocation1,
+                        dataunits::Locations<T> *apLocation2, const int &aDistanceMetric);
+
+    private:
+
+        /**
+         * @brief CPU Function used by starpu_codelet struct
+         * @param[in] apBuffers An array of pointers to the buffers containing the matrix data.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure
+         * @return void
+         *
+         */
+        static void cl_ddist_function(void **apBuffers, void *apCodeletArguments);
+
+        /// starpu_codelet struct
+        static struct starpu_codelet cl_ddist;
+    };
+
+    /**
+     * @brief Instantiates the ddist codelet class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(DDISTCodelet)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_DDIST_CODELET_HPP
@@ -47,10 +47,11 @@ namespace exageostat::runtime {
          * @brief Inserts a task for DDOTP codelet processing.
          * @param[in] apDescA A pointer to the descriptor for the vector.
          * @param[in,out] apDescProduct A pointer to the descriptor for the dot product.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order.
          * @return void
          *
          */
-        void InsertTask(void *apDescA, void *apDescProduct);
+        void InsertTask(void *apDescA, void *apDescProduct, const bool &aIsDeterministic);
 
     private:
 
@@ -0,0 +1,83 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dfrobenius-codelet.hpp
+ * @brief A class for starpu codelet dfrobenius.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_DFROBENIUS_CODELET_HPP
+#define EXAGEOSTATCPP_DFROBENIUS_CODELET_HPP
+
+#include <common/Definitions.hpp>
+
+namespace exageostat::runtime {
+
+    /**
+     * @class DFROBENIUS Codelet
+     * @brief A class for starpu codelet dfrobenius.
+     * @tparam T Data Type: float or double
+     * @details This class encapsulates the struct cl_dfrobenius and its CPU functions.
+     * It computes the Frobenius inner product sum(A o B) = trace(A^T * B) of two symmetric matrices, reading their
+     * lower triangular part only.
+     *
+     */
+    template<typename T>
+    class DFROBENIUSCodelet {
+
+    public:
+
+        /**
+         * @brief Default constructor
+         *
+         */
+        DFROBENIUSCodelet() = default;
+
+        /**
+         * @brief Default destructor
+         *
+         */
+        ~DFROBENIUSCodelet() = default;
+
+        /**
+         * @brief Inserts a task for DFROBENIUS codelet processing.
+         * @param[in] apDescA A pointer to the descriptor for the first symmetric matrix.
+         * @param[in] apDescB A pointer to the descriptor for the second symmetric matrix, with the same tiling.
+         * @param[in,out] apDescProduct A pointer to the descriptor for the product, accumulated into.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order.
+         * @return void
+         *
+         */
+        void InsertTask(void *apDescA, void *apDescB, void *apDescProduct, const bool &aIsDeterministic);
+
+    private:
+
+        /**
+         * @brief Executes the DFROBENIUS codelet function, which adds the element-wise product of two tiles.
+         * @param[in] apBuffers An array of pointers to the buffers.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure, which includes the tile dimensions and whether the tile is on the diagonal.
+         * @return void
+         *
+         */
+        static void cl_dfrobenius_function(void **apBuffers, void *apCodeletArguments);
+
+        /// starpu_codelet struct
+        static struct starpu_codelet cl_dfrobenius;
+
+    };
+
+    /**
+     * @brief Instantiates the dfrobenius codelet class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(DFROBENIUSCodelet)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_DFROBENIUS_CODELET_HPP
@@ -49,11 +49,12 @@ namespace exageostat::runtime {
          * @param[in] apDescA A pointer to the descriptor for matrix A.
          * @param[in,out] apDescDet A pointer to the descriptor for the determinant.
          * @param[in] aStarPuHelpers A reference to a unique pointer of StarPuHelpers, used for accessing and managing data.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order.
          * @return void
          *
          */
         void InsertTask(const common::Computation &aComputation, void *apDescA, void *apDescDet,
-                        std::unique_ptr<StarPuHelpers> &aStarPuHelpers);
+                        std::unique_ptr<StarPuHelpers> &aStarPuHelpers, const bool &aIsDeterministic);
 
     private:
 
@@ -50,18 +50,20 @@ namespace exageostat::runtime {
          * @param[in] apDescExpr3 A pointer to the descriptor for the third expression.
          * @param[in,out] apDescMLOE A pointer to the descriptor for the MLOE result.
          * @param[in,out] apDescMMOM A pointer to the descriptor for the MMOM result.
+         * @param[in] aBlockSize The number of columns holding the expressions of one location, the tile size must be a multiple of it.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order.
          * @return void
          *
          */
         void InsertTask(void *apDescExpr1, void *apDescExpr2, void *apDescExpr3, void *apDescMLOE,
-                        void *apDescMMOM);
+                        void *apDescMMOM, const int &aBlockSize, const bool &aIsDeterministic);
 
     private:
 
         /**
          * @brief Executes the DmloeMmom codelet function for MLOE and MMOM calculations.
          * @param[in] apBuffers An array of pointers to the buffers.
-         * @param[in] apCodeletArguments A pointer to the codelet arguments structure, which includes the matrix dimensions and offsets.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure, which includes the matrix dimensions and the block size.
          * @return void
          *
          */
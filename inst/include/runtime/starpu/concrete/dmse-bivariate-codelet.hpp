@@ -50,11 +50,13 @@ namespace exageostat::runtime {
          * @param[in,out] apDescsError A pointer to the descriptor for the total error sum.
          * @param[in,out] apDescsError1 A pointer to the descriptor for the error sum for the first variable.
          * @param[in,out] apDescsError2 A pointer to the descriptor for the error sum for the second variable.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order.
          * @return void
          *
          */
         void
-        InsertTask(void *apDescZMiss, void *apDescZPre, void *apDescsError, void *apDescsError1, void *apDescsError2);
+        InsertTask(void *apDescZMiss, void *apDescZPre, void *apDescsError, void *apDescsError1, void *apDescsError2,
+                   const bool &aIsDeterministic);
 
     private:
 
@@ -48,10 +48,11 @@ namespace exageostat::runtime {
          * @param[in,out] apDescError A pointer to the descriptor for the error sum.
          * @param[in] apDescZPredict A pointer to the descriptor for the predicted values.
          * @param[in] apDescZMiss A pointer to the descriptor for the observed values.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order.
          * @return void
          *
          */
-        void InsertTask(void *apDescError, void *apDescZPredict, void *apDescZMiss);
+        void InsertTask(void *apDescError, void *apDescZPredict, void *apDescZMiss, const bool &aIsDeterministic);
 
     private:
 
@@ -0,0 +1,80 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dnormal-codelet.hpp
+ * @brief A class for starpu codelet dnormal.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_DNORMAL_CODELET_HPP
+#define EXAGEOSTATCPP_DNORMAL_CODELET_HPP
+
+#include <common/Definitions.hpp>
+
+namespace exageostat::runtime {
+
+    /**
+     * @class DNORMAL Codelet
+     * @brief A class for starpu codelet dnormal.
+     * @tparam T Data Type: float or double
+     * @details This class encapsulates the struct cl_dnormal and its CPU functions, which fill every tile of a
+     * descriptor with its own standard normal values of the counter-based generator.
+     *
+     */
+    template<typename T>
+    class DNORMALCodelet {
+
+    public:
+
+        /**
+         * @brief Default constructor
+         *
+         */
+        DNORMALCodelet() = default;
+
+        /**
+         * @brief Default destructor
+         *
+         */
+        ~DNORMALCodelet() = default;
+
+        /**
+         * @brief Inserts a task for DNORMAL codelet processing.
+         * @param[out] apDescriptor A pointer to the descriptor to fill.
+         * @param[in] aSeed The seed of the generator.
+         * @return void
+         *
+         */
+        void InsertTask(void *apDescriptor, const int &aSeed);
+
+    private:
+
+        /**
+          * @brief Executes the DNORMAL codelet function for filling a tile with normal values.
+          * @param[in] apBuffers An array of pointers to the buffers.
+          * @param[in] apCodeletArguments A pointer to the codelet arguments structure, which includes the tile size,
+          * its offset in the descriptor and the seed.
+          * @return void
+          *
+          */
+        static void cl_dnormal_function(void **apBuffers, void *apCodeletArguments);
+
+        /// starpu_codelet struct
+        static struct starpu_codelet cl_dnormal;
+    };
+
+    /**
+     * @brief Instantiates the dnormal codelet class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(DNORMALCodelet)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_DNORMAL_CODELET_HPP
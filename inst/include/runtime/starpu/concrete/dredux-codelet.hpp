@@ -0,0 +1,116 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dredux-codelet.hpp
+ * @brief A class for the starpu reduction codelets of scalar accumulators.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_DREDUX_CODELET_HPP
+#define EXAGEOSTATCPP_DREDUX_CODELET_HPP
+
+#include <vector>
+
+#include <common/Definitions.hpp>
+
+namespace exageostat::runtime {
+
+    /**
+     * @class DREDUX Codelet
+     * @brief A class for the starpu codelets used to reduce tile contributions into an accumulator.
+     * @tparam T Data Type: float or double
+     * @details Tile tasks access the accumulator returned by GetHandle() in STARPU_REDUX mode, so they run concurrently
+     * on per-worker copies that are initialized with cl_dzero and merged with cl_dsum.
+     * In deterministic mode, every tile task gets a private accumulator instead, and InsertTask() merges them into the
+     * original one through a fixed binary tree, which makes the result independent of the scheduling.
+     *
+     */
+    template<typename T>
+    class DREDUXCodelet {
+
+    public:
+
+        /**
+         * @brief Constructor, prepares the accumulator for the tile tasks.
+         * @param[in] apHandle The starpu handle of the accumulator.
+         * @param[in] aTilesNumber The number of tile tasks contributing to the accumulator.
+         * @param[in] aIsDeterministic Whether the contributions must be merged in a fixed order.
+         *
+         */
+        DREDUXCodelet(void *apHandle, const int &aTilesNumber, const bool &aIsDeterministic);
+
+        /**
+         * @brief Default destructor
+         *
+         */
+        ~DREDUXCodelet() = default;
+
+        /**
+         * @brief Gets the accumulator a tile task should access in STARPU_REDUX mode.
+         * @param[in] aTileIndex The index of the tile task.
+         * @return The starpu handle of the accumulator.
+         *
+         */
+        void *GetHandle(const int &aTileIndex);
+
+        /**
+         * @brief Inserts the tasks merging the tile contributions into the accumulator, to be called after all the tile tasks.
+         * @return void
+         *
+         */
+        void InsertTask();
+
+    private:
+
+        /**
+         * @brief Releases an accumulator acquired to trigger its reduction.
+         * @param[in] apHandle The starpu handle of the accumulator.
+         * @return void
+         *
+         */
+        static void ReleaseHandle(void *apHandle);
+
+        /**
+         * @brief Executes the DZERO codelet function, which sets a contribution to zero.
+         * @param[in] apBuffers An array of pointers to the buffers.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure, unused.
+         * @return void
+         *
+         */
+        static void cl_dzero_function(void **apBuffers, void *apCodeletArguments);
+
+        /**
+         * @brief Executes the DSUM codelet function, which adds the second buffer to the first one.
+         * @param[in] apBuffers An array of pointers to the buffers.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure, unused.
+         * @return void
+         *
+         */
+        static void cl_dsum_function(void **apBuffers, void *apCodeletArguments);
+
+        /// The starpu handle of the accumulator.
+        void *mpHandle;
+        /// Private accumulators of the tile tasks, used in deterministic mode only.
+        std::vector<void *> mPartialHandles;
+        /// starpu_codelet struct used to initialize contributions.
+        static struct starpu_codelet cl_dzero;
+        /// starpu_codelet struct used to merge contributions.
+        static struct starpu_codelet cl_dsum;
+
+    };
+
+    /**
+     * @brief Instantiates the dredux codelet class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(DREDUXCodelet)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_DREDUX_CODELET_HPP
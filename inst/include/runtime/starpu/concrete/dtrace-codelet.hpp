@@ -48,10 +48,11 @@ namespace exageostat::runtime {
          * @param[in] apDescA A pointer to the descriptor for the matrix.
          * @param[in,out] apDescNum A pointer to the descriptor for the sum.
          * @param[in,out] apDescTrace A pointer to the descriptor for the trace.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order.
          * @return void
          *
          */
-        void InsertTask(void *apDescA, void *apDescNum, void *apDescTrace);
+        void InsertTask(void *apDescA, void *apDescNum, void *apDescTrace, const bool &aIsDeterministic);
 
     private:
 
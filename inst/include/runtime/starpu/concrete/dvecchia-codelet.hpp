@@ -0,0 +1,95 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dvecchia-codelet.hpp
+ * @brief A class for starpu codelet dvecchia.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_DVECCHIA_CODELET_HPP
+#define EXAGEOSTATCPP_DVECCHIA_CODELET_HPP
+
+#include <kernels/Kernel.hpp>
+
+namespace exageostat::runtime {
+
+    /**
+     * @class DVECCHIA Codelet
+     * @brief A class for starpu codelet dvecchia.
+     * @tparam T Data Type: float or double
+     * @details This class encapsulates the struct cl_dvecchia and its CPU functions. Every task evaluates the
+     * conditional densities of a block of consecutive locations, each one given its conditioning neighbors, through a
+     * small dense covariance matrix factored in the task.
+     *
+     */
+    template<typename T>
+    class DVECCHIACodelet {
+
+    public:
+
+        /**
+         * @brief Default constructor
+         *
+         */
+        DVECCHIACodelet() = default;
+
+        /**
+         * @brief Default destructor
+         *
+         */
+        ~DVECCHIACodelet() = default;
+
+        /**
+         * @brief Inserts the tasks of the Vecchia log-likelihood, one per block of locations.
+         * @param[in] aN The number of locations.
+         * @param[in] aNeighborsNumber The maximum number of conditioning neighbors of a location.
+         * @param[in] apNeighbors The aNeighborsNumber neighbors of every location, padded with -1.
+         * @param[in] apLocations A pointer to the ordered locations.
+         * @param[in] apMedianLocations A pointer to the median locations, used by the non-stationary kernels.
+         * @param[in] apZ A pointer to the measurements of the ordered locations.
+         * @param[in] apLocalTheta A pointer to the local theta value.
+         * @param[in] aDistanceMetric An integer specifying the distance metric to be used.
+         * @param[in] apKernel A pointer to the kernel function generating the covariance of the neighbors.
+         * @param[in] aBlockSize The number of locations of a task.
+         * @param[in,out] apDescDet A pointer to the descriptor accumulating the log determinant of the Cholesky factors.
+         * @param[in,out] apDescProduct A pointer to the descriptor accumulating the squared standardized residuals.
+         * @param[in] aIsDeterministic Whether the block contributions are reduced in a fixed order.
+         * @return void
+         *
+         */
+        void InsertTask(const int &aN, const int &aNeighborsNumber, const int *apNeighbors,
+                        dataunits::Locations<T> *apLocations, dataunits::Locations<T> *apMedianLocations, T *apZ,
+                        T *apLocalTheta, const int &aDistanceMetric, const kernels::Kernel<T> *apKernel,
+                        const int &aBlockSize, void *apDescDet, void *apDescProduct, const bool &aIsDeterministic);
+
+    private:
+
+        /**
+         * @brief Executes the DVECCHIA codelet function.
+         * @param[in] apBuffers An array of pointers to the buffers of the determinant and the product.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure.
+         * @return void
+         *
+         */
+        static void cl_dvecchia_function(void **apBuffers, void *apCodeletArguments);
+
+        /// starpu_codelet struct
+        static struct starpu_codelet cl_dvecchia;
+
+    };
+
+    /**
+     * @brief Instantiates the dvecchia codelet class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(DVECCHIACodelet)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_DVECCHIA_CODELET_HPP
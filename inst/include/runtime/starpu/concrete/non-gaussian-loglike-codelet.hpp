@@ -49,11 +49,13 @@ namespace exageostat::runtime {
          * @param[in,out] apDescSum A pointer to the descriptor for the sum.
          * @param[in] apTheta A pointer to the transformation parameters.
          * @param[in] aStarPuHelpers A reference to a unique pointer of StarPuHelpers, used for accessing and managing data.
+         * @param[in] aIsDeterministic Whether the tile contributions are reduced in a fixed order.
          * @return void
          *
          */
         void
-        InsertTask(void *apDescZ, void *apDescSum, const T *apTheta, std::unique_ptr<StarPuHelpers> &aStarPuHelper);
+        InsertTask(void *apDescZ, void *apDescSum, const T *apTheta, std::unique_ptr<StarPuHelpers> &aStarPuHelper,
+                   const bool &aIsDeterministic);
 
     private:
 
@@ -0,0 +1,83 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file non-gaussian-predict-codelet.hpp
+ * @brief A class for starpu codelet non-gaussian-predict.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#ifndef EXAGEOSTATCPP_NON_GAUSSIAN_PREDICT_CODELET_HPP
+#define EXAGEOSTATCPP_NON_GAUSSIAN_PREDICT_CODELET_HPP
+
+#include <runtime/starpu/helpers/StarPuHelpers.hpp>
+
+namespace exageostat::runtime {
+
+    /**
+     * @class NonGaussianPredict Codelet
+     * @brief A class for starpu codelet non gaussian predict.
+     * @tparam T Data Type: float or double
+     * @details This class encapsulates the struct cl_non_gaussian_predict and its CPU functions.
+     * It maps the Gaussian conditional means and variances of the missing locations back to the Tukey g-and-h scale.
+     *
+     */
+    template<typename T>
+    class NonGaussianPredict {
+
+    public:
+
+        /**
+         * @brief Default constructor
+         *
+         */
+        NonGaussianPredict() = default;
+
+        /**
+         * @brief Default destructor
+         *
+         */
+        ~NonGaussianPredict() = default;
+
+        /**
+         * @brief Inserts a task for every tile of the predicted values.
+         * @param[in,out] apDescZMiss A pointer to the descriptor of the conditional means, overwritten by the predictions.
+         * @param[in] apDescExplainedVariance A pointer to the 1-by-M descriptor of the explained variances.
+         * @param[in] apTheta A pointer to the transformation parameters.
+         * @param[in] apStarPuHelpers A reference to a unique pointer of StarPuHelpers, used for accessing and managing data.
+         * @return void
+         *
+         */
+        void InsertTask(void *apDescZMiss, void *apDescExplainedVariance, const T *apTheta,
+                        std::unique_ptr<StarPuHelpers> &apStarPuHelpers);
+
+    private:
+
+        /**
+         * @brief Executes the Non-Gaussian prediction codelet function.
+         * @param[in] apBuffers An array of pointers to the buffers.
+         * @param[in] apCodeletArguments A pointer to the codelet arguments structure, which includes the tile size
+         * and the transformation parameters.
+         * @return void
+         *
+         */
+        static void cl_non_gaussian_predict_function(void **apBuffers, void *apCodeletArguments);
+
+        /// starpu_codelet struct
+        static struct starpu_codelet cl_non_gaussian_predict;
+    };
+
+    /**
+     * @brief Instantiates the non-gaussian-predict codelet class for float and double types.
+     * @tparam T Data Type: float or double
+     *
+     */
+    EXAGEOSTAT_INSTANTIATE_CLASS(NonGaussianPredict)
+
+}//namespace exageostat
+
+#endif //EXAGEOSTATCPP_NON_GAUSSIAN_PREDICT_CODELET_HPP
@@ -34,6 +34,8 @@ inline exageostat::common::Computation GetInputComputation(std::string aComputat
         return exageostat::common::DIAGONAL_APPROX;
     } else if (aComputation == "tlr" || aComputation == "tile_low_rank") {
         return exageostat::common::TILE_LOW_RANK;
+    } else if (aComputation == "vecchia") {
+        return exageostat::common::VECCHIA_APPROX;
     } else {
         const std::string msg = "Error in Initialization : Unknown computation Value" + std::string(aComputation);
         throw API_EXCEPTION(msg, INVALID_ARGUMENT_ERROR);
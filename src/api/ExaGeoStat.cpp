@@ -12,8 +12,8 @@
 **/
 
 #include <api/ExaGeoStat.hpp>
+#include <api/ModelingSession.hpp>
 #include <data-generators/DataGenerator.hpp>
-#include <data-units/ModelingDataHolders.hpp>
 #include <prediction/Prediction.hpp>
 
 using namespace std;
@@ -47,32 +47,47 @@ T ExaGeoStat<T>::ExaGeoStatDataModeling(Configurations &aConfigurations, std::un
 
     aConfigurations.PrintSummary();
     LOGGER("** ExaGeoStat data Modeling **")
-    // Register and create a kernel object
-    kernels::Kernel<T> *pKernel = plugins::PluginRegistry<kernels::Kernel<T>>::Create(aConfigurations.GetKernelName(),
-                                                                                      aConfigurations.GetTimeSlot());
     // Add the data modeling arguments.
     aConfigurations.InitializeDataModelingArguments();
 
-    int parameters_number = pKernel->GetParametersNumbers();
+    // The kernel, the solver and the runtime state are created once and shared by all the evaluations of the fit.
+    ModelingSession<T> session(aConfigurations, aData, apMeasurementsMatrix);
+    int parameters_number = session.GetKernel().GetParametersNumbers();
     int max_number_of_iterations = aConfigurations.GetMaxMleIterations();
-    // Setting struct of data to pass to the modeling.
-    auto modeling_data = new mModelingData(aData, aConfigurations, *apMeasurementsMatrix, *pKernel);
     // Create nlopt
     double opt_f;
-    opt optimizing_function(nlopt::LN_BOBYQA, parameters_number);
+    // The gradient-based algorithms use the analytic score returned by the objective function.
+    nlopt::algorithm algorithm = nlopt::LN_BOBYQA;
+    if (aConfigurations.GetOptimizer() == common::LBFGS) {
+        algorithm = nlopt::LD_LBFGS;
+    } else if (aConfigurations.GetOptimizer() == common::SLSQP) {
+        algorithm = nlopt::LD_SLSQP;
+    }
+    opt optimizing_function(algorithm, parameters_number);
     // Initialize problem's bound.
     optimizing_function.set_lower_bounds(aConfigurations.GetLowerBounds());
     optimizing_function.set_upper_bounds(aConfigurations.GetUpperBounds());
     optimizing_function.set_ftol_abs(aConfigurations.GetTolerance());
     // Set max iterations value.
     optimizing_function.set_maxeval(max_number_of_iterations);
-    optimizing_function.set_max_objective(ExaGeoStatMLETileAPI, (void *) modeling_data);
+    optimizing_function.set_max_objective(ExaGeoStatMLETileAPI, (void *) &session);
     // Optimize mle using nlopt.
     optimizing_function.optimize(aConfigurations.GetStartingTheta(), opt_f);
     aConfigurations.SetEstimatedTheta(aConfigurations.GetStartingTheta());
 
     auto theta = aConfigurations.GetStartingTheta();
 
+    // The optimizer may have evaluated other points after its optimum, evaluate the final theta once more so that
+    // the next stages find its exact factor in the covariance descriptor.
+    if (aConfigurations.GetIsRetainFactor() && aConfigurations.GetComputation() == common::EXACT_DENSE &&
+        aConfigurations.GetPrecision() != common::MIXED &&
+        aData->GetFactorTheta() != vector<T>(theta.begin(), theta.end())) {
+        VERBOSE("\tEvaluate the final theta to retain its Cholesky factor...")
+        session.GetLinearAlgebraSolver().ExaGeoStatMLETile(aData, aConfigurations, theta.data(),
+                                                           apMeasurementsMatrix, session.GetKernel());
+        VERBOSE("\tDone.")
+    }
+
     LOGGER("--> Final Theta Values (", true)
     for (int i = 0; i < parameters_number; i++) {
         LOGGER_PRECISION(theta[i])
@@ -83,8 +98,6 @@ T ExaGeoStat<T>::ExaGeoStatDataModeling(Configurations &aConfigurations, std::un
     LOGGER_PRECISION(")")
     LOGGER("")
 
-    delete pKernel;
-    delete modeling_data;
     return optimizing_function.last_optimum_value();
 }
 
@@ -92,15 +105,9 @@ template<typename T>
 double
 ExaGeoStat<T>::ExaGeoStatMLETileAPI(const std::vector<double> &aTheta, std::vector<double> &aGrad, void *apInfo) {
 
-    auto config = ((mModelingData<T> *) apInfo)->mpConfiguration;
-    auto data = ((mModelingData<T> *) apInfo)->mpData;
-    auto measurements = ((mModelingData<T> *) apInfo)->mpMeasurementsMatrix;
-    auto kernel = ((mModelingData<T> *) apInfo)->mpKernel;
-
-    // We do Date Modeling with any computation.
-    auto linear_algebra_solver = linearAlgebra::LinearAlgebraFactory<T>::CreateLinearAlgebraSolver(
-            config->GetComputation());
-    return linear_algebra_solver->ExaGeoStatMLETile(*data, *config, aTheta.data(), measurements, *kernel);
+    // The session holds everything but theta, which is pushed through the solver created for the fit.
+    auto session = (ModelingSession<T> *) apInfo;
+    return session->Evaluate(aTheta.data(), aGrad.empty() ? nullptr : aGrad.data());
 }
 
 
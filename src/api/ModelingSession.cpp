@@ -0,0 +1,128 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ModelingSession.cpp
+ * @brief Contains the implementation of the ModelingSession class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <api/ModelingSession.hpp>
+#include <helpers/CommunicatorMPI.hpp>
+#include <linear-algebra-solvers/LinearAlgebraFactory.hpp>
+#include <results/Results.hpp>
+
+using namespace std;
+
+using namespace exageostat::api;
+using namespace exageostat::configurations;
+using namespace exageostat::helpers;
+using namespace exageostat::kernels;
+using namespace exageostat::linearAlgebra;
+using namespace exageostat::results;
+
+template<typename T>
+ModelingSession<T>::ModelingSession(Configurations &aConfigurations, unique_ptr<ExaGeoStatData<T>> &aData,
+                                    T *apMeasurementsMatrix) : mConfigurations(aConfigurations), mData(aData),
+                                                               mpMeasurementsMatrix(apMeasurementsMatrix) {
+
+    // Register and create a kernel object
+    this->mpKernel = unique_ptr<kernels::Kernel<T>>(
+            plugins::PluginRegistry<kernels::Kernel<T>>::Create(aConfigurations.GetKernelName(),
+                                                                aConfigurations.GetTimeSlot()));
+    this->mpLinearAlgebraSolver = linearAlgebra::LinearAlgebraFactory<T>::CreateLinearAlgebraSolver(
+            aConfigurations.GetComputation());
+
+    // Resume from the evaluations recorded by a previous run of the same fit, the first process records the new ones.
+    if (!aConfigurations.GetRecoveryFile().empty()) {
+        CheckpointProblem problem;
+        problem.mProblemSize = aConfigurations.GetProblemSize();
+        problem.mKernelName = aConfigurations.GetKernelName();
+        problem.mComputation = aConfigurations.GetComputation();
+        problem.mLowerBounds = aConfigurations.GetLowerBounds();
+        problem.mUpperBounds = aConfigurations.GetUpperBounds();
+        problem.mStartingTheta = aConfigurations.GetStartingTheta();
+        problem.mDataChecksum = this->GetDataChecksum();
+        this->mpCheckpoint = make_unique<MLECheckpoint>(aConfigurations.GetRecoveryFile(),
+                                                        this->mpKernel->GetParametersNumbers(), problem,
+                                                        aConfigurations.GetOptimizer() != common::BOBYQA,
+                                                        CommunicatorMPI::GetInstance()->GetRank() == 0);
+        if (this->mpCheckpoint->GetEvaluationsNumber() > 0) {
+            LOGGER("\tResuming from the " << this->mpCheckpoint->GetEvaluationsNumber() << " evaluations of "
+                                            << aConfigurations.GetRecoveryFile())
+        }
+    }
+}
+
+template<typename T>
+double ModelingSession<T>::Evaluate(const double *apTheta, double *apGradient) {
+
+    double loglik;
+    // The optimizer asks again for the points of the interrupted run, their recorded values are returned as they are.
+    if (this->mpCheckpoint && this->mpCheckpoint->Replay(apTheta, loglik, apGradient)) {
+        LOGGER("\t" << this->mpCheckpoint->GetReplayedNumber() << " - Recovered evaluation ----> LogLi: " << loglik)
+        Results::GetInstance()->SetMLEIterations(this->mpCheckpoint->GetReplayedNumber());
+        Results::GetInstance()->SetMaximumTheta(
+                vector<double>(apTheta, apTheta + this->mpKernel->GetParametersNumbers()));
+        Results::GetInstance()->SetLogLikValue(loglik);
+        return loglik;
+    }
+
+    loglik = this->mpLinearAlgebraSolver->ExaGeoStatMLETile(this->mData, this->mConfigurations, apTheta,
+                                                            this->mpMeasurementsMatrix, *this->mpKernel);
+    // NLOPT only asks for the gradient when a gradient-based algorithm is used.
+    if (apGradient != nullptr) {
+        this->mpLinearAlgebraSolver->ExaGeoStatMLEGradientTile(this->mConfigurations, this->mData, apTheta,
+                                                               apGradient, *this->mpKernel);
+    }
+    if (this->mpCheckpoint) {
+        this->mpCheckpoint->Save(apTheta, loglik, apGradient);
+        Results::GetInstance()->SetMLEIterations(this->mpCheckpoint->GetEvaluationsNumber());
+    }
+    return loglik;
+}
+
+template<typename T>
+uint64_t ModelingSession<T>::GetDataChecksum() {
+
+    auto *pLocations = this->mData->GetLocations();
+    size_t size = pLocations->GetSize() * sizeof(T);
+    uint64_t checksum = MLECheckpoint::GetChecksum(pLocations->GetLocationX(), size);
+    checksum = MLECheckpoint::GetChecksum(pLocations->GetLocationY(), size, checksum);
+    if (pLocations->GetDimension() != common::Dimension2D) {
+        checksum = MLECheckpoint::GetChecksum(pLocations->GetLocationZ(), size, checksum);
+    }
+
+    if (this->mpMeasurementsMatrix != nullptr) {
+        return MLECheckpoint::GetChecksum(this->mpMeasurementsMatrix,
+                                          this->mConfigurations.GetProblemSize() *
+                                          this->mpKernel->GetVariablesNumber() * sizeof(T), checksum);
+    }
+    // The evaluations overwrite Z, the measurements are then kept in its copy.
+    auto *pDescriptorData = this->mData->GetDescriptorData();
+    auto *pDescriptorZ = pDescriptorData->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
+                                                        this->mData->GetMleIterations() > 0
+                                                        ? common::DESCRIPTOR_Z_COPY
+                                                        : common::DESCRIPTOR_Z).chameleon_desc;
+    if (pDescriptorZ == nullptr) {
+        return checksum;
+    }
+    vector<T> measurements(pDescriptorZ->m);
+    this->mpLinearAlgebraSolver->ExaGeoStatDesc2Lap(measurements.data(), pDescriptorZ->m, pDescriptorZ,
+                                                    common::EXAGEOSTAT_UPPER_LOWER);
+    return MLECheckpoint::GetChecksum(measurements.data(), measurements.size() * sizeof(T), checksum);
+}
+
+template<typename T>
+Kernel<T> &ModelingSession<T>::GetKernel() {
+    return *this->mpKernel;
+}
+
+template<typename T>
+LinearAlgebraMethods<T> &ModelingSession<T>::GetLinearAlgebraSolver() {
+    return *this->mpLinearAlgebraSolver;
+}
@@ -62,9 +62,25 @@ Configurations::Configurations() {
     SetIsMSPE(false);
     SetIsFisher(false);
     SetIsIDW(false);
+    SetIDWNeighborsNumber(0);
+    SetIDWRadius(0);
+    SetIDWPower(2);
+    SetIsKrigingVariance(false);
     SetIsMLOEMMOM(false);
     SetDataPath("");
+    SetOrdering(DEFAULT_ORDERING);
+    SetRandomGenerator(LAPACK_GENERATOR);
+    SetDataFormat(CSV_FILE);
     SetDistanceMetric(EUCLIDEAN_DISTANCE);
+    // The defaults don't go through the setters, which would reset the tolerances the kernels share.
+    mDictionary["SmoothnessTolerance"] = 0.0;
+    mDictionary["BesselTableTolerance"] = 0.0;
+    SetDistanceCacheBudget(0);
+    SetVecchiaNeighborsNumber(30);
+    SetOptimizer(BOBYQA);
+    SetTraceProbesNumber(0);
+    SetIsDeterministic(false);
+    SetIsRetainFactor(false);
     SetAccuracy(0);
     SetIsNonGaussian(false);
     mIsThetaInit = false;
@@ -150,20 +166,38 @@ void Configurations::InitializeArguments(const int &aArgC, char **apArgV, const
                 ParseVerbose(argument_value);
             } else if (argument_name == "--distance_metric" || argument_name == "--distanceMetric") {
                 ParseDistanceMetric(argument_value);
+            } else if (argument_name == "--nu_tolerance" || argument_name == "--nuTolerance") {
+                // No digits keeps the exact matching of the default, rather than a tolerance of 1.
+                int digits = CheckNumericalValue(argument_value);
+                SetSmoothnessTolerance(digits == 0 ? 0 : pow(10, -1 * digits));
+            } else if (argument_name == "--bessel_tolerance" || argument_name == "--besselTolerance") {
+                SetBesselTableTolerance(pow(10, -1 * CheckNumericalValue(argument_value)));
+            } else if (argument_name == "--trace_probes" || argument_name == "--traceProbes") {
+                SetTraceProbesNumber(CheckNumericalValue(argument_value));
             } else if (argument_name == "--logpath" || argument_name == "--log_path" || argument_name == "--logPath") {
                 SetLoggerPath(argument_value);
             } else {
                 if (!(argument_name == "--ZmissNumber" || argument_name == "--Zmiss" ||
                       argument_name == "--ZMiss" || argument_name == "--predict" || argument_name == "--Predict" ||
+                      argument_name == "--idw_neighbors" || argument_name == "--idwNeighbors" ||
+                      argument_name == "--idw_radius" || argument_name == "--idwRadius" ||
+                      argument_name == "--idw_power" || argument_name == "--idwPower" ||
                       argument_name == "--iterations" ||
                       argument_name == "--Iterations" || argument_name == "--max_mle_iterations" ||
                       argument_name == "--maxMleIterations" || argument_name == "--opt_iters" ||
                       argument_name == "--tolerance" || argument_name == "--opt_tol" ||
+                      argument_name == "--distance_cache" || argument_name == "--distanceCache" ||
+                      argument_name == "--vecchia_neighbors" || argument_name == "--vecchiaNeighbors" ||
+                      argument_name == "--optimizer" || argument_name == "--Optimizer" ||
+                      argument_name == "--recovery_file" || argument_name == "--recoveryFile" ||
                       argument_name == "--distanceMetric" || argument_name == "--distance_metric" ||
                       argument_name == "--log_file_name" || argument_name == "--logFileName" ||
                       argument_name == "--Band" || argument_name == "--band" ||
                       argument_name == "--DataPath" || argument_name == "--dataPath" ||
                       argument_name == "--data_path" ||
+                      argument_name == "--ordering" || argument_name == "--Ordering" ||
+                      argument_name == "--random_generator" || argument_name == "--randomGenerator" ||
+                      argument_name == "--data_format" || argument_name == "--dataFormat" ||
                       argument_name == "--acc" || argument_name == "--Acc")) {
                     LOGGER("!! " << argument_name << " !!")
                     throw invalid_argument(
@@ -181,9 +215,14 @@ void Configurations::InitializeArguments(const int &aArgC, char **apArgV, const
                 SetApproximationMode(true);
             } else if (argument_name == "--log" || argument_name == "--Log") {
                 SetLogger(true);
+            } else if (argument_name == "--deterministic" || argument_name == "--Deterministic") {
+                SetIsDeterministic(true);
+            } else if (argument_name == "--retain_factor" || argument_name == "--retainFactor") {
+                SetIsRetainFactor(true);
             } else {
                 if (!(argument_name == "--mspe" || argument_name == "--MSPE" ||
                       argument_name == "--idw" || argument_name == "--IDW" ||
+                      argument_name == "--kriging_variance" || argument_name == "--krigingVariance" ||
                       argument_name == "--mloe-mmom" || argument_name == "--mloe_mmom" ||
                       argument_name == "--fisher" || argument_name == "--Fisher")) {
                     LOGGER("!! " << argument_name << " !!")
@@ -269,6 +308,12 @@ void Configurations::InitializeDataGenerationArguments() {
                 argument_name == "--data_path") {
                 SetDataPath(argument_value);
                 SetIsSynthetic(false);
+            } else if (argument_name == "--ordering" || argument_name == "--Ordering") {
+                ParseOrdering(argument_value);
+            } else if (argument_name == "--random_generator" || argument_name == "--randomGenerator") {
+                ParseRandomGenerator(argument_value);
+            } else if (argument_name == "--data_format" || argument_name == "--dataFormat") {
+                ParseDataFormat(argument_value);
             }
         }
     }
@@ -305,6 +350,14 @@ void Configurations::InitializeDataModelingArguments() {
                 SetMaxMleIterations(CheckNumericalValue(argument_value));
             } else if (argument_name == "--tolerance" || argument_name == "--opt_tol") {
                 SetTolerance(CheckNumericalValue(argument_value));
+            } else if (argument_name == "--distance_cache" || argument_name == "--distanceCache") {
+                SetDistanceCacheBudget(CheckNumericalValue(argument_value));
+            } else if (argument_name == "--vecchia_neighbors" || argument_name == "--vecchiaNeighbors") {
+                SetVecchiaNeighborsNumber(CheckNumericalValue(argument_value));
+            } else if (argument_name == "--optimizer" || argument_name == "--Optimizer") {
+                ParseOptimizer(argument_value);
+            } else if (argument_name == "--recovery_file" || argument_name == "--recoveryFile") {
+                SetRecoveryFile(argument_value);
             } else if (argument_name == "--Band" || argument_name == "--band") {
                 SetBand(CheckNumericalValue(argument_value));
             } else if (argument_name == "--acc" || argument_name == "--Acc") {
@@ -323,6 +376,11 @@ void Configurations::InitializeDataModelingArguments() {
             throw domain_error("You need to set the tile band thickness, before starting");
         }
     }
+    if (GetComputation() == VECCHIA_APPROX) {
+        if (GetVecchiaNeighborsNumber() == 0) {
+            throw domain_error("You need to set the number of Vecchia conditioning neighbors, before starting");
+        }
+    }
     if (GetComputation() == TILE_LOW_RANK) {
 #ifdef USE_HICMA
         if (GetLowTileSize() == 0) {
@@ -349,6 +407,12 @@ void Configurations::InitializeDataPredictionArguments() {
             if (argument_name == "--ZmissNumber" || argument_name == "--Zmiss" || argument_name == "--ZMiss" ||
                 argument_name == "--predict" || argument_name == "--Predict") {
                 SetUnknownObservationsNb(CheckUnknownObservationsValue(argument_value));
+            } else if (argument_name == "--idw_neighbors" || argument_name == "--idwNeighbors") {
+                SetIDWNeighborsNumber(CheckNumericalValue(argument_value));
+            } else if (argument_name == "--idw_radius" || argument_name == "--idwRadius") {
+                SetIDWRadius(CheckDecimalValue(argument_value));
+            } else if (argument_name == "--idw_power" || argument_name == "--idwPower") {
+                SetIDWPower(CheckDecimalValue(argument_value));
             }
         }
     }
@@ -371,6 +435,12 @@ void Configurations::InitializeDataPredictionArguments() {
                         "You need to set ZMiss number, as the number of missing values should be bigger than one");
             }
             SetIsIDW(true);
+        } else if (argument_name == "--kriging_variance" || argument_name == "--krigingVariance") {
+            if (GetUnknownObservationsNb() <= 1) {
+                throw domain_error(
+                        "You need to set ZMiss number, as the number of missing values should be bigger than one");
+            }
+            SetIsKrigingVariance(true);
         } else if (argument_name == "--mloe-mmom" || argument_name == "--MLOE_MMOM" || argument_name == "--mloe_mmom") {
             if (GetUnknownObservationsNb() <= 1) {
                 throw domain_error(
@@ -382,6 +452,10 @@ void Configurations::InitializeDataPredictionArguments() {
             SetIsFisher(true);
         }
     }
+    // The kriging variance is only returned along with the Gaussian MSPE prediction.
+    if (GetIsKrigingVariance() && (!GetIsMSPE() || GetIsNonGaussian())) {
+        throw domain_error("The kriging variance needs --mspe, and is not supported by the non-Gaussian kernels.");
+    }
 }
 
 void Configurations::PrintUsage() {
@@ -398,7 +472,7 @@ void Configurations::PrintUsage() {
     LOGGER("--gpus=value : Used to set the number of GPUs.")
     LOGGER("--dts=value : Used to set the Dense Tile size.")
     LOGGER("--lts=value : Used to set the Low Tile size.")
-    LOGGER("--band=value : Used to set the Tile diagonal thickness.")
+    LOGGER("--band=value : Used to set the Tile diagonal thickness, also kept in double precision for mixed precision.")
     LOGGER("--Zmiss=value : Used to set number of unknown observation to be predicted.")
     LOGGER("--observations_file=PATH/TO/File : Used to pass the observations file path.")
     LOGGER("--max_rank=value : Used to the max rank value.")
@@ -410,16 +484,32 @@ void Configurations::PrintUsage() {
     LOGGER("--verbose=value : Run mode whether quiet/standard/detailed.")
     LOGGER("--log_path=value : Path to log file.")
     LOGGER("--distance_metric=value : Used distance metric either eg or gcd.")
+    LOGGER("--nu_tolerance=value : Treat nu within 10^-value of 0.5, 1.5 or 2.5 as a half-integer (closed-form Matern), 0 for exact values.")
+    LOGGER("--bessel_tolerance=value : Evaluate the Matern Bessel function through tables with a 10^-value relative error.")
+    LOGGER("--trace_probes=value : Estimate the likelihood gradient and Fisher traces with value Rademacher probes instead of exactly.")
     LOGGER("--max_mle_iterations=value : Maximum number of MLE iterations.")
     LOGGER("--tolerance : MLE tolerance between two iterations.")
+    LOGGER("--distance_cache=value : Memory budget in MB for caching the distance matrix across MLE iterations.")
+    LOGGER("--vecchia_neighbors=value : Number of conditioning neighbors of each location in the vecchia computation.")
+    LOGGER("--optimizer=value : MLE optimizer either bobyqa (derivative-free), lbfgs or slsqp (analytic gradient).")
+    LOGGER("--recovery_file=value : Binary checkpoint of the MLE evaluations, replayed when the modeling is run again.")
     LOGGER("--data_path : Used to enter the path to the real data file.")
+    LOGGER("--ordering=value : Reorder the locations along a morton or hilbert curve, or keep them as they are with none.")
+    LOGGER("--random_generator=value : Random number generator of the synthetic data, either lapack or the tile-parallel philox.")
+    LOGGER("--data_format=value : File format of the data written with --log, either csv or the memory-mapped binary.")
     LOGGER("--mspe: Used to enable mean square prediction error.")
     LOGGER("--fisher: Used to enable fisher tile prediction function.")
     LOGGER("--idw: Used to IDW prediction auxiliary function.")
+    LOGGER("--idw_neighbors=value : Number of nearest observed locations an IDW prediction uses, all of them with 0.")
+    LOGGER("--idw_radius=value : Only the observed locations within this distance are used by IDW, no limit with 0.")
+    LOGGER("--idw_power=value : Power of the inverse distance weights of IDW, 2 by default.")
+    LOGGER("--kriging_variance: Used to return the kriging variance of every predicted value along with the mspe prediction.")
     LOGGER("--mloe-mmom: Used to enable MLOE MMOM.")
     LOGGER("--OOC : Used to enable Out of core technology.")
     LOGGER("--approximation_mode : Used to enable Approximation mode.")
     LOGGER("--log : Enable logging.")
+    LOGGER("--deterministic : Reduce the tile contributions in a fixed order, for bit-for-bit reproducible results.")
+    LOGGER("--retain_factor : Keep the Cholesky factor of the final MLE theta and reuse it for prediction and Fisher.")
     LOGGER("--acc : Used to set the accuracy when using tlr.")
     LOGGER("\n\n")
 
@@ -450,17 +540,35 @@ int Configurations::CheckNumericalValue(const string &aValue) {
     return numericalValue;
 }
 
+double Configurations::CheckDecimalValue(const string &aValue) {
+
+    double decimalValue;
+    try {
+        decimalValue = stod(aValue);
+    }
+    catch (...) {
+        throw range_error("Invalid value. Please use Numerical values only.");
+    }
+
+    if (decimalValue < 0 || !isfinite(decimalValue)) {
+        throw range_error("Invalid value. Please use positive values");
+    }
+    return decimalValue;
+}
+
 Computation Configurations::CheckComputationValue(const std::string &aValue) {
 
     if (aValue != "exact" and aValue != "Exact" and aValue != "Dense" and aValue != "dense" and
         aValue != "diag_approx" and aValue != "diagonal_approx" and aValue != "lr_approx" and aValue != "tlr" and
-        aValue != "TLR") {
-        throw range_error("Invalid value for Computation. Please use Exact, diagonal_approx or TLR.");
+        aValue != "TLR" and aValue != "vecchia" and aValue != "Vecchia") {
+        throw range_error("Invalid value for Computation. Please use Exact, diagonal_approx, TLR or vecchia.");
     }
     if (aValue == "exact" or aValue == "Exact" or aValue == "Dense" or aValue == "dense") {
         return EXACT_DENSE;
     } else if (aValue == "diag_approx" or aValue == "diagonal_approx") {
         return DIAGONAL_APPROX;
+    } else if (aValue == "vecchia" or aValue == "Vecchia") {
+        return VECCHIA_APPROX;
     }
     return TILE_LOW_RANK;
 }
@@ -605,6 +713,50 @@ void Configurations::ParseDistanceMetric(const std::string &aDistanceMetric) {
     }
 }
 
+void Configurations::ParseOptimizer(const std::string &aOptimizer) {
+    if (aOptimizer == "bobyqa" || aOptimizer == "BOBYQA") {
+        SetOptimizer(BOBYQA);
+    } else if (aOptimizer == "lbfgs" || aOptimizer == "LBFGS") {
+        SetOptimizer(LBFGS);
+    } else if (aOptimizer == "slsqp" || aOptimizer == "SLSQP") {
+        SetOptimizer(SLSQP);
+    } else {
+        throw range_error("Invalid value. Please use bobyqa, lbfgs or slsqp values only.");
+    }
+}
+
+void Configurations::ParseOrdering(const std::string &aOrdering) {
+    if (aOrdering == "morton" || aOrdering == "Morton") {
+        SetOrdering(MORTON_ORDERING);
+    } else if (aOrdering == "hilbert" || aOrdering == "Hilbert") {
+        SetOrdering(HILBERT_ORDERING);
+    } else if (aOrdering == "none" || aOrdering == "None") {
+        SetOrdering(NO_ORDERING);
+    } else {
+        throw range_error("Invalid value. Please use morton, hilbert or none values only.");
+    }
+}
+
+void Configurations::ParseRandomGenerator(const std::string &aRandomGenerator) {
+    if (aRandomGenerator == "lapack" || aRandomGenerator == "LAPACK") {
+        SetRandomGenerator(LAPACK_GENERATOR);
+    } else if (aRandomGenerator == "philox" || aRandomGenerator == "Philox") {
+        SetRandomGenerator(PHILOX_GENERATOR);
+    } else {
+        throw range_error("Invalid value. Please use lapack or philox values only.");
+    }
+}
+
+void Configurations::ParseDataFormat(const std::string &aDataFormat) {
+    if (aDataFormat == "csv" || aDataFormat == "CSV") {
+        SetDataFormat(CSV_FILE);
+    } else if (aDataFormat == "binary" || aDataFormat == "Binary") {
+        SetDataFormat(BINARY_FILE);
+    } else {
+        throw range_error("Invalid value. Please use csv or binary values only.");
+    }
+}
+
 
 void Configurations::InitTheta(vector<double> &aTheta, const int &size) {
 
@@ -655,6 +807,8 @@ void Configurations::PrintSummary() {
             LOGGER("#Computation: Exact")
         } else if (this->GetComputation() == DIAGONAL_APPROX) {
             LOGGER("#Computation: Diagonal Approx")
+        } else if (this->GetComputation() == VECCHIA_APPROX) {
+            LOGGER("#Computation: Vecchia, " << this->GetVecchiaNeighborsNumber() << " neighbors")
         }
 
         if (this->GetDimension() == Dimension2D) {
@@ -700,3 +854,14 @@ Configurations::~Configurations() {
 void Configurations::SetTolerance(double aTolerance) {
     mDictionary["Tolerance"] = pow(10, -1 * aTolerance);
 }
+
+void Configurations::SetSmoothnessTolerance(double aSmoothnessTolerance) {
+    mDictionary["SmoothnessTolerance"] = aSmoothnessTolerance;
+    // The kernels are created through the plugin registry, so the tolerance is shared through their static configurations.
+    kernels::KernelsConfigurations::GetSmoothnessTolerance() = aSmoothnessTolerance;
+}
+
+void Configurations::SetBesselTableTolerance(double aBesselTableTolerance) {
+    mDictionary["BesselTableTolerance"] = aBesselTableTolerance;
+    kernels::KernelsConfigurations::GetBesselTableTolerance() = aBesselTableTolerance;
+}
@@ -14,9 +14,11 @@
 #include <data-generators/DataGenerator.hpp>
 #include <data-generators/concrete/SyntheticGenerator.hpp>
 #include <data-loader/concrete/CSVLoader.hpp>
+#include <data-loader/concrete/BinaryLoader.hpp>
 
 using namespace exageostat::generators;
 using namespace exageostat::dataLoader::csv;
+using namespace exageostat::dataLoader::binary;
 using namespace exageostat::generators::synthetic;
 using namespace exageostat::common;
 using namespace exageostat::results;
@@ -24,9 +26,12 @@ using namespace exageostat::results;
 template<typename T>
 std::unique_ptr<DataGenerator<T>> DataGenerator<T>::CreateGenerator(configurations::Configurations &apConfigurations) {
 
-    //// TODO: In case of other file support, Then we can create another layer for the factory creation depending on the file size.
-    // Check the used Data generation method, whether it's synthetic or real.
-    aDataSourceType = apConfigurations.GetIsSynthetic() ? SYNTHETIC : CSV_FILE;
+    // Check the used Data generation method, whether it's synthetic or real, the binary files are known by their signature.
+    if (apConfigurations.GetIsSynthetic()) {
+        aDataSourceType = SYNTHETIC;
+    } else {
+        aDataSourceType = BinaryLoader<T>::IsBinaryFile(apConfigurations.GetDataPath()) ? BINARY_FILE : CSV_FILE;
+    }
 
     // Return DataGenerator unique pointer of Synthetic type
     if (aDataSourceType == SYNTHETIC) {
@@ -35,6 +40,9 @@ std::unique_ptr<DataGenerator<T>> DataGenerator<T>::CreateGenerator(configuratio
     } else if (aDataSourceType == CSV_FILE) {
         Results::GetInstance()->SetIsSynthetic(false);
         return std::unique_ptr<DataGenerator<T>>(CSVLoader<T>::GetInstance());
+    } else if (aDataSourceType == BINARY_FILE) {
+        Results::GetInstance()->SetIsSynthetic(false);
+        return std::unique_ptr<DataGenerator<T>>(BinaryLoader<T>::GetInstance());
     } else {
         throw std::runtime_error("Data Loading for this file type is unsupported for now");
     }
@@ -47,6 +55,8 @@ DataGenerator<T>::~DataGenerator() {
         SyntheticGenerator<T>::GetInstance()->ReleaseInstance();
     } else if (aDataSourceType == CSV_FILE) {
         CSVLoader<T>::GetInstance()->ReleaseInstance();
+    } else if (aDataSourceType == BINARY_FILE) {
+        BinaryLoader<T>::GetInstance()->ReleaseInstance();
     } else {
         std::cerr << "Data Loading for this file type is unsupported for now" << std::endl;
         std::exit(1);
@@ -12,10 +12,13 @@
 **/
 
 #include <cmath>
+#include <vector>
 #include <algorithm>
 
 #include <data-generators/LocationGenerator.hpp>
 #include <helpers/ByteHandler.hpp>
+#include <helpers/SpaceFillingCurve.hpp>
+#include <helpers/PhiloxRandom.hpp>
 
 using namespace exageostat::generators;
 using namespace exageostat::common;
@@ -23,8 +26,11 @@ using namespace exageostat::dataunits;
 using namespace exageostat::helpers;
 
 template<typename T>
-void LocationGenerator<T>::GenerateLocations(const int &aN, const int &aTimeSlot, const Dimension &aDimension,
-                                             Locations<T> &aLocations) {
+std::vector<int>
+LocationGenerator<T>::GenerateLocations(const int &aN, const int &aTimeSlot, const Dimension &aDimension,
+                                        Locations<T> &aLocations, const Ordering &aOrdering,
+                                        const RandomGenerator &aRandomGenerator, const int &aSeed,
+                                        const int &aThreadsNumber) {
 
     aLocations.SetSize(aN);
     int index = 0;
@@ -44,24 +50,27 @@ void LocationGenerator<T>::GenerateLocations(const int &aN, const int &aTimeSlot
         grid[i] = i + 1;
     }
     T range_low = -0.4, range_high = 0.4;
+    // The counter-based jitter of an axis only depends on the index of its location.
+    auto jitter = [&](const int &aAxis) {
+        if (aRandomGenerator == PHILOX_GENERATOR) {
+            return range_low + (range_high - range_low) *
+                               PhiloxRandom<T>::Uniform(aSeed, PhiloxRandom<T>::LOCATIONS_STREAM + aAxis, index);
+        }
+        return UniformDistribution(range_low, range_high);
+    };
 
     for (auto i = 0; i < rootN && index < aN; i++) {
         for (auto j = 0; j < rootN && index < aN; j++) {
             if (aDimension == Dimension3D) {
                 for (auto k = 0; k < rootN && index < aN; k++) {
-                    aLocations.GetLocationX()[index] =
-                            (grid[i] - 0.5 + UniformDistribution(range_low, range_high)) / rootN;
-                    aLocations.GetLocationY()[index] =
-                            (grid[j] - 0.5 + UniformDistribution(range_low, range_high)) / rootN;
-                    aLocations.GetLocationZ()[index] =
-                            (grid[k] - 0.5 + UniformDistribution(range_low, range_high)) / rootN;
+                    aLocations.GetLocationX()[index] = (grid[i] - 0.5 + jitter(0)) / rootN;
+                    aLocations.GetLocationY()[index] = (grid[j] - 0.5 + jitter(1)) / rootN;
+                    aLocations.GetLocationZ()[index] = (grid[k] - 0.5 + jitter(2)) / rootN;
                     index++;
                 }
             } else {
-                aLocations.GetLocationX()[index] =
-                        (grid[i] - 0.5 + UniformDistribution(range_low, range_high)) / rootN;
-                aLocations.GetLocationY()[index] =
-                        (grid[j] - 0.5 + UniformDistribution(range_low, range_high)) / rootN;
+                aLocations.GetLocationX()[index] = (grid[i] - 0.5 + jitter(0)) / rootN;
+                aLocations.GetLocationY()[index] = (grid[j] - 0.5 + jitter(1)) / rootN;
                 if (aDimension == DimensionST) {
                     aLocations.GetLocationZ()[index] = 1.0;
                 }
@@ -70,15 +79,19 @@ void LocationGenerator<T>::GenerateLocations(const int &aN, const int &aTimeSlot
         }
     }
     delete[] grid;
-    if (aDimension != DimensionST) {
-        SortLocations(aN, aDimension, aLocations);
-    } else {
+    if (aDimension == DimensionST) {
         for (auto i = 0; i < aN; i++) {
-            aLocations.GetLocationX()[i] = aLocations.GetLocationX()[i];
-            aLocations.GetLocationY()[i] = aLocations.GetLocationY()[i];
             aLocations.GetLocationZ()[i] = (T) (i / aTimeSlot + 1);
         }
     }
+    if (aOrdering == MORTON_ORDERING || aOrdering == HILBERT_ORDERING) {
+        return SpaceFillingCurve<T>::Reorder(aN, aLocations, nullptr, 1, aOrdering, aThreadsNumber);
+    }
+    // The historical sorting is part of the default generation, the locations keep no other index.
+    if (aOrdering == DEFAULT_ORDERING && aDimension != DimensionST) {
+        SortLocations(aN, aDimension, aLocations);
+    }
+    return {};
 }
 
 template<typename T>
@@ -94,7 +107,7 @@ LocationGenerator<T>::SortLocations(const int &aN, const Dimension &aDimension,
 
     // Some sorting, required by spatial statistics code
     uint16_t x, y, z;
-    uint64_t vectorZ[aN];
+    std::vector<uint64_t> vectorZ(aN);
 
     // Encode data into vector z
     for (auto i = 0; i < aN; i++) {
@@ -108,7 +121,7 @@ LocationGenerator<T>::SortLocations(const int &aN, const Dimension &aDimension,
         vectorZ[i] = (SpreadBits(z) << 2) + (SpreadBits(y) << 1) + SpreadBits(x);
     }
     // Sort vector z
-    std::sort(vectorZ, vectorZ + aN, CompareUint64);
+    std::sort(vectorZ.begin(), vectorZ.end(), CompareUint64);
 
     // Decode data from vector z
     for (auto i = 0; i < aN; i++) {
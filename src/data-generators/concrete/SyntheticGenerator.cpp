@@ -47,8 +47,10 @@ SyntheticGenerator<T>::CreateData(Configurations &aConfigurations,
     aConfigurations.SetInitialTheta(aConfigurations.GetInitialTheta());
 
     // Generate Locations phase
-    LocationGenerator<T>::GenerateLocations(n, aConfigurations.GetTimeSlot(), aConfigurations.GetDimension(),
-                                            *locations);
+    data->SetOriginalIndices(LocationGenerator<T>::GenerateLocations(
+            n, aConfigurations.GetTimeSlot(), aConfigurations.GetDimension(), *locations,
+            aConfigurations.GetOrdering(), aConfigurations.GetRandomGenerator(), aConfigurations.GetSeed(),
+            aConfigurations.GetCoresNumber()));
     data->SetLocations(*locations);
 
     // Generate Descriptors phase
@@ -57,28 +59,9 @@ SyntheticGenerator<T>::CreateData(Configurations &aConfigurations,
 
     if (aConfigurations.GetLogger()) {
         VERBOSE("Writing generated data to the disk (Synthetic Dataset Generation Phase) .....")
-#ifdef USE_MPI
-        auto pMatrix = new T[aConfigurations.GetProblemSize()];
-        std::string path = aConfigurations.GetLoggerPath();
-
-        CHAMELEON_Desc2Lap(ChamUpperLower, data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
-                                                                                    DESCRIPTOR_Z).chameleon_desc,
-                           pMatrix, aConfigurations.GetProblemSize());
-        if (helpers::CommunicatorMPI::GetInstance()->GetRank() == 0) {
-            dataLoader::csv::CSVLoader<T>::GetInstance()->WriteData(
-                    *((T *) data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
-                                                                     DESCRIPTOR_Z).chameleon_desc->mat),
-                    aConfigurations.GetProblemSize(), parameters_number, path,
-                    *data->GetLocations());
-        }
-        delete[] pMatrix;
-#else
-        std::string path = aConfigurations.GetLoggerPath();
-        dataLoader::csv::CSVLoader<T>::GetInstance()->WriteData(*((T *) data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
-                                                                                           DESCRIPTOR_Z).chameleon_desc->mat),
-                                          aConfigurations.GetProblemSize(), aKernel.GetVariablesNumber(), path,
-                                          *data->GetLocations());
-#endif
+        auto *CHAM_descZ = data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR, DESCRIPTOR_Z).chameleon_desc;
+        linear_algebra_solver->WriteMeasurementsVector(aConfigurations, CHAM_descZ, aConfigurations.GetProblemSize(),
+                                                       aKernel.GetVariablesNumber(), *data->GetLocations());
         VERBOSE("Done.")
     }
     Results::GetInstance()->SetGeneratedLocationsNumber(n);
@@ -13,6 +13,9 @@
 **/
 
 #include <data-loader/DataLoader.hpp>
+#include <helpers/SpaceFillingCurve.hpp>
+#include <helpers/ParallelFileWriter.hpp>
+#include <helpers/CommunicatorMPI.hpp>
 
 using namespace std;
 
@@ -24,39 +27,37 @@ template<typename T>
 std::unique_ptr<ExaGeoStatData<T>>
 DataLoader<T>::CreateData(configurations::Configurations &aConfigurations, exageostat::kernels::Kernel<T> &aKernel) {
 
-    // create vectors that will be populated with read data.
-    vector<T> measurements_vector;
-    vector<T> x_locations;
-    vector<T> y_locations;
-    vector<T> z_locations;
-
     aKernel.SetPValue(aConfigurations.GetTimeSlot());
     int p = aKernel.GetVariablesNumber();
 
-    //Read the data out of the CSV file.
-    this->ReadData(aConfigurations, measurements_vector, x_locations, y_locations, z_locations, p);
+    //Count the records first, so that the data is read straight into its final place.
+    this->CountLocations(aConfigurations, p);
 
     //create data object
     auto data = std::make_unique<ExaGeoStatData<T>>(aConfigurations.GetProblemSize() / p,
                                                     aConfigurations.GetDimension());
 
-    //Initialize the descriptors.
+    //Initialize the descriptors, the Vecchia likelihood never forms the covariance matrix.
     auto linear_algebra_solver = linearAlgebra::LinearAlgebraFactory<T>::CreateLinearAlgebraSolver(EXACT_DENSE);
-    linear_algebra_solver->InitiateDescriptors(aConfigurations, *data->GetDescriptorData(), p);
-    linear_algebra_solver->ExaGeoStatLaSetTile(EXAGEOSTAT_UPPER_LOWER, 0, 0,
-                                               data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
-                                                                                        DESCRIPTOR_C).chameleon_desc);
-    //populate data object with read data
-    for (int i = 0; i < aConfigurations.GetProblemSize() / p; i++) {
-        data->GetLocations()->GetLocationX()[i] = x_locations[i];
-        data->GetLocations()->GetLocationY()[i] = y_locations[i];
-        if (aConfigurations.GetDimension() != Dimension2D) {
-            data->GetLocations()->GetLocationZ()[i] = z_locations[i];
-        }
+    if (aConfigurations.GetComputation() == VECCHIA_APPROX) {
+        linear_algebra_solver->InitiateVecchiaDescriptors(aConfigurations, *data->GetDescriptorData());
+    } else {
+        linear_algebra_solver->InitiateDescriptors(aConfigurations, *data->GetDescriptorData(), p);
+        linear_algebra_solver->ExaGeoStatLaSetTile(EXAGEOSTAT_UPPER_LOWER, 0, 0,
+                                                   data->GetDescriptorData()->GetDescriptor(
+                                                           CHAMELEON_DESCRIPTOR, DESCRIPTOR_C).chameleon_desc);
     }
-    for (int i = 0; i < aConfigurations.GetProblemSize(); i++) {
-        ((T *) data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
-                                                        DESCRIPTOR_Z).chameleon_desc->mat)[i] = measurements_vector[i];
+    //populate data object with read data
+    auto *measurements = (T *) data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
+                                                                        DESCRIPTOR_Z).chameleon_desc->mat;
+    this->ReadData(aConfigurations, *data->GetLocations(), measurements, p);
+
+    // Reorder the read locations along a space-filling curve, the measurements follow their locations.
+    if ((aConfigurations.GetOrdering() == MORTON_ORDERING || aConfigurations.GetOrdering() == HILBERT_ORDERING) &&
+        aConfigurations.GetOrdering() != this->mDataOrdering) {
+        data->SetOriginalIndices(helpers::SpaceFillingCurve<T>::Reorder(
+                aConfigurations.GetProblemSize() / p, *data->GetLocations(), measurements, p,
+                aConfigurations.GetOrdering(), aConfigurations.GetCoresNumber()));
     }
 
     Results::GetInstance()->SetGeneratedLocationsNumber(aConfigurations.GetProblemSize() / p);
@@ -65,3 +66,57 @@ DataLoader<T>::CreateData(configurations::Configurations &aConfigurations, exage
 
     return data;
 }
+
+template<typename T>
+std::string DataLoader<T>::GetOutputFilePath(std::string &aLoggerPath, const int &aLocationsNumber) {
+
+    // Determine the path for storing the output files
+    if (aLoggerPath.empty()) {
+        aLoggerPath = LOG_PATH;
+    } else {
+        if (aLoggerPath.back() == '/') {
+            aLoggerPath += "synthetic_ds";
+        } else {
+            aLoggerPath += "/synthetic_ds";
+        }
+    }
+    // The first process names the file of all the processes, an empty name tells the others it failed.
+    if (helpers::CommunicatorMPI::GetInstance()->GetRank() != 0) {
+        auto path = helpers::ParallelFileWriter::SharePath("");
+        if (path.empty()) {
+            throw runtime_error("Error creating directory: " + aLoggerPath);
+        }
+        return path;
+    }
+
+    // Create a new directory if it does not already exist
+    bool created;
+    if (!filesystem::exists(aLoggerPath)) {
+        try {
+            created = filesystem::create_directories(aLoggerPath);
+        } catch (const filesystem::filesystem_error &e) {
+            created = false;
+        }
+    } else {
+        created = true;
+    }
+
+    // Check if the directory was created successfully, the other processes are waiting for the name.
+    if (!created) {
+        helpers::ParallelFileWriter::SharePath("");
+        throw runtime_error("Error creating directory: " + aLoggerPath);
+    }
+
+    // Determine the names of the output files
+    size_t i = 1;
+    std::string n_file_log = aLoggerPath + "/log_" + std::to_string(aLocationsNumber) + "_";
+    std::string temp = n_file_log + std::to_string(i);
+
+    // Check if log file exists
+    while (std::filesystem::exists(temp)) {
+        i++;
+        temp = n_file_log + std::to_string(i);
+    }
+    return helpers::ParallelFileWriter::SharePath(
+            aLoggerPath + "/SYN_" + std::to_string(aLocationsNumber) + "_" + std::to_string(i));
+}
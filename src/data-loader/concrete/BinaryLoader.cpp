@@ -0,0 +1,252 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file BinaryLoader.cpp
+ * @brief Implementation of the BinaryLoader class
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <cstring>
+#include <fstream>
+
+#include <data-loader/concrete/BinaryLoader.hpp>
+#include <helpers/MappedFile.hpp>
+#include <helpers/ParallelFileWriter.hpp>
+#include <helpers/CommunicatorMPI.hpp>
+
+using namespace std;
+
+using namespace exageostat::configurations;
+using namespace exageostat::common;
+using namespace exageostat::dataLoader::binary;
+using namespace exageostat::helpers;
+
+//// Signature at the beginning of every binary data file.
+static const char BINARY_MAGIC[8] = {'E', 'X', 'A', 'G', 'E', 'O', 'S', 'T'};
+
+template<typename T>
+BinaryLoader<T> *BinaryLoader<T>::GetInstance() {
+
+    if (mpInstance == nullptr) {
+        mpInstance = new BinaryLoader<T>();
+    }
+    return mpInstance;
+}
+
+template<typename T>
+bool BinaryLoader<T>::IsBinaryFile(const string &aPath) {
+
+    char magic[sizeof(BINARY_MAGIC)];
+    ifstream file(aPath, ios::binary);
+    return file.read(magic, sizeof(magic)) && memcmp(magic, BINARY_MAGIC, sizeof(magic)) == 0;
+}
+
+/**
+ * @brief Validates the header of a mapped binary data file.
+ * @param[in] aFile The mapped file.
+ * @param[in] aPath The path of the file, used in the error messages.
+ * @return The header of the file.
+ * @throws std::runtime_error if the header is invalid or the blocks do not fit in the file.
+ *
+ */
+static BinaryHeader ReadHeader(const MappedFile &aFile, const string &aPath) {
+
+    BinaryHeader header{};
+    if (aFile.GetSize() < sizeof(header)) {
+        throw runtime_error("Invalid binary data file: " + aPath);
+    }
+    memcpy(&header, aFile.Begin(), sizeof(header));
+    if (memcmp(header.mMagic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0 ||
+        (header.mPrecision != sizeof(float) && header.mPrecision != sizeof(double)) ||
+        (header.mSpatialDimension != 2 && header.mSpatialDimension != 3) || header.mHasTime > 1 ||
+        header.mSpatialDimension + header.mHasTime > 3 || header.mVariablesNumber == 0 ||
+        header.mOrdering > HILBERT_ORDERING) {
+        throw runtime_error("Invalid binary data file: " + aPath);
+    }
+    if (header.mVersion != BinaryLoader<double>::FORMAT_VERSION) {
+        throw runtime_error("Unsupported version of the binary data file: " + aPath);
+    }
+
+    // Every present block must lie inside the file.
+    uint64_t counts[4] = {header.mLocationsNumber, header.mLocationsNumber,
+                          header.mSpatialDimension + header.mHasTime == 3 ? header.mLocationsNumber : 0,
+                          header.mLocationsNumber * header.mVariablesNumber};
+    for (int block = 0; block < 4; block++) {
+        if (counts[block] == 0) {
+            continue;
+        }
+        if (header.mOffsets[block] < sizeof(header) || header.mOffsets[block] > aFile.GetSize() ||
+            counts[block] > (aFile.GetSize() - header.mOffsets[block]) / header.mPrecision) {
+            throw runtime_error("Truncated binary data file: " + aPath);
+        }
+    }
+    return header;
+}
+
+/**
+ * @brief Copies a column block of the mapped file, converting it if its precision differs from T.
+ * @tparam T Data Type: float or double
+ * @param[in] apSource The beginning of the block.
+ * @param[in] aPrecision The size in bytes of a stored value.
+ * @param[in] aCount The number of values to copy.
+ * @param[out] apDestination The destination array.
+ * @return void
+ *
+ */
+template<typename T>
+static void CopyBlock(const char *apSource, const uint32_t &aPrecision, const size_t &aCount, T *apDestination) {
+
+    if (aPrecision == sizeof(T)) {
+        memcpy(apDestination, apSource, aCount * sizeof(T));
+    } else if (aPrecision == sizeof(float)) {
+        auto *pSource = (const float *) apSource;
+        for (size_t i = 0; i < aCount; i++) {
+            apDestination[i] = (T) pSource[i];
+        }
+    } else {
+        auto *pSource = (const double *) apSource;
+        for (size_t i = 0; i < aCount; i++) {
+            apDestination[i] = (T) pSource[i];
+        }
+    }
+}
+
+template<typename T>
+int BinaryLoader<T>::CountLocations(Configurations &aConfigurations, const int &aP) {
+
+    //Check if the user entered a valid path for the binary file.
+    if (aConfigurations.GetDataPath().empty()) {
+        throw runtime_error("Please enter the path to data file.");
+    }
+    MappedFile file(aConfigurations.GetDataPath());
+    BinaryHeader header = ReadHeader(file, aConfigurations.GetDataPath());
+
+    Dimension dimension = aConfigurations.GetDimension();
+    bool is_consistent = header.mHasTime ? dimension == DimensionST :
+                         header.mSpatialDimension == 2 ? dimension == Dimension2D : dimension == Dimension3D;
+    if (!is_consistent) {
+        throw runtime_error("The data dimensions in the provided file isn't consistent with the dimensions input.");
+    }
+    if (header.mVariablesNumber != (uint32_t) aP) {
+        throw runtime_error("The data P in the provided file isn't consistent with the Kernel's P.");
+    }
+
+    // The locations of the file do not need to be sorted again with the same curve.
+    this->mDataOrdering = (Ordering) header.mOrdering;
+    aConfigurations.SetProblemSize((int) header.mLocationsNumber * aP / aConfigurations.GetTimeSlot());
+    return (int) header.mLocationsNumber;
+}
+
+template<typename T>
+void BinaryLoader<T>::ReadData(Configurations &aConfigurations, dataunits::Locations<T> &aLocations,
+                               T *apMeasurements, const int &aP) {
+
+    //Check if the user entered a valid path for the binary file.
+    if (aConfigurations.GetDataPath().empty()) {
+        throw runtime_error("Please enter the path to data file.");
+    }
+
+    string data_path = aConfigurations.GetDataPath();
+    MappedFile file(data_path);
+    BinaryHeader header = ReadHeader(file, data_path);
+    if (header.mVariablesNumber != (uint32_t) aP) {
+        throw runtime_error("The data P in the provided file isn't consistent with the Kernel's P.");
+    }
+    size_t locations_number = min((size_t) aConfigurations.GetProblemSize() / aP, (size_t) header.mLocationsNumber);
+    size_t measurements_number = min((size_t) aConfigurations.GetProblemSize(),
+                                     (size_t) (header.mLocationsNumber * header.mVariablesNumber));
+    T *axes[3] = {aLocations.GetLocationX(), aLocations.GetLocationY(), aLocations.GetLocationZ()};
+
+    for (int axis = 0; axis < 3; axis++) {
+        if (header.mOffsets[axis] != 0 && axes[axis] != nullptr) {
+            CopyBlock(file.Begin() + header.mOffsets[axis], header.mPrecision, locations_number, axes[axis]);
+        }
+    }
+    CopyBlock(file.Begin() + header.mOffsets[3], header.mPrecision, measurements_number, apMeasurements);
+
+    LOGGER("\tData is read from " << data_path << " successfully.")
+}
+
+template<typename T>
+void BinaryLoader<T>::WriteData(const T &aMatrixPointer, const int &aProblemSize, const int &aP,
+                                std::string &aLoggerPath, dataunits::Locations<T> &aLocations) {
+    this->WriteData(aMatrixPointer, aProblemSize, aP, aLoggerPath, aLocations, DEFAULT_ORDERING);
+}
+
+template<typename T>
+void BinaryLoader<T>::WriteData(const T &aMatrixPointer, const int &aProblemSize, const int &aP,
+                                std::string &aLoggerPath, dataunits::Locations<T> &aLocations,
+                                const Ordering &aOrdering) {
+
+    // The calling process holds the whole vector, it writes the measurements of its own locations.
+    size_t begin, end;
+    ParallelFileWriter::GetBlock(aProblemSize / aP, begin, end);
+    vector<MeasurementsBlock<T>> blocks = {{begin * aP, &aMatrixPointer + begin * aP, (end - begin) * aP}};
+    this->WriteData(blocks, aProblemSize, aP, aLoggerPath, aLocations, aOrdering);
+}
+
+template<typename T>
+void BinaryLoader<T>::WriteData(const vector<MeasurementsBlock<T>> &aBlocks, const int &aProblemSize, const int &aP,
+                                std::string &aLoggerPath, dataunits::Locations<T> &aLocations,
+                                const Ordering &aOrdering) {
+
+    // Determine the name of the output file
+    std::string n_file_synthetic = this->GetOutputFilePath(aLoggerPath, aProblemSize / aP) + ".bin";
+    uint64_t locations_number = aProblemSize / aP;
+
+    BinaryHeader header{};
+    memcpy(header.mMagic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    header.mVersion = FORMAT_VERSION;
+    header.mPrecision = sizeof(T);
+    header.mSpatialDimension = aLocations.GetDimension() == Dimension3D ? 3 : 2;
+    header.mHasTime = aLocations.GetDimension() == DimensionST ? 1 : 0;
+    header.mVariablesNumber = aP;
+    header.mOrdering = aOrdering;
+    header.mLocationsNumber = locations_number;
+
+    // Lay the blocks out one after the other, each one aligned.
+    const T *columns[3] = {aLocations.GetLocationX(), aLocations.GetLocationY(),
+                           aLocations.GetDimension() == Dimension2D ? nullptr : aLocations.GetLocationZ()};
+    uint64_t offset = sizeof(header);
+    for (int block = 0; block < 4; block++) {
+        if (block < 3 && columns[block] == nullptr) {
+            continue;
+        }
+        offset = (offset + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+        header.mOffsets[block] = offset;
+        offset += locations_number * (block < 3 ? 1 : aP) * sizeof(T);
+    }
+
+    // Every process writes its own block of locations in each column, the gaps between the columns stay zero.
+    size_t begin, end;
+    ParallelFileWriter::GetBlock(locations_number, begin, end);
+    ParallelFileWriter file(n_file_synthetic);
+    if (CommunicatorMPI::GetInstance()->GetRank() == 0) {
+        file.WriteAt(0, (const char *) &header, sizeof(header));
+    }
+    for (int block = 0; block < 3; block++) {
+        if (columns[block] == nullptr) {
+            continue;
+        }
+        file.WriteAt(header.mOffsets[block] + begin * sizeof(T), (const char *) (columns[block] + begin),
+                     (end - begin) * sizeof(T));
+    }
+    for (auto &measurements: aBlocks) {
+        file.WriteAt(header.mOffsets[3] + measurements.mBegin * sizeof(T), (const char *) measurements.mpValues,
+                     measurements.mCount * sizeof(T));
+    }
+}
+
+template<typename T>
+void BinaryLoader<T>::ReleaseInstance() {
+    if (mpInstance != nullptr) {
+        mpInstance = nullptr;
+    }
+}
+
+template<typename T> BinaryLoader<T> *BinaryLoader<T>::mpInstance = nullptr;
@@ -12,15 +12,24 @@
  * @date 2023-02-14
 **/
 
-#include <fstream>
+#include <charconv>
+#include <cstring>
+#include <thread>
 
 #include <data-loader/concrete/CSVLoader.hpp>
+#include <helpers/MappedFile.hpp>
+#include <helpers/ParallelBlocks.hpp>
+#include <helpers/ParallelFileWriter.hpp>
 
 using namespace std;
 
 using namespace exageostat::configurations;
 using namespace exageostat::common;
 using namespace exageostat::dataLoader::csv;
+using namespace exageostat::helpers;
+
+// Minimum number of lines formatted by a thread when writing.
+#define WRITE_CHUNK_LINES ((size_t) 1 << 16)
 
 template<typename T>
 CSVLoader<T> *CSVLoader<T>::GetInstance() {
@@ -31,9 +40,111 @@ CSVLoader<T> *CSVLoader<T>::GetInstance() {
     return mpInstance;
 }
 
+/**
+ * @brief Splits a text into chunks that start at the beginning of a line.
+ * @param[in] apBegin The beginning of the text.
+ * @param[in] apEnd The end of the text.
+ * @param[in] aChunksNumber The maximum number of chunks.
+ * @return The boundaries of the chunks, chunk i spans [boundaries[i], boundaries[i + 1]).
+ *
+ */
+static vector<const char *> SplitLines(const char *apBegin, const char *apEnd, const int &aChunksNumber) {
+
+    vector<const char *> boundaries{apBegin};
+    size_t chunk_size = (apEnd - apBegin) / aChunksNumber + 1;
+    for (int chunk = 1; chunk < aChunksNumber; chunk++) {
+        const char *pPosition = max(boundaries.back(), apBegin + min(chunk * chunk_size, (size_t) (apEnd - apBegin)));
+        // Move the boundary past the end of the line it falls in.
+        if (pPosition != apBegin && pPosition != apEnd && pPosition[-1] != '\n') {
+            auto *pNewline = (const char *) memchr(pPosition, '\n', apEnd - pPosition);
+            pPosition = pNewline ? pNewline + 1 : apEnd;
+        }
+        boundaries.push_back(pPosition);
+    }
+    boundaries.push_back(apEnd);
+    return boundaries;
+}
+
+/**
+ * @brief Gets the end of the line starting at a position, without its end of line characters.
+ * @param[in] apLine The beginning of the line.
+ * @param[in] apEnd The end of the text.
+ * @param[out] apNext The beginning of the next line.
+ * @return The end of the line content.
+ *
+ */
+static const char *LineEnd(const char *apLine, const char *apEnd, const char *&apNext) {
+
+    auto *pNewline = (const char *) memchr(apLine, '\n', apEnd - apLine);
+    apNext = pNewline ? pNewline + 1 : apEnd;
+    const char *pLineEnd = pNewline ? pNewline : apEnd;
+    if (pLineEnd != apLine && pLineEnd[-1] == '\r') {
+        pLineEnd--;
+    }
+    return pLineEnd;
+}
+
+/**
+ * @brief Counts the non-empty lines of a text.
+ * @param[in] apBegin The beginning of the text.
+ * @param[in] apEnd The end of the text.
+ * @return The number of non-empty lines.
+ *
+ */
+static size_t CountLines(const char *apBegin, const char *apEnd) {
+
+    size_t lines_number = 0;
+    const char *pNext;
+    for (const char *pLine = apBegin; pLine < apEnd; pLine = pNext) {
+        if (LineEnd(pLine, apEnd, pNext) != pLine) {
+            lines_number++;
+        }
+    }
+    return lines_number;
+}
+
+/**
+ * @brief Gets the number of chunks a file is parsed with.
+ * @param[in] aConfigurations The configurations, holding the number of cores.
+ * @param[in] apBegin The beginning of the file.
+ * @param[in] apEnd The end of the file.
+ * @return One chunk per core, without going below a megabyte per chunk.
+ *
+ */
+static int GetChunksNumber(Configurations &aConfigurations, const char *apBegin, const char *apEnd) {
+
+    size_t megabytes = (apEnd - apBegin) >> 20;
+    return (int) max((size_t) 1, min((size_t) aConfigurations.GetCoresNumber(), megabytes));
+}
+
+template<typename T>
+int CSVLoader<T>::CountLocations(Configurations &aConfigurations, const int &aP) {
+
+    //Check if the user entered a valid path for the CSV file.
+    if (aConfigurations.GetDataPath().empty()) {
+        throw runtime_error("Please enter the path to data file.");
+    }
+    MappedFile file(aConfigurations.GetDataPath());
+    int chunks_number = GetChunksNumber(aConfigurations, file.Begin(), file.End());
+    auto boundaries = SplitLines(file.Begin(), file.End(), chunks_number);
+
+    vector<size_t> lines_numbers(chunks_number);
+    ParallelBlocks::ForEachBlock(chunks_number, 1, chunks_number, [&](const int &aChunk, const int &, const int &) {
+        lines_numbers[aChunk] = CountLines(boundaries[aChunk], boundaries[aChunk + 1]);
+    });
+    size_t lines_number = 0;
+    for (auto chunk_lines: lines_numbers) {
+        lines_number += chunk_lines;
+    }
+
+    //problem size is equal to the number of the CSV lines * P / aConfigurations.GetTimeSlot().
+    aConfigurations.SetProblemSize((int) lines_number * aP / aConfigurations.GetTimeSlot());
+    return (int) lines_number;
+}
+
 template<typename T>
-void CSVLoader<T>::ReadData(Configurations &aConfigurations, vector<T> &aMeasurementsMatrix, vector<T> &aXLocations,
-                            vector<T> &aYLocations, vector<T> &aZLocations, const int &aP) {
+void CSVLoader<T>::ReadData(Configurations &aConfigurations, dataunits::Locations<T> &aLocations, T *apMeasurements,
+                            const int &aP) {
 
     //Check if the user entered a valid path for the CSV file.
     if (aConfigurations.GetDataPath().empty()) {
@@ -42,193 +153,138 @@ void CSVLoader<T>::ReadData(Configurations &aConfigurations, vector<T> &aMeasure
 
     string data_path = aConfigurations.GetDataPath();
     Dimension dimension = aConfigurations.GetDimension();
-    ifstream file;
+    //If its a 2D locations' data, the values after X and Y are the measurements.
+    //If its 3D or ST locations' data, the third value is the Z or the Time coordinate.
+    int coordinates_number = dimension == Dimension2D ? 2 : 3;
+    int values_number = coordinates_number + aP;
+    size_t locations_number = aConfigurations.GetProblemSize() / aP;
+    size_t measurements_number = aConfigurations.GetProblemSize();
+    T *axes[3] = {aLocations.GetLocationX(), aLocations.GetLocationY(), aLocations.GetLocationZ()};
 
-    file.open(data_path, ios::in);
+    MappedFile file(data_path);
+    int chunks_number = GetChunksNumber(aConfigurations, file.Begin(), file.End());
+    auto boundaries = SplitLines(file.Begin(), file.End(), chunks_number);
 
-    //Throw error if unable to open file.
-    if (!file.is_open()) {
-        throw runtime_error("Cannot read locations file: " + data_path);
+    // The first line of every chunk.
+    vector<size_t> first_lines(chunks_number + 1, 0);
+    ParallelBlocks::ForEachBlock(chunks_number, 1, chunks_number, [&](const int &aChunk, const int &, const int &) {
+        first_lines[aChunk + 1] = CountLines(boundaries[aChunk], boundaries[aChunk + 1]);
+    });
+    for (int chunk = 0; chunk < chunks_number; chunk++) {
+        first_lines[chunk + 1] += first_lines[chunk];
     }
 
-    //Keep track of number of lines.
-    int index = 0;
-    string line;
-    //Loop through the lines
-    while (getline(file, line)) {
-        istringstream iss(line);
-        string token;
-
-        // Split each line into tokens using ',' as the delimiter
-        if (getline(iss, token, ',')) {
-            aXLocations.push_back(stod(token));
-        }
-        if (getline(iss, token, ',')) {
-            aYLocations.push_back(stod(token));
-        }
-        if (getline(iss, token, ',')) {
-            //If its a 2D locations' data, the last values of the lines should be the measurement values.
-            //If its 3D locations' data, the third value of the line should be the Z coordinate.
-            //If its ST location data, the third value of the line should be the Time coordinate
-            if (dimension == Dimension2D) {
-                aMeasurementsMatrix.push_back(stod(token));
-                //if p == 2, the third and fourth values of each line are saved in the Measurements Matrix.
-                if (aP == 2) {
-                    if (getline(iss, token, ',')) {
-                        aMeasurementsMatrix.push_back(stod(token));
-                    } else {
-                        throw runtime_error(
-                                "The data P in the provided file isn't consistent with the Kernel's P.");
-                    }
+    ParallelBlocks::ForEachBlock(chunks_number, 1, chunks_number, [&](const int &aChunk, const int &, const int &) {
+        size_t line_index = first_lines[aChunk];
+        const char *pEnd = boundaries[aChunk + 1];
+        const char *pNext;
+        vector<T> values(values_number);
+        for (const char *pLine = boundaries[aChunk]; pLine < pEnd; pLine = pNext) {
+            const char *pLineEnd = LineEnd(pLine, pEnd, pNext);
+            if (pLineEnd == pLine) {
+                continue;
+            }
+            // Split the line into values using ',' as the delimiter.
+            int tokens_number = 0;
+            for (const char *pToken = pLine; pToken <= pLineEnd; tokens_number++) {
+                auto *pComma = (const char *) memchr(pToken, ',', pLineEnd - pToken);
+                const char *pTokenEnd = pComma ? pComma : pLineEnd;
+                if (tokens_number >= values_number) {
+                    throw runtime_error(
+                            "The data dimensions in the provided file isn't consistent with the dimensions input.");
                 }
-                if (aP == 3) {
-                    //if p == 3, the third, fourth, and fifth values of each line are saved in the Measurements Matrix.
-                    if (getline(iss, token, ',')) {
-                        aMeasurementsMatrix.push_back(stod(token));
-                    }
-                    if (getline(iss, token, ',')) {
-                        aMeasurementsMatrix.push_back(stod(token));
-                    } else {
-                        throw runtime_error(
-                                "The data P in the provided file isn't consistent with the Kernel's P.");
-                    }
+                const char *pValue = pToken;
+                while (pValue < pTokenEnd && (*pValue == ' ' || *pValue == '\t' || *pValue == '+')) {
+                    pValue++;
                 }
-            } else {
-                aZLocations.push_back(stod(token));
+                auto result = from_chars(pValue, pTokenEnd, values[tokens_number]);
+                if (result.ec != errc() || pValue == pTokenEnd) {
+                    throw runtime_error("Invalid value in the data file: " + string(pToken, pTokenEnd));
+                }
+                pToken = pTokenEnd + 1;
+            }
+            if (tokens_number <= coordinates_number) {
+                throw runtime_error("The data dimensions in the provided file isn't consistent with the dimensions input.");
+            } else if (tokens_number < values_number) {
+                throw runtime_error("The data P in the provided file isn't consistent with the Kernel's P.");
             }
-        }
 
-        if (getline(iss, token, ',')) {
-            if (dimension != Dimension2D) {
-                aMeasurementsMatrix.push_back(stod(token));
-                //if p == 2, the fourth and fifth values of each line are saved in the Measurements Matrix.
-                if (aP == 2) {
-                    if (getline(iss, token, ',')) {
-                        aMeasurementsMatrix.push_back(stod(token));
-                    } else {
-                        throw runtime_error(
-                                "The data P in the provided file isn't consistent with the Kernel's P.");
-                    }
-                }
-                if (aP == 3) {
-                    //if p == 3, the fourth, fifth, and sixth values of each line are saved in the Measurements Matrix.
-                    if (getline(iss, token, ',')) {
-                        aMeasurementsMatrix.push_back(stod(token));
-                    }
-                    if (getline(iss, token, ',')) {
-                        aMeasurementsMatrix.push_back(stod(token));
-                    } else {
-                        throw runtime_error(
-                                "The data P in the provided file isn't consistent with the Kernel's P.");
-                    }
+            if (line_index < locations_number) {
+                for (int axis = 0; axis < coordinates_number; axis++) {
+                    axes[axis][line_index] = values[axis];
                 }
-            } else {
-                throw runtime_error(
-                        "The data dimensions in the provided file isn't consistent with the dimensions input.");
             }
-        } else if (dimension != Dimension2D) {
-            throw runtime_error("The data dimensions in the provided file isn't consistent with the dimensions input.");
+            for (int i = 0; i < aP && line_index * aP + i < measurements_number; i++) {
+                apMeasurements[line_index * aP + i] = values[coordinates_number + i];
+            }
+            line_index++;
         }
-        index++;
-    }
+    });
 
-    //problem size is equal to the number of the CSV lines * P / aConfigurations.GetTimeSlot().
-    aConfigurations.SetProblemSize(index * aP / aConfigurations.GetTimeSlot());
-
-    file.close();
     LOGGER("\tData is read from " << data_path << " successfully.")
 }
 
+/**
+ * @brief Appends a value and its separator to a text buffer.
+ * @details The 15 significant digits match the former stream output, while to_chars does not go through the locale.
+ * @param[in,out] aBuffer The text buffer.
+ * @param[in] aValue The value to append.
+ * @param[in] aSeparator The character following the value.
+ * @return void
+ *
+ */
+template<typename T>
+static void AppendValue(string &aBuffer, const T &aValue, const char &aSeparator) {
+
+    char text[32];
+    auto result = to_chars(text, text + sizeof(text), aValue, chars_format::general, 15);
+    aBuffer.append(text, result.ptr);
+    aBuffer.push_back(aSeparator);
+}
+
 template<typename T>
 void CSVLoader<T>::WriteData(const T &aMatrixPointer, const int &aProblemSize, const int &aP, std::string &aLoggerPath,
                              dataunits::Locations<T> &aLocations) {
-    // Determine the path for storing the output files
-    if (aLoggerPath.empty()) {
-        aLoggerPath = LOG_PATH;
-    } else {
-        if (aLoggerPath.back() == '/') {
-            aLoggerPath += "synthetic_ds";
-        } else {
-            aLoggerPath += "/synthetic_ds";
-        }
-    }
-    // Create a new directory if it does not already exist
-    bool created;
-    if (!filesystem::exists(aLoggerPath)) {
-        try {
-            created = filesystem::create_directories(aLoggerPath);
-        } catch (const filesystem::filesystem_error &e) {
-            throw runtime_error("Error creating directory: " + aLoggerPath);
-        }
-    } else {
-        created = true;
-    }
 
-    // Check if the directory was created successfully
-    if (!created) {
-        throw runtime_error("Error creating directory: " + aLoggerPath);
-    }
+    // Determine the name of the output file
+    std::string n_file_synthetic = this->GetOutputFilePath(aLoggerPath, aProblemSize / aP);
+    size_t begin, end;
+    ParallelFileWriter::GetBlock(aProblemSize / aP, begin, end);
 
-    // Determine the names of the output files
-    size_t i = 1, j;
-    std::ofstream p_file_synthetic, p_file_log;
-    std::string n_file_synthetic = aLoggerPath + "/SYN_" + std::to_string(aProblemSize / aP) + "_";
-    std::string n_file_log = aLoggerPath + "/log_" + std::to_string(aProblemSize / aP) + "_";
-    std::string temp = n_file_log + std::to_string(i);
-
-    // Check if log file exists
-    while (std::filesystem::exists(temp)) {
-        i++;
-        temp = n_file_log + std::to_string(i);
-    }
+    //2 Dimensions have X and Y only, 3 Dimensions and space-time have Z or the time as third value.
+    T *axes[3] = {aLocations.GetLocationX(), aLocations.GetLocationY(), aLocations.GetLocationZ()};
+    int coordinates_number = aLocations.GetLocationZ() == nullptr ? 2 : 3;
 
-    n_file_synthetic += std::to_string(i);
-    p_file_synthetic.open(n_file_synthetic);
-
-    for (j = 0, i = 0; i < aProblemSize / aP; i++) {
-        if (aLocations.GetLocationZ() == nullptr) {
-            //2 Dimensions
-            if (aP == 1) {
-                p_file_synthetic << std::setprecision(15) << aLocations.GetLocationX()[i] << ','
-                                 << aLocations.GetLocationY()[i] << "," << std::setprecision(15) << (&aMatrixPointer)[i]
-                                 << '\n';
-            } else if (aP == 2) {
-                p_file_synthetic << std::setprecision(15) << aLocations.GetLocationX()[i] << ','
-                                 << aLocations.GetLocationY()[i] << "," << std::setprecision(15) << (&aMatrixPointer)[j]
-                                 << ","
-                                 << std::setprecision(15) << (&aMatrixPointer)[j + 1] << '\n';
-                j += 2;
-            } else if (aP == 3) {
-                p_file_synthetic << std::setprecision(15) << aLocations.GetLocationX()[i] << ','
-                                 << aLocations.GetLocationY()[i] << "," << std::setprecision(15) << (&aMatrixPointer)[j]
-                                 << ","
-                                 << std::setprecision(15) << (&aMatrixPointer)[j + 1] << "," << std::setprecision(15)
-                                 << (&aMatrixPointer)[j + 2] << '\n';
-                j += 3;
+    // Format the lines of this process into one buffer per thread.
+    int chunks_number = (int) max((size_t) 1, min((size_t) thread::hardware_concurrency(),
+                                                   (end - begin) / WRITE_CHUNK_LINES));
+    vector<string> buffers(chunks_number);
+    ParallelBlocks::ForEachBlock(chunks_number, 1, chunks_number, [&](const int &aChunk, const int &, const int &) {
+        size_t first_line = begin + (end - begin) * aChunk / chunks_number;
+        size_t last_line = begin + (end - begin) * (aChunk + 1) / chunks_number;
+        string &buffer = buffers[aChunk];
+        buffer.reserve((last_line - first_line) * (coordinates_number + aP) * 24);
+        for (size_t i = first_line; i < last_line; i++) {
+            for (int axis = 0; axis < coordinates_number; axis++) {
+                AppendValue(buffer, axes[axis][i], ',');
             }
-        } else {
-            //3 Dimensions
-            if (aP == 1) {
-                p_file_synthetic << std::setprecision(15) << aLocations.GetLocationX()[i] << ','
-                                 << aLocations.GetLocationY()[i] << ',' << aLocations.GetLocationZ()[i] << ","
-                                 << std::setprecision(15) << (&aMatrixPointer)[i] << '\n';
-            } else if (aP == 2) {
-                p_file_synthetic << std::setprecision(15) << aLocations.GetLocationX()[i] << ','
-                                 << aLocations.GetLocationY()[i] << ',' << aLocations.GetLocationZ()[i] << ","
-                                 << std::setprecision(15) << (&aMatrixPointer)[j] << std::setprecision(15) << ","
-                                 << (&aMatrixPointer)[j + 1] << '\n';
-                j += 2;
-            } else if (aP == 3) {
-                p_file_synthetic << std::setprecision(15) << aLocations.GetLocationX()[i] << ','
-                                 << aLocations.GetLocationY()[i] << ',' << aLocations.GetLocationZ()[i] << ","
-                                 << std::setprecision(15) << (&aMatrixPointer)[j] << "," << std::setprecision(15)
-                                 << (&aMatrixPointer)[j + 1] << "," << std::setprecision(15) << (&aMatrixPointer)[j + 2]
-                                 << '\n';
-                j += 3;
+            for (int j = 0; j < aP; j++) {
+                AppendValue(buffer, (&aMatrixPointer)[i * aP + j], j == aP - 1 ? '\n' : ',');
             }
         }
+    });
+
+    // Write the buffers one after the other, after the lines of the previous processes.
+    size_t bytes_number = 0;
+    for (auto &buffer: buffers) {
+        bytes_number += buffer.size();
+    }
+    ParallelFileWriter file(n_file_synthetic);
+    uint64_t offset = file.GetOffset(bytes_number);
+    for (auto &buffer: buffers) {
+        file.WriteAt(offset, buffer.data(), buffer.size());
+        offset += buffer.size();
     }
-    p_file_synthetic.close();
 }
 
 template<typename T>
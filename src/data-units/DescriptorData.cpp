@@ -12,6 +12,8 @@
  * @date 2023-07-18
 **/
 
+#include <cstring>
+
 #include <data-units/DescriptorData.hpp>
 
 using namespace exageostat::dataunits;
@@ -56,7 +58,12 @@ void *DescriptorData<T>::GetSequence() {
 
 template<typename T>
 void DescriptorData<T>::SetRequest(void *apRequest) {
-    this->mpRequest = apRequest;
+    if (apRequest == nullptr) {
+        this->mpRequest = nullptr;
+        return;
+    }
+    memcpy(this->mRequest, apRequest, sizeof(this->mRequest));
+    this->mpRequest = this->mRequest;
 }
 
 template<typename T>
@@ -284,6 +291,36 @@ std::string DescriptorData<T>::GetDescriptorName(const DescriptorName &aDescript
             return "DESCRIPTOR_R";
         case DESCRIPTOR_R_COPY :
             return "DESCRIPTOR_R_COPY";
+        case DESCRIPTOR_DISTANCE :
+            return "DESCRIPTOR_DISTANCE";
+        case DESCRIPTOR_C_SINGLE :
+            return "DESCRIPTOR_C_SINGLE";
+        case DESCRIPTOR_CL :
+            return "DESCRIPTOR_CL";
+        case DESCRIPTOR_CM :
+            return "DESCRIPTOR_CM";
+        case DESCRIPTOR_C_INVERSE :
+            return "DESCRIPTOR_C_INVERSE";
+        case DESCRIPTOR_Z_SOLVED :
+            return "DESCRIPTOR_Z_SOLVED";
+        case DESCRIPTOR_Z_DERIVATIVE :
+            return "DESCRIPTOR_Z_DERIVATIVE";
+        case DESCRIPTOR_PROBES :
+            return "DESCRIPTOR_PROBES";
+        case DESCRIPTOR_PROBES_CROSS :
+            return "DESCRIPTOR_PROBES_CROSS";
+        case DESCRIPTOR_PROBES_DERIVATIVE_1 :
+            return "DESCRIPTOR_PROBES_DERIVATIVE_1";
+        case DESCRIPTOR_PROBES_DERIVATIVE_2 :
+            return "DESCRIPTOR_PROBES_DERIVATIVE_2";
+        case DESCRIPTOR_PROBES_DERIVATIVE_3 :
+            return "DESCRIPTOR_PROBES_DERIVATIVE_3";
+        case DESCRIPTOR_PROBES_DERIVATIVE_4 :
+            return "DESCRIPTOR_PROBES_DERIVATIVE_4";
+        case DESCRIPTOR_KRIGING_VARIANCE :
+            return "DESCRIPTOR_KRIGING_VARIANCE";
+        case DESCRIPTOR_C_PANEL :
+            return "DESCRIPTOR_C_PANEL";
         default:
             throw std::invalid_argument(
                     "The name of descriptor you provided is undefined, Please read the user manual to know the available descriptors");
@@ -71,6 +71,26 @@ int ExaGeoStatData<T>::GetMleIterations() {
     return this->mMleIterations;
 }
 
+template<typename T>
+void ExaGeoStatData<T>::SetFactorTheta(const std::vector<T> &aFactorTheta) {
+    this->mFactorTheta = aFactorTheta;
+}
+
+template<typename T>
+std::vector<T> &ExaGeoStatData<T>::GetFactorTheta() {
+    return this->mFactorTheta;
+}
+
+template<typename T>
+void ExaGeoStatData<T>::SetOriginalIndices(const std::vector<int> &aOriginalIndices) {
+    this->mOriginalIndices = aOriginalIndices;
+}
+
+template<typename T>
+std::vector<int> &ExaGeoStatData<T>::GetOriginalIndices() {
+    return this->mOriginalIndices;
+}
+
 template<typename T>
 void ExaGeoStatData<T>::CalculateMedianLocations(const std::string &aKernelName, Locations<T> &aLocations) {
 
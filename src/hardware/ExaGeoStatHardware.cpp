@@ -128,7 +128,7 @@ void *ExaGeoStatHardware::GetChameleonContext() {
 }
 
 void *ExaGeoStatHardware::GetContext(Computation aComputation) {
-    if (aComputation == EXACT_DENSE || aComputation == DIAGONAL_APPROX) {
+    if (aComputation == EXACT_DENSE || aComputation == DIAGONAL_APPROX || aComputation == VECCHIA_APPROX) {
         return GetChameleonContext();
     }
     if (aComputation == TILE_LOW_RANK) {
@@ -35,6 +35,18 @@ int CommunicatorMPI::GetRank() const {
 #endif
 }
 
+int CommunicatorMPI::GetSize() const {
+#ifdef USE_MPI
+    if (!mIsHardwareInitialized) {
+        return 1;
+    } else {
+        return CHAMELEON_Comm_size();
+    }
+#else
+    return 1;
+#endif
+}
+
 void CommunicatorMPI::SetHardwareInitialization() {
     mIsHardwareInitialized = true;
 }
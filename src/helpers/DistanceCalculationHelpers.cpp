@@ -12,7 +12,10 @@
  * @date 2023-06-08
 **/
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 #include <helpers/DistanceCalculationHelpers.hpp>
 
@@ -65,4 +68,96 @@ T DistanceCalculationHelpers<T>::CalculateDistance(exageostat::dataunits::Locati
         dz = z2 - z1;
         return sqrt(pow(dx, 2) + pow(dy, 2) + pow(dz, 2));
     }
-}
\ No newline at end of file
+}
+template<typename T>
+void DistanceCalculationHelpers<T>::CalculateTileDistances(T *apDistances,
+                                                           exageostat::dataunits::Locations<T> &aLocations1,
+                                                           exageostat::dataunits::Locations<T> &aLocations2,
+                                                           const int &aRowsNumber, const int &aColumnsNumber,
+                                                           const int &aRowOffset, const int &aColumnOffset,
+                                                           const int &aDistanceMetric, const int &aFlagZ) {
+
+    const T *x1 = aLocations1.GetLocationX() + aRowOffset;
+    const T *y1 = aLocations1.GetLocationY() + aRowOffset;
+    const T *x2 = aLocations2.GetLocationX() + aColumnOffset;
+    const T *y2 = aLocations2.GetLocationY() + aColumnOffset;
+    const bool is_3d = aLocations1.GetLocationZ() != nullptr && aLocations2.GetLocationZ() != nullptr && aFlagZ != 0;
+    int i, j;
+
+    if (aDistanceMetric == 1) {
+        if (is_3d) {
+            throw std::runtime_error("Great Circle (GC) distance is only valid for 2D!");
+        }
+        // Each location is converted to radians once per tile, the haversine is then evaluated on the cached values.
+        std::vector<T> lat1(aRowsNumber), lon1(aRowsNumber), cos_lat1(aRowsNumber);
+        for (i = 0; i < aRowsNumber; i++) {
+            lat1[i] = DegreeToRadian(x1[i]);
+            lon1[i] = DegreeToRadian(y1[i]);
+            cos_lat1[i] = cos(lat1[i]);
+        }
+        for (j = 0; j < aColumnsNumber; j++) {
+            const T lat2 = DegreeToRadian(x2[j]);
+            const T lon2 = DegreeToRadian(y2[j]);
+            const T cos_lat2 = cos(lat2);
+            T *pColumn = apDistances + (size_t) j * aRowsNumber;
+            for (i = 0; i < aRowsNumber; i++) {
+                const T u = sin((lat2 - lat1[i]) / 2);
+                const T v = sin((lon2 - lon1[i]) / 2);
+                pColumn[i] = 2.0 * EARTH_RADIUS * asin(sqrt(u * u + cos_lat1[i] * cos_lat2 * v * v));
+            }
+        }
+        return;
+    }
+
+    if (is_3d) {
+        const T *z1 = aLocations1.GetLocationZ() + aRowOffset;
+        const T *z2 = aLocations2.GetLocationZ() + aColumnOffset;
+        for (j = 0; j < aColumnsNumber; j++) {
+            T *pColumn = apDistances + (size_t) j * aRowsNumber;
+            for (i = 0; i < aRowsNumber; i++) {
+                const T dx = x2[j] - x1[i];
+                const T dy = y2[j] - y1[i];
+                const T dz = z2[j] - z1[i];
+                pColumn[i] = sqrt(dx * dx + dy * dy + dz * dz);
+            }
+        }
+    } else {
+        for (j = 0; j < aColumnsNumber; j++) {
+            T *pColumn = apDistances + (size_t) j * aRowsNumber;
+            for (i = 0; i < aRowsNumber; i++) {
+                const T dx = x2[j] - x1[i];
+                const T dy = y2[j] - y1[i];
+                pColumn[i] = sqrt(dx * dx + dy * dy);
+            }
+        }
+    }
+}
+
+template<typename T>
+T DistanceCalculationHelpers<T>::CalculateMaximumDistance(exageostat::dataunits::Locations<T> &aLocations1,
+                                                          exageostat::dataunits::Locations<T> &aLocations2,
+                                                          const int &aDistanceMetric, const int &aFlagZ) {
+
+    if (aDistanceMetric == 1) {
+        return PI * EARTH_RADIUS;
+    }
+    const bool is_3d = aLocations1.GetLocationZ() != nullptr && aLocations2.GetLocationZ() != nullptr && aFlagZ != 0;
+    const int dimensions = is_3d ? 3 : 2;
+    T squared_diagonal = 0;
+
+    for (int dimension = 0; dimension < dimensions; dimension++) {
+        T min_value = std::numeric_limits<T>::max();
+        T max_value = std::numeric_limits<T>::lowest();
+        for (auto *pLocations: {&aLocations1, &aLocations2}) {
+            const T *pCoordinates = dimension == 0 ? pLocations->GetLocationX() : dimension == 1
+                                                                                   ? pLocations->GetLocationY()
+                                                                                   : pLocations->GetLocationZ();
+            for (int i = 0; i < pLocations->GetSize(); i++) {
+                min_value = std::min(min_value, pCoordinates[i]);
+                max_value = std::max(max_value, pCoordinates[i]);
+            }
+        }
+        squared_diagonal += (max_value - min_value) * (max_value - min_value);
+    }
+    return sqrt(squared_diagonal);
+}
@@ -0,0 +1,252 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file MLECheckpoint.cpp
+ * @brief Contains the implementation of the MLECheckpoint class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <helpers/CommunicatorMPI.hpp>
+#include <helpers/MLECheckpoint.hpp>
+#include <helpers/ParallelFileWriter.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+
+//// Signature at the beginning of every checkpoint file.
+static const char CHECKPOINT_MAGIC[8] = {'E', 'X', 'A', 'G', 'E', 'O', 'C', 'K'};
+
+MLECheckpoint::MLECheckpoint(const string &aPath, const int &aParametersNumber, const CheckpointProblem &aProblem,
+                             const bool &aHasGradient, const bool &aIsWriter) {
+
+    this->mPath = aPath;
+    this->mRecordSize = aParametersNumber * (aHasGradient ? 2 : 1) + 1;
+    memcpy(this->mHeader.mMagic, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    this->mHeader.mVersion = FORMAT_VERSION;
+    this->mHeader.mParametersNumber = aParametersNumber;
+    this->mHeader.mHasGradient = aHasGradient ? 1 : 0;
+    this->mHeader.mComputation = aProblem.mComputation;
+    this->mHeader.mProblemSize = aProblem.mProblemSize;
+    this->mHeader.mDataChecksum = aProblem.mDataChecksum;
+    strncpy(this->mHeader.mKernelName, aProblem.mKernelName.c_str(), sizeof(this->mHeader.mKernelName) - 1);
+    for (auto *pValues: {&aProblem.mLowerBounds, &aProblem.mUpperBounds, &aProblem.mStartingTheta}) {
+        auto values = *pValues;
+        values.resize(aParametersNumber, 0);
+        this->mProblemValues.insert(this->mProblemValues.end(), values.begin(), values.end());
+    }
+    this->mRecordsOffset = sizeof(CheckpointHeader) + this->mProblemValues.size() * sizeof(double);
+
+    // Only the first process reads the file, the others could see it while it is cleaned up.
+    string error;
+    if (CommunicatorMPI::GetInstance()->GetRank() == 0) {
+        try {
+            this->Load(aProblem);
+            if (aIsWriter) {
+                this->Open();
+            }
+        } catch (exception &e) {
+            error = e.what();
+        }
+    }
+    // An error of the first process is raised by all of them, none of them starts the fit alone.
+    error = ParallelFileWriter::SharePath(error);
+    if (!error.empty()) {
+        throw runtime_error(error);
+    }
+    this->ShareRecords();
+}
+
+MLECheckpoint::~MLECheckpoint() {
+    if (this->mpFile) {
+        fclose(this->mpFile);
+    }
+}
+
+bool MLECheckpoint::Replay(const double *apTheta, double &aLogLik, double *apGradient) {
+
+    if (this->mIsReplayOver) {
+        return false;
+    }
+    size_t parameters_number = this->mHeader.mParametersNumber;
+    const double *pRecord = this->mRecords.data() + this->mReplayedNumber * this->mRecordSize;
+    if (this->mReplayedNumber < this->mHeader.mEvaluationsNumber &&
+        memcmp(pRecord, apTheta, parameters_number * sizeof(double)) == 0) {
+        aLogLik = pRecord[parameters_number];
+        if (apGradient != nullptr && this->mHeader.mHasGradient) {
+            memcpy(apGradient, pRecord + parameters_number + 1, parameters_number * sizeof(double));
+        }
+        this->mReplayedNumber++;
+        return true;
+    }
+
+    // The optimizer left the recorded path, the next records do not belong to this fit any more.
+    this->mIsReplayOver = true;
+    if (this->mReplayedNumber < this->mHeader.mEvaluationsNumber) {
+        this->mHeader.mEvaluationsNumber = this->mReplayedNumber;
+        this->mRecords.resize(this->mReplayedNumber * this->mRecordSize);
+        this->UpdateBestEvaluation();
+        if (this->mpFile) {
+            this->WriteHeader();
+        }
+    }
+    return false;
+}
+
+void MLECheckpoint::Save(const double *apTheta, const double &aLogLik, const double *apGradient) {
+
+    size_t parameters_number = this->mHeader.mParametersNumber;
+    size_t first = this->mRecords.size();
+    this->mRecords.resize(first + this->mRecordSize, 0);
+    memcpy(this->mRecords.data() + first, apTheta, parameters_number * sizeof(double));
+    this->mRecords[first + parameters_number] = aLogLik;
+    if (this->mHeader.mHasGradient && apGradient != nullptr) {
+        memcpy(this->mRecords.data() + first + parameters_number + 1, apGradient, parameters_number * sizeof(double));
+    }
+    if (this->mHeader.mEvaluationsNumber == 0 ||
+        aLogLik > this->mRecords[this->mHeader.mBestEvaluation * this->mRecordSize + parameters_number]) {
+        this->mHeader.mBestEvaluation = this->mHeader.mEvaluationsNumber;
+    }
+    this->mHeader.mEvaluationsNumber++;
+    // Once replayed records are exhausted, no later point can be answered from the file.
+    this->mIsReplayOver = true;
+
+    if (this->mpFile == nullptr) {
+        return;
+    }
+    // The record is written before the header counts it.
+    if (fseek(this->mpFile, (long) (this->mRecordsOffset + first * sizeof(double)), SEEK_SET) != 0 ||
+        fwrite(this->mRecords.data() + first, sizeof(double), this->mRecordSize, this->mpFile) != this->mRecordSize ||
+        fflush(this->mpFile) != 0) {
+        throw runtime_error("Cannot write checkpoint file: " + this->mPath);
+    }
+    this->WriteHeader();
+}
+
+void MLECheckpoint::Load(const CheckpointProblem &aProblem) {
+
+    ifstream file(this->mPath, ios::binary);
+    CheckpointHeader header{};
+    if (!file.read((char *) &header, sizeof(header))) {
+        return;
+    }
+    if (memcmp(header.mMagic, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) != 0 ||
+        header.mVersion != FORMAT_VERSION) {
+        throw runtime_error("Invalid checkpoint file: " + this->mPath);
+    }
+    if (header.mParametersNumber != this->mHeader.mParametersNumber ||
+        header.mHasGradient != this->mHeader.mHasGradient) {
+        throw runtime_error("The checkpoint file does not match the modeling configuration: " + this->mPath);
+    }
+    vector<double> problem_values(this->mProblemValues.size());
+    file.read((char *) problem_values.data(), (streamsize) (problem_values.size() * sizeof(double)));
+    if (!file || header.mProblemSize != aProblem.mProblemSize || header.mComputation != aProblem.mComputation ||
+        memcmp(header.mKernelName, this->mHeader.mKernelName, sizeof(header.mKernelName)) != 0 ||
+        header.mDataChecksum != aProblem.mDataChecksum ||
+        memcmp(problem_values.data(), this->mProblemValues.data(), problem_values.size() * sizeof(double)) != 0) {
+        throw runtime_error("The checkpoint file was recorded for another dataset, kernel, computation, bounds or "
+                            "starting theta: " + this->mPath);
+    }
+    // A record interrupted while written is not counted in the header, a shorter file has lost its end.
+    size_t stored_number = (filesystem::file_size(this->mPath) - this->mRecordsOffset) / sizeof(double) /
+                           this->mRecordSize;
+    this->mHeader.mEvaluationsNumber = min((size_t) header.mEvaluationsNumber, stored_number);
+    this->mRecords.resize(this->mHeader.mEvaluationsNumber * this->mRecordSize);
+    file.read((char *) this->mRecords.data(), (streamsize) (this->mRecords.size() * sizeof(double)));
+    this->UpdateBestEvaluation();
+}
+
+void MLECheckpoint::Open() {
+
+    bool is_new = this->mHeader.mEvaluationsNumber == 0;
+    if (!is_new) {
+        // Drop the end of an interrupted record.
+        filesystem::resize_file(this->mPath,
+                                this->mRecordsOffset + this->mHeader.mEvaluationsNumber * this->mRecordSize *
+                                                       sizeof(double));
+    }
+    this->mpFile = fopen(this->mPath.c_str(), is_new ? "w+b" : "r+b");
+    if (this->mpFile == nullptr) {
+        throw runtime_error("Cannot open checkpoint file: " + this->mPath);
+    }
+    this->WriteHeader();
+    if (is_new && (fwrite(this->mProblemValues.data(), sizeof(double), this->mProblemValues.size(),
+                          this->mpFile) != this->mProblemValues.size() || fflush(this->mpFile) != 0)) {
+        throw runtime_error("Cannot write checkpoint file: " + this->mPath);
+    }
+}
+
+void MLECheckpoint::ShareRecords() {
+#ifdef USE_MPI
+    if (CommunicatorMPI::GetInstance()->GetSize() > 1) {
+        MPI_Bcast(&this->mHeader, sizeof(this->mHeader), MPI_BYTE, 0, MPI_COMM_WORLD);
+        this->mRecords.resize(this->mHeader.mEvaluationsNumber * this->mRecordSize);
+        MPI_Bcast(this->mRecords.data(), (int) this->mRecords.size(), MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    }
+#endif
+}
+
+void MLECheckpoint::UpdateBestEvaluation() {
+
+    size_t parameters_number = this->mHeader.mParametersNumber;
+    this->mHeader.mBestEvaluation = 0;
+    for (size_t i = 1; i < this->mHeader.mEvaluationsNumber; i++) {
+        if (this->mRecords[i * this->mRecordSize + parameters_number] >
+            this->mRecords[this->mHeader.mBestEvaluation * this->mRecordSize + parameters_number]) {
+            this->mHeader.mBestEvaluation = i;
+        }
+    }
+}
+
+void MLECheckpoint::WriteHeader() {
+
+    if (fseek(this->mpFile, 0, SEEK_SET) != 0 ||
+        fwrite(&this->mHeader, sizeof(this->mHeader), 1, this->mpFile) != 1 || fflush(this->mpFile) != 0) {
+        throw runtime_error("Cannot write checkpoint file: " + this->mPath);
+    }
+}
+
+int MLECheckpoint::GetEvaluationsNumber() const {
+    return (int) this->mHeader.mEvaluationsNumber;
+}
+
+int MLECheckpoint::GetReplayedNumber() const {
+    return (int) this->mReplayedNumber;
+}
+
+vector<double> MLECheckpoint::GetBestTheta() const {
+
+    if (this->mHeader.mEvaluationsNumber == 0) {
+        return {};
+    }
+    auto pRecord = this->mRecords.begin() + (long) (this->mHeader.mBestEvaluation * this->mRecordSize);
+    return {pRecord, pRecord + this->mHeader.mParametersNumber};
+}
+
+double MLECheckpoint::GetBestLogLik() const {
+
+    if (this->mHeader.mEvaluationsNumber == 0) {
+        return 0;
+    }
+    return this->mRecords[this->mHeader.mBestEvaluation * this->mRecordSize + this->mHeader.mParametersNumber];
+}
+
+uint64_t MLECheckpoint::GetChecksum(const void *apData, const size_t &aSize, const uint64_t &aChecksum) {
+
+    uint64_t checksum = aChecksum;
+    auto *pBytes = (const unsigned char *) apData;
+    for (size_t i = 0; i < aSize; i++) {
+        checksum = (checksum ^ pBytes[i]) * 1099511628211ULL;
+    }
+    return checksum;
+}
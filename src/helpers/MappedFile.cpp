@@ -0,0 +1,69 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file MappedFile.cpp
+ * @brief Contains the implementation of the MappedFile class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <helpers/MappedFile.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+
+MappedFile::MappedFile(const string &aPath) {
+
+    int file_descriptor = open(aPath.c_str(), O_RDONLY);
+    //Throw error if unable to open file.
+    if (file_descriptor < 0) {
+        throw runtime_error("Cannot read locations file: " + aPath);
+    }
+    struct stat file_status{};
+    if (fstat(file_descriptor, &file_status) != 0) {
+        close(file_descriptor);
+        throw runtime_error("Cannot read locations file: " + aPath);
+    }
+    this->mSize = (size_t) file_status.st_size;
+    if (this->mSize > 0) {
+        void *pMapping = mmap(nullptr, this->mSize, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (pMapping == MAP_FAILED) {
+            close(file_descriptor);
+            throw runtime_error("Cannot map locations file: " + aPath);
+        }
+        // The files are read once from the beginning to the end.
+        madvise(pMapping, this->mSize, MADV_SEQUENTIAL);
+        this->mpData = (const char *) pMapping;
+    }
+    close(file_descriptor);
+}
+
+MappedFile::~MappedFile() {
+    if (this->mpData) {
+        munmap((void *) this->mpData, this->mSize);
+    }
+}
+
+const char *MappedFile::Begin() const {
+    return this->mpData;
+}
+
+const char *MappedFile::End() const {
+    return this->mpData + this->mSize;
+}
+
+size_t MappedFile::GetSize() const {
+    return this->mSize;
+}
@@ -0,0 +1,152 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file MaternInterpolationTable.cpp
+ * @brief Contains the implementation of the MaternInterpolationTable class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+extern "C" {
+#include <gsl/gsl_sf_bessel.h>
+}
+
+#include <helpers/MaternInterpolationTable.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+
+// Smallest tabulated distance, relative to the largest one.
+#define MATERN_TABLE_MIN_DISTANCE_RATIO 1e-8
+// Initial and maximum number of grid intervals.
+#define MATERN_TABLE_INITIAL_INTERVALS 64
+#define MATERN_TABLE_MAX_INTERVALS 65536
+// Maximum of |(t + 1) t (t - 1) (t - 2)| over [0, 1], reached at t = 1 / 2.
+#define MATERN_TABLE_NODE_POLYNOMIAL_MAXIMUM 0.5625
+
+// Radii of the discs of the Cauchy estimates, below pi / 2 so that the discs stay in the right half plane.
+static const double MATERN_TABLE_CAUCHY_RADII[] = {0.25, 0.5, 1.0, 1.4};
+
+template<typename T>
+MaternInterpolationTable<T>::MaternInterpolationTable(const T &aNu, const T &aMaxDistance,
+                                                      const double &aRelativeTolerance) {
+
+    this->mNu = aNu;
+    this->mMaxDistance = aMaxDistance;
+    this->mMinDistance = aMaxDistance * MATERN_TABLE_MIN_DISTANCE_RATIO;
+    this->mLogMinDistance = log(this->mMinDistance);
+    this->mRelativeTolerance = aRelativeTolerance;
+
+    if (aMaxDistance <= 0) {
+        return;
+    }
+    const double log_range = log(this->mMaxDistance) - this->mLogMinDistance;
+
+    for (int intervals = MATERN_TABLE_INITIAL_INTERVALS; intervals <= MATERN_TABLE_MAX_INTERVALS; intervals *= 2) {
+        const double step = log_range / intervals;
+        this->mIntervalsNumber = intervals;
+        this->mInverseStep = 1.0 / step;
+        this->mValues.resize(intervals + 3);
+        // Node k of the grid is stored at index k + 1, so that every interval has a full four points stencil.
+        for (int k = -1; k <= intervals + 1; k++) {
+            this->mValues[k + 1] = ExactScaledValue(aNu, exp(this->mLogMinDistance + k * step));
+        }
+
+        this->mIsValid = true;
+        for (int k = 0; k < intervals && this->mIsValid; k++) {
+            this->mIsValid = GetErrorBound(k, step) <= aRelativeTolerance;
+        }
+        if (this->mIsValid) {
+            return;
+        }
+    }
+    this->mValues.clear();
+}
+
+template<typename T>
+bool MaternInterpolationTable<T>::IsValid() const {
+    return this->mIsValid;
+}
+
+template<typename T>
+T MaternInterpolationTable<T>::GetNu() const {
+    return this->mNu;
+}
+
+template<typename T>
+T MaternInterpolationTable<T>::GetMaxDistance() const {
+    return this->mMaxDistance;
+}
+
+template<typename T>
+double MaternInterpolationTable<T>::GetRelativeTolerance() const {
+    return this->mRelativeTolerance;
+}
+
+template<typename T>
+double MaternInterpolationTable<T>::ExactScaledValue(const double &aNu, const double &aDistance) {
+    return pow(aDistance, aNu) * gsl_sf_bessel_Knu_scaled(aNu, aDistance);
+}
+
+template<typename T>
+double MaternInterpolationTable<T>::GetErrorBound(const int &aInterval, const double &aStep) const {
+
+    // The scaled function is monotonic, its smallest value over the interval is at one of its nodes.
+    const double minimum = min(this->mValues[aInterval + 1], this->mValues[aInterval + 2]);
+    const double first_node = this->mLogMinDistance + (aInterval - 1) * aStep;
+    const double last_node = this->mLogMinDistance + (aInterval + 2) * aStep;
+
+    double bound = numeric_limits<double>::infinity();
+    for (double radius: MATERN_TABLE_CAUCHY_RADII) {
+        // The discs of this radius around the stencil lie in the rectangle of real parts
+        // [first_node - radius, last_node + radius] and imaginary parts [-radius, radius] of the log variable.
+        // There, the real part of x is between e^(first_node - radius) cos(radius) and e^(last_node + radius).
+        const double cos_radius = cos(radius);
+        const double maximum = pow(cos_radius, -(double) this->mNu) *
+                               max(ExactScaledValue(this->mNu, exp(first_node - radius) * cos_radius),
+                                   ExactScaledValue(this->mNu, exp(last_node + radius)));
+        bound = min(bound, MATERN_TABLE_NODE_POLYNOMIAL_MAXIMUM * pow(aStep / radius, 4) * maximum / minimum);
+    }
+    return bound;
+}
+
+template<typename T>
+double MaternInterpolationTable<T>::Interpolate(const double &aGridPosition) const {
+
+    int k = (int) aGridPosition;
+    if (k > this->mIntervalsNumber - 1) {
+        k = this->mIntervalsNumber - 1;
+    }
+    const double t = aGridPosition - k;
+    const double *pNodes = this->mValues.data() + k;
+
+    // Cubic Lagrange interpolation over the nodes k - 1, k, k + 1 and k + 2.
+    return pNodes[0] * (-t * (t - 1) * (t - 2) / 6) + pNodes[1] * ((t + 1) * (t - 1) * (t - 2) / 2) +
+           pNodes[2] * (-(t + 1) * t * (t - 2) / 2) + pNodes[3] * ((t + 1) * t * (t - 1) / 6);
+}
+
+template<typename T>
+T MaternInterpolationTable<T>::Evaluate(const T &aDistance) const {
+    if (!this->mIsValid || aDistance < this->mMinDistance || aDistance > this->mMaxDistance) {
+        return ExactScaledValue(this->mNu, aDistance) * exp(-aDistance);
+    }
+    return Interpolate((log(aDistance) - this->mLogMinDistance) * this->mInverseStep) * exp(-aDistance);
+}
+
+template<typename T>
+void MaternInterpolationTable<T>::EvaluateTile(T *apDistances, const size_t &aSize, const T &aConstant,
+                                               const T &aZeroValue) const {
+    for (size_t k = 0; k < aSize; k++) {
+        const T dist = apDistances[k];
+        apDistances[k] = (dist == 0.0) ? aZeroValue : aConstant * Evaluate(dist);
+    }
+}
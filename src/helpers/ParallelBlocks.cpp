@@ -0,0 +1,60 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ParallelBlocks.cpp
+ * @brief Contains the implementation of the ParallelBlocks class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <helpers/ParallelBlocks.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+
+void ParallelBlocks::ForEachBlock(const int &aItemsNumber, const int &aBlockSize, const int &aThreadsNumber,
+                                  const function<void(const int &, const int &, const int &)> &aFunction) {
+
+    int blocks_number = (aItemsNumber + aBlockSize - 1) / aBlockSize;
+    int threads_number = max(1, min(aThreadsNumber, blocks_number));
+    atomic<int> next_block(0);
+    vector<exception_ptr> errors(threads_number);
+    auto worker = [&](const int &aThread) {
+        try {
+            int block;
+            while ((block = next_block.fetch_add(1)) < blocks_number) {
+                int first = block * aBlockSize;
+                aFunction(block, first, min(first + aBlockSize, aItemsNumber));
+            }
+        } catch (...) {
+            errors[aThread] = current_exception();
+            // Stop the other threads early.
+            next_block = blocks_number;
+        }
+    };
+    vector<thread> workers;
+    for (int thread_index = 1; thread_index < threads_number; thread_index++) {
+        workers.emplace_back(worker, thread_index);
+    }
+    // The calling thread takes a share of the blocks.
+    worker(0);
+    for (auto &thread_worker: workers) {
+        thread_worker.join();
+    }
+    for (auto &error: errors) {
+        if (error) {
+            rethrow_exception(error);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ParallelFileWriter.cpp
+ * @brief Contains the implementation of the ParallelFileWriter class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <helpers/ParallelFileWriter.hpp>
+#include <helpers/CommunicatorMPI.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+
+// Largest buffer handed to a single write call.
+#define MAX_WRITE_SIZE ((size_t) 1 << 30)
+
+ParallelFileWriter::ParallelFileWriter(const string &aPath) {
+
+    this->mPath = aPath;
+#ifdef USE_MPI
+    this->mIsShared = CommunicatorMPI::GetInstance()->GetSize() > 1;
+    if (this->mIsShared) {
+        if (MPI_File_open(MPI_COMM_WORLD, aPath.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL,
+                          &this->mFile) != MPI_SUCCESS) {
+            throw runtime_error("Cannot write data file: " + aPath);
+        }
+        // Drop the content of a previous file with the same name.
+        MPI_File_set_size(this->mFile, 0);
+        return;
+    }
+#endif
+    this->mFileDescriptor = open(aPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (this->mFileDescriptor < 0) {
+        throw runtime_error("Cannot write data file: " + aPath);
+    }
+}
+
+ParallelFileWriter::~ParallelFileWriter() {
+#ifdef USE_MPI
+    if (this->mIsShared) {
+        MPI_File_close(&this->mFile);
+    }
+#endif
+    if (this->mFileDescriptor >= 0) {
+        close(this->mFileDescriptor);
+    }
+}
+
+void ParallelFileWriter::GetBlock(const size_t &aRecordsNumber, size_t &aBegin, size_t &aEnd) {
+
+    size_t rank = CommunicatorMPI::GetInstance()->GetRank();
+    size_t size = CommunicatorMPI::GetInstance()->GetSize();
+    aBegin = aRecordsNumber * rank / size;
+    aEnd = aRecordsNumber * (rank + 1) / size;
+}
+
+string ParallelFileWriter::SharePath(const string &aPath) {
+
+    string path = aPath;
+#ifdef USE_MPI
+    if (CommunicatorMPI::GetInstance()->GetSize() > 1) {
+        int length = (int) path.size();
+        MPI_Bcast(&length, 1, MPI_INT, 0, MPI_COMM_WORLD);
+        path.resize(length);
+        MPI_Bcast(path.data(), length, MPI_CHAR, 0, MPI_COMM_WORLD);
+    }
+#endif
+    return path;
+}
+
+uint64_t ParallelFileWriter::GetOffset(const uint64_t &aBytesNumber) const {
+
+    uint64_t offset = 0;
+#ifdef USE_MPI
+    if (this->mIsShared) {
+        MPI_Exscan(&aBytesNumber, &offset, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+        // The exclusive scan leaves the buffer of the first rank undefined.
+        if (CommunicatorMPI::GetInstance()->GetRank() == 0) {
+            offset = 0;
+        }
+    }
+#endif
+    return offset;
+}
+
+void ParallelFileWriter::WriteAt(const uint64_t &aOffset, const char *apBuffer, const size_t &aSize) {
+
+    size_t written = 0;
+    while (written < aSize) {
+        size_t count = min(aSize - written, MAX_WRITE_SIZE);
+#ifdef USE_MPI
+        if (this->mIsShared) {
+            if (MPI_File_write_at(this->mFile, (MPI_Offset) (aOffset + written), apBuffer + written, (int) count,
+                                  MPI_BYTE, MPI_STATUS_IGNORE) != MPI_SUCCESS) {
+                throw runtime_error("Cannot write data file: " + this->mPath);
+            }
+            written += count;
+            continue;
+        }
+#endif
+        ssize_t result = pwrite(this->mFileDescriptor, apBuffer + written, count, (off_t) (aOffset + written));
+        if (result <= 0) {
+            throw runtime_error("Cannot write data file: " + this->mPath);
+        }
+        written += result;
+    }
+}
@@ -0,0 +1,104 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file PhiloxRandom.cpp
+ * @brief Contains the implementation of the PhiloxRandom class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <cmath>
+
+#include <helpers/PhiloxRandom.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+
+// Multipliers and Weyl key increments of Philox4x32, from Salmon et al., SC'11.
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+#define PHILOX_ROUNDS 10
+
+template<typename T>
+void PhiloxRandom<T>::Philox4x32(const uint32_t *apCounter, const uint32_t *apKey, uint32_t *apOutput) {
+
+    uint32_t counter[4] = {apCounter[0], apCounter[1], apCounter[2], apCounter[3]};
+    uint32_t key[2] = {apKey[0], apKey[1]};
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+        uint64_t product0 = (uint64_t) PHILOX_M0 * counter[0];
+        uint64_t product1 = (uint64_t) PHILOX_M1 * counter[2];
+        uint32_t next[4] = {(uint32_t) (product1 >> 32) ^ counter[1] ^ key[0], (uint32_t) product1,
+                            (uint32_t) (product0 >> 32) ^ counter[3] ^ key[1], (uint32_t) product0};
+        counter[0] = next[0], counter[1] = next[1], counter[2] = next[2], counter[3] = next[3];
+        key[0] += PHILOX_W0;
+        key[1] += PHILOX_W1;
+    }
+    apOutput[0] = counter[0], apOutput[1] = counter[1], apOutput[2] = counter[2], apOutput[3] = counter[3];
+}
+
+/**
+ * @brief Draws the four random words of a value.
+ * @param[in] aSeed The seed of the generator.
+ * @param[in] aStream The stream of the value.
+ * @param[in] aIndex The index of the value in its stream.
+ * @param[out] apWords The four random words.
+ * @return void
+ *
+ */
+template<typename T>
+static void DrawWords(const uint32_t &aSeed, const uint32_t &aStream, const uint64_t &aIndex, uint32_t *apWords) {
+
+    uint32_t counter[4] = {(uint32_t) aIndex, (uint32_t) (aIndex >> 32), aStream, 0};
+    uint32_t key[2] = {aSeed, aStream};
+    PhiloxRandom<T>::Philox4x32(counter, key, apWords);
+}
+
+/**
+ * @brief Maps two random words to a double in [0, 1) with 53 random bits.
+ * @param[in] aHigh The first word.
+ * @param[in] aLow The second word.
+ * @return The uniform value.
+ *
+ */
+static double WordsToUniform(const uint32_t &aHigh, const uint32_t &aLow) {
+    return (double) ((((uint64_t) aHigh << 32) | aLow) >> 11) * 0x1.0p-53;
+}
+
+template<typename T>
+T PhiloxRandom<T>::Uniform(const uint32_t &aSeed, const uint32_t &aStream, const uint64_t &aIndex) {
+
+    uint32_t words[4];
+    DrawWords<T>(aSeed, aStream, aIndex, words);
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        // 24 random bits, a rounded double could reach 1 in single precision.
+        return (T) ((float) (words[0] >> 8) * 0x1.0p-24f);
+    }
+    return (T) WordsToUniform(words[0], words[1]);
+}
+
+template<typename T>
+T PhiloxRandom<T>::Normal(const uint32_t &aSeed, const uint32_t &aStream, const uint64_t &aIndex) {
+
+    uint32_t words[4];
+    DrawWords<T>(aSeed, aStream, aIndex, words);
+    // The first uniform lies in (0, 1], so that its logarithm is finite.
+    double radius = sqrt(-2.0 * log(1.0 - WordsToUniform(words[0], words[1])));
+    double angle = 2.0 * PI * WordsToUniform(words[2], words[3]);
+    return (T) (radius * cos(angle));
+}
+
+template<typename T>
+void PhiloxRandom<T>::NormalVector(const uint32_t &aSeed, const uint32_t &aStream, const uint64_t &aOffset,
+                                   const int &aSize, T *apOutput) {
+
+    for (int i = 0; i < aSize; i++) {
+        apOutput[i] = Normal(aSeed, aStream, aOffset + i);
+    }
+}
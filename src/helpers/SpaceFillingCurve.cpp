@@ -0,0 +1,217 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file SpaceFillingCurve.cpp
+ * @brief Contains the implementation of the SpaceFillingCurve class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <helpers/ParallelBlocks.hpp>
+#include <helpers/SpaceFillingCurve.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+using namespace exageostat::common;
+using namespace exageostat::dataunits;
+
+// Number of bits of every quantized axis, three axes fill 63 bits of the key.
+#define SPACE_FILLING_CURVE_BITS 21
+// Number of consecutive locations a thread keys, sorts or moves at once.
+#define SPACE_FILLING_CURVE_BLOCK 4096
+
+/**
+ * @brief Spreads the 21 bits of a coordinate one bit apart.
+ * @param[in] aValue The coordinate.
+ * @return The spread bits.
+ *
+ */
+static uint64_t SpreadBitsByOne(uint64_t aValue) {
+
+    aValue &= 0x00000000001fffff;
+    aValue = (aValue | (aValue << 16)) & 0x0000ffff0000ffff;
+    aValue = (aValue | (aValue << 8)) & 0x00ff00ff00ff00ff;
+    aValue = (aValue | (aValue << 4)) & 0x0f0f0f0f0f0f0f0f;
+    aValue = (aValue | (aValue << 2)) & 0x3333333333333333;
+    aValue = (aValue | (aValue << 1)) & 0x5555555555555555;
+    return aValue;
+}
+
+/**
+ * @brief Spreads the 21 bits of a coordinate two bits apart.
+ * @param[in] aValue The coordinate.
+ * @return The spread bits.
+ *
+ */
+static uint64_t SpreadBitsByTwo(uint64_t aValue) {
+
+    aValue &= 0x00000000001fffff;
+    aValue = (aValue | (aValue << 32)) & 0x001f00000000ffff;
+    aValue = (aValue | (aValue << 16)) & 0x001f0000ff0000ff;
+    aValue = (aValue | (aValue << 8)) & 0x100f00f00f00f00f;
+    aValue = (aValue | (aValue << 4)) & 0x10c30c30c30c30c3;
+    aValue = (aValue | (aValue << 2)) & 0x1249249249249249;
+    return aValue;
+}
+
+template<typename T>
+vector<int>
+SpaceFillingCurve<T>::GetPermutation(const int &aN, Locations<T> &aLocations, const Ordering &aOrdering,
+                                     const int &aThreadsNumber) {
+
+    if (aOrdering != MORTON_ORDERING && aOrdering != HILBERT_ORDERING) {
+        throw invalid_argument("The locations can only be reordered along a Morton or a Hilbert curve.");
+    }
+    int axes_number = aLocations.GetDimension() == Dimension2D ? 2 : 3;
+    T *axes[3] = {aLocations.GetLocationX(), aLocations.GetLocationY(), aLocations.GetLocationZ()};
+
+    // Bounding box of the locations.
+    T minimum[3], maximum[3];
+    for (int axis = 0; axis < axes_number; axis++) {
+        minimum[axis] = maximum[axis] = aN > 0 ? axes[axis][0] : 0;
+        for (int i = 1; i < aN; i++) {
+            minimum[axis] = min(minimum[axis], axes[axis][i]);
+            maximum[axis] = max(maximum[axis], axes[axis][i]);
+        }
+    }
+    const double max_coordinate = (double) ((1u << SPACE_FILLING_CURVE_BITS) - 1);
+    double spatial_range = 0;
+    int spatial_axes_number = aLocations.GetDimension() == DimensionST ? 2 : axes_number;
+    for (int axis = 0; axis < spatial_axes_number; axis++) {
+        spatial_range = max(spatial_range, (double) (maximum[axis] - minimum[axis]));
+    }
+    double scale[3];
+    for (int axis = 0; axis < axes_number; axis++) {
+        double range = axis < spatial_axes_number ? spatial_range : (double) (maximum[axis] - minimum[axis]);
+        scale[axis] = range > 0 ? max_coordinate / range : 0;
+    }
+
+    // The keys carry the index, so that equal keys keep the input order and any thread count gives the same order.
+    vector<pair<uint64_t, int>> keys(aN);
+    ParallelBlocks::ForEachBlock(aN, SPACE_FILLING_CURVE_BLOCK, aThreadsNumber,
+                                 [&](const int &, const int &aFirst, const int &aLast) {
+        uint32_t coordinates[3];
+        for (int i = aFirst; i < aLast; i++) {
+            for (int axis = 0; axis < axes_number; axis++) {
+                coordinates[axis] = (uint32_t) ((axes[axis][i] - minimum[axis]) * scale[axis] + 0.5);
+            }
+            keys[i].first = aOrdering == MORTON_ORDERING ? MortonKey(coordinates, axes_number)
+                                                         : HilbertKey(coordinates, axes_number);
+            keys[i].second = i;
+        }
+        sort(keys.begin() + aFirst, keys.begin() + aLast);
+    });
+    // The sorted blocks are merged pairwise, the merges of a round are independent.
+    for (int width = SPACE_FILLING_CURVE_BLOCK; width < aN; width *= 2) {
+        ParallelBlocks::ForEachBlock(aN, 2 * width, aThreadsNumber,
+                                     [&](const int &, const int &aFirst, const int &aLast) {
+            inplace_merge(keys.begin() + aFirst, keys.begin() + min(aFirst + width, aLast), keys.begin() + aLast);
+        });
+    }
+
+    vector<int> permutation(aN);
+    for (int i = 0; i < aN; i++) {
+        permutation[i] = keys[i].second;
+    }
+    return permutation;
+}
+
+template<typename T>
+vector<int> SpaceFillingCurve<T>::Reorder(const int &aN, Locations<T> &aLocations, T *apMeasurements, const int &aP,
+                                          const Ordering &aOrdering, const int &aThreadsNumber) {
+
+    vector<int> permutation = GetPermutation(aN, aLocations, aOrdering, aThreadsNumber);
+    T *axes[3] = {aLocations.GetLocationX(), aLocations.GetLocationY(), aLocations.GetLocationZ()};
+
+    vector<T> buffer(aN);
+    for (auto *pAxis: axes) {
+        if (pAxis == nullptr) {
+            continue;
+        }
+        ParallelBlocks::ForEachBlock(aN, SPACE_FILLING_CURVE_BLOCK, aThreadsNumber,
+                                     [&](const int &, const int &aFirst, const int &aLast) {
+            for (int i = aFirst; i < aLast; i++) {
+                buffer[i] = pAxis[permutation[i]];
+            }
+        });
+        copy(buffer.begin(), buffer.end(), pAxis);
+    }
+    if (apMeasurements) {
+        buffer.resize((size_t) aN * aP);
+        ParallelBlocks::ForEachBlock(aN, SPACE_FILLING_CURVE_BLOCK, aThreadsNumber,
+                                     [&](const int &, const int &aFirst, const int &aLast) {
+            for (int i = aFirst; i < aLast; i++) {
+                for (int j = 0; j < aP; j++) {
+                    buffer[(size_t) i * aP + j] = apMeasurements[(size_t) permutation[i] * aP + j];
+                }
+            }
+        });
+        copy(buffer.begin(), buffer.end(), apMeasurements);
+    }
+    return permutation;
+}
+
+template<typename T>
+uint64_t SpaceFillingCurve<T>::MortonKey(const uint32_t *apCoordinates, const int &aAxesNumber) {
+
+    if (aAxesNumber == 2) {
+        return SpreadBitsByOne(apCoordinates[0]) | (SpreadBitsByOne(apCoordinates[1]) << 1);
+    }
+    return SpreadBitsByTwo(apCoordinates[0]) | (SpreadBitsByTwo(apCoordinates[1]) << 1) |
+           (SpreadBitsByTwo(apCoordinates[2]) << 2);
+}
+
+template<typename T>
+uint64_t SpaceFillingCurve<T>::HilbertKey(const uint32_t *apCoordinates, const int &aAxesNumber) {
+
+    uint32_t x[3];
+    for (int i = 0; i < aAxesNumber; i++) {
+        x[i] = apCoordinates[i];
+    }
+    const uint32_t highest_bit = 1u << (SPACE_FILLING_CURVE_BITS - 1);
+    uint32_t bit, mask, swap;
+
+    // Inverse undo of the rotations and reflections, from the coarsest level down.
+    for (bit = highest_bit; bit > 1; bit >>= 1) {
+        mask = bit - 1;
+        for (int i = 0; i < aAxesNumber; i++) {
+            if (x[i] & bit) {
+                x[0] ^= mask;
+            } else {
+                swap = (x[0] ^ x[i]) & mask;
+                x[0] ^= swap;
+                x[i] ^= swap;
+            }
+        }
+    }
+    // Gray encoding.
+    for (int i = 1; i < aAxesNumber; i++) {
+        x[i] ^= x[i - 1];
+    }
+    swap = 0;
+    for (bit = highest_bit; bit > 1; bit >>= 1) {
+        if (x[aAxesNumber - 1] & bit) {
+            swap ^= bit - 1;
+        }
+    }
+    for (int i = 0; i < aAxesNumber; i++) {
+        x[i] ^= swap;
+    }
+
+    // The transposed key is interleaved with the first axis as the most significant bit of each level.
+    uint64_t key = 0;
+    for (int level = SPACE_FILLING_CURVE_BITS - 1; level >= 0; level--) {
+        for (int i = 0; i < aAxesNumber; i++) {
+            key = (key << 1) | ((x[i] >> level) & 1);
+        }
+    }
+    return key;
+}
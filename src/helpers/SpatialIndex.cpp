@@ -0,0 +1,403 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file SpatialIndex.cpp
+ * @brief Contains the implementation of the SpatialIndex class.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#include <helpers/ParallelBlocks.hpp>
+#include <helpers/SpatialIndex.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+using namespace exageostat::common;
+using namespace exageostat::dataunits;
+
+//// Maximum number of locations in a leaf of the tree.
+static const int SPATIAL_INDEX_LEAF_SIZE = 16;
+//// Number of consecutive queries a thread answers at once.
+static const int SPATIAL_INDEX_QUERIES_BLOCK = 256;
+
+/**
+ * @brief Counts the nodes of the tree over a number of locations.
+ * @details Every split halves a range, so the ranges of a level take at most two consecutive sizes.
+ * @param[in] aN The number of locations.
+ * @return The number of nodes.
+ *
+ */
+static int CountNodes(const int &aN) {
+
+    // The sizes of the current level, with the number of ranges of each size.
+    int small_size = aN, small_count = 1, large_count = 0;
+    int nodes_number = 0;
+    while (small_count + large_count > 0) {
+        nodes_number += small_count + large_count;
+        int next_small_count = 0, next_large_count = 0;
+        int next_small_size = small_size / 2;
+        // A range of size s splits into s / 2 and s - s / 2, the sizes of the next level are s / 2 and s / 2 + 1.
+        for (int size_index = 0; size_index < 2; size_index++) {
+            int size = small_size + size_index;
+            int count = size_index == 0 ? small_count : large_count;
+            if (count == 0 || size <= SPATIAL_INDEX_LEAF_SIZE) {
+                continue;
+            }
+            for (int half: {size / 2, size - size / 2}) {
+                if (half == next_small_size) {
+                    next_small_count += count;
+                } else {
+                    next_large_count += count;
+                }
+            }
+        }
+        small_size = next_small_size, small_count = next_small_count, large_count = next_large_count;
+    }
+    return nodes_number;
+}
+
+template<typename T>
+SpatialIndex<T>::SpatialIndex(Locations<T> &aLocations, const int &aN, const DistanceMetric &aDistanceMetric,
+                              const int &aThreadsNumber, const T &aTimeScale) : mSize(aN),
+                                                                                mDistanceMetric(aDistanceMetric),
+                                                                                mTimeScale(aTimeScale),
+                                                                                mDimension(aLocations.GetDimension()) {
+
+    if (mDistanceMetric == GREAT_CIRCLE_DISTANCE && mDimension != Dimension2D) {
+        throw runtime_error("Great Circle (GC) distance is only valid for 2D!");
+    }
+    mAxesNumber = mDistanceMetric == GREAT_CIRCLE_DISTANCE || mDimension != Dimension2D ? 3 : 2;
+    if (mSize == 0) {
+        return;
+    }
+
+    // The tree is built on the locations in their original order, the coordinates follow the tree order afterwards.
+    ToCoordinates(aLocations, mSize, this->mCoordinates);
+    this->mIndices.resize(mSize);
+    for (int i = 0; i < mSize; i++) {
+        this->mIndices[i] = i;
+    }
+    this->mNodes.resize(CountNodes(mSize));
+    Build(0, 0, mSize, max(1, aThreadsNumber));
+
+    vector<T> tree_coordinates(this->mCoordinates.size());
+    for (int axis = 0; axis < mAxesNumber; axis++) {
+        for (int position = 0; position < mSize; position++) {
+            tree_coordinates[(size_t) axis * mSize + position] = this->mCoordinates[(size_t) axis * mSize +
+                                                                                    this->mIndices[position]];
+        }
+    }
+    this->mCoordinates.swap(tree_coordinates);
+}
+
+template<typename T>
+void SpatialIndex<T>::ToCoordinates(Locations<T> &aLocations, const int &aN, vector<T> &aCoordinates) const {
+
+    if (aLocations.GetDimension() != mDimension) {
+        throw invalid_argument("The query locations must have the dimension of the indexed locations.");
+    }
+    aCoordinates.resize((size_t) mAxesNumber * aN);
+    T *x = aLocations.GetLocationX();
+    T *y = aLocations.GetLocationY();
+    if (mDistanceMetric == GREAT_CIRCLE_DISTANCE) {
+        for (int i = 0; i < aN; i++) {
+            T latitude = x[i] * PI / 180, longitude = y[i] * PI / 180;
+            aCoordinates[i] = cos(latitude) * cos(longitude);
+            aCoordinates[(size_t) aN + i] = cos(latitude) * sin(longitude);
+            aCoordinates[(size_t) 2 * aN + i] = sin(latitude);
+        }
+        return;
+    }
+    copy(x, x + aN, aCoordinates.begin());
+    copy(y, y + aN, aCoordinates.begin() + aN);
+    if (mAxesNumber == 3) {
+        T *z = aLocations.GetLocationZ();
+        T scale = mDimension == DimensionST ? mTimeScale : 1;
+        for (int i = 0; i < aN; i++) {
+            aCoordinates[(size_t) 2 * aN + i] = z[i] * scale;
+        }
+    }
+}
+
+template<typename T>
+T SpatialIndex<T>::ToDistance(const T &aSquaredDistance) const {
+
+    if (mDistanceMetric == GREAT_CIRCLE_DISTANCE) {
+        // The chord of the unit sphere between two points is 2 sin(angle / 2).
+        return 2 * EARTH_RADIUS * asin(min((T) 1, sqrt(aSquaredDistance) / 2));
+    }
+    return sqrt(aSquaredDistance);
+}
+
+template<typename T>
+void SpatialIndex<T>::Build(const int &aNode, const int &aBegin, const int &aEnd, const int &aThreadsNumber) {
+
+    Node &node = this->mNodes[aNode];
+    node.mBegin = aBegin;
+    node.mEnd = aEnd;
+    node.mRight = -1;
+    node.mMinimumIndex = numeric_limits<int>::max();
+    for (int axis = 0; axis < 3; axis++) {
+        node.mLower[axis] = node.mUpper[axis] = 0;
+    }
+    for (int axis = 0; axis < mAxesNumber; axis++) {
+        const T *pAxis = this->mCoordinates.data() + (size_t) axis * mSize;
+        node.mLower[axis] = numeric_limits<T>::max();
+        node.mUpper[axis] = numeric_limits<T>::lowest();
+        for (int position = aBegin; position < aEnd; position++) {
+            T value = pAxis[this->mIndices[position]];
+            node.mLower[axis] = min(node.mLower[axis], value);
+            node.mUpper[axis] = max(node.mUpper[axis], value);
+        }
+    }
+    for (int position = aBegin; position < aEnd; position++) {
+        node.mMinimumIndex = min(node.mMinimumIndex, this->mIndices[position]);
+    }
+    if (aEnd - aBegin <= SPATIAL_INDEX_LEAF_SIZE) {
+        return;
+    }
+
+    int split_axis = 0;
+    for (int axis = 1; axis < mAxesNumber; axis++) {
+        if (node.mUpper[axis] - node.mLower[axis] > node.mUpper[split_axis] - node.mLower[split_axis]) {
+            split_axis = axis;
+        }
+    }
+    const T *pAxis = this->mCoordinates.data() + (size_t) split_axis * mSize;
+    int middle = aBegin + (aEnd - aBegin) / 2;
+    nth_element(this->mIndices.begin() + aBegin, this->mIndices.begin() + middle, this->mIndices.begin() + aEnd,
+                [&](const int &aFirst, const int &aSecond) {
+                    return pAxis[aFirst] < pAxis[aSecond] || (pAxis[aFirst] == pAxis[aSecond] && aFirst < aSecond);
+                });
+    node.mRight = aNode + 1 + CountNodes(middle - aBegin);
+
+    int right = node.mRight;
+    if (aThreadsNumber > 1) {
+        // The two subtrees own disjoint ranges of the nodes and of the tree order.
+        thread left_builder(&SpatialIndex<T>::Build, this, aNode + 1, aBegin, middle, aThreadsNumber / 2);
+        Build(right, middle, aEnd, aThreadsNumber - aThreadsNumber / 2);
+        left_builder.join();
+    } else {
+        Build(aNode + 1, aBegin, middle, 1);
+        Build(right, middle, aEnd, 1);
+    }
+}
+
+template<typename T>
+void SpatialIndex<T>::Search(const T *apPoint, const int &aNeighborsNumber, const int &aIndexBound,
+                             vector<pair<T, int>> &aHeap) const {
+
+    aHeap.clear();
+    if (mSize == 0 || aNeighborsNumber == 0) {
+        return;
+    }
+    auto box_distance = [&](const Node &aNode) {
+        T distance = 0;
+        for (int axis = 0; axis < mAxesNumber; axis++) {
+            T gap = max(max(aNode.mLower[axis] - apPoint[axis], apPoint[axis] - aNode.mUpper[axis]), (T) 0);
+            distance += gap * gap;
+        }
+        return distance;
+    };
+
+    // Depth-first traversal, the nearer child first. A node is skipped when its box is farther than the current k-th
+    // neighbor, or when all its locations come after the bound.
+    pair<int, T> stack[128];
+    int stack_size = 0;
+    stack[stack_size++] = {0, box_distance(this->mNodes[0])};
+    while (stack_size > 0) {
+        auto [node_index, node_distance] = stack[--stack_size];
+        const Node &node = this->mNodes[node_index];
+        if (node.mMinimumIndex >= aIndexBound ||
+            ((int) aHeap.size() == aNeighborsNumber && node_distance > aHeap.front().first)) {
+            continue;
+        }
+        if (node.mRight < 0) {
+            for (int position = node.mBegin; position < node.mEnd; position++) {
+                int index = this->mIndices[position];
+                if (index >= aIndexBound) {
+                    continue;
+                }
+                T distance = 0;
+                for (int axis = 0; axis < mAxesNumber; axis++) {
+                    T difference = apPoint[axis] - this->mCoordinates[(size_t) axis * mSize + position];
+                    distance += difference * difference;
+                }
+                pair<T, int> entry(distance, index);
+                if ((int) aHeap.size() < aNeighborsNumber) {
+                    aHeap.push_back(entry);
+                    push_heap(aHeap.begin(), aHeap.end());
+                } else if (entry < aHeap.front()) {
+                    pop_heap(aHeap.begin(), aHeap.end());
+                    aHeap.back() = entry;
+                    push_heap(aHeap.begin(), aHeap.end());
+                }
+            }
+            continue;
+        }
+        int left = node_index + 1, right = node.mRight;
+        T left_distance = box_distance(this->mNodes[left]), right_distance = box_distance(this->mNodes[right]);
+        if (left_distance <= right_distance) {
+            stack[stack_size++] = {right, right_distance};
+            stack[stack_size++] = {left, left_distance};
+        } else {
+            stack[stack_size++] = {left, left_distance};
+            stack[stack_size++] = {right, right_distance};
+        }
+    }
+    sort_heap(aHeap.begin(), aHeap.end());
+}
+
+template<typename T>
+void SpatialIndex<T>::KNearestNeighbors(Locations<T> &aQueries, const int &aQueriesNumber,
+                                        const int &aNeighborsNumber, int *apIndices, T *apDistances,
+                                        const int &aThreadsNumber) const {
+
+    vector<T> queries;
+    ToCoordinates(aQueries, aQueriesNumber, queries);
+    ParallelBlocks::ForEachBlock(aQueriesNumber, SPATIAL_INDEX_QUERIES_BLOCK, aThreadsNumber,
+                                 [&](const int &, const int &aFirst, const int &aLast) {
+        vector<pair<T, int>> heap;
+        heap.reserve(aNeighborsNumber + 1);
+        for (int i = aFirst; i < aLast; i++) {
+            T point[3] = {0, 0, 0};
+            for (int axis = 0; axis < mAxesNumber; axis++) {
+                point[axis] = queries[(size_t) axis * aQueriesNumber + i];
+            }
+            Search(point, aNeighborsNumber, mSize, heap);
+            for (int k = 0; k < aNeighborsNumber; k++) {
+                bool is_found = k < (int) heap.size();
+                apIndices[(size_t) i * aNeighborsNumber + k] = is_found ? heap[k].second : -1;
+                if (apDistances != nullptr) {
+                    apDistances[(size_t) i * aNeighborsNumber + k] = is_found ? ToDistance(heap[k].first)
+                                                                              : numeric_limits<T>::infinity();
+                }
+            }
+        }
+    });
+}
+
+template<typename T>
+void SpatialIndex<T>::KNearestPrecedingNeighbors(const int &aNeighborsNumber, int *apIndices,
+                                                 const int &aThreadsNumber) const {
+
+    // The locations are visited in the tree order, so consecutive queries explore the same nodes.
+    ParallelBlocks::ForEachBlock(mSize, SPATIAL_INDEX_QUERIES_BLOCK, aThreadsNumber,
+                                 [&](const int &, const int &aFirst, const int &aLast) {
+        vector<pair<T, int>> heap;
+        heap.reserve(aNeighborsNumber + 1);
+        for (int position = aFirst; position < aLast; position++) {
+            T point[3] = {0, 0, 0};
+            for (int axis = 0; axis < mAxesNumber; axis++) {
+                point[axis] = this->mCoordinates[(size_t) axis * mSize + position];
+            }
+            int index = this->mIndices[position];
+            Search(point, aNeighborsNumber, index, heap);
+            for (int k = 0; k < aNeighborsNumber; k++) {
+                apIndices[(size_t) index * aNeighborsNumber + k] = k < (int) heap.size() ? heap[k].second : -1;
+            }
+        }
+    });
+}
+
+template<typename T>
+void SpatialIndex<T>::RadiusNeighbors(Locations<T> &aQueries, const int &aQueriesNumber, const T &aRadius,
+                                      vector<int> &aOffsets, vector<int> &aIndices, vector<T> *apDistances,
+                                      const int &aThreadsNumber) const {
+
+    vector<T> queries;
+    ToCoordinates(aQueries, aQueriesNumber, queries);
+    T squared_radius;
+    if (mDistanceMetric == GREAT_CIRCLE_DISTANCE) {
+        T chord = aRadius >= PI * EARTH_RADIUS ? 2 : 2 * sin(max((T) 0, aRadius) / (2 * EARTH_RADIUS));
+        squared_radius = chord * chord;
+    } else {
+        squared_radius = aRadius * aRadius;
+    }
+
+    // Every block keeps its neighbors until the offsets of all the queries are known.
+    int blocks_number = (aQueriesNumber + SPATIAL_INDEX_QUERIES_BLOCK - 1) / SPATIAL_INDEX_QUERIES_BLOCK;
+    vector<vector<pair<T, int>>> block_neighbors(blocks_number);
+    aOffsets.assign(aQueriesNumber + 1, 0);
+    ParallelBlocks::ForEachBlock(aQueriesNumber, SPATIAL_INDEX_QUERIES_BLOCK, aThreadsNumber,
+                                 [&](const int &aBlock, const int &aFirst, const int &aLast) {
+        auto &neighbors = block_neighbors[aBlock];
+        vector<int> stack;
+        for (int i = aFirst; i < aLast; i++) {
+            T point[3] = {0, 0, 0};
+            for (int axis = 0; axis < mAxesNumber; axis++) {
+                point[axis] = queries[(size_t) axis * aQueriesNumber + i];
+            }
+            size_t first_neighbor = neighbors.size();
+            stack.clear();
+            if (mSize > 0) {
+                stack.push_back(0);
+            }
+            while (!stack.empty()) {
+                int node_index = stack.back();
+                stack.pop_back();
+                const Node &node = this->mNodes[node_index];
+                T distance = 0;
+                for (int axis = 0; axis < mAxesNumber; axis++) {
+                    T gap = max(max(node.mLower[axis] - point[axis], point[axis] - node.mUpper[axis]), (T) 0);
+                    distance += gap * gap;
+                }
+                if (distance > squared_radius) {
+                    continue;
+                }
+                if (node.mRight >= 0) {
+                    stack.push_back(node.mRight);
+                    stack.push_back(node_index + 1);
+                    continue;
+                }
+                for (int position = node.mBegin; position < node.mEnd; position++) {
+                    distance = 0;
+                    for (int axis = 0; axis < mAxesNumber; axis++) {
+                        T difference = point[axis] - this->mCoordinates[(size_t) axis * mSize + position];
+                        distance += difference * difference;
+                    }
+                    if (distance <= squared_radius) {
+                        neighbors.emplace_back(distance, this->mIndices[position]);
+                    }
+                }
+            }
+            sort(neighbors.begin() + first_neighbor, neighbors.end());
+            aOffsets[i + 1] = (int) (neighbors.size() - first_neighbor);
+        }
+    });
+    for (int i = 0; i < aQueriesNumber; i++) {
+        aOffsets[i + 1] += aOffsets[i];
+    }
+
+    aIndices.resize(aOffsets[aQueriesNumber]);
+    if (apDistances != nullptr) {
+        apDistances->resize(aOffsets[aQueriesNumber]);
+    }
+    ParallelBlocks::ForEachBlock(aQueriesNumber, SPATIAL_INDEX_QUERIES_BLOCK, aThreadsNumber,
+                                 [&](const int &aBlock, const int &aFirst, const int &aLast) {
+        auto &neighbors = block_neighbors[aBlock];
+        for (size_t k = 0; k < neighbors.size(); k++) {
+            aIndices[aOffsets[aFirst] + k] = neighbors[k].second;
+            if (apDistances != nullptr) {
+                (*apDistances)[aOffsets[aFirst] + k] = ToDistance(neighbors[k].first);
+            }
+        }
+        vector<pair<T, int>>().swap(neighbors);
+    });
+}
+
+template<typename T>
+int SpatialIndex<T>::GetSize() const {
+    return mSize;
+}
@@ -17,6 +17,7 @@
 using namespace std;
 
 using namespace exageostat::kernels;
+using namespace exageostat::helpers;
 
 template<typename T>
 int Kernel<T>::GetVariablesNumber() const {
@@ -35,4 +36,106 @@ void Kernel<T>::SetPValue(int aTimeSlot) {
 template<typename T>
 int Kernel<T>::GetParametersNumbers() const {
     return this->mParametersNumber;
-}
\ No newline at end of file
+}
+
+template<typename T>
+void Kernel<T>::GenerateCovarianceTile(T *apMatrixA, const int &aRowsNumber, const int &aColumnsNumber,
+                                       const int &aRowOffset, const int &aColumnOffset,
+                                       dataunits::Locations<T> &aLocation1, dataunits::Locations<T> &aLocation2,
+                                       dataunits::Locations<T> &aLocation3, T *apLocalTheta,
+                                       const int &aDistanceMetric) {
+    this->GenerateCovarianceMatrix(apMatrixA, aRowsNumber, aColumnsNumber, aRowOffset, aColumnOffset, aLocation1,
+                                   aLocation2, aLocation3, apLocalTheta, aDistanceMetric);
+}
+
+template<typename T>
+bool Kernel<T>::IsIsotropic() const {
+    return false;
+}
+
+template<typename T>
+void Kernel<T>::GenerateCovarianceTileFromDistances(T *apMatrixA, const T *apDistances, const int &aRowsNumber,
+                                                    const int &aColumnsNumber, dataunits::Locations<T> &aLocation1,
+                                                    dataunits::Locations<T> &aLocation2, T *apLocalTheta,
+                                                    const int &aDistanceMetric) {
+    throw runtime_error("This kernel can't generate its covariance from cached distances.");
+}
+
+template<typename T>
+int Kernel<T>::GetHalfIntegerSmoothness(const T &aNu) {
+    const double tolerance = KernelsConfigurations::GetSmoothnessTolerance();
+    for (int order = 0; order < 3; order++) {
+        if (fabs(aNu - (order + 0.5)) <= tolerance) {
+            return order;
+        }
+    }
+    return -1;
+}
+
+template<typename T>
+T Kernel<T>::HalfIntegerMatern(const int &aHalfIntegerOrder, const T &aDistance) {
+    switch (aHalfIntegerOrder) {
+        case 0:
+            return exp(-aDistance);
+        case 1:
+            return (1 + aDistance) * exp(-aDistance);
+        case 2:
+            return (1 + aDistance + aDistance * aDistance / 3) * exp(-aDistance);
+        default:
+            throw runtime_error("Closed-form Matern is only available for nu = 0.5, 1.5 and 2.5");
+    }
+}
+
+template<typename T>
+void Kernel<T>::HalfIntegerMaternTile(T *apDistances, const size_t &aSize, const int &aHalfIntegerOrder,
+                                      const T &aSigmaSquare) {
+    // The order is resolved once, so each loop is a branch-free pass over the buffer.
+    switch (aHalfIntegerOrder) {
+        case 0:
+            for (size_t k = 0; k < aSize; k++) {
+                apDistances[k] = aSigmaSquare * exp(-apDistances[k]);
+            }
+            break;
+        case 1:
+            for (size_t k = 0; k < aSize; k++) {
+                const T dist = apDistances[k];
+                apDistances[k] = aSigmaSquare * (1 + dist) * exp(-dist);
+            }
+            break;
+        case 2:
+            for (size_t k = 0; k < aSize; k++) {
+                const T dist = apDistances[k];
+                apDistances[k] = aSigmaSquare * (1 + dist + dist * dist / 3) * exp(-dist);
+            }
+            break;
+        default:
+            throw runtime_error("Closed-form Matern is only available for nu = 0.5, 1.5 and 2.5");
+    }
+}
+
+template<typename T>
+shared_ptr<const MaternInterpolationTable<T>>
+Kernel<T>::GetMaternTable(const T &aNu, const T &aRange, const T &aTileMaxDistance,
+                          dataunits::Locations<T> &aLocation1, dataunits::Locations<T> &aLocation2,
+                          const int &aDistanceMetric, const int &aFlagZ) {
+
+    const double tolerance = KernelsConfigurations::GetBesselTableTolerance();
+    if (tolerance <= 0) {
+        return nullptr;
+    }
+
+    lock_guard<mutex> lock(this->mMaternTableMutex);
+    if (this->mpMaternTable == nullptr || this->mpMaternTable->GetNu() != aNu ||
+        this->mpMaternTable->GetMaxDistance() < aTileMaxDistance ||
+        this->mpMaternTable->GetRelativeTolerance() != tolerance) {
+        // Tabulate the whole dataset range, so that the remaining tiles of this theta reuse the same table.
+        T max_distance = DistanceCalculationHelpers<T>::CalculateMaximumDistance(aLocation1, aLocation2,
+                                                                                 aDistanceMetric, aFlagZ) / aRange;
+        max_distance = max(max_distance, aTileMaxDistance);
+        this->mpMaternTable = make_shared<const MaternInterpolationTable<T>>(aNu, max_distance, tolerance);
+    }
+    if (!this->mpMaternTable->IsValid()) {
+        return nullptr;
+    }
+    return this->mpMaternTable;
+}
@@ -75,6 +75,12 @@ BivariateMaternFlexible<T>::GenerateCovarianceMatrix(T *apMatrixA, const int &aR
     con12 = 1.0 / con12;
     con12 = rho * con12;
 
+    // Half-integer smoothness values are evaluated in closed form instead of through the Bessel function.
+    const int order1 = this->GetHalfIntegerSmoothness(nu1);
+    const int order2 = this->GetHalfIntegerSmoothness(nu2);
+    const int order12 = this->GetHalfIntegerSmoothness(nu12);
+    T value1, value2, value12;
+
     i0 /= 2;
     int flag = aLocation1.GetLocationZ() == nullptr ? 0 : 1;
 
@@ -99,16 +105,23 @@ BivariateMaternFlexible<T>::GenerateCovarianceMatrix(T *apMatrixA, const int &aR
                     apMatrixA[(i + 1) + (j + 1) * aRowsNumber] = aLocalTheta[1];
                 }
             } else {
-                apMatrixA[i + j * aRowsNumber] = con1 * pow(expr1, nu1) * gsl_sf_bessel_Knu(nu1, expr1);
+                value1 = (order1 >= 0) ? sigma_square11 * this->HalfIntegerMatern(order1, expr1) :
+                         con1 * pow(expr1, nu1) * gsl_sf_bessel_Knu(nu1, expr1);
+                value12 = (order12 >= 0) ? rho * this->HalfIntegerMatern(order12, expr12) :
+                          con12 * pow(expr12, nu12) * gsl_sf_bessel_Knu(nu12, expr12);
+                value2 = (order2 >= 0) ? sigma_square22 * this->HalfIntegerMatern(order2, expr2) :
+                         con2 * pow(expr2, nu2) * gsl_sf_bessel_Knu(nu2, expr2);
+
+                apMatrixA[i + j * aRowsNumber] = value1;
 
                 if (((i + 1) + j * aRowsNumber) < aRowsNumber * aColumnsNumber) {
-                    apMatrixA[(i + 1) + j * aRowsNumber] = con12 * pow(expr12, nu12) * gsl_sf_bessel_Knu(nu12, expr12);
+                    apMatrixA[(i + 1) + j * aRowsNumber] = value12;
                 }
                 if ((i + (j + 1) * aRowsNumber) < aRowsNumber * aColumnsNumber) {
-                    apMatrixA[i + (j + 1) * aRowsNumber] = con12 * pow(expr12, nu12) * gsl_sf_bessel_Knu(nu12, expr12);
+                    apMatrixA[i + (j + 1) * aRowsNumber] = value12;
                 }
                 if (((i + 1) + (j + 1) * aRowsNumber) < aRowsNumber * aColumnsNumber) {
-                    apMatrixA[(i + 1) + (j + 1) * aRowsNumber] = con2 * pow(expr2, nu2) * gsl_sf_bessel_Knu(nu2, expr2);
+                    apMatrixA[(i + 1) + (j + 1) * aRowsNumber] = value2;
                 }
             }
             j0++;
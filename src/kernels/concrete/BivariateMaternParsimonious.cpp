@@ -65,6 +65,12 @@ void BivariateMaternParsimonious<T>::GenerateCovarianceMatrix(T *apMatrixA, cons
     con12 = 1.0 / con12;
     con12 = rho * sqrt(aLocalTheta[0] * aLocalTheta[1]) * con12;
 
+    // Half-integer smoothness values are evaluated in closed form instead of through the Bessel function.
+    const int order1 = this->GetHalfIntegerSmoothness(aLocalTheta[3]);
+    const int order2 = this->GetHalfIntegerSmoothness(aLocalTheta[4]);
+    const int order12 = this->GetHalfIntegerSmoothness(nu12);
+    T value1, value2, value12;
+
     i0 /= 2;
     int flag = aLocation1.GetLocationZ() == nullptr ? 0 : 1;
 
@@ -87,18 +93,24 @@ void BivariateMaternParsimonious<T>::GenerateCovarianceMatrix(T *apMatrixA, cons
                 }
 
             } else {
-                apMatrixA[i + j * aRowsNumber] =
-                        con1 * pow(expr, aLocalTheta[3]) * gsl_sf_bessel_Knu(aLocalTheta[3], expr);
+                value1 = (order1 >= 0) ? aLocalTheta[0] * this->HalfIntegerMatern(order1, expr) :
+                         con1 * pow(expr, aLocalTheta[3]) * gsl_sf_bessel_Knu(aLocalTheta[3], expr);
+                value12 = (order12 >= 0) ? rho * sqrt(aLocalTheta[0] * aLocalTheta[1]) *
+                                           this->HalfIntegerMatern(order12, expr) :
+                          con12 * pow(expr, nu12) * gsl_sf_bessel_Knu(nu12, expr);
+                value2 = (order2 >= 0) ? aLocalTheta[1] * this->HalfIntegerMatern(order2, expr) :
+                         con2 * pow(expr, aLocalTheta[4]) * gsl_sf_bessel_Knu(aLocalTheta[4], expr);
+
+                apMatrixA[i + j * aRowsNumber] = value1;
 
                 if (((i + 1) + j * aRowsNumber) < aRowsNumber * aColumnsNumber) {
-                    apMatrixA[(i + 1) + j * aRowsNumber] = con12 * pow(expr, nu12) * gsl_sf_bessel_Knu(nu12, expr);
+                    apMatrixA[(i + 1) + j * aRowsNumber] = value12;
                 }
                 if ((i + (j + 1) * aRowsNumber) < aRowsNumber * aColumnsNumber) {
-                    apMatrixA[i + (j + 1) * aRowsNumber] = con12 * pow(expr, nu12) * gsl_sf_bessel_Knu(nu12, expr);
+                    apMatrixA[i + (j + 1) * aRowsNumber] = value12;
                 }
                 if (((i + 1) + (j + 1) * aRowsNumber) < aRowsNumber * aColumnsNumber) {
-                    apMatrixA[(i + 1) + (j + 1) * aRowsNumber] =
-                            con2 * pow(expr, aLocalTheta[4]) * gsl_sf_bessel_Knu(aLocalTheta[4], expr);
+                    apMatrixA[(i + 1) + (j + 1) * aRowsNumber] = value2;
                 }
             }
             j0++;
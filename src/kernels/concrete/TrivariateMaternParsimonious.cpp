@@ -85,6 +85,15 @@ void TrivariateMaternParsimonious<T>::GenerateCovarianceMatrix(T *apMatrixA, con
     con23 = 1.0 / con23;
     con23 = rho23 * sqrt(aLocalTheta[1] * aLocalTheta[2]) * con23;
 
+    // Half-integer smoothness values are evaluated in closed form instead of through the Bessel function.
+    const int order1 = this->GetHalfIntegerSmoothness(aLocalTheta[4]);
+    const int order2 = this->GetHalfIntegerSmoothness(aLocalTheta[5]);
+    const int order3 = this->GetHalfIntegerSmoothness(aLocalTheta[6]);
+    const int order12 = this->GetHalfIntegerSmoothness(nu12);
+    const int order13 = this->GetHalfIntegerSmoothness(nu13);
+    const int order23 = this->GetHalfIntegerSmoothness(nu23);
+    T value1, value2, value3, value12, value13, value23;
+
     i0 /= 3;
     int matrix_size = aRowsNumber * aColumnsNumber;
     int index;
@@ -134,45 +143,56 @@ void TrivariateMaternParsimonious<T>::GenerateCovarianceMatrix(T *apMatrixA, con
                     apMatrixA[(i + 2) + (j + 2) * aRowsNumber] = aLocalTheta[2];
                 }
             } else {
-                apMatrixA[i + j * aRowsNumber] =
-                        con1 * pow(expr, aLocalTheta[4]) * gsl_sf_bessel_Knu(aLocalTheta[4], expr);
+                value1 = (order1 >= 0) ? aLocalTheta[0] * this->HalfIntegerMatern(order1, expr) :
+                         con1 * pow(expr, aLocalTheta[4]) * gsl_sf_bessel_Knu(aLocalTheta[4], expr);
+                value2 = (order2 >= 0) ? aLocalTheta[1] * this->HalfIntegerMatern(order2, expr) :
+                         con2 * pow(expr, aLocalTheta[5]) * gsl_sf_bessel_Knu(aLocalTheta[5], expr);
+                value3 = (order3 >= 0) ? aLocalTheta[2] * this->HalfIntegerMatern(order3, expr) :
+                         con3 * pow(expr, aLocalTheta[6]) * gsl_sf_bessel_Knu(aLocalTheta[6], expr);
+                value12 = (order12 >= 0) ? rho12 * sqrt(aLocalTheta[0] * aLocalTheta[1]) *
+                                           this->HalfIntegerMatern(order12, expr) :
+                          con12 * pow(expr, nu12) * gsl_sf_bessel_Knu(nu12, expr);
+                value13 = (order13 >= 0) ? rho13 * sqrt(aLocalTheta[0] * aLocalTheta[2]) *
+                                           this->HalfIntegerMatern(order13, expr) :
+                          con13 * pow(expr, nu13) * gsl_sf_bessel_Knu(nu13, expr);
+                value23 = (order23 >= 0) ? rho23 * sqrt(aLocalTheta[1] * aLocalTheta[2]) *
+                                           this->HalfIntegerMatern(order23, expr) :
+                          con23 * pow(expr, nu23) * gsl_sf_bessel_Knu(nu23, expr);
+
+                apMatrixA[i + j * aRowsNumber] = value1;
 
                 index = (i + 1) + j * aRowsNumber;
                 if (index < matrix_size) {
-                    apMatrixA[(i + 1) + j * aRowsNumber] = con12 * pow(expr, nu12) * gsl_sf_bessel_Knu(nu12, expr);
+                    apMatrixA[(i + 1) + j * aRowsNumber] = value12;
                 }
                 index = i + (j + 1) * aRowsNumber;
                 if (index < matrix_size) {
-                    apMatrixA[i + (j + 1) * aRowsNumber] = con12 * pow(expr, nu12) * gsl_sf_bessel_Knu(nu12, expr);
+                    apMatrixA[i + (j + 1) * aRowsNumber] = value12;
                 }
                 index = (i + 2) + j * aRowsNumber;
                 if (index < matrix_size) {
-                    apMatrixA[(i + 2) + j * aRowsNumber] = con13 * pow(expr, nu13) * gsl_sf_bessel_Knu(nu13, expr);
+                    apMatrixA[(i + 2) + j * aRowsNumber] = value13;
                 }
                 index = i + (j + 2) * aRowsNumber;
                 if (index < matrix_size) {
-                    apMatrixA[i + (j + 2) * aRowsNumber] = con13 * pow(expr, nu13) * gsl_sf_bessel_Knu(nu13, expr);
+                    apMatrixA[i + (j + 2) * aRowsNumber] = value13;
                 }
                 index = (i + 1) + (j + 1) * aRowsNumber;
                 if (index < matrix_size) {
-                    apMatrixA[(i + 1) + (j + 1) * aRowsNumber] =
-                            con2 * pow(expr, aLocalTheta[5]) * gsl_sf_bessel_Knu(aLocalTheta[5], expr);
+                    apMatrixA[(i + 1) + (j + 1) * aRowsNumber] = value2;
                 }
 
                 index = (i + 1) + (j + 2) * aRowsNumber;
                 if (index < matrix_size) {
-                    apMatrixA[(i + 1) + (j + 2) * aRowsNumber] =
-                            con23 * pow(expr, nu23) * gsl_sf_bessel_Knu(nu23, expr);
+                    apMatrixA[(i + 1) + (j + 2) * aRowsNumber] = value23;
                 }
                 index = (i + 2) + (j + 1) * aRowsNumber;
                 if (index < matrix_size) {
-                    apMatrixA[(i + 2) + (j + 1) * aRowsNumber] =
-                            con23 * pow(expr, nu23) * gsl_sf_bessel_Knu(nu23, expr);
+                    apMatrixA[(i + 2) + (j + 1) * aRowsNumber] = value23;
                 }
                 index = (i + 2) + (j + 2) * aRowsNumber;
                 if (index < matrix_size) {
-                    apMatrixA[(i + 2) + (j + 2) * aRowsNumber] =
-                            con3 * pow(expr, aLocalTheta[6]) * gsl_sf_bessel_Knu(aLocalTheta[6], expr);
+                    apMatrixA[(i + 2) + (j + 2) * aRowsNumber] = value3;
                 }
             }
             j0++;
@@ -59,7 +59,7 @@ void UnivariateMaternNuggetsStationary<T>::GenerateCovarianceMatrix(T *apMatrixA
         for (i = 0; i < aRowsNumber; i++) {
             j0 = aColumnOffset;
             for (j = 0; j < aColumnsNumber; j++) {
-                expr = DistanceCalculationHelpers<T>::CalculateDistance(aLocation1, aLocation2, j0, i0, aDistanceMetric,
+                expr = DistanceCalculationHelpers<T>::CalculateDistance(aLocation1, aLocation2, i0, j0, aDistanceMetric,
                                                                         flag) / aLocalTheta[1];
                 if (expr == 0) {
                     apMatrixA[i + j * aRowsNumber] = sigma_square + aLocalTheta[3];
@@ -77,8 +77,8 @@ void UnivariateMaternNuggetsStationary<T>::GenerateCovarianceMatrix(T *apMatrixA
             j0 = aColumnOffset;
             for (j = 0; j < aColumnsNumber; j++) {
                 flag = 1;
-                expr = DistanceCalculationHelpers<T>::CalculateDistance(aLocation1, aLocation2, j0, i0, aDistanceMetric,
-                                                                        flag);
+                expr = DistanceCalculationHelpers<T>::CalculateDistance(aLocation1, aLocation2, i0, j0, aDistanceMetric,
+                                                                        flag) / aLocalTheta[1];
                 if (expr == 0) {
                     apMatrixA[i + j * aRowsNumber] = sigma_square + aLocalTheta[3];
                 } else {
@@ -91,4 +91,69 @@ void UnivariateMaternNuggetsStationary<T>::GenerateCovarianceMatrix(T *apMatrixA
             i0++;
         }
     }
-}
\ No newline at end of file
+}
+template<typename T>
+void UnivariateMaternNuggetsStationary<T>::GenerateCovarianceTile(T *apMatrixA, const int &aRowsNumber,
+                                                                  const int &aColumnsNumber, const int &aRowOffset,
+                                                                  const int &aColumnOffset, Locations<T> &aLocation1,
+                                                                  Locations<T> &aLocation2, Locations<T> &aLocation3,
+                                                                  T *aLocalTheta, const int &aDistanceMetric) {
+
+    int flag = aLocation1.GetLocationZ() == nullptr ? 0 : 1;
+
+    // First pass: all the tile distances, computed in place in the output tile.
+    DistanceCalculationHelpers<T>::CalculateTileDistances(apMatrixA, aLocation1, aLocation2, aRowsNumber,
+                                                          aColumnsNumber, aRowOffset, aColumnOffset, aDistanceMetric,
+                                                          flag);
+    // Second pass: evaluate the Matern function over the contiguous buffer.
+    this->GenerateCovarianceTileFromDistances(apMatrixA, apMatrixA, aRowsNumber, aColumnsNumber, aLocation1,
+                                              aLocation2, aLocalTheta, aDistanceMetric);
+}
+
+template<typename T>
+bool UnivariateMaternNuggetsStationary<T>::IsIsotropic() const {
+    return true;
+}
+
+template<typename T>
+void UnivariateMaternNuggetsStationary<T>::GenerateCovarianceTileFromDistances(T *apMatrixA, const T *apDistances,
+                                                                               const int &aRowsNumber,
+                                                                               const int &aColumnsNumber,
+                                                                               Locations<T> &aLocation1,
+                                                                               Locations<T> &aLocation2, T *aLocalTheta,
+                                                                               const int &aDistanceMetric) {
+
+    const T sigma_square = aLocalTheta[0];
+    const T beta = aLocalTheta[1];
+    const T nu = aLocalTheta[2];
+    const T nugget = aLocalTheta[3];
+    const T con = sigma_square * (1.0 / (pow(2, (nu - 1)) * tgamma(nu)));
+    const size_t tile_size = (size_t) aRowsNumber * aColumnsNumber;
+    int flag = aLocation1.GetLocationZ() == nullptr ? 0 : 1;
+
+    // Scale by the range while reading the distances, apDistances may alias apMatrixA.
+    T max_distance = 0;
+    for (size_t k = 0; k < tile_size; k++) {
+        apMatrixA[k] = apDistances[k] / beta;
+        max_distance = std::max(max_distance, apMatrixA[k]);
+    }
+    const int half_integer_order = this->GetHalfIntegerSmoothness(nu);
+    if (half_integer_order >= 0) {
+        for (size_t k = 0; k < tile_size; k++) {
+            const T expr = apMatrixA[k];
+            apMatrixA[k] = (expr == 0) ? sigma_square + nugget : sigma_square * this->HalfIntegerMatern(
+                    half_integer_order, expr);
+        }
+        return;
+    }
+    const auto pTable = this->GetMaternTable(nu, beta, max_distance, aLocation1, aLocation2, aDistanceMetric, flag);
+    if (pTable != nullptr) {
+        pTable->EvaluateTile(apMatrixA, tile_size, con, sigma_square + nugget);
+        return;
+    }
+    for (size_t k = 0; k < tile_size; k++) {
+        const T expr = apMatrixA[k];
+        // Matern Function
+        apMatrixA[k] = (expr == 0) ? sigma_square + nugget : con * pow(expr, nu) * gsl_sf_bessel_Knu(nu, expr);
+    }
+}
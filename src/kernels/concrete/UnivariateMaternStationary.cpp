@@ -64,4 +64,63 @@ UnivariateMaternStationary<T>::GenerateCovarianceMatrix(T *apMatrixA, const int
         }
         i0++;
     }
-}
\ No newline at end of file
+}
+template<typename T>
+void UnivariateMaternStationary<T>::GenerateCovarianceTile(T *apMatrixA, const int &aRowsNumber,
+                                                           const int &aColumnsNumber, const int &aRowOffset,
+                                                           const int &aColumnOffset, Locations<T> &aLocation1,
+                                                           Locations<T> &aLocation2, Locations<T> &aLocation3,
+                                                           T *aLocalTheta, const int &aDistanceMetric) {
+
+    int flag = aLocation1.GetLocationZ() == nullptr ? 0 : 1;
+
+    // First pass: all the tile distances, computed in place in the output tile.
+    DistanceCalculationHelpers<T>::CalculateTileDistances(apMatrixA, aLocation1, aLocation2, aRowsNumber,
+                                                          aColumnsNumber, aRowOffset, aColumnOffset, aDistanceMetric,
+                                                          flag);
+    // Second pass: evaluate the Matern function over the contiguous buffer.
+    this->GenerateCovarianceTileFromDistances(apMatrixA, apMatrixA, aRowsNumber, aColumnsNumber, aLocation1,
+                                              aLocation2, aLocalTheta, aDistanceMetric);
+}
+
+template<typename T>
+bool UnivariateMaternStationary<T>::IsIsotropic() const {
+    return true;
+}
+
+template<typename T>
+void UnivariateMaternStationary<T>::GenerateCovarianceTileFromDistances(T *apMatrixA, const T *apDistances,
+                                                                        const int &aRowsNumber,
+                                                                        const int &aColumnsNumber,
+                                                                        Locations<T> &aLocation1,
+                                                                        Locations<T> &aLocation2, T *aLocalTheta,
+                                                                        const int &aDistanceMetric) {
+
+    const T sigma_square = aLocalTheta[0];
+    const T beta = aLocalTheta[1];
+    const T nu = aLocalTheta[2];
+    const T inv_con = sigma_square * (1.0 / (pow(2, (nu - 1)) * tgamma((nu))));
+    const size_t tile_size = (size_t) aRowsNumber * aColumnsNumber;
+    int flag = aLocation1.GetLocationZ() == nullptr ? 0 : 1;
+
+    // Scale by the range while reading the distances, apDistances may alias apMatrixA.
+    T max_distance = 0;
+    for (size_t k = 0; k < tile_size; k++) {
+        apMatrixA[k] = apDistances[k] / beta;
+        max_distance = std::max(max_distance, apMatrixA[k]);
+    }
+    const int half_integer_order = this->GetHalfIntegerSmoothness(nu);
+    if (half_integer_order >= 0) {
+        this->HalfIntegerMaternTile(apMatrixA, tile_size, half_integer_order, sigma_square);
+        return;
+    }
+    const auto pTable = this->GetMaternTable(nu, beta, max_distance, aLocation1, aLocation2, aDistanceMetric, flag);
+    if (pTable != nullptr) {
+        pTable->EvaluateTile(apMatrixA, tile_size, inv_con, sigma_square);
+        return;
+    }
+    for (size_t k = 0; k < tile_size; k++) {
+        const T dist = apMatrixA[k];
+        apMatrixA[k] = (dist == 0.0) ? sigma_square : inv_con * pow(dist, nu) * gsl_sf_bessel_Knu(nu, dist);
+    }
+}
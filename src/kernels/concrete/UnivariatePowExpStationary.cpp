@@ -65,3 +65,26 @@ UnivariatePowExpStationary<T>::GenerateCovarianceMatrix(T *apMatrixA, const int
         i0++;
     }
 }
+
+template<typename T>
+void
+UnivariatePowExpStationary<T>::GenerateCovarianceTile(T *apMatrixA, const int &aRowsNumber, const int &aColumnsNumber,
+                                                      const int &aRowOffset, const int &aColumnOffset,
+                                                      Locations<T> &aLocation1, Locations<T> &aLocation2,
+                                                      Locations<T> &aLocation3, T *aLocalTheta,
+                                                      const int &aDistanceMetric) {
+
+    const T sigma_square = aLocalTheta[0];
+    const T beta = aLocalTheta[1];
+    const T nu = aLocalTheta[2];
+    const size_t tile_size = (size_t) aRowsNumber * aColumnsNumber;
+    int flag = 0;
+
+    DistanceCalculationHelpers<T>::CalculateTileDistances(apMatrixA, aLocation1, aLocation2, aRowsNumber,
+                                                          aColumnsNumber, aRowOffset, aColumnOffset, aDistanceMetric,
+                                                          flag);
+    for (size_t k = 0; k < tile_size; k++) {
+        const T dist = pow(apMatrixA[k], nu);
+        apMatrixA[k] = (dist == 0.0) ? sigma_square : sigma_square * exp(-(dist / beta));
+    }
+}
@@ -18,6 +18,7 @@
 
 #include <linear-algebra-solvers/concrete/chameleon/dense/ChameleonDense.hpp>
 #include <linear-algebra-solvers/concrete/chameleon/dst/ChameleonDST.hpp>
+#include <linear-algebra-solvers/concrete/chameleon/vecchia/ChameleonVecchia.hpp>
 
 #ifdef USE_HICMA
 
@@ -48,6 +49,8 @@ std::unique_ptr<LinearAlgebraMethods<T>> LinearAlgebraFactory<T>::CreateLinearAl
     } else if (aComputation == DIAGONAL_APPROX) {
         return std::make_unique<diagonalSuperTile::ChameleonDST<T>>();
 
+    } else if (aComputation == VECCHIA_APPROX) {
+        return std::make_unique<vecchia::ChameleonVecchia<T>>();
     }
     // Return nullptr if no computation is selected
     throw std::runtime_error("You need to enable whether HiCMA or Chameleon");
@@ -12,6 +12,8 @@
  * @date 2024-02-04
 **/
 
+#include <algorithm>
+
 #ifdef USE_MPI
 
 #include <mpi.h>
@@ -22,6 +24,7 @@
 
 #include <linear-algebra-solvers/LinearAlgebraMethods.hpp>
 #include <data-loader/concrete/CSVLoader.hpp>
+#include <data-loader/concrete/BinaryLoader.hpp>
 
 using namespace std;
 
@@ -32,6 +35,43 @@ using namespace exageostat::configurations;
 using namespace exageostat::runtime;
 using namespace exageostat::results;
 
+// The kernels of the covariance derivatives used by the Fisher matrix and the likelihood gradient, in the order of the parameters.
+static const vector<string> FISHER_DERIVATIVE_KERNELS = {"UnivariateMaternDdsigmaSquare", "UnivariateMaternDbeta",
+                                                         "UnivariateMaternDnu", "UnivariateMaternNuggetsStationary"};
+// The descriptors holding the solved covariance derivatives, in the order of the parameters.
+static const vector<DescriptorName> FISHER_DERIVATIVES = {DESCRIPTOR_CJ, DESCRIPTOR_CK, DESCRIPTOR_CL, DESCRIPTOR_CM};
+// The descriptors holding the covariance derivatives applied to the trace estimator probes.
+static const vector<DescriptorName> PROBES_DERIVATIVES = {DESCRIPTOR_PROBES_DERIVATIVE_1,
+                                                          DESCRIPTOR_PROBES_DERIVATIVE_2,
+                                                          DESCRIPTOR_PROBES_DERIVATIVE_3,
+                                                          DESCRIPTOR_PROBES_DERIVATIVE_4};
+
+/**
+ * @brief Averages the Hutchinson samples on the diagonal of a probes cross product.
+ * @param[in] apCross The cross product, of leading dimension aProbesNumber + 1, whose last column is not a probe.
+ * @param[in] aProbesNumber The number of probes.
+ * @param[out] aRelativeError The relative standard error of the mean, zero for a single probe.
+ * @return The trace estimate.
+ *
+ */
+template<typename T>
+static double ProbesMean(const T *apCross, const int &aProbesNumber, double &aRelativeError) {
+    const int leading_dim = aProbesNumber + 1;
+    double mean = 0, variance = 0;
+    for (int i = 0; i < aProbesNumber; i++) {
+        mean += apCross[i + i * leading_dim];
+    }
+    mean /= aProbesNumber;
+    for (int i = 0; i < aProbesNumber; i++) {
+        variance += (apCross[i + i * leading_dim] - mean) * (apCross[i + i * leading_dim] - mean);
+    }
+    aRelativeError = 0;
+    if (aProbesNumber > 1 && mean != 0) {
+        aRelativeError = sqrt(variance / (aProbesNumber - 1) / aProbesNumber) / fabs(mean);
+    }
+    return mean;
+}
+
 // Define a method to set up the Chameleon descriptors
 template<typename T>
 void LinearAlgebraMethods<T>::InitiateDescriptors(Configurations &aConfigurations, DescriptorData<T> &aDescriptorData,
@@ -69,9 +109,13 @@ void LinearAlgebraMethods<T>::InitiateDescriptors(Configurations &aConfiguration
         throw runtime_error("Unsupported for now!");
     }
 
-    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C, is_OOC, nullptr, float_point, dts, dts,
-                                  dts * dts, full_problem_size, full_problem_size, 0, 0, full_problem_size,
-                                  full_problem_size, p_grid, q_grid);
+    // In mixed precision, C only holds the tiles near the diagonal and C_SINGLE the others. Both are created out of
+    // core, so the runtime only allocates the tiles that are used.
+    bool is_mixed_precision = aConfigurations.GetPrecision() == MIXED &&
+                              aConfigurations.GetComputation() == EXACT_DENSE && float_point == EXAGEOSTAT_REAL_DOUBLE;
+    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C, is_OOC || is_mixed_precision, nullptr,
+                                  float_point, dts, dts, dts * dts, full_problem_size, full_problem_size, 0, 0,
+                                  full_problem_size, full_problem_size, p_grid, q_grid);
     aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_Z, is_OOC, apMeasurementsMatrix, float_point,
                                   dts, dts, dts * dts, full_problem_size, 1, 0, 0, full_problem_size, 1, p_grid,
                                   q_grid);
@@ -105,6 +149,17 @@ void LinearAlgebraMethods<T>::InitiateDescriptors(Configurations &aConfiguration
                                       dts, dts, dts * dts, 1, 1, 0, 0, 1, 1, p_grid, q_grid);
         aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_PRODUCT_2, is_OOC, nullptr, float_point,
                                       dts, dts, dts * dts, 1, 1, 0, 0, 1, 1, p_grid, q_grid);
+        // The off-band tiles of the mixed-precision factorization, and a column of double precision tiles they are
+        // promoted into, one at a time, by the solve.
+        if (is_mixed_precision) {
+            aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C_SINGLE, true, nullptr,
+                                          EXAGEOSTAT_REAL_FLOAT, dts, dts, dts * dts, full_problem_size,
+                                          full_problem_size, 0, 0, full_problem_size, full_problem_size, p_grid,
+                                          q_grid);
+            aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C_PANEL, is_OOC, nullptr,
+                                          float_point, dts, dts, dts * dts, full_problem_size, dts, 0, 0,
+                                          full_problem_size, dts, p_grid, q_grid);
+        }
     }
 
     if (aConfigurations.GetIsNonGaussian()) {
@@ -117,6 +172,70 @@ void LinearAlgebraMethods<T>::InitiateDescriptors(Configurations &aConfiguration
     aDescriptorData.SetIsDescriptorInitiated(true);
 }
 
+template<typename T>
+void LinearAlgebraMethods<T>::InitiateVecchiaDescriptors(Configurations &aConfigurations,
+                                                         DescriptorData<T> &aDescriptorData, T *apMeasurementsMatrix) {
+
+    if (aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_PRODUCT).chameleon_desc != nullptr) {
+        return;
+    }
+    // Check for initialize the Chameleon context.
+    if (!ExaGeoStatHardware::GetChameleonContext()) {
+        throw std::runtime_error(
+                "ExaGeoStat hardware is not initialized, please use 'ExaGeoStatHardware(computation, cores_number, gpu_numbers);'.");
+    }
+
+    int problem_size = aConfigurations.GetProblemSize();
+    int dts = aConfigurations.GetDenseTileSize();
+    int p_grid = ExaGeoStatHardware::GetPGrid();
+    int q_grid = ExaGeoStatHardware::GetQGrid();
+    bool is_OOC = aConfigurations.GetIsOOC();
+    FloatPoint float_point = sizeof(T) == SIZE_OF_FLOAT ? EXAGEOSTAT_REAL_FLOAT : EXAGEOSTAT_REAL_DOUBLE;
+
+    if (!aDescriptorData.GetSequence()) {
+        RUNTIME_sequence_t *pSequence;
+        ExaGeoStatCreateSequence(&pSequence);
+        aDescriptorData.SetSequence(pSequence);
+        RUNTIME_request_t request_array[2] = {RUNTIME_REQUEST_INITIALIZER, RUNTIME_REQUEST_INITIALIZER};
+        aDescriptorData.SetRequest(request_array);
+    }
+    if (aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_Z).chameleon_desc == nullptr) {
+        aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_Z, is_OOC, apMeasurementsMatrix,
+                                      float_point, dts, dts, dts * dts, problem_size, 1, 0, 0, problem_size, 1, p_grid,
+                                      q_grid);
+    }
+    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_DETERMINANT, is_OOC, nullptr, float_point,
+                                  dts, dts, dts * dts, 1, 1, 0, 0, 1, 1, p_grid, q_grid, false);
+    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_PRODUCT, is_OOC, nullptr, float_point, dts,
+                                  dts, dts * dts, 1, 1, 0, 0, 1, 1, p_grid, q_grid, false);
+}
+
+template<typename T>
+bool LinearAlgebraMethods<T>::InitiateDistanceCacheDescriptor(Configurations &aConfigurations,
+                                                              DescriptorData<T> &aDescriptorData, const int &aP) {
+
+    if (aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_DISTANCE).chameleon_desc != nullptr) {
+        return true;
+    }
+    // The cache is disabled unless a memory budget is given.
+    const size_t budget = (size_t) aConfigurations.GetDistanceCacheBudget() * 1024 * 1024;
+    const size_t full_problem_size = (size_t) aConfigurations.GetProblemSize() * aP;
+    if (budget == 0 || full_problem_size * full_problem_size * sizeof(T) > budget) {
+        return false;
+    }
+
+    int dts = aConfigurations.GetDenseTileSize();
+    int p_grid = ExaGeoStatHardware::GetPGrid();
+    int q_grid = ExaGeoStatHardware::GetQGrid();
+    bool is_OOC = aConfigurations.GetIsOOC();
+    FloatPoint float_point = sizeof(T) == SIZE_OF_FLOAT ? EXAGEOSTAT_REAL_FLOAT : EXAGEOSTAT_REAL_DOUBLE;
+
+    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_DISTANCE, is_OOC, nullptr, float_point, dts,
+                                  dts, dts * dts, full_problem_size, full_problem_size, 0, 0, full_problem_size,
+                                  full_problem_size, p_grid, q_grid);
+    return true;
+}
+
 template<typename T>
 void LinearAlgebraMethods<T>::InitiateFisherDescriptors(Configurations &aConfigurations,
                                                         dataunits::DescriptorData<T> &aDescriptorData) {
@@ -163,29 +282,106 @@ void LinearAlgebraMethods<T>::InitiateFisherDescriptors(Configurations &aConfigu
     aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_A, is_OOC, nullptr, float_point, dts,
                                   dts, dts * dts, num_params, num_params, 0, 0, num_params, num_params, p_grid, q_grid);
 
-    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_CJ, is_OOC, nullptr, float_point,
-                                  dts, dts, dts * dts, full_problem_size, full_problem_size, 0, 0, full_problem_size,
-                                  full_problem_size, p_grid, q_grid);
+    // The stochastic estimator only keeps the derivatives applied to its probes.
+    if (aConfigurations.GetTraceProbesNumber() > 0) {
+        this->InitiateTraceEstimatorDescriptors(aConfigurations, aDescriptorData, num_params);
+        return;
+    }
 
-    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_CK, is_OOC, nullptr, float_point,
-                                  dts, dts, dts * dts, full_problem_size, full_problem_size, 0, 0, full_problem_size,
-                                  full_problem_size, p_grid, q_grid);
+    // One matrix per parameter, each derivative is kept once solved so that every pair can be reduced.
+    if (num_params > (int) FISHER_DERIVATIVES.size()) {
+        throw runtime_error("Fisher matrix supports up to " + to_string(FISHER_DERIVATIVES.size()) + " parameters.");
+    }
+    // The likelihood gradient may have created some of them already.
+    for (int i = 0; i < num_params; i++) {
+        if (aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, FISHER_DERIVATIVES[i]).chameleon_desc) {
+            continue;
+        }
+        aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, FISHER_DERIVATIVES[i], is_OOC, nullptr,
+                                      float_point, dts, dts, dts * dts, full_problem_size, full_problem_size, 0, 0,
+                                      full_problem_size, full_problem_size, p_grid, q_grid);
+    }
 
-    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_RESULTS, is_OOC, nullptr,
-                                  float_point, dts, dts, dts * dts, full_problem_size, full_problem_size, 0, 0,
-                                  full_problem_size, full_problem_size, p_grid, q_grid);
+    if (!aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_C_TRACE).chameleon_desc) {
+        aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_C_TRACE, is_OOC, nullptr,
+                                      float_point, dts, dts, dts * dts, 1, 1, 0, 0, 1, 1, p_grid, q_grid);
+    }
+}
 
-    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_C_TRACE, is_OOC, nullptr,
-                                  float_point, dts, dts, dts * dts, 1, 1, 0, 0, 1, 1, p_grid, q_grid);
+template<typename T>
+void LinearAlgebraMethods<T>::InitiateGradientDescriptors(Configurations &aConfigurations,
+                                                          dataunits::DescriptorData<T> &aDescriptorData) {
+
+    if (aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C_INVERSE).chameleon_desc != nullptr) {
+        return;
+    }
+
+    int full_problem_size = aConfigurations.GetProblemSize();
+    int dts = aConfigurations.GetDenseTileSize();
+    int p_grid = ExaGeoStatHardware::GetPGrid();
+    int q_grid = ExaGeoStatHardware::GetQGrid();
+    bool is_OOC = aConfigurations.GetIsOOC();
+    FloatPoint float_point = sizeof(T) == SIZE_OF_FLOAT ? EXAGEOSTAT_REAL_FLOAT : EXAGEOSTAT_REAL_DOUBLE;
 
-    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_C_DIAG, is_OOC, nullptr, float_point,
+    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C_INVERSE, is_OOC, nullptr, float_point,
+                                  dts, dts, dts * dts, full_problem_size, full_problem_size, 0, 0, full_problem_size,
+                                  full_problem_size, p_grid, q_grid);
+    // A single derivative is alive at a time, it shares the first Fisher derivative descriptor.
+    if (!aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, FISHER_DERIVATIVES[0]).chameleon_desc) {
+        aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, FISHER_DERIVATIVES[0], is_OOC, nullptr,
+                                      float_point, dts, dts, dts * dts, full_problem_size, full_problem_size, 0, 0,
+                                      full_problem_size, full_problem_size, p_grid, q_grid);
+    }
+    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_Z_SOLVED, is_OOC, nullptr, float_point, dts,
+                                  dts, dts * dts, full_problem_size, 1, 0, 0, full_problem_size, 1, p_grid, q_grid);
+    aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_Z_DERIVATIVE, is_OOC, nullptr, float_point,
                                   dts, dts, dts * dts, full_problem_size, 1, 0, 0, full_problem_size, 1, p_grid,
                                   q_grid);
+    if (!aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_C_TRACE).chameleon_desc) {
+        aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, common::DESCRIPTOR_C_TRACE, is_OOC, nullptr,
+                                      float_point, dts, dts, dts * dts, 1, 1, 0, 0, 1, 1, p_grid, q_grid);
+    }
+}
+
+template<typename T>
+void LinearAlgebraMethods<T>::InitiateTraceEstimatorDescriptors(Configurations &aConfigurations,
+                                                                dataunits::DescriptorData<T> &aDescriptorData,
+                                                                const int &aParametersNumber) {
+
+    if (aParametersNumber > (int) PROBES_DERIVATIVES.size()) {
+        throw runtime_error("Trace estimation supports up to " + to_string(PROBES_DERIVATIVES.size()) + " parameters.");
+    }
+
+    int full_problem_size = aConfigurations.GetProblemSize();
+    int block_size = aConfigurations.GetTraceProbesNumber() + 1;
+    int dts = aConfigurations.GetDenseTileSize();
+    int p_grid = ExaGeoStatHardware::GetPGrid();
+    int q_grid = ExaGeoStatHardware::GetQGrid();
+    bool is_OOC = aConfigurations.GetIsOOC();
+    FloatPoint float_point = sizeof(T) == SIZE_OF_FLOAT ? EXAGEOSTAT_REAL_FLOAT : EXAGEOSTAT_REAL_DOUBLE;
+
+    if (!aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_PROBES).chameleon_desc) {
+        aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_PROBES, is_OOC, nullptr, float_point,
+                                      dts, dts, dts * dts, full_problem_size, block_size, 0, 0, full_problem_size,
+                                      block_size, p_grid, q_grid);
+        aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_PROBES_CROSS, is_OOC, nullptr,
+                                      float_point, dts, dts, dts * dts, block_size, block_size, 0, 0, block_size,
+                                      block_size, p_grid, q_grid);
+    }
+    for (int i = 0; i < aParametersNumber; i++) {
+        if (aDescriptorData.GetDescriptor(common::CHAMELEON_DESCRIPTOR, PROBES_DERIVATIVES[i]).chameleon_desc) {
+            continue;
+        }
+        aDescriptorData.SetDescriptor(common::CHAMELEON_DESCRIPTOR, PROBES_DERIVATIVES[i], is_OOC, nullptr,
+                                      float_point, dts, dts, dts * dts, full_problem_size, block_size, 0, 0,
+                                      full_problem_size, block_size, p_grid, q_grid);
+    }
 }
 
 template<typename T>
 void LinearAlgebraMethods<T>::InitiatePredictionDescriptors(Configurations &aConfigurations,
-                                                            std::unique_ptr<ExaGeoStatData<T>> &aData) {
+                                                            std::unique_ptr<ExaGeoStatData<T>> &aData,
+                                                            const bool &aIsFactorReused) {
 
     if (!ExaGeoStatHardware::GetChameleonContext()) {
         throw std::runtime_error(
@@ -231,23 +427,25 @@ void LinearAlgebraMethods<T>::InitiatePredictionDescriptors(Configurations &aCon
     if (CHAM_descC12) {
         exaGeoStatDescriptor.DestroyDescriptor(CHAMELEON_DESCRIPTOR, CHAM_descC12);
     }
-    auto *CHAM_descC22 = aData->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR, DESCRIPTOR_C22).chameleon_desc;
-    if (CHAM_descC22) {
-        exaGeoStatDescriptor.DestroyDescriptor(CHAMELEON_DESCRIPTOR, CHAM_descC22);
+    // The retained factor of the modeling stands for C22, so the observations covariance matrix is not allocated.
+    if (!aIsFactorReused) {
+        auto *CHAM_descC22 = aData->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
+                                                                       DESCRIPTOR_C22).chameleon_desc;
+        if (CHAM_descC22) {
+            exaGeoStatDescriptor.DestroyDescriptor(CHAMELEON_DESCRIPTOR, CHAM_descC22);
+        }
+        aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C22, is_OOC, nullptr,
+                                                  float_point, dts, dts, dts * dts, n_z_obs, n_z_obs, 0, 0, n_z_obs,
+                                                  n_z_obs, p_grid, q_grid);
     }
-    aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C22, is_OOC, nullptr,
-                                              float_point, dts, dts, dts * dts, n_z_obs, n_z_obs, 0, 0, n_z_obs,
-                                              n_z_obs, p_grid, q_grid);
-    if (aConfigurations.GetIsNonGaussian()) {
+    if (aConfigurations.GetIsNonGaussian() || aConfigurations.GetIsKrigingVariance()) {
+        // The cross covariance is stored transposed, so that its triangular solve gives the variances as column norms.
         aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_R, is_OOC, nullptr,
                                                   float_point, dts, dts, dts * dts, n_z_obs, z_miss_number, 0, 0,
                                                   n_z_obs, z_miss_number, p_grid, q_grid);
-        aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_R_COPY, is_OOC, nullptr,
-                                                  float_point, dts, dts, dts * dts, n_z_obs, z_miss_number, 0, 0,
-                                                  n_z_obs, z_miss_number, p_grid, q_grid);
-        aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C12, is_OOC, nullptr,
-                                                  float_point, dts, dts, dts * dts, z_miss_number, z_miss_number, 0, 0,
-                                                  z_miss_number, z_miss_number, p_grid, q_grid);
+        aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_KRIGING_VARIANCE, is_OOC,
+                                                  nullptr, float_point, dts, dts, dts * dts, 1, z_miss_number, 0, 0,
+                                                  1, z_miss_number, p_grid, q_grid);
     } else {
         aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_C12, is_OOC, nullptr,
                                                   float_point, dts, dts, dts * dts, z_miss_number, n_z_obs, 0, 0,
@@ -279,34 +477,45 @@ void LinearAlgebraMethods<T>::InitiateMLOEMMOMDescriptors(Configurations &aConfi
     } else {
         throw runtime_error("Unsupported for now!");
     }
+    // All the missing locations are processed together, each one owns a block of aP columns.
+    int n_z_miss = aConfigurations.GetUnknownObservationsNb() * aP;
+    if (dts % aP != 0) {
+        throw runtime_error("MLOE-MMOM requires the dense tile size to be a multiple of the number of variables.");
+    }
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_k_T, is_OOC, nullptr,
-                                              float_point,
-                                              dts, dts, dts * dts, n_z_obs, aP, 0, 0, n_z_obs, aP, p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, n_z_obs, n_z_miss, 0, 0, n_z_obs,
+                                              n_z_miss, p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_k_A, is_OOC, nullptr,
-                                              float_point,
-                                              dts, dts, dts * dts, n_z_obs, aP, 0, 0, n_z_obs, aP, p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, n_z_obs, n_z_miss, 0, 0, n_z_obs,
+                                              n_z_miss, p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_k_A_TMP, is_OOC, nullptr,
-                                              float_point, dts, dts, dts * dts, n_z_obs, aP, 0, 0, n_z_obs, aP,
-                                              p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, n_z_obs, n_z_miss, 0, 0, n_z_obs,
+                                              n_z_miss, p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_k_T_TMP, is_OOC, nullptr,
-                                              float_point, dts, dts, dts * dts, n_z_obs, aP, 0, 0, n_z_obs, aP,
-                                              p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, n_z_obs, n_z_miss, 0, 0, n_z_obs,
+                                              n_z_miss, p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_EXPR_1, is_OOC, nullptr,
-                                              float_point, dts, dts, dts * dts, aP, aP, 0, 0, aP, aP, p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, aP, n_z_miss, 0, 0, aP, n_z_miss,
+                                              p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_EXPR_2, is_OOC, nullptr,
-                                              float_point, dts, dts, dts * dts, aP, aP, 0, 0, aP, aP, p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, aP, n_z_miss, 0, 0, aP, n_z_miss,
+                                              p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_EXPR_3, is_OOC, nullptr,
-                                              float_point, dts, dts, dts * dts, aP, aP, 0, 0, aP, aP, p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, aP, n_z_miss, 0, 0, aP, n_z_miss,
+                                              p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_EXPR_4, is_OOC, nullptr,
-                                              float_point, dts, dts, dts * dts, aP, aP, 0, 0, aP, aP, p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, aP, n_z_miss, 0, 0, aP, n_z_miss,
+                                              p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_MLOE, is_OOC, nullptr,
                                               float_point, dts, dts, dts * dts, 1, 1, 0, 0, 1, 1, p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_MMOM, is_OOC, nullptr,
                                               float_point, dts, dts, dts * dts, 1, 1, 0, 0, 1, 1, p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_TRUTH_ALPHA, is_OOC, nullptr,
-                                              float_point, dts, dts, dts * dts, aP, aP, 0, 0, aP, aP, p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, aP, n_z_miss, 0, 0, aP, n_z_miss,
+                                              p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_TIMATED_ALPHA, is_OOC, nullptr,
-                                              float_point, dts, dts, dts * dts, aP, aP, 0, 0, aP, aP, p_grid, q_grid);
+                                              float_point, dts, dts, dts * dts, aP, n_z_miss, 0, 0, aP, n_z_miss,
+                                              p_grid, q_grid);
     aData->GetDescriptorData()->SetDescriptor(common::CHAMELEON_DESCRIPTOR, DESCRIPTOR_K_T, is_OOC, nullptr,
                                               float_point,
                                               dts, dts, dts * dts, n_z_obs, n_z_obs, 0, 0, n_z_obs,
@@ -360,8 +569,17 @@ void LinearAlgebraMethods<T>::GenerateObservationsVector(Configurations &aConfig
     }
     auto *CHAM_descC = aData->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR, DESCRIPTOR_C).chameleon_desc;
     //normal random generation of e -- ei~N(0, 1) to generate Z
-    auto *randomN = new T[full_problem_size];
-    LAPACKE_dlarnv(3, initial_seed, full_problem_size, (double *) randomN);
+    // The counter-based generator fills the tiles of Z directly, without the whole vector on every process.
+    bool is_philox = aConfigurations.GetRandomGenerator() == common::PHILOX_GENERATOR;
+    T *randomN = nullptr;
+    if (!is_philox) {
+        randomN = new T[full_problem_size];
+        if (sizeof(T) == SIZE_OF_FLOAT) {
+            LAPACKE_slarnv(3, initial_seed, full_problem_size, (float *) randomN);
+        } else {
+            LAPACKE_dlarnv(3, initial_seed, full_problem_size, (double *) randomN);
+        }
+    }
 
     //Generate the co-variance matrix C
     auto *theta = new T[aConfigurations.GetInitialTheta().size()];
@@ -383,7 +601,11 @@ void LinearAlgebraMethods<T>::GenerateObservationsVector(Configurations &aConfig
     //Copy randomN to Z
     VERBOSE("\tGenerate Normal Random Distribution Vector Z (Synthetic Dataset Generation Phase) .....")
     auto *CHAM_descZ = aData->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR, DESCRIPTOR_Z).chameleon_desc;
-    RuntimeFunctions<T>::CopyDescriptorZ(*aData->GetDescriptorData(), CHAM_descZ, randomN);
+    if (is_philox) {
+        RuntimeFunctions<T>::GenerateNormalDescriptor(*aData->GetDescriptorData(), CHAM_descZ, seed);
+    } else {
+        RuntimeFunctions<T>::CopyDescriptorZ(*aData->GetDescriptorData(), CHAM_descZ, randomN);
+    }
     VERBOSE("Done.")
 
     //Cholesky factorization for the Co-variance matrix C
@@ -392,6 +614,7 @@ void LinearAlgebraMethods<T>::GenerateObservationsVector(Configurations &aConfig
     ExaGeoStatPotrfTile(EXAGEOSTAT_LOWER, CHAM_descC, 0, nullptr, nullptr, 0, 0);
     STOP_TIMING(time_facto);
     flops = flops + flops_dpotrf(full_problem_size);
+    aData->SetFactorTheta({});
     VERBOSE("\tDone.")
 
     //Triangular matrix-matrix multiplication
@@ -411,21 +634,8 @@ void LinearAlgebraMethods<T>::GenerateObservationsVector(Configurations &aConfig
     }
     delete[] theta;
     if (aConfigurations.GetLogger()) {
-        T *pMatrix;
         VERBOSE("Writing generated data to the disk (Synthetic Dataset Generation Phase) .....")
-#ifdef USE_MPI
-        pMatrix = new T[full_problem_size];
-        string path = aConfigurations.GetLoggerPath();
-        ExaGeoStatDesc2Lap(pMatrix, full_problem_size, CHAM_descZ, EXAGEOSTAT_UPPER_LOWER);
-        if (CHAMELEON_Comm_rank() == 0) {
-            dataLoader::csv::CSVLoader<T>::GetInstance()->WriteData(*pMatrix, full_problem_size, P, path, *apLocation1);
-        }
-        delete[] pMatrix;
-#else
-        pMatrix = (T *) CHAM_descZ->mat;
-        string path = aConfigurations.GetLoggerPath();
-        dataLoader::csv::CSVLoader<T>::GetInstance()->WriteData(*pMatrix, full_problem_size, P, path, *apLocation1);
-#endif
+        this->WriteMeasurementsVector(aConfigurations, CHAM_descZ, full_problem_size, P, *apLocation1);
         VERBOSE("\tDone.")
     }
 
@@ -448,17 +658,63 @@ void LinearAlgebraMethods<T>::GenerateObservationsVector(Configurations &aConfig
 
 }
 
+template<typename T>
+void LinearAlgebraMethods<T>::WriteMeasurementsVector(Configurations &aConfigurations, void *apDescZ,
+                                                      const int &aProblemSize, const int &aP,
+                                                      Locations<T> &aLocations) {
+
+    auto *pDescZ = (CHAM_desc_t *) apDescZ;
+    string path = aConfigurations.GetLoggerPath();
+#ifdef USE_MPI
+    if (aConfigurations.GetDataFormat() == BINARY_FILE) {
+        // The tiles have fixed offsets in the file, every process writes its own ones without gathering the vector.
+        CHAMELEON_Desc_Acquire(pDescZ);
+        vector<dataLoader::binary::MeasurementsBlock<T>> blocks;
+        for (int row = 0; row < pDescZ->mt; row++) {
+            if (pDescZ->get_rankof(pDescZ, row, 0) != pDescZ->myrank) {
+                continue;
+            }
+            int rows_number = row == pDescZ->mt - 1 ? pDescZ->m - row * pDescZ->mb : pDescZ->mb;
+            blocks.push_back({(uint64_t) row * pDescZ->mb, (const T *) pDescZ->get_blkaddr(pDescZ, row, 0),
+                              (size_t) rows_number});
+        }
+        dataLoader::binary::BinaryLoader<T>::GetInstance()->WriteData(blocks, aProblemSize, aP, path, aLocations,
+                                                                     aConfigurations.GetOrdering());
+        CHAMELEON_Desc_Release(pDescZ);
+        return;
+    }
+    // The offsets of the CSV lines depend on all the preceding values, the vector is gathered on every process.
+    auto *pMatrix = new T[aProblemSize];
+    ExaGeoStatDesc2Lap(pMatrix, aProblemSize, pDescZ, EXAGEOSTAT_UPPER_LOWER);
+    MPI_Bcast(pMatrix, aProblemSize, sizeof(T) == SIZE_OF_FLOAT ? MPI_FLOAT : MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    dataLoader::csv::CSVLoader<T>::GetInstance()->WriteData(*pMatrix, aProblemSize, aP, path, aLocations);
+    delete[] pMatrix;
+#else
+    auto *pMatrix = (T *) pDescZ->mat;
+    if (aConfigurations.GetDataFormat() == BINARY_FILE) {
+        dataLoader::binary::BinaryLoader<T>::GetInstance()->WriteData(*pMatrix, aProblemSize, aP, path, aLocations,
+                                                                     aConfigurations.GetOrdering());
+    } else {
+        dataLoader::csv::CSVLoader<T>::GetInstance()->WriteData(*pMatrix, aProblemSize, aP, path, aLocations);
+    }
+#endif
+}
+
 template<typename T>
 T *LinearAlgebraMethods<T>::ExaGeoStatMLEPredictTile(std::unique_ptr<ExaGeoStatData<T>> &aData, T *apTheta,
                                                      const int &aZMissNumber, const int &aZObsNumber, T *apZObs,
-                                                     T *apZActual, T *apZMiss, Configurations &aConfiguration,
+                                                     T *apZActual, T *apZMiss, T *apZMissVariance,
+                                                     Configurations &aConfiguration,
                                                      Locations<T> &aMissLocations, Locations<T> &aObsLocations,
                                                      const kernels::Kernel<T> &aKernel) {
 
     int i;
-    this->InitiatePredictionDescriptors(aConfiguration, aData);
+    // When the observations are the modeling locations, C22 is the matrix the modeling already factorized.
+    bool is_factor_reused = IsFactorReusable(aConfiguration, aData, apTheta, aKernel.GetParametersNumbers(),
+                                             aObsLocations);
+    this->InitiatePredictionDescriptors(aConfiguration, aData, is_factor_reused);
 
-    double time_solve, mat_gen_time, time_gemm, time_mspe = 0.0, flops = 0.0;
+    double time_solve, mat_gen_time, time_gemm, time_variance, time_mspe = 0.0, flops = 0.0;
     int num_params;
 
     auto *CHAM_desc_Zmiss = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
@@ -524,35 +780,92 @@ T *LinearAlgebraMethods<T>::ExaGeoStatMLEPredictTile(std::unique_ptr<ExaGeoStatD
     LOGGER_PRECISION(")")
     LOGGER("")
 
+    auto *CHAM_desc_factor = CHAM_desc_C22;
+    if (is_factor_reused) {
+        CHAM_desc_factor = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
+                                                                     DescriptorName::DESCRIPTOR_C).chameleon_desc;
+    }
+    // The kriging variance needs the cross covariance with one column per missing location.
+    bool is_kriging_variance = aConfiguration.GetIsKrigingVariance();
+    auto *CHAM_desc_R = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
+                                                                  DescriptorName::DESCRIPTOR_R).chameleon_desc;
+
     START_TIMING(mat_gen_time);
-    VERBOSE("\tGenerate C22 Covariance Matrix... (Prediction Stage)")
     int upper_lower = EXAGEOSTAT_LOWER;
-    RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C22, upper_lower, &aObsLocations,
-                                          &aObsLocations, &median_locations, apTheta, 0, &aKernel);
-    ExaGeoStatSequenceWait(sequence);
-    VERBOSE("Done.")
-    VERBOSE("Generate C12 Covariance Matrix... (Prediction Stage)")
-    RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C12, upper_lower, &aMissLocations,
-                                          &aObsLocations, &median_locations, apTheta, 0, &aKernel);
+    if (!is_factor_reused) {
+        VERBOSE("\tGenerate C22 Covariance Matrix... (Prediction Stage)")
+        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C22, upper_lower,
+                                              &aObsLocations, &aObsLocations, &median_locations, apTheta, 0,
+                                              &aKernel);
+        ExaGeoStatSequenceWait(sequence);
+        VERBOSE("Done.")
+    }
+    if (is_kriging_variance) {
+        VERBOSE("Generate C21 Covariance Matrix... (Prediction Stage)")
+        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_R, EXAGEOSTAT_UPPER_LOWER,
+                                              &aObsLocations, &aMissLocations, &median_locations, apTheta, 0,
+                                              &aKernel);
+    } else {
+        VERBOSE("Generate C12 Covariance Matrix... (Prediction Stage)")
+        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C12, upper_lower,
+                                              &aMissLocations, &aObsLocations, &median_locations, apTheta, 0,
+                                              &aKernel);
+    }
     ExaGeoStatSequenceWait(sequence);
     VERBOSE("\tDone.")
     STOP_TIMING(mat_gen_time);
 
     START_TIMING(time_solve);
     //Start prediction
-    VERBOSE("\tCalculate dposv C22 Covariance Matrix... (Prediction Stage)")
-    ExaGeoStatPosvTile(EXAGEOSTAT_LOWER, CHAM_desc_C22, CHAM_desc_Zobs);
-    flops = flops + flops_dpotrf(aZObsNumber);
-    flops = flops + flops_dtrsm(ChamLeft, aZObsNumber, aZObsNumber);
+    if (is_factor_reused) {
+        VERBOSE("\tSolve with the retained Cholesky factor of C22... (Prediction Stage)")
+        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                           CHAM_desc_factor, nullptr, nullptr, CHAM_desc_Zobs, 0);
+        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                           CHAM_desc_factor, nullptr, nullptr, CHAM_desc_Zobs, 0);
+        flops = flops + 2 * flops_dtrsm(ChamLeft, aZObsNumber, CHAM_desc_Zobs->n);
+    } else {
+        VERBOSE("\tCalculate dposv C22 Covariance Matrix... (Prediction Stage)")
+        ExaGeoStatPosvTile(EXAGEOSTAT_LOWER, CHAM_desc_C22, CHAM_desc_Zobs);
+        flops = flops + flops_dpotrf(aZObsNumber);
+        flops = flops + flops_dtrsm(ChamLeft, aZObsNumber, aZObsNumber);
+    }
     VERBOSE("\tDone.")
     STOP_TIMING(time_solve);
 
     START_TIMING(time_gemm);
-    VERBOSE("\tCalculate dgemm Zmiss= C12 * Zobs Covariance Matrix... (Prediction Stage)")
-    CHAMELEON_dgemm_Tile(ChamNoTrans, ChamNoTrans, 1, CHAM_desc_C12, CHAM_desc_Zobs, 0, CHAM_desc_Zmiss);
+    if (is_kriging_variance) {
+        VERBOSE("\tCalculate dgemm Zmiss= C21^T * Zobs Covariance Matrix... (Prediction Stage)")
+        ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_R, CHAM_desc_Zobs, 0,
+                           CHAM_desc_Zmiss);
+    } else {
+        VERBOSE("\tCalculate dgemm Zmiss= C12 * Zobs Covariance Matrix... (Prediction Stage)")
+        ExaGeoStatGemmTile(EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_C12, CHAM_desc_Zobs, 0,
+                           CHAM_desc_Zmiss);
+    }
     flops = flops + flops_dgemm(aZMissNumber, aZObsNumber, aZObsNumber);
     VERBOSE("\tDone.")
     STOP_TIMING(time_gemm);
+
+    if (is_kriging_variance) {
+        START_TIMING(time_variance);
+        // sigma^2 - c^T * C22^-1 * c, the solved part of every missing location is reduced as one column norm.
+        VERBOSE("\tCalculate the kriging variance of the missing locations... (Prediction Stage)")
+        ExaGeoStatExplainedVarianceTile(aData, CHAM_desc_factor, CHAM_desc_R, apZMissVariance);
+        flops = flops + flops_dtrsm(ChamLeft, aZObsNumber, aZMissNumber);
+        auto *pKernel = plugins::PluginRegistry<kernels::Kernel<T>>::Create(kernel_name,
+                                                                           aConfiguration.GetTimeSlot());
+        T prior_variance;
+        for (i = 0; i < aZMissNumber; i++) {
+            pKernel->GenerateCovarianceTile(&prior_variance, 1, 1, i, i, aMissLocations, aMissLocations,
+                                            median_locations, apTheta, 0);
+            apZMissVariance[i] = prior_variance - apZMissVariance[i];
+        }
+        delete pKernel;
+        VERBOSE("\tDone.")
+        STOP_TIMING(time_variance);
+        VERBOSE("\t---- Kriging Variance Time: " << time_variance)
+    }
     ExaGeoStatDesc2Lap(apZMiss, aZMissNumber, CHAM_desc_Zmiss, EXAGEOSTAT_UPPER_LOWER);
 
     if (apZActual) {
@@ -562,11 +875,11 @@ T *LinearAlgebraMethods<T>::ExaGeoStatMLEPredictTile(std::unique_ptr<ExaGeoStatD
             RuntimeFunctions<T>::ExaGeoStatMLEMSPEBivariateTileAsync(CHAM_desc_Zactual, CHAM_desc_Zmiss,
                                                                      CHAM_desc_mspe1,
                                                                      CHAM_desc_mspe2, CHAM_desc_mspe, sequence,
-                                                                     &request_array[0]);
+                                                                     &request_array[0],
+                                                                     aConfiguration.GetIsDeterministic());
         } else {
             RuntimeFunctions<T>::ExaGeoStatMLEMSPETileAsync(CHAM_desc_Zactual, CHAM_desc_Zmiss, CHAM_desc_mspe,
-                                                            sequence,
-                                                            request);
+                                                            sequence, request, aConfiguration.GetIsDeterministic());
         }
         ExaGeoStatSequenceWait(sequence);
         VERBOSE("\tDone.")
@@ -614,16 +927,21 @@ T *LinearAlgebraMethods<T>::ExaGeoStatMLENonGaussianPredictTile(std::unique_ptr<
                                                                 dataunits::Locations<T> &aObsLocations,
                                                                 const kernels::Kernel<T> &aKernel) {
 
+    if (aKernel.GetVariablesNumber() != 1) {
+        throw domain_error("The Non-Gaussian prediction supports the univariate kernels only.");
+    }
+
     int i;
-    this->InitiatePredictionDescriptors(aConfiguration, aData);
+    // When the observations are the modeling locations, R_theta is the matrix the modeling already factorized.
+    bool is_factor_reused = IsFactorReusable(aConfiguration, aData, apTheta, aKernel.GetParametersNumbers(),
+                                             aObsLocations);
+    this->InitiatePredictionDescriptors(aConfiguration, aData, is_factor_reused);
 
     double time_solve, mat_gen_time, mat_gen_time_2, time_trsm, time_gemm, time_mspe = 0.0, flops = 0.0;
     int num_params;
 
     auto *CHAM_desc_Zmiss = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
                                                                       DescriptorName::DESCRIPTOR_Z_MISS).chameleon_desc;
-    auto *CHAM_desc_C12 = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
-                                                                    DescriptorName::DESCRIPTOR_C12).chameleon_desc;
     auto *CHAM_desc_C22 = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
                                                                     DescriptorName::DESCRIPTOR_C22).chameleon_desc;
     auto *CHAM_desc_mspe = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
@@ -638,8 +956,8 @@ T *LinearAlgebraMethods<T>::ExaGeoStatMLENonGaussianPredictTile(std::unique_ptr<
                                                                      DescriptorName::DESCRIPTOR_Z_OBSERVATIONS).chameleon_desc;
     auto *CHAM_desc_R = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
                                                                   DescriptorName::DESCRIPTOR_R).chameleon_desc;
-    auto *CHAM_desc_Rcopy = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
-                                                                      DescriptorName::DESCRIPTOR_R_COPY).chameleon_desc;
+    auto *CHAM_desc_variance = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
+                                                                         DescriptorName::DESCRIPTOR_KRIGING_VARIANCE).chameleon_desc;
 
     T *mspe = aData->GetDescriptorData()->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_MSPE);
     *mspe = 0;
@@ -691,20 +1009,37 @@ T *LinearAlgebraMethods<T>::ExaGeoStatMLENonGaussianPredictTile(std::unique_ptr<
     RuntimeFunctions<T>::ExaGeoStatNonGaussianTransformTileAsync(aConfiguration.GetComputation(), CHAM_desc_Zobs,
                                                                  apTheta, sequence, &request_array[0]);
 
+    auto *CHAM_desc_factor = CHAM_desc_C22;
+    if (is_factor_reused) {
+        CHAM_desc_factor = aData->GetDescriptorData()->GetDescriptor(common::CHAMELEON_DESCRIPTOR,
+                                                                     DescriptorName::DESCRIPTOR_C).chameleon_desc;
+    }
+
     START_TIMING(mat_gen_time);
-    VERBOSE("\tGenerate R_theta Covariance Matrix... (Prediction Stage)")
     int upper_lower = EXAGEOSTAT_LOWER;
-    RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C22, upper_lower, &aObsLocations,
-                                          &aObsLocations, &median_locations, apTheta, 0, &aKernel);
-    ExaGeoStatSequenceWait(sequence);
-    VERBOSE("\tDone.")
+    if (!is_factor_reused) {
+        VERBOSE("\tGenerate R_theta Covariance Matrix... (Prediction Stage)")
+        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C22, upper_lower,
+                                              &aObsLocations, &aObsLocations, &median_locations, apTheta, 0,
+                                              &aKernel);
+        ExaGeoStatSequenceWait(sequence);
+        VERBOSE("\tDone.")
+    }
     STOP_TIMING(mat_gen_time);
 
     START_TIMING(time_solve);
-    VERBOSE("Calculate dposv R_theta Covariance Matrix... (Prediction Stage)")
-    ExaGeoStatPosvTile(EXAGEOSTAT_LOWER, CHAM_desc_C22, CHAM_desc_Zobs);
-    flops = flops + flops_dpotrf(aZObsNumber);
-    flops = flops + 2 * flops_dtrsm(ChamLeft, CHAM_desc_C22->m, CHAM_desc_Zobs->n);
+    if (is_factor_reused) {
+        VERBOSE("Solve with the retained Cholesky factor of R_theta... (Prediction Stage)")
+        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                           CHAM_desc_factor, nullptr, nullptr, CHAM_desc_Zobs, 0);
+        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                           CHAM_desc_factor, nullptr, nullptr, CHAM_desc_Zobs, 0);
+    } else {
+        VERBOSE("Calculate dposv R_theta Covariance Matrix... (Prediction Stage)")
+        ExaGeoStatPosvTile(EXAGEOSTAT_LOWER, CHAM_desc_C22, CHAM_desc_Zobs);
+        flops = flops + flops_dpotrf(aZObsNumber);
+    }
+    flops = flops + 2 * flops_dtrsm(ChamLeft, CHAM_desc_factor->m, CHAM_desc_Zobs->n);
     VERBOSE("\tDone.")
     STOP_TIMING(time_solve);
 
@@ -716,53 +1051,32 @@ T *LinearAlgebraMethods<T>::ExaGeoStatMLENonGaussianPredictTile(std::unique_ptr<
     VERBOSE("\tDone.")
     STOP_TIMING(mat_gen_time_2);
 
-    ExaGeoStatLapackCopyTile(EXAGEOSTAT_LOWER, CHAM_desc_R, CHAM_desc_Rcopy);
-
-    START_TIMING(time_trsm);
-    VERBOSE("Calculate dposv r_theta Covariance Matrix... (Prediction Stage)")
-    ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_C22,
-                       nullptr, nullptr, CHAM_desc_R, 0);
-    ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_C22,
-                       nullptr, nullptr, CHAM_desc_R, 0);
-    flops = flops + 2 * flops_dtrsm(ChamLeft, CHAM_desc_C22->m, CHAM_desc_Zobs->n);
-    VERBOSE("\tDone.")
-    STOP_TIMING(time_trsm);
-
     START_TIMING(time_gemm);
     VERBOSE("For each missing location, Generate correlation vector CHAMELEON_descr (Prediction Stage) .....")
-    CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Rcopy, CHAM_desc_Zobs, 0, CHAM_desc_Zmiss);
-    CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Rcopy, CHAM_desc_R, 0, CHAM_desc_C12);
+    ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_R, CHAM_desc_Zobs, 0, CHAM_desc_Zmiss);
+    flops = flops + flops_dgemm(aZMissNumber, aZObsNumber, CHAM_desc_Zobs->n);
     STOP_TIMING(time_gemm);
 
-    auto r = aData->GetDescriptorData()->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_C12);
-    auto Zmiss2 = aData->GetDescriptorData()->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_Z_MISS);
-
-    auto ng_nu = new T[aZMissNumber];
-    auto ng_sigma_sq = new T[aZMissNumber];
-
-    double mu = -1;
-    double sigma_sq = -1;
+    // Only the diagonal of r^T * R_theta^-1 * r is needed, it is reduced from the columns of L^-1 * r.
+    START_TIMING(time_trsm);
+    VERBOSE("Calculate the explained variance of the missing locations... (Prediction Stage)")
+    ExaGeoStatExplainedVarianceTile(aData, CHAM_desc_factor, CHAM_desc_R, nullptr);
+    flops = flops + flops_dtrsm(ChamLeft, aZObsNumber, aZMissNumber);
+    VERBOSE("\tDone.")
+    STOP_TIMING(time_trsm);
 
-    for (i = 0; i < aZMissNumber; i++) {
-        mu = Zmiss2[i];
-        sigma_sq = 1 - r[i * aZMissNumber + i];
-        ng_nu[i] = mu;
-        ng_sigma_sq[i] = sigma_sq;
-        //r^t X Z
-        apZMiss[i] = apTheta[2] + (apTheta[3] / (apTheta[4] * sqrt(1 - apTheta[5] * sigma_sq))) *
-                                  exp(apTheta[5] * pow(mu, 2) / (2 * (1 - apTheta[5] * sigma_sq))) *
-                                  (exp((pow(apTheta[4], 2) * sigma_sq + 2 * apTheta[4] * mu) /
-                                       (2 * (1 - apTheta[5] * sigma_sq))) - 1);
-    }
+    VERBOSE("Transform the conditional means to the Tukey g-and-h predictions... (Prediction Stage)")
+    RuntimeFunctions<T>::ExaGeoStatNonGaussianPredictTileAsync(aConfiguration.GetComputation(), CHAM_desc_Zmiss,
+                                                               CHAM_desc_variance, apTheta, sequence, request);
+    ExaGeoStatSequenceWait(sequence);
+    ExaGeoStatDesc2Lap(apZMiss, aZMissNumber, CHAM_desc_Zmiss, EXAGEOSTAT_UPPER_LOWER);
     VERBOSE("\t Done.")
 
-    ExaGeoStatLap2Desc(apZMiss, aZMissNumber, CHAM_desc_Zmiss, EXAGEOSTAT_UPPER_LOWER);
-
     if (apZActual != nullptr) {
         START_TIMING(time_mspe);
         VERBOSE("Calculate Mean Square Error (MSE) ... (Prediction Stage) \n")
         RuntimeFunctions<T>::ExaGeoStatMLEMSPETileAsync(CHAM_desc_Zactual, CHAM_desc_Zmiss, CHAM_desc_mspe, sequence,
-                                                        request);
+                                                        request, aConfiguration.GetIsDeterministic());
         ExaGeoStatSequenceWait(sequence);
         VERBOSE("\t Done.")
         STOP_TIMING(time_mspe);
@@ -779,9 +1093,11 @@ T *LinearAlgebraMethods<T>::ExaGeoStatMLENonGaussianPredictTile(std::unique_ptr<
                     (flops / 1e9 / (time_solve)),
                     *mspe);
         }
-        VERBOSE("\t- Z Actual .. Z Miss")
-        for (i = 0; i < aZMissNumber; i++) {
-            VERBOSE("\t (" << apZActual[i] << ", " << apZMiss[i] << ")")
+        if (apZActual != nullptr) {
+            VERBOSE("\t- Z Actual .. Z Miss")
+            for (i = 0; i < aZMissNumber; i++) {
+                VERBOSE("\t (" << apZActual[i] << ", " << apZMiss[i] << ")")
+            }
         }
 
         Results::GetInstance()->SetMSPEExecutionTime(time_solve + time_gemm + time_trsm);
@@ -793,8 +1109,6 @@ T *LinearAlgebraMethods<T>::ExaGeoStatMLENonGaussianPredictTile(std::unique_ptr<
     all_mspe[0] = *mspe;
     all_mspe[1] = *mspe_1;
     all_mspe[2] = *mspe_2;
-    delete[] ng_sigma_sq;
-    delete[] ng_nu;
 
     return all_mspe;
 }
@@ -823,11 +1137,7 @@ void LinearAlgebraMethods<T>::ExaGeoStatMLETileMLOEMMOM(Configurations &aConfigu
         VERBOSE(apEstimatedTheta[num] << " ",true)
     }
     VERBOSE("")
-    int p;
-    double all_time, cholesky1, cholesky2, matrix_gen, vecs_gen, copy_vecs, trsm1, trsm2, trsm3, trsm4, gevv1, gevv2, gevv3, gevv4, gevv5;
-
-    auto loe = new T[n_z_miss];
-    auto mom = new T[n_z_miss];
+    double all_time, cholesky1, cholesky2, matrix_gen, vecs_gen, copy_vecs, trsm1, trsm2, trsm3, trsm4, gevv1, gevv2, gevv3, gevv4;
 
     auto *CHAM_desc_k_t = aData->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
                                                                     DESCRIPTOR_k_T).chameleon_desc;
@@ -875,11 +1185,6 @@ void LinearAlgebraMethods<T>::ExaGeoStatMLETileMLOEMMOM(Configurations &aConfigu
     }
     void *request = aData->GetDescriptorData()->GetRequest();
 
-    auto lmiss = new Locations<T>(n_z_miss, aData->GetLocations()->GetDimension());
-    T nu12;
-    T rho;
-    T sigma_square12;
-
     T flops = 0.0;
     START_TIMING(all_time);
 
@@ -887,9 +1192,6 @@ void LinearAlgebraMethods<T>::ExaGeoStatMLETileMLOEMMOM(Configurations &aConfigu
 
     auto truth_alpha = new T[m * m];
     auto estimated_alpha = new T[m * m];
-    auto temp1 = new T[m * m];
-    auto temp2 = new T[m * m];
-    auto temp3 = new T[m * m];
 
     if (m == 1) {
         truth_alpha[0] = apTruthTheta[0];
@@ -915,15 +1217,30 @@ void LinearAlgebraMethods<T>::ExaGeoStatMLETileMLOEMMOM(Configurations &aConfigu
         estimated_alpha[2] = apEstimatedTheta[1];
     }
 
-    this->ExaGeoStatLap2Desc(truth_alpha, m, CHAM_desc_truth_alpha, EXAGEOSTAT_UPPER_LOWER);
-    this->ExaGeoStatLap2Desc(estimated_alpha, m, CHAM_desc_estimated_alpha, EXAGEOSTAT_UPPER_LOWER);
+    // Repeat the alpha blocks once per missing location, to match the layout of the batched expressions.
+    auto truth_alpha_blocks = new T[m * m * n_z_miss];
+    auto estimated_alpha_blocks = new T[m * m * n_z_miss];
+    for (int p = 0; p < n_z_miss; p++) {
+        copy_n(truth_alpha, m * m, truth_alpha_blocks + p * m * m);
+        copy_n(estimated_alpha, m * m, estimated_alpha_blocks + p * m * m);
+    }
+    this->ExaGeoStatLap2Desc(truth_alpha_blocks, m, CHAM_desc_truth_alpha, EXAGEOSTAT_UPPER_LOWER);
+    this->ExaGeoStatLap2Desc(estimated_alpha_blocks, m, CHAM_desc_estimated_alpha, EXAGEOSTAT_UPPER_LOWER);
+
+    // When the observations are the modeling locations, K_a is the matrix the modeling already factorized.
+    bool is_factor_reused = IsFactorReusable(aConfigurations, aData, apEstimatedTheta, num_par, aObsLocations);
+    if (is_factor_reused) {
+        CHAM_desc_K_a = aData->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR, DESCRIPTOR_C).chameleon_desc;
+    }
 
     START_TIMING(matrix_gen);
     VERBOSE("\tCreate K_a and K_t Covariance Matrices (MLOE-MMOM).....")
     int upper_lower = EXAGEOSTAT_LOWER;
-    RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_K_a, upper_lower, &aObsLocations,
-                                          &aObsLocations, &median_locations, apEstimatedTheta, 0, &aKernel);
-    this->ExaGeoStatSequenceWait(sequence);
+    if (!is_factor_reused) {
+        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_K_a, upper_lower,
+                                              &aObsLocations, &aObsLocations, &median_locations, apEstimatedTheta, 0,
+                                              &aKernel);
+    }
     RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_K_t, upper_lower, &aObsLocations,
                                           &aObsLocations, &median_locations, apTruthTheta, 0, &aKernel);
     this->ExaGeoStatSequenceWait(sequence);
@@ -932,11 +1249,15 @@ void LinearAlgebraMethods<T>::ExaGeoStatMLETileMLOEMMOM(Configurations &aConfigu
 
     //Cholesky factorization for the Co-variance matrix CHAM_desc_K_a
     START_TIMING(cholesky1);
-    VERBOSE("\tCholesky factorization of CHAM_desc_K_a (MLOE-MMOM) .....")
-    ExaGeoStatPotrfTile(EXAGEOSTAT_LOWER, CHAM_desc_K_a, aConfigurations.GetBand(), nullptr, nullptr, 0, 0);
+    if (is_factor_reused) {
+        VERBOSE("\tReuse the retained Cholesky factor as CHAM_desc_K_a (MLOE-MMOM) .....")
+    } else {
+        VERBOSE("\tCholesky factorization of CHAM_desc_K_a (MLOE-MMOM) .....")
+        ExaGeoStatPotrfTile(EXAGEOSTAT_LOWER, CHAM_desc_K_a, aConfigurations.GetBand(), nullptr, nullptr, 0, 0);
+        flops = flops + flops_dpotrf(CHAM_desc_K_a->m);
+    }
     VERBOSE("\tDone.")
     STOP_TIMING(cholesky1);
-    flops = flops + flops_dpotrf(CHAM_desc_K_a->m);
 
     START_TIMING(cholesky2);
     //Cholesky factorization for the Co-variance matrix CHAM_desc_K_t
@@ -946,164 +1267,114 @@ void LinearAlgebraMethods<T>::ExaGeoStatMLETileMLOEMMOM(Configurations &aConfigu
     STOP_TIMING(cholesky2);
     flops = flops + flops_dpotrf(CHAM_desc_K_t->m);
 
-    T total_loop_time = 0.0;
-    T loop_time;
-    bool verbose;
-    VERBOSE("\t* Verbose messages are printed every 10 iteration *")
-    for (p = 0; p < n_z_miss; p++) {
-        verbose = p % 10 == 0;
-        lmiss->GetLocationX()[0] = aMissLocations.GetLocationX()[p];
-        lmiss->GetLocationY()[0] = aMissLocations.GetLocationY()[p];
-
-        if (verbose) {
-            VERBOSE("\tGenerate two vectors k_a and k_t (MLOE-MMOM).....")
-        }
-        START_TIMING(vecs_gen);
-        upper_lower = EXAGEOSTAT_UPPER_LOWER;
-        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_k_t, upper_lower, &aObsLocations,
-                                              lmiss, &median_locations, apTruthTheta, 0, &aKernel);
-        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_k_a, upper_lower, &aObsLocations,
-                                              lmiss, &median_locations, apEstimatedTheta, 0, &aKernel);
-        this->ExaGeoStatSequenceWait(sequence);
-
-        STOP_TIMING(vecs_gen);
-        //Copy CHAM_desc_k_a to CHAM_descK_atmp  (MLOE-MMOM)
-        if (verbose) {
-            VERBOSE("\tCopy CHAM_desc_k_a to CHAM_descK_atmp  (MLOE-MMOM).....")
-        }
-        START_TIMING(copy_vecs);
-        ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_k_t, CHAM_desc_k_t_tmp);
-        ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_k_a, CHAM_desc_k_a_tmp);
-        STOP_TIMING(copy_vecs);
-        if (verbose) {
-            VERBOSE("\tDone.")
-        }
-
-        START_TIMING(loop_time);
-        START_TIMING(trsm1);
-        // Triangular Solve (TRSM) k_a = TRSM(L_a^-1, k_a)
-        if (verbose) {
-            VERBOSE("\tSolving the linear system k_a = TRSM(l_a^-1, k_a) ...(MLOE-MMOM)")
-        }
-        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
-                           CHAM_desc_K_a, nullptr, nullptr, CHAM_desc_k_a, 0);
-        if (verbose) {
-            VERBOSE("\tDone.")
-        }
-        flops = flops + flops_dtrsm(ChamLeft, CHAM_desc_K_a->m, CHAM_desc_k_a->n);
-        STOP_TIMING(trsm1);
-
-        START_TIMING(trsm2);
-        // Triangular Solve (TRSM) k_t = TRSM(L_t^-1, k_t)
-        if (verbose) {
-            VERBOSE("\tSolving the linear system k_t = TRSM(L_t^-1, k_t) ...(MLOE-MMOM)")
-        }
-        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
-                           CHAM_desc_K_t, nullptr, nullptr, CHAM_desc_k_t, 0);
-        flops = flops + flops_dtrsm(ChamLeft, CHAM_desc_K_t->m, CHAM_desc_k_t->n);
-        if (verbose) {
-            VERBOSE("\tDone.")
-        }
-        STOP_TIMING(trsm2);
-
-        START_TIMING(trsm3);
-        // Triangular Solve (TRSM) k_a = TRSM(L_a^-T, k_a)
-        if (verbose) {
-            VERBOSE("\tSolving the linear system k_a = TRSM(L_a^-T, k_a) ...(MLOE-MMOM)")
-        }
-        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_K_a,
-                           nullptr, nullptr, CHAM_desc_k_a, 0);
-        flops = flops + flops_dtrsm(ChamLeft, CHAM_desc_K_a->m, CHAM_desc_k_a->n);
-        if (verbose) {
-            VERBOSE("\tDone.")
-        }
-        STOP_TIMING(trsm3);
-
-        START_TIMING(trsm4);
-        // Triangular Solve (TRSM) k_t = TRSM(L_t^-T, k_t)
-        if (verbose) {
-            VERBOSE("\tSolving the linear system k_t = TRSM(L_a^-T, k_t) ...(MLOE-MMOM)")
-        }
-        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_K_t,
-                           nullptr, nullptr, CHAM_desc_k_t, 0);
-        flops = flops + flops_dtrsm(ChamLeft, CHAM_desc_K_t->m, CHAM_desc_k_t->n);
-        if (verbose) {
-            VERBOSE("\tDone.")
-        }
-        STOP_TIMING(trsm4);
+    // The cross covariances of all the missing locations are generated at once, one block of columns per location.
+    VERBOSE("\tGenerate the k_a and k_t cross covariance matrices (MLOE-MMOM).....")
+    START_TIMING(vecs_gen);
+    upper_lower = EXAGEOSTAT_UPPER_LOWER;
+    RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_k_t, upper_lower, &aObsLocations,
+                                          &aMissLocations, &median_locations, apTruthTheta, 0, &aKernel);
+    RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_k_a, upper_lower, &aObsLocations,
+                                          &aMissLocations, &median_locations, apEstimatedTheta, 0, &aKernel);
+    this->ExaGeoStatSequenceWait(sequence);
+    STOP_TIMING(vecs_gen);
+    VERBOSE("\tDone.")
 
-        START_TIMING(gevv2);
-        // Calculate dgemm value= CHAM_desc_k_t^T * CHAM_desc_k_a
-        if (verbose) {
-            VERBOSE("\tCalculate dgemm CHAM_desc_expr1 = CHAM_desc_k_t^T * CHAM_desc_k_a... (MLOE-MMOM)")
-        }
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_k_t_tmp, CHAM_desc_k_a, 0, CHAM_desc_expr1);
-        flops = flops + flops_dgemm(CHAM_desc_k_t_tmp->m, CHAM_desc_k_a->n, CHAM_desc_expr1->n);
-        if (verbose) {
-            VERBOSE("\tDone.")
-        }
-        STOP_TIMING(gevv2);
-        START_TIMING(gevv3);
-        // Calculate dgemm value= CHAM_desc_k_a^T * CHAM_desc_k_a_tmp
-        if (verbose) {
-            VERBOSE("\tCalculate dgemm CHAM_desc_expr1 = CHAM_desc_k_a^T * CHAM_desc_k_a... (MLOE-MMOM)")
-        }
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_k_a_tmp, CHAM_desc_k_a, 0, CHAM_desc_expr4);
-        flops = flops + flops_dgemm(CHAM_desc_k_a_tmp->m, CHAM_desc_k_a->n, CHAM_desc_expr4->n);
-        if (verbose) {
-            VERBOSE("\tDone.")
-        }
-        STOP_TIMING(gevv3);
+    VERBOSE("\tCopy CHAM_desc_k_a to CHAM_descK_atmp  (MLOE-MMOM).....")
+    START_TIMING(copy_vecs);
+    ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_k_t, CHAM_desc_k_t_tmp);
+    ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_k_a, CHAM_desc_k_a_tmp);
+    STOP_TIMING(copy_vecs);
+    VERBOSE("\tDone.")
 
-        START_TIMING(gevv1);
-        // Calculate dgemm value= CHAM_desc_k_a^T * CHAM_desc_k_t
-        if (verbose) {
-            VERBOSE("\tCalculate dgemm CHAM_desc_expr4 = CHAM_desc_k_a^T * CHAM_desc_k_t... (Prediction Stage)")
-        }
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_k_t_tmp, CHAM_desc_k_t, 0, CHAM_desc_expr3);
-        flops = flops + flops_dgemm(CHAM_desc_k_t_tmp->m, CHAM_desc_k_t->n, CHAM_desc_expr3->n);
-        if (verbose) {
-            VERBOSE("\tDone.")
-        }
-        STOP_TIMING(gevv1);
+    T total_loop_time;
+    START_TIMING(total_loop_time);
+    START_TIMING(trsm1);
+    // Triangular Solve (TRSM) k_a = TRSM(L_a^-1, k_a)
+    VERBOSE("\tSolving the linear system k_a = TRSM(l_a^-1, k_a) ...(MLOE-MMOM)")
+    ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                       CHAM_desc_K_a, nullptr, nullptr, CHAM_desc_k_a, 0);
+    VERBOSE("\tDone.")
+    flops = flops + flops_dtrsm(ChamLeft, CHAM_desc_K_a->m, CHAM_desc_k_a->n);
+    STOP_TIMING(trsm1);
+
+    START_TIMING(trsm2);
+    // Triangular Solve (TRSM) k_t = TRSM(L_t^-1, k_t)
+    VERBOSE("\tSolving the linear system k_t = TRSM(L_t^-1, k_t) ...(MLOE-MMOM)")
+    ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                       CHAM_desc_K_t, nullptr, nullptr, CHAM_desc_k_t, 0);
+    flops = flops + flops_dtrsm(ChamLeft, CHAM_desc_K_t->m, CHAM_desc_k_t->n);
+    VERBOSE("\tDone.")
+    STOP_TIMING(trsm2);
+
+    START_TIMING(trsm3);
+    // Triangular Solve (TRSM) k_a = TRSM(L_a^-T, k_a)
+    VERBOSE("\tSolving the linear system k_a = TRSM(L_a^-T, k_a) ...(MLOE-MMOM)")
+    ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_K_a,
+                       nullptr, nullptr, CHAM_desc_k_a, 0);
+    flops = flops + flops_dtrsm(ChamLeft, CHAM_desc_K_a->m, CHAM_desc_k_a->n);
+    VERBOSE("\tDone.")
+    STOP_TIMING(trsm3);
+
+    START_TIMING(trsm4);
+    // Triangular Solve (TRSM) k_t = TRSM(L_t^-T, k_t)
+    VERBOSE("\tSolving the linear system k_t = TRSM(L_a^-T, k_t) ...(MLOE-MMOM)")
+    ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_K_t,
+                       nullptr, nullptr, CHAM_desc_k_t, 0);
+    flops = flops + flops_dtrsm(ChamLeft, CHAM_desc_K_t->m, CHAM_desc_k_t->n);
+    VERBOSE("\tDone.")
+    STOP_TIMING(trsm4);
+
+    // Only the diagonal blocks of the products are needed, one per missing location.
+    START_TIMING(gevv1);
+    VERBOSE("\tCalculate the blocks CHAM_desc_expr1 = CHAM_desc_k_t^T * CHAM_desc_k_a... (MLOE-MMOM)")
+    RuntimeFunctions<T>::ExaGeoStatBlockCrossProductTileAsync(CHAM_desc_k_t_tmp, CHAM_desc_k_a, CHAM_desc_expr1, m,
+                                                              sequence, request);
+    VERBOSE("\tCalculate the blocks CHAM_desc_expr4 = CHAM_desc_k_a^T * CHAM_desc_k_a... (MLOE-MMOM)")
+    RuntimeFunctions<T>::ExaGeoStatBlockCrossProductTileAsync(CHAM_desc_k_a_tmp, CHAM_desc_k_a, CHAM_desc_expr4, m,
+                                                              sequence, request);
+    VERBOSE("\tCalculate the blocks CHAM_desc_expr3 = CHAM_desc_k_t^T * CHAM_desc_k_t... (MLOE-MMOM)")
+    RuntimeFunctions<T>::ExaGeoStatBlockCrossProductTileAsync(CHAM_desc_k_t_tmp, CHAM_desc_k_t, CHAM_desc_expr3, m,
+                                                              sequence, request);
+    this->ExaGeoStatSequenceWait(sequence);
+    flops = flops + 3 * flops_dgemm(CHAM_desc_expr1->m, CHAM_desc_expr1->n, CHAM_desc_k_a->m);
+    STOP_TIMING(gevv1);
+
+    // Calculate CHAM_desc_k_a = CHAM_desc_L_t^T * CHAM_desc_k_a
+    START_TIMING(gevv2);
+    ExaGeoStatTrmmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_K_t,
+                       CHAM_desc_k_a);
+    flops = flops + flops_dtrmm(ChamLeft, CHAM_desc_K_t->m, CHAM_desc_k_a->n);
+    STOP_TIMING(gevv2);
+
+    START_TIMING(gevv3);
+    VERBOSE("\tCalculate the blocks CHAM_desc_expr2 = CHAM_desc_k_a^T * CHAM_desc_k_a... (MLOE-MMOM)")
+    RuntimeFunctions<T>::ExaGeoStatBlockCrossProductTileAsync(CHAM_desc_k_a, CHAM_desc_k_a, CHAM_desc_expr2, m,
+                                                              sequence, request);
+    this->ExaGeoStatSequenceWait(sequence);
+    flops = flops + flops_dgemm(CHAM_desc_expr2->m, CHAM_desc_expr2->n, CHAM_desc_k_a->m);
+    VERBOSE("\tDone.")
+    STOP_TIMING(gevv3);
 
-        // Calculate dgemm CHAM_desc_k_a= CHAM_desc_K_t * CHAM_desc_k_a (use k_t as k_a)
-        START_TIMING(gevv4);
-        ExaGeoStatTrmmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_K_t,
-                           CHAM_desc_k_a);
-        STOP_TIMING(gevv4);
+    START_TIMING(gevv4);
+    ExaGeoStatGeaddTile(EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_truth_alpha, -2, CHAM_desc_expr1);
+    ExaGeoStatGeaddTile(EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_expr1, 1, CHAM_desc_expr2);
+    ExaGeoStatGeaddTile(EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_truth_alpha, -1, CHAM_desc_expr3);
+    ExaGeoStatGeaddTile(EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_estimated_alpha, -1, CHAM_desc_expr4);
 
-        // Calculate dgemm value= CHAM_desc_k_a^T * CHAM_desc_k_t
-        if (verbose) {
-            VERBOSE("\tCalculate dgemm CHAM_desc_expr1 = CHAM_desc_k_a^T * CHAM_desc_k_a... (Prediction Stage)")
-        }
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_k_a, CHAM_desc_k_a, 0, CHAM_desc_expr2);
-        flops = flops + flops_dgemm(CHAM_desc_k_a_tmp->m, CHAM_desc_k_t->n, CHAM_desc_expr2->n);
-        if (verbose) {
-            VERBOSE("\tDone.")
-        }
-        START_TIMING(gevv5);
-        STOP_TIMING(gevv5);
-
-        STOP_TIMING(loop_time);
-        total_loop_time += loop_time;
-
-        ExaGeoStatGeaddTile(EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_truth_alpha, -2, CHAM_desc_expr1);
-        ExaGeoStatGeaddTile(EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_expr1, 1, CHAM_desc_expr2);
-        ExaGeoStatGeaddTile(EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_truth_alpha, -1, CHAM_desc_expr3);
-        ExaGeoStatGeaddTile(EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_estimated_alpha, -1, CHAM_desc_expr4);
-
-        VERBOSE("\t- Matrix Generation Time: " << matrix_gen << " Vectors Generation Time: " << vecs_gen
-                                               << " First Cholesky factorization Time: " << cholesky1
-                                               << " First Cholesky factorization Time: " << cholesky2)
-        VERBOSE("\t- First Trsm time: " << trsm1 << " Second Trsm time: " << trsm2 << " Third Trsm time: " << trsm3
-                                        << " Fourth Trsm time: " << trsm4)
-        VERBOSE("\t- First gemm time: " << gevv1 << " Second gemm time: " << gevv2 << " Third gemm time: " << gevv3
-                                        << " Fourth gemm time: " << gevv4 << " Fifth gemm time: " << gevv5)
-        RuntimeFunctions<T>::ExaGeoStatMLETileAsyncMLOEMMOM(CHAM_desc_expr2, CHAM_desc_expr3, CHAM_desc_expr4,
-                                                            CHAM_desc_mloe, CHAM_desc_mmom, sequence, request);
-        this->ExaGeoStatSequenceWait(sequence);
-    }
+    RuntimeFunctions<T>::ExaGeoStatMLETileAsyncMLOEMMOM(CHAM_desc_expr2, CHAM_desc_expr3, CHAM_desc_expr4,
+                                                        CHAM_desc_mloe, CHAM_desc_mmom, m, sequence, request,
+                                                        aConfigurations.GetIsDeterministic());
+    this->ExaGeoStatSequenceWait(sequence);
+    STOP_TIMING(gevv4);
+    STOP_TIMING(total_loop_time);
+
+    VERBOSE("\t- Matrix Generation Time: " << matrix_gen << " Vectors Generation Time: " << vecs_gen
+                                           << " First Cholesky factorization Time: " << cholesky1
+                                           << " Second Cholesky factorization Time: " << cholesky2)
+    VERBOSE("\t- First Trsm time: " << trsm1 << " Second Trsm time: " << trsm2 << " Third Trsm time: " << trsm3
+                                    << " Fourth Trsm time: " << trsm4)
+    VERBOSE("\t- Cross products time: " << gevv1 + gevv3 << " Trmm time: " << gevv2 << " Reduction time: "
+                                        << gevv4)
     VERBOSE("\t---- MLOE-MMOM Gflop/s: " << flops / 1e9 / (total_loop_time + cholesky1 + cholesky2))
 
     *mloe /= n_z_miss;
@@ -1120,14 +1391,10 @@ void LinearAlgebraMethods<T>::ExaGeoStatMLETileMLOEMMOM(Configurations &aConfigu
     Results::GetInstance()->SetLoopTimeMLOEMMOM(total_loop_time);
     Results::GetInstance()->SetFlopsMLOEMMOM((flops / 1e9 / (total_loop_time + cholesky1 + cholesky2)));
 
-    delete[] loe;
-    delete[] mom;
-    delete[] temp1;
-    delete[] temp2;
-    delete[] temp3;
+    delete[] estimated_alpha_blocks;
+    delete[] truth_alpha_blocks;
     delete[] estimated_alpha;
     delete[] truth_alpha;
-    delete lmiss;
 }
 
 template<typename T>
@@ -1141,19 +1408,6 @@ T *LinearAlgebraMethods<T>::ExaGeoStatFisherTile(Configurations &aConfigurations
                                                                   DescriptorName::DESCRIPTOR_A).chameleon_desc;
     auto *CHAM_desc_C = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
                                                                   DescriptorName::DESCRIPTOR_C).chameleon_desc;
-    auto *CHAM_desc_CJ = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
-                                                                   DescriptorName::DESCRIPTOR_CJ).chameleon_desc;
-    auto *CHAM_desc_results = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
-                                                                        DescriptorName::DESCRIPTOR_RESULTS).chameleon_desc;
-    auto *CHAM_desc_CK = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
-                                                                   DescriptorName::DESCRIPTOR_CK).chameleon_desc;
-    auto *CHAM_desc_C_diag = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
-                                                                       DescriptorName::DESCRIPTOR_C_DIAG).chameleon_desc;
-    auto *CHAM_desc_C_trace = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
-                                                                        DescriptorName::DESCRIPTOR_C_TRACE).chameleon_desc;
-
-    auto trace = aData->GetDescriptorData()->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_C_TRACE);
-    *trace = 0.0;
 
     RUNTIME_request_t request_array[2] = {RUNTIME_REQUEST_INITIALIZER, RUNTIME_REQUEST_INITIALIZER};
     RUNTIME_sequence_t *sequence;
@@ -1172,98 +1426,117 @@ T *LinearAlgebraMethods<T>::ExaGeoStatFisherTile(Configurations &aConfigurations
     double time;
 
     START_TIMING(time);
-    VERBOSE("Generate covariance matrix  CHAM_desc_C  (Fisher Matrix Generation).....")
-    RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C, EXAGEOSTAT_LOWER,
-                                          aData->GetLocations(), aData->GetLocations(), &median_locations, apTheta,
-                                          aConfigurations.GetDistanceMetric(), &aKernel);
-    ExaGeoStatSequenceWait(sequence);
-    VERBOSE("\tDone.")
+    if (IsFactorReusable(aConfigurations, aData, apTheta, num_params, *aData->GetLocations())) {
+        VERBOSE("Reuse the retained Cholesky factor of CHAM_desc_C  (Fisher Matrix Generation).....")
+    } else {
+        VERBOSE("Generate covariance matrix  CHAM_desc_C  (Fisher Matrix Generation).....")
+        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C, EXAGEOSTAT_LOWER,
+                                              aData->GetLocations(), aData->GetLocations(), &median_locations,
+                                              apTheta, aConfigurations.GetDistanceMetric(), &aKernel);
+        ExaGeoStatSequenceWait(sequence);
+        VERBOSE("\tDone.")
 
-    VERBOSE("\tCalculate Cholesky decomposition  (Fisher Matrix Generation).....")
-    ExaGeoStatPotrfTile(EXAGEOSTAT_LOWER, CHAM_desc_C, 0, nullptr, nullptr, 0, 0);
-    VERBOSE("\tDone.")
+        VERBOSE("\tCalculate Cholesky decomposition  (Fisher Matrix Generation).....")
+        ExaGeoStatPotrfTile(EXAGEOSTAT_LOWER, CHAM_desc_C, 0, nullptr, nullptr, 0, 0);
+        VERBOSE("\tDone.")
+        // Prediction can carry on with this factor when it was computed with the modeling distance.
+        if (aConfigurations.GetDistanceMetric() == EUCLIDEAN_DISTANCE) {
+            aData->SetFactorTheta(vector<T>(apTheta, apTheta + num_params));
+        } else {
+            aData->SetFactorTheta({});
+        }
+    }
 
     //Allocate memory for A, and initialize it with 0s.
     auto A = new T[num_params * num_params]();
+    int probes_number = aConfigurations.GetTraceProbesNumber();
 
-    for (int j = 0; j < num_params; j++) {
+    if (probes_number > 0) {
+        VERBOSE("Apply the covariance derivatives to the trace probes  (Fisher Matrix Generation).....")
+        ExaGeoStatDerivativeProbesTile(aConfigurations, aData, apTheta, num_params, nullptr);
+        VERBOSE("\tDone.")
 
-        if (j == 0) {
-            kernel_name = "UnivariateMaternDdsigmaSquare";
-        } else if (j == 1) {
-            kernel_name = "UnivariateMaternDbeta";
-        } else if (j == 2) {
-            kernel_name = "UnivariateMaternDnu";
-        } else if (j == 3) {
-            kernel_name = "UnivariateMaternNuggetsStationary";
+        // One more solve gives L^-1 * dC_j * L^-T * V, the probe-wise dot products of two solved derivatives
+        // estimate trace(C^-1 * dC_j * C^-1 * dC_k) without any N-by-N derivative.
+        vector<void *> derivatives(num_params);
+        VERBOSE("\tCompute triangular solves of the probe derivatives  (Fisher Matrix Generation).....")
+        for (int j = 0; j < num_params; j++) {
+            derivatives[j] = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                       PROBES_DERIVATIVES[j]).chameleon_desc;
+            ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                               CHAM_desc_C, nullptr, nullptr, derivatives[j], 0);
         }
+        VERBOSE("\tDone.")
 
-        auto pKernel_cj = plugins::PluginRegistry<kernels::Kernel<T>>::Create(kernel_name,
-                                                                              aConfigurations.GetTimeSlot());
-
-        VERBOSE("Generate covariance matrix  CHAM_desc_CJ  (Fisher Matrix Generation).....")
-        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_CJ, EXAGEOSTAT_UPPER_LOWER,
-                                              aData->GetLocations(), aData->GetLocations(), &median_locations, apTheta,
-                                              aConfigurations.GetDistanceMetric(), pKernel_cj);
+        auto *CHAM_desc_probes_cross = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                                 DescriptorName::DESCRIPTOR_PROBES_CROSS).chameleon_desc;
+        int block_size = probes_number + 1;
+        auto cross = new T[block_size * block_size];
+        double relative_error, max_relative_error = 0;
+        VERBOSE("Estimate the traces of the derivatives products (Fisher Matrix Generation).....")
+        for (int j = 0; j < num_params; j++) {
+            for (int k = j; k < num_params; k++) {
+                ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, derivatives[j], derivatives[k], 0,
+                                   CHAM_desc_probes_cross);
+                ExaGeoStatDesc2Lap(cross, block_size, CHAM_desc_probes_cross, EXAGEOSTAT_UPPER_LOWER);
+                A[k + num_params * j] = 0.5 * ProbesMean(cross, probes_number, relative_error);
+                max_relative_error = max(max_relative_error, relative_error);
+            }
+        }
+        delete[] cross;
+        VERBOSE("\tDone.")
+        VERBOSE("\tFisher trace relative standard error: " << max_relative_error)
+        Results::GetInstance()->SetTraceEstimatorStandardError(max_relative_error);
+    } else {
+        auto *CHAM_desc_C_trace = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                            DescriptorName::DESCRIPTOR_C_TRACE).chameleon_desc;
+        auto trace = aData->GetDescriptorData()->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_C_TRACE);
+        *trace = 0.0;
+
+        // Generate every covariance derivative once, the tasks of all the parameters are submitted together.
+        vector<void *> derivatives(num_params);
+        vector<kernels::Kernel<T> *> derivative_kernels(num_params);
+        VERBOSE("Generate the covariance derivatives  (Fisher Matrix Generation).....")
+        for (int j = 0; j < num_params; j++) {
+            derivatives[j] = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                       FISHER_DERIVATIVES[j]).chameleon_desc;
+            derivative_kernels[j] = plugins::PluginRegistry<kernels::Kernel<T>>::Create(
+                    FISHER_DERIVATIVE_KERNELS[j], aConfigurations.GetTimeSlot());
+            RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), derivatives[j],
+                                                  EXAGEOSTAT_UPPER_LOWER, aData->GetLocations(),
+                                                  aData->GetLocations(), &median_locations, apTheta,
+                                                  aConfigurations.GetDistanceMetric(), derivative_kernels[j]);
+        }
         ExaGeoStatSequenceWait(sequence);
+        for (auto &derivative_kernel: derivative_kernels) {
+            delete derivative_kernel;
+        }
         VERBOSE("\tDone.")
 
-        VERBOSE("\tCompute triangular solve  CHAM_desc_CJ  (Fisher Matrix Generation).....")
-        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
-                           CHAM_desc_C,
-                           nullptr, nullptr, CHAM_desc_CJ, 0);
-        ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1,
-                           CHAM_desc_C,
-                           nullptr, nullptr, CHAM_desc_CJ, 0);
+        // Solving from both sides gives the symmetric L^-1 * dC_j * L^-T, so that
+        // trace(C^-1 * dC_j * C^-1 * dC_k) is the sum of the element-wise product of the two solved derivatives.
+        VERBOSE("\tCompute triangular solves of the covariance derivatives  (Fisher Matrix Generation).....")
+        for (int j = 0; j < num_params; j++) {
+            ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                               CHAM_desc_C, nullptr, nullptr, derivatives[j], 0);
+            ExaGeoStatTrsmTile(EXAGEOSTAT_RIGHT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                               CHAM_desc_C, nullptr, nullptr, derivatives[j], 0);
+        }
         VERBOSE("\tDone.")
 
-        delete pKernel_cj;
-        for (int k = j; k < num_params; k++) {
-
-            if (k == 0) {
-                kernel_name = "UnivariateMaternDdsigmaSquare";
-            } else if (k == 1) {
-                kernel_name = "UnivariateMaternDbeta";
-            } else if (k == 2) {
-                kernel_name = "UnivariateMaternDnu";
-            } else if (k == 3) {
-                kernel_name = "UnivariateMaternNuggetsStationary";
+        VERBOSE("Compute the traces of the derivatives products (Fisher Matrix Generation).....")
+        for (int j = 0; j < num_params; j++) {
+            for (int k = j; k < num_params; k++) {
+                RuntimeFunctions<T>::ExaGeoStatFrobeniusProductTileAsync(derivatives[j], derivatives[k],
+                                                                         CHAM_desc_C_trace, sequence,
+                                                                         &request_array[0],
+                                                                         aConfigurations.GetIsDeterministic());
+                ExaGeoStatSequenceWait(sequence);
+                A[k + num_params * j] = 0.5 * *trace;
+                *trace = 0;
             }
-
-            auto pKernel_ck = plugins::PluginRegistry<kernels::Kernel<T>>::Create(kernel_name,
-                                                                                  aConfigurations.GetTimeSlot());
-
-            VERBOSE("Generate covariance matrix  CHAM_desc_CK  (Fisher Matrix Generation).....")
-            RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_CK, EXAGEOSTAT_UPPER_LOWER,
-                                                  aData->GetLocations(), aData->GetLocations(), &median_locations,
-                                                  apTheta, aConfigurations.GetDistanceMetric(), pKernel_ck);
-            ExaGeoStatSequenceWait(sequence);
-            VERBOSE("\tDone.")
-
-            VERBOSE("\tCompute tringular solve  CHAM_desc_CK  (Fisher Matrix Generation).....")
-            ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
-                               CHAM_desc_C,
-                               nullptr, nullptr, CHAM_desc_CK, 0);
-            ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1,
-                               CHAM_desc_C,
-                               nullptr, nullptr, CHAM_desc_CK, 0);
-            VERBOSE("\tDone.")
-
-            VERBOSE("\tCompute matrix-matrix multiplication  CHAM_desc_CK  (Fisher Matrix Generation).....")
-            CHAMELEON_dgemm_Tile(ChamNoTrans, ChamNoTrans, 1, CHAM_desc_CJ, CHAM_desc_CK, 0, CHAM_desc_results);
-            VERBOSE("\tDone.")
-
-            VERBOSE("Compute the trace/diagonal of CHAM_desc_CK (Fisher Matrix Generation).....")
-            RuntimeFunctions<T>::ExaGeoStatMLETraceTileAsync(CHAM_desc_results, sequence, &request_array[0],
-                                                             CHAM_desc_C_trace,
-                                                             CHAM_desc_C_diag);
-            ExaGeoStatSequenceWait(sequence);
-            VERBOSE("\tDone.")
-
-            A[k + num_params * j] = 0.5 * *trace;
-            *trace = 0;
-            delete pKernel_ck;
         }
+        VERBOSE("\tDone.")
     }
 
     STOP_TIMING(time);
@@ -1273,30 +1546,56 @@ T *LinearAlgebraMethods<T>::ExaGeoStatFisherTile(Configurations &aConfigurations
     VERBOSE("\tDone.")
 
     VERBOSE("\tCalculate Cholesky decomposition  (Fisher Matrix Generation).....")
-    LAPACKE_dpotrf(LAPACK_COL_MAJOR, 'L', num_params, (double *) A, num_params);
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        LAPACKE_spotrf(LAPACK_COL_MAJOR, 'L', num_params, (float *) A, num_params);
+    } else {
+        LAPACKE_dpotrf(LAPACK_COL_MAJOR, 'L', num_params, (double *) A, num_params);
+    }
     VERBOSE("\tDone.")
     VERBOSE("\tGenerate Identity Matrix (I) (Fisher Matrix Generation).....")
 
     //Allocate memory for A, and initialize it with 0s.
     auto I_matrix = new T[num_params * num_params + 1]();
-    LAPACKE_dlaset(LAPACK_COL_MAJOR, 'L', num_params, num_params, 0, 1, (double *) I_matrix, num_params);
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        LAPACKE_slaset(LAPACK_COL_MAJOR, 'L', num_params, num_params, 0, 1, (float *) I_matrix, num_params);
+    } else {
+        LAPACKE_dlaset(LAPACK_COL_MAJOR, 'L', num_params, num_params, 0, 1, (double *) I_matrix, num_params);
+    }
     VERBOSE("\tDone.")
 
-    cblas_dtrsm(
-            CblasColMajor,
-            CblasLeft,
-            CblasLower,
-            CblasNoTrans,
-            CblasNonUnit,
-            num_params, num_params, 1.0, (double *) A, num_params, (double *) I_matrix, num_params);
-
-    cblas_dtrsm(
-            CblasColMajor,
-            CblasLeft,
-            CblasLower,
-            CblasTrans,
-            CblasNonUnit,
-            num_params, num_params, 1.0, (double *) A, num_params, (double *) I_matrix, num_params);
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        cblas_strsm(
+                CblasColMajor,
+                CblasLeft,
+                CblasLower,
+                CblasNoTrans,
+                CblasNonUnit,
+                num_params, num_params, 1.0, (float *) A, num_params, (float *) I_matrix, num_params);
+
+        cblas_strsm(
+                CblasColMajor,
+                CblasLeft,
+                CblasLower,
+                CblasTrans,
+                CblasNonUnit,
+                num_params, num_params, 1.0, (float *) A, num_params, (float *) I_matrix, num_params);
+    } else {
+        cblas_dtrsm(
+                CblasColMajor,
+                CblasLeft,
+                CblasLower,
+                CblasNoTrans,
+                CblasNonUnit,
+                num_params, num_params, 1.0, (double *) A, num_params, (double *) I_matrix, num_params);
+
+        cblas_dtrsm(
+                CblasColMajor,
+                CblasLeft,
+                CblasLower,
+                CblasTrans,
+                CblasNonUnit,
+                num_params, num_params, 1.0, (double *) A, num_params, (double *) I_matrix, num_params);
+    }
 
     I_matrix[num_params * num_params] = time;
 
@@ -1339,6 +1638,236 @@ LinearAlgebraMethods<T>::ExaGeoStatGetZObs(Configurations &aConfigurations, T *a
     this->ExaGeoStatDesc2Lap(apZ, aSize, z_desc, UpperLower::EXAGEOSTAT_UPPER_LOWER);
 }
 
+template<typename T>
+void LinearAlgebraMethods<T>::ExaGeoStatMLEGradientTile(Configurations &aConfigurations,
+                                                        std::unique_ptr<ExaGeoStatData<T>> &aData,
+                                                        const double *apTheta, double *apGradient,
+                                                        const kernels::Kernel<T> &aKernel) {
+
+    if (aConfigurations.GetComputation() != EXACT_DENSE ||
+        aConfigurations.GetKernelName() != "UnivariateMaternStationary" || aConfigurations.GetIsNonGaussian()) {
+        throw domain_error(
+                "The likelihood gradient is only supported for the exact dense UnivariateMaternStationary kernel.");
+    }
+
+    auto kernel_name = aConfigurations.GetKernelName();
+    int num_params = aKernel.GetParametersNumbers();
+    int probes_number = aConfigurations.GetTraceProbesNumber();
+    std::vector<T> local_theta(apTheta, apTheta + num_params);
+    double gradient_time;
+
+    auto *CHAM_desc_Z = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                  DescriptorName::DESCRIPTOR_Z).chameleon_desc;
+
+    if (probes_number > 0) {
+        this->InitiateTraceEstimatorDescriptors(aConfigurations, *aData->GetDescriptorData(), num_params);
+        auto *CHAM_desc_probes = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                           DescriptorName::DESCRIPTOR_PROBES).chameleon_desc;
+        auto *CHAM_desc_probes_cross = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                                 DescriptorName::DESCRIPTOR_PROBES_CROSS).chameleon_desc;
+        START_TIMING(gradient_time);
+        // Z holds L^-1 * Z after the likelihood evaluation, it is solved along with the probes into C^-1 * Z.
+        VERBOSE("\tApply the covariance derivatives to the trace probes (Gradient).....")
+        ExaGeoStatDerivativeProbesTile(aConfigurations, aData, local_theta.data(), num_params, CHAM_desc_Z);
+        VERBOSE("\tDone.")
+
+        VERBOSE("\tCompute the score of each parameter (Gradient).....")
+        int block_size = probes_number + 1;
+        auto cross = new T[block_size * block_size];
+        double relative_error, max_relative_error = 0;
+        for (int j = 0; j < num_params; j++) {
+            auto *CHAM_desc_derivative = aData->GetDescriptorData()->GetDescriptor(
+                    DescriptorType::CHAMELEON_DESCRIPTOR, PROBES_DERIVATIVES[j]).chameleon_desc;
+            ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_probes, CHAM_desc_derivative, 0,
+                               CHAM_desc_probes_cross);
+            ExaGeoStatDesc2Lap(cross, block_size, CHAM_desc_probes_cross, EXAGEOSTAT_UPPER_LOWER);
+            // The last diagonal element is the quadratic term Z^T * C^-1 * dC_j * C^-1 * Z.
+            double trace = ProbesMean(cross, probes_number, relative_error);
+            apGradient[j] = -0.5 * trace + 0.5 * cross[block_size * block_size - 1];
+            max_relative_error = max(max_relative_error, relative_error);
+        }
+        delete[] cross;
+        STOP_TIMING(gradient_time);
+        VERBOSE("\tDone.")
+        VERBOSE("\tTrace relative standard error: " << max_relative_error)
+        VERBOSE("\tGradient time: " << gradient_time)
+        Results::GetInstance()->SetTraceEstimatorStandardError(max_relative_error);
+        return;
+    }
+
+    this->InitiateGradientDescriptors(aConfigurations, *aData->GetDescriptorData());
+
+    auto *CHAM_desc_C = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                  DescriptorName::DESCRIPTOR_C).chameleon_desc;
+    auto *CHAM_desc_C_inverse = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                          DescriptorName::DESCRIPTOR_C_INVERSE).chameleon_desc;
+    auto *CHAM_desc_derivative = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                           FISHER_DERIVATIVES[0]).chameleon_desc;
+    auto *CHAM_desc_Z_solved = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                         DescriptorName::DESCRIPTOR_Z_SOLVED).chameleon_desc;
+    auto *CHAM_desc_Z_derivative = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                             DescriptorName::DESCRIPTOR_Z_DERIVATIVE).chameleon_desc;
+    auto *CHAM_desc_C_trace = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                        DescriptorName::DESCRIPTOR_C_TRACE).chameleon_desc;
+    auto *CHAM_desc_product = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                        DescriptorName::DESCRIPTOR_PRODUCT).chameleon_desc;
+
+    auto trace = aData->GetDescriptorData()->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_C_TRACE);
+    auto product = aData->GetDescriptorData()->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_PRODUCT);
+
+    RUNTIME_request_t request_array[2] = {RUNTIME_REQUEST_INITIALIZER, RUNTIME_REQUEST_INITIALIZER};
+    auto sequence = (RUNTIME_sequence_t *) aData->GetDescriptorData()->GetSequence();
+
+    auto median_locations = Locations<T>(1, aData->GetLocations()->GetDimension());
+    aData->CalculateMedianLocations(kernel_name, median_locations);
+
+    START_TIMING(gradient_time);
+    // Z holds L^-1 * Z after the likelihood evaluation, one more solve gives C^-1 * Z.
+    VERBOSE("\tSolve the measurements against the covariance matrix (Gradient).....")
+    ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_Z, CHAM_desc_Z_solved);
+    ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_C,
+                       nullptr, nullptr, CHAM_desc_Z_solved, 0);
+    VERBOSE("\tDone.")
+
+    // The inverse is formed once, so each trace(C^-1 * dC_j) is a single pass over the lower tiles.
+    VERBOSE("\tInvert the covariance matrix from its Cholesky factor (Gradient).....")
+    ExaGeoStatLapackCopyTile(EXAGEOSTAT_LOWER, CHAM_desc_C, CHAM_desc_C_inverse);
+    ExaGeoStatPotriTile(EXAGEOSTAT_LOWER, CHAM_desc_C_inverse);
+    VERBOSE("\tDone.")
+
+    VERBOSE("\tCompute the score of each parameter (Gradient).....")
+    for (int j = 0; j < num_params; j++) {
+        auto derivative_kernel = plugins::PluginRegistry<kernels::Kernel<T>>::Create(FISHER_DERIVATIVE_KERNELS[j],
+                                                                                     aConfigurations.GetTimeSlot());
+        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_derivative,
+                                              EXAGEOSTAT_UPPER_LOWER, aData->GetLocations(), aData->GetLocations(),
+                                              &median_locations, local_theta.data(),
+                                              aConfigurations.GetDistanceMetric(), derivative_kernel);
+        *trace = 0;
+        RuntimeFunctions<T>::ExaGeoStatFrobeniusProductTileAsync(CHAM_desc_C_inverse, CHAM_desc_derivative,
+                                                                 CHAM_desc_C_trace, sequence, &request_array[0],
+                                                                 aConfigurations.GetIsDeterministic());
+        ExaGeoStatGemmTile(EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_derivative, CHAM_desc_Z_solved, 0,
+                           CHAM_desc_Z_derivative);
+        ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_Z_solved, CHAM_desc_Z_derivative, 0,
+                           CHAM_desc_product);
+        ExaGeoStatSequenceWait(sequence);
+        delete derivative_kernel;
+        apGradient[j] = -0.5 * *trace + 0.5 * *product;
+    }
+    VERBOSE("\tDone.")
+    STOP_TIMING(gradient_time);
+    VERBOSE("\tGradient time: " << gradient_time)
+}
+
+template<typename T>
+void LinearAlgebraMethods<T>::ExaGeoStatDerivativeProbesTile(Configurations &aConfigurations,
+                                                             std::unique_ptr<ExaGeoStatData<T>> &aData, T *apTheta,
+                                                             const int &aParametersNumber, void *apLastColumn) {
+
+    auto *CHAM_desc_C = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                  DescriptorName::DESCRIPTOR_C).chameleon_desc;
+    auto *CHAM_desc_probes = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                       DescriptorName::DESCRIPTOR_PROBES).chameleon_desc;
+    auto sequence = (RUNTIME_sequence_t *) aData->GetDescriptorData()->GetSequence();
+
+    int full_problem_size = aConfigurations.GetProblemSize();
+    int probes_number = aConfigurations.GetTraceProbesNumber();
+    size_t probes_size = (size_t) full_problem_size * probes_number;
+
+    // The probes are drawn from the same seed at every call, so successive estimates share their noise.
+    auto probes = new T[probes_size + full_problem_size]();
+    int seed = aConfigurations.GetSeed();
+    int initial_seed[4] = {seed, seed, seed, 1};
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        LAPACKE_slarnv(1, initial_seed, (int) probes_size, (float *) probes);
+    } else {
+        LAPACKE_dlarnv(1, initial_seed, (int) probes_size, (double *) probes);
+    }
+    for (size_t i = 0; i < probes_size; i++) {
+        probes[i] = probes[i] < 0.5 ? -1 : 1;
+    }
+    if (apLastColumn) {
+        ExaGeoStatDesc2Lap(probes + probes_size, full_problem_size, apLastColumn, EXAGEOSTAT_UPPER_LOWER);
+    }
+    ExaGeoStatLap2Desc(probes, full_problem_size, CHAM_desc_probes, EXAGEOSTAT_UPPER_LOWER);
+    delete[] probes;
+
+    ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_TRANS, EXAGEOSTAT_NON_UNIT, 1, CHAM_desc_C,
+                       nullptr, nullptr, CHAM_desc_probes, 0);
+
+    auto median_locations = Locations<T>(1, aData->GetLocations()->GetDimension());
+    aData->CalculateMedianLocations(aConfigurations.GetKernelName(), median_locations);
+    vector<kernels::Kernel<T> *> derivative_kernels(aParametersNumber);
+    for (int j = 0; j < aParametersNumber; j++) {
+        auto *CHAM_desc_derivative = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                               PROBES_DERIVATIVES[j]).chameleon_desc;
+        derivative_kernels[j] = plugins::PluginRegistry<kernels::Kernel<T>>::Create(FISHER_DERIVATIVE_KERNELS[j],
+                                                                                    aConfigurations.GetTimeSlot());
+        RuntimeFunctions<T>::CovarianceMatrixProduct(*aData->GetDescriptorData(), CHAM_desc_probes,
+                                                     CHAM_desc_derivative, aData->GetLocations(),
+                                                     aData->GetLocations(), &median_locations, apTheta,
+                                                     aConfigurations.GetDistanceMetric(), derivative_kernels[j]);
+    }
+    ExaGeoStatSequenceWait(sequence);
+    for (auto &derivative_kernel: derivative_kernels) {
+        delete derivative_kernel;
+    }
+}
+
+template<typename T>
+void LinearAlgebraMethods<T>::ExaGeoStatExplainedVarianceTile(std::unique_ptr<ExaGeoStatData<T>> &aData,
+                                                              void *apFactor, void *apCrossCovariance,
+                                                              T *apExplainedVariance) {
+
+    auto *CHAM_desc_variance = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                         DescriptorName::DESCRIPTOR_KRIGING_VARIANCE).chameleon_desc;
+    auto sequence = (RUNTIME_sequence_t *) aData->GetDescriptorData()->GetSequence();
+    void *request = aData->GetDescriptorData()->GetRequest();
+
+    // c^T * C^-1 * c is the squared norm of L^-1 * c, all the columns are solved at once.
+    ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1, apFactor,
+                       nullptr, nullptr, apCrossCovariance, 0);
+    RuntimeFunctions<T>::ExaGeoStatBlockCrossProductTileAsync(apCrossCovariance, apCrossCovariance,
+                                                              CHAM_desc_variance, 1, sequence, request);
+    ExaGeoStatSequenceWait(sequence);
+    if (apExplainedVariance) {
+        ExaGeoStatDesc2Lap(apExplainedVariance, 1, CHAM_desc_variance, EXAGEOSTAT_UPPER_LOWER);
+    }
+}
+
+template<typename T>
+bool LinearAlgebraMethods<T>::IsFactorReusable(Configurations &aConfigurations,
+                                               std::unique_ptr<ExaGeoStatData<T>> &aData, const T *apTheta,
+                                               const int &aParametersNumber, Locations<T> &aLocations) {
+
+    // The cross covariances of the prediction are built with the euclidean distance, the factor has to match.
+    auto &factor_theta = aData->GetFactorTheta();
+    if (!aConfigurations.GetIsRetainFactor() || aConfigurations.GetDistanceMetric() != EUCLIDEAN_DISTANCE ||
+        (int) factor_theta.size() != aParametersNumber ||
+        !equal(factor_theta.begin(), factor_theta.end(), apTheta)) {
+        return false;
+    }
+    auto *pModelingLocations = aData->GetLocations();
+    if (&aLocations == pModelingLocations) {
+        return true;
+    }
+    int size = aLocations.GetSize();
+    if (size != pModelingLocations->GetSize()) {
+        return false;
+    }
+    // The factor of a principal submatrix is only the leading block of L, so the order has to match as well.
+    bool is_same = equal(aLocations.GetLocationX(), aLocations.GetLocationX() + size,
+                         pModelingLocations->GetLocationX()) &&
+                   equal(aLocations.GetLocationY(), aLocations.GetLocationY() + size,
+                         pModelingLocations->GetLocationY());
+    if (is_same && aLocations.GetDimension() != Dimension2D) {
+        is_same = equal(aLocations.GetLocationZ(), aLocations.GetLocationZ() + size,
+                        pModelingLocations->GetLocationZ());
+    }
+    return is_same;
+}
+
 #ifdef USE_HICMA
 
 template<typename T>
@@ -1392,9 +1921,14 @@ LinearAlgebraMethods<T>::ExaGeoStatLap2Desc(T *apA, const int &aLDA, void *apDes
 template<typename T>
 void LinearAlgebraMethods<T>::ExaGeoStatLaSetTile(const common::UpperLower &aUpperLower, T alpha, T beta,
                                                   void *apDescriptor) {
-    int status = CHAMELEON_dlaset_Tile((cham_uplo_t) aUpperLower, alpha, beta, (CHAM_desc_t *) apDescriptor);
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_slaset_Tile((cham_uplo_t) aUpperLower, alpha, beta, (CHAM_desc_t *) apDescriptor);
+    } else {
+        status = CHAMELEON_dlaset_Tile((cham_uplo_t) aUpperLower, alpha, beta, (CHAM_desc_t *) apDescriptor);
+    }
     if (status != CHAMELEON_SUCCESS) {
-        throw std::runtime_error("CHAMELEON_dlaset_Tile Failed!");
+        throw std::runtime_error("CHAMELEON_laset_Tile Failed!");
     }
 }
 
@@ -1402,62 +1936,73 @@ template<typename T>
 void LinearAlgebraMethods<T>::ExaGeoStatTrmmTile(const Side &aSide, const UpperLower &aUpperLower, const Trans &aTrans,
                                                  const Diag &aDiag, const T &alpha, void *apDescA, void *apDescB) {
 
-    int status = CHAMELEON_dtrmm_Tile((cham_side_t) aSide, (cham_uplo_t) aUpperLower, (cham_trans_t) aTrans,
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_strmm_Tile((cham_side_t) aSide, (cham_uplo_t) aUpperLower, (cham_trans_t) aTrans,
+                                      (cham_diag_t) aDiag, alpha, (CHAM_desc_t *) apDescA, (CHAM_desc_t *) apDescB);
+    } else {
+        status = CHAMELEON_dtrmm_Tile((cham_side_t) aSide, (cham_uplo_t) aUpperLower, (cham_trans_t) aTrans,
                                       (cham_diag_t) aDiag, alpha, (CHAM_desc_t *) apDescA, (CHAM_desc_t *) apDescB);
+    }
+    if (status != CHAMELEON_SUCCESS) {
+        throw std::runtime_error("CHAMELEON_trmm_Tile Failed!");
+    }
+}
+
+template<typename T>
+void LinearAlgebraMethods<T>::ExaGeoStatGemmTile(const Trans &aTransA, const Trans &aTransB, const T &aAlpha,
+                                                 void *apDescA, void *apDescB, const T &aBeta, void *apDescC) {
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_sgemm_Tile((cham_trans_t) aTransA, (cham_trans_t) aTransB, aAlpha, (CHAM_desc_t *) apDescA,
+                                      (CHAM_desc_t *) apDescB, aBeta, (CHAM_desc_t *) apDescC);
+    } else {
+        status = CHAMELEON_dgemm_Tile((cham_trans_t) aTransA, (cham_trans_t) aTransB, aAlpha, (CHAM_desc_t *) apDescA,
+                                      (CHAM_desc_t *) apDescB, aBeta, (CHAM_desc_t *) apDescC);
+    }
     if (status != CHAMELEON_SUCCESS) {
-        throw std::runtime_error("CHAMELEON_dtrmm_Tile Failed!");
+        throw std::runtime_error("CHAMELEON_gemm_Tile Failed!");
     }
 }
 
 template<typename T>
 void LinearAlgebraMethods<T>::ExaGeoStatGeaddTile(const common::Trans &aTrans, const T &aAlpha, void *apDescA,
                                                   const T &aBeta, void *apDescB) {
-    int status = CHAMELEON_dgeadd_Tile((cham_trans_t) aTrans, aAlpha, (CHAM_desc_t *) apDescA, aBeta,
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_sgeadd_Tile((cham_trans_t) aTrans, aAlpha, (CHAM_desc_t *) apDescA, aBeta,
                                        (CHAM_desc_t *) apDescB);
+    } else {
+        status = CHAMELEON_dgeadd_Tile((cham_trans_t) aTrans, aAlpha, (CHAM_desc_t *) apDescA, aBeta,
+                                       (CHAM_desc_t *) apDescB);
+    }
     if (status != CHAMELEON_SUCCESS) {
-        throw std::runtime_error("CHAMELEON_dgeadd_Tile Failed!");
+        throw std::runtime_error("CHAMELEON_geadd_Tile Failed!");
     }
 }
 
 template<typename T>
 void LinearAlgebraMethods<T>::ExaGeoStatPosvTile(const common::UpperLower &aUpperLower, void *apA, void *apB) {
-    int status = CHAMELEON_dposv_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA, (CHAM_desc_t *) apB);
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_sposv_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA, (CHAM_desc_t *) apB);
+    } else {
+        status = CHAMELEON_dposv_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA, (CHAM_desc_t *) apB);
+    }
     if (status != CHAMELEON_SUCCESS) {
-        throw std::runtime_error("CHAMELEON_dposv_Tile Failed!");
+        throw std::runtime_error("CHAMELEON_posv_Tile Failed!");
     }
 }
 
 template<typename T>
-bool LinearAlgebraMethods<T>::Recover(char *apPath, const int &aIterationCount, T *apTheta, T *apLogLik,
-                                      const int &aNumParams) {
-
-    char *pLine = nullptr, *pTokens;
-    size_t length = 0;
-    int count, i;
-
-    FILE *pFile_handler;
-    pFile_handler = fopen(apPath, "r");
-
-    if (pFile_handler == nullptr) {
-        throw std::runtime_error("Cannot open observations file");
-    }
-    while (getline(&pLine, &length, pFile_handler) != -1) {
-        pTokens = strtok(pLine, " ");
-        count = (int) strtol(pTokens, nullptr, 10);
-        if (count == aIterationCount) {
-            pTokens = strtok(nullptr, " ");
-            for (i = 0; i < aNumParams; i++) {
-                apTheta[i] = strtol(pTokens, nullptr, 10);
-                pTokens = strtok(nullptr, " ");
-            }
-            *apLogLik = strtol(pTokens, nullptr, 10);
-            fclose(pFile_handler);
-            free(pLine);
-            return true;
-        }
+void LinearAlgebraMethods<T>::ExaGeoStatPotriTile(const common::UpperLower &aUpperLower, void *apA) {
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_spotri_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA);
+    } else {
+        status = CHAMELEON_dpotri_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA);
+    }
+    if (status != CHAMELEON_SUCCESS) {
+        throw std::runtime_error("CHAMELEON_potri_Tile Failed!");
     }
-
-    fclose(pFile_handler);
-    free(pLine);
-    return false;
 }
@@ -19,6 +19,8 @@
 
 #endif
 
+#include <algorithm>
+
 #include <cblas.h>
 
 #include <linear-algebra-solvers/concrete/chameleon/ChameleonImplementation.hpp>
@@ -52,15 +54,18 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
 
     auto pSequence = (RUNTIME_sequence_t *) aData->GetDescriptorData()->GetSequence();
     //Initialization
-    T loglik = 0.0, logdet, variance, variance1 = 1, variance2 = 1, variance3, dot_product = 0, dot_product1 = 0, dot_product2 = 0, dot_product3, n, dzcpy_time, time_facto, time_solve, logdet_calculate, matrix_gen_time;
+    T loglik = 0.0, logdet, variance, variance1 = 1, variance2 = 1, variance3, dot_product = 0, dot_product1 = 0, dot_product2 = 0, dot_product3, n, dzcpy_time, evaluation_time;
     double accumulated_executed_time, accumulated_flops;
 
     int nhrs, i;
     T flops = 0.0;
     T *univariate_theta, *univariate2_theta, *univariate3_theta, nu12, rho, sigma_square12;
+    bool is_mixed_precision = false, is_distance_cached = false;
 
     auto kernel_name = aConfigurations.GetKernelName();
     int num_params = aKernel.GetParametersNumbers();
+    // The optimizer works in double precision, the kernels in the precision of the descriptors.
+    std::vector<T> local_theta(theta, theta + num_params);
     auto median_locations = Locations<T>(1, aData->GetLocations()->GetDimension());
     aData->CalculateMedianLocations(kernel_name, median_locations);
 
@@ -94,6 +99,10 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
                                                                          DescriptorName::DESCRIPTOR_PRODUCT_2).chameleon_desc;
     auto *CHAM_desc_product3 = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
                                                                          DescriptorName::DESCRIPTOR_PRODUCT_3).chameleon_desc;
+    auto *CHAM_desc_C_single = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                         DescriptorName::DESCRIPTOR_C_SINGLE).chameleon_desc;
+    auto *CHAM_desc_C_panel = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                        DescriptorName::DESCRIPTOR_C_PANEL).chameleon_desc;
 
     T *determinant = aData->GetDescriptorData()->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_DETERMINANT);
     *determinant = 0;
@@ -107,26 +116,24 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
     n = CHAM_desc_C->m;
     nhrs = CHAM_desc_Z->n;
 
-    string recovery_file = aConfigurations.GetRecoveryFile();
     int iter_count = aData->GetMleIterations();
 
-    if (recovery_file.empty() ||
-        !(this->Recover((char *) (recovery_file.c_str()), iter_count, (T *) theta, &loglik, num_params))) {
-        START_TIMING(dzcpy_time);
-        if (iter_count == 0) {
-            // Save a copy of descZ into descZcpy for restoring each iteration (Only for the first iteration)
-            this->ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_Z, CHAM_desc_Zcpy);
-        } else {
-            VERBOSE("\tRe-store the original Z vector...")
-            this->ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_Zcpy, CHAM_desc_Z);
-            VERBOSE("\tDone.")
-        }
-        STOP_TIMING(dzcpy_time);
+    START_TIMING(dzcpy_time);
+    if (iter_count == 0) {
+        // Save a copy of descZ into descZcpy for restoring each iteration (Only for the first iteration)
+        this->ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_Z, CHAM_desc_Zcpy);
+    } else {
+        VERBOSE("\tRe-store the original Z vector...")
+        this->ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_Zcpy, CHAM_desc_Z);
+        VERBOSE("\tDone.")
     }
+    STOP_TIMING(dzcpy_time);
 
+    // The whole evaluation is submitted as a single task graph, so the factorization of a panel starts as soon as its
+    // tiles are generated, and the runtime is only waited for once the scalar values are needed.
+    START_TIMING(evaluation_time);
     //Generate new co-variance matrix C based on new theta
-    VERBOSE("\tGenerate New Covariance Matrix...")
-    START_TIMING(matrix_gen_time);
+    VERBOSE("\tSubmit the generation of the new Covariance Matrix...")
 
     if (kernel_name == "bivariate_matern_parsimonious2" ||
         kernel_name == "bivariate_matern_parsimonious2_profile") {
@@ -156,7 +163,6 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
         RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_sub_C12, upper_lower,
                                               &median_locations, aData->GetLocations(), &median_locations,
                                               univariate2_theta, 0, &aKernel);
-        STOP_TIMING(matrix_gen_time);
 
         univariate3_theta[0] = theta[1];
         univariate3_theta[1] = theta[2];
@@ -167,69 +173,102 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
                                               univariate2_theta, 0, &aKernel);
     } else {
         int upper_lower = EXAGEOSTAT_LOWER;
-        RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C, upper_lower,
-                                              aData->GetLocations(), aData->GetLocations(), &median_locations,
-                                              (T *) theta, 0, &aKernel);
+        is_mixed_precision = CHAM_desc_C_single != nullptr;
+        // Stationary isotropic kernels reuse the pairwise distances, computed once when the cache is created.
+        auto *CHAM_desc_distance = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                             DescriptorName::DESCRIPTOR_DISTANCE).chameleon_desc;
+        bool is_distance_cache_new = CHAM_desc_distance == nullptr;
+        if (aKernel.IsIsotropic() &&
+            this->InitiateDistanceCacheDescriptor(aConfigurations, *aData->GetDescriptorData(),
+                                                  aKernel.GetVariablesNumber())) {
+            CHAM_desc_distance = aData->GetDescriptorData()->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                                           DescriptorName::DESCRIPTOR_DISTANCE).chameleon_desc;
+            is_distance_cached = true;
+            if (is_distance_cache_new) {
+                VERBOSE("\tCache the distance matrix...")
+                RuntimeFunctions<T>::DistanceMatrix(*aData->GetDescriptorData(), CHAM_desc_distance, upper_lower,
+                                                    aData->GetLocations(), aData->GetLocations(), 0);
+            }
+        }
+        if (is_mixed_precision) {
+            // The tiles away from the diagonal are generated straight into their single precision descriptor.
+            RuntimeFunctions<T>::MixedPrecisionCovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C,
+                                                                CHAM_desc_C_single,
+                                                                is_distance_cached ? CHAM_desc_distance : nullptr,
+                                                                max(aConfigurations.GetBand(), 1),
+                                                                aData->GetLocations(), aData->GetLocations(),
+                                                                &median_locations, local_theta.data(), 0, &aKernel);
+        } else if (is_distance_cached) {
+            RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C, CHAM_desc_distance,
+                                                  upper_lower, aData->GetLocations(), aData->GetLocations(),
+                                                  local_theta.data(), 0, &aKernel);
+        } else {
+            RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_C, upper_lower,
+                                                  aData->GetLocations(), aData->GetLocations(), &median_locations,
+                                                  local_theta.data(), 0, &aKernel);
+        }
     }
-    this->ExaGeoStatSequenceWait(pSequence);
-    STOP_TIMING(matrix_gen_time);
-    VERBOSE("\tDone.")
 
-    VERBOSE("\tCholesky factorization of Sigma...")
-    START_TIMING(time_facto);
-    this->ExaGeoStatPotrfTile(EXAGEOSTAT_LOWER, CHAM_desc_C, aConfigurations.GetBand(), nullptr, nullptr, 0, 0);
-    STOP_TIMING(time_facto);
+    VERBOSE("\tSubmit the Cholesky factorization of Sigma...")
+    if (is_mixed_precision) {
+        this->ExaGeoStatMixedPrecisionPotrfTileAsync(EXAGEOSTAT_LOWER, CHAM_desc_C, CHAM_desc_C_single,
+                                                     CHAM_desc_C_panel, max(aConfigurations.GetBand(), 1), pSequence,
+                                                     &request_array[0]);
+    } else {
+        this->ExaGeoStatPotrfTileAsync(EXAGEOSTAT_LOWER, CHAM_desc_C, aConfigurations.GetBand(), pSequence,
+                                       &request_array[0]);
+    }
     flops += flops_dpotrf(n);
-    VERBOSE("\tDone.")
 
-    //Calculate log(|C|) --> log(square(|L|))
-    VERBOSE("\tCalculating the log determinant ...")
-    START_TIMING(logdet_calculate);
+    //Calculate log(|C|) --> log(square(|L|)), each diagonal tile is reduced as soon as its potrf task completes.
+    VERBOSE("\tSubmit the log determinant calculation...")
     RuntimeFunctions<T>::ExaGeoStatMeasureDetTileAsync(aConfigurations.GetComputation(), CHAM_desc_C, pSequence,
-                                                       &request_array, CHAM_desc_det);
-    this->ExaGeoStatSequenceWait(pSequence);
-
-    logdet = 2 * (*determinant);
-    STOP_TIMING(logdet_calculate);
-    VERBOSE("\tDone.")
+                                                       &request_array, CHAM_desc_det,
+                                                       aConfigurations.GetIsDeterministic());
 
     if (aConfigurations.GetIsNonGaussian()) {
         VERBOSE("Transform Z vector to Gaussian field ...")
         RuntimeFunctions<T>::ExaGeoStatNonGaussianTransformTileAsync(aConfigurations.GetComputation(), CHAM_desc_Z,
-                                                                     (T *) theta, pSequence, &request_array[0]);
-        this->ExaGeoStatSequenceWait(pSequence);
+                                                                     local_theta.data(), pSequence, &request_array[0]);
         VERBOSE("\tDone.")
 
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Z, CHAM_desc_Z, 0, CHAM_desc_product);
+        this->ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_Z, CHAM_desc_Z,
+                                 0, CHAM_desc_product);
 
         VERBOSE("Calculate non-Gaussian loglik ...")
         RuntimeFunctions<T>::ExaGeoStatNonGaussianLogLikeTileAsync(aConfigurations.GetComputation(), CHAM_desc_Z,
-                                                                   CHAM_desc_sum, (T *) theta, pSequence,
-                                                                   &request_array[0]);
-        this->ExaGeoStatSequenceWait(pSequence);
+                                                                   CHAM_desc_sum, local_theta.data(), pSequence,
+                                                                   &request_array[0],
+                                                                   aConfigurations.GetIsDeterministic());
         VERBOSE("\tDone.")
     }
 
     // Solving Linear System (L*X=Z)--->inv(L)*Z
-    VERBOSE("\tSolving the linear system ...")
-    START_TIMING(time_solve);
-    this->ExaGeoStatTrsmTile(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
-                             CHAM_desc_C, nullptr, nullptr, CHAM_desc_Z, 0);
-    STOP_TIMING(time_solve);
+    VERBOSE("\tSubmit the solve of the linear system...")
+    if (is_mixed_precision) {
+        this->ExaGeoStatMixedPrecisionTrsmTileAsync(CHAM_desc_C, CHAM_desc_C_single, CHAM_desc_C_panel, CHAM_desc_Z,
+                                                    max(aConfigurations.GetBand(), 1), pSequence, &request_array[0]);
+    } else {
+        this->ExaGeoStatTrsmTileAsync(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT, 1,
+                                      CHAM_desc_C, CHAM_desc_Z, pSequence, &request_array[0]);
+    }
     flops += flops_dtrsm(ChamLeft, n, nhrs);
-    VERBOSE("\tDone.")
 
     //Calculate MLE likelihood
     VERBOSE("Calculating the MLE likelihood function ...")
     RuntimeFunctions<T>::ExaGeoStatDoubleDotProduct(CHAM_desc_Z, CHAM_desc_product,
-                                                    pSequence, request_array);
+                                                    pSequence, request_array, aConfigurations.GetIsDeterministic());
     ExaGeoStatSequenceWait(pSequence);
+    STOP_TIMING(evaluation_time);
+    logdet = 2 * (*determinant);
 
     if (kernel_name == "BivariateMaternParsimonious2Profile") {
         loglik =
                 -(n / 2) + (n / 2) * log(n) - (n / 2) * log(dot_product) - 0.5 * logdet - (T) (n / 2.0) * log(2.0 * PI);
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Z1, CHAM_desc_Z1, 0, CHAM_desc_product1);
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Z2, CHAM_desc_Z2, 0, CHAM_desc_product2);
+        this->ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_Z1, CHAM_desc_Z1,
+                                 0, CHAM_desc_product1);
+        this->ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_Z2, CHAM_desc_Z2,
+                                 0, CHAM_desc_product2);
         variance1 = (1.0 / (n / 2)) * dot_product1;
         variance2 = (1.0 / (n / 2)) * dot_product2;
 
@@ -238,8 +277,10 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
                  (double) (n / 2.0) * log(2.0 * PI);
         RuntimeFunctions<T>::ExaGeoStaStrideVectorTileAsync(CHAM_desc_Z, CHAM_desc_Z1, CHAM_desc_Z2, pSequence,
                                                             &request_array[0]);
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Z1, CHAM_desc_Z1, 0, CHAM_desc_product1);
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Z2, CHAM_desc_Z2, 0, CHAM_desc_product2);
+        this->ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_Z1, CHAM_desc_Z1,
+                                 0, CHAM_desc_product1);
+        this->ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_Z2, CHAM_desc_Z2,
+                                 0, CHAM_desc_product2);
         variance1 = (1.0 / (n / 2)) * dot_product1;
         variance2 = (1.0 / (n / 2)) * dot_product2;
     } else if (kernel_name == "TrivariateMaternParsimoniousProfile") {
@@ -249,9 +290,12 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
         //to be optimized
         RuntimeFunctions<T>::ExaGeoStaStrideVectorTileAsync(CHAM_desc_Z, CHAM_desc_Z1, CHAM_desc_Z2, CHAM_desc_Z3,
                                                             pSequence, &request_array[0]);
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Z1, CHAM_desc_Z1, 0, CHAM_desc_product1);
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Z2, CHAM_desc_Z2, 0, CHAM_desc_product2);
-        CHAMELEON_dgemm_Tile(ChamTrans, ChamNoTrans, 1, CHAM_desc_Z3, CHAM_desc_Z3, 0, CHAM_desc_product3);
+        this->ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_Z1, CHAM_desc_Z1,
+                                 0, CHAM_desc_product1);
+        this->ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_Z2, CHAM_desc_Z2,
+                                 0, CHAM_desc_product2);
+        this->ExaGeoStatGemmTile(EXAGEOSTAT_TRANS, EXAGEOSTAT_NO_TRANS, 1, CHAM_desc_Z3, CHAM_desc_Z3,
+                                 0, CHAM_desc_product3);
         variance1 = (1.0 / (n / 3.0)) * dot_product1;
         variance2 = (1.0 / (n / 3.0)) * dot_product2;
     } else {
@@ -262,12 +306,54 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
         } else {
             loglik = loglik - (double) (n / 2.0) * log(2.0 * PI);
         }
+        // Measure the accuracy of the mixed-precision factorization once, against a double precision evaluation.
+        if (is_mixed_precision && iter_count == 0 && !aConfigurations.GetIsNonGaussian()) {
+            VERBOSE("\tEvaluating the double precision reference likelihood...")
+            // The reference needs the whole matrix in double precision, it is only held during this evaluation.
+            CHAM_desc_t *CHAM_desc_reference = nullptr;
+            CHAMELEON_Desc_Create_OOC(&CHAM_desc_reference, ChamRealDouble, CHAM_desc_C->mb, CHAM_desc_C->nb,
+                                      CHAM_desc_C->bsiz, CHAM_desc_C->lm, CHAM_desc_C->ln, 0, 0, CHAM_desc_C->m,
+                                      CHAM_desc_C->n, CHAM_desc_C->p, CHAM_desc_C->q);
+            this->ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, CHAM_desc_Zcpy, CHAM_desc_Z);
+            if (is_distance_cached) {
+                RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_reference,
+                                                      aData->GetDescriptorData()->GetDescriptor(
+                                                              DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                              DescriptorName::DESCRIPTOR_DISTANCE).chameleon_desc,
+                                                      EXAGEOSTAT_LOWER, aData->GetLocations(), aData->GetLocations(),
+                                                      local_theta.data(), 0, &aKernel);
+            } else {
+                RuntimeFunctions<T>::CovarianceMatrix(*aData->GetDescriptorData(), CHAM_desc_reference,
+                                                      EXAGEOSTAT_LOWER, aData->GetLocations(), aData->GetLocations(),
+                                                      &median_locations, local_theta.data(), 0, &aKernel);
+            }
+            *determinant = 0;
+            *product = 0;
+            this->ExaGeoStatPotrfTileAsync(EXAGEOSTAT_LOWER, CHAM_desc_reference, aConfigurations.GetBand(),
+                                           pSequence, &request_array[0]);
+            RuntimeFunctions<T>::ExaGeoStatMeasureDetTileAsync(aConfigurations.GetComputation(), CHAM_desc_reference,
+                                                               pSequence, &request_array, CHAM_desc_det,
+                                                               aConfigurations.GetIsDeterministic());
+            this->ExaGeoStatTrsmTileAsync(EXAGEOSTAT_LEFT, EXAGEOSTAT_LOWER, EXAGEOSTAT_NO_TRANS, EXAGEOSTAT_NON_UNIT,
+                                          1, CHAM_desc_reference, CHAM_desc_Z, pSequence, &request_array[0]);
+            RuntimeFunctions<T>::ExaGeoStatDoubleDotProduct(CHAM_desc_Z, CHAM_desc_product, pSequence, request_array,
+                                                            aConfigurations.GetIsDeterministic());
+            this->ExaGeoStatSequenceWait(pSequence);
+            CHAMELEON_Desc_Destroy(&CHAM_desc_reference);
+
+            double reference_loglik =
+                    -0.5 * (*product) - (*determinant) - (double) (n / 2.0) * log(2.0 * PI);
+            double deviation = fabs(loglik - reference_loglik) / fabs(reference_loglik);
+            LOGGER("\tMixed precision log likelihood relative deviation from double precision: " << deviation)
+            Results::GetInstance()->SetMixedPrecisionDeviation(deviation);
+            VERBOSE("\tDone.")
+        }
     }
     VERBOSE("\tDone.")
 
     //Distribute the values in the case of MPI
 #ifdef USE_MPI
-    MPI_Bcast(&loglik, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&loglik, 1, sizeof(T) == SIZE_OF_FLOAT ? MPI_FLOAT : MPI_DOUBLE, 0, MPI_COMM_WORLD);
 #endif
 
     LOGGER("\t" << iter_count + 1 << " - Model Parameters (", true)
@@ -301,22 +387,23 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
     if (aConfigurations.GetLogger()) {
         fprintf(aConfigurations.GetFileLogPath(), ")----> LogLi: %.18f\n", loglik);
     }
-    VERBOSE("---- Facto Time: " << time_facto)
-    VERBOSE("---- Log Determent Time: " << logdet_calculate)
-    VERBOSE("---- dtrsm Time: " << time_solve)
-    VERBOSE("---- Matrix Generation Time: " << matrix_gen_time)
-    VERBOSE("---- Total Time: " << time_facto + logdet_calculate + time_solve)
-    VERBOSE("---- Gflop/s: " << flops / 1e9 / (time_facto + time_solve))
+    VERBOSE("---- Total Time (Generation, Facto, Log Determent and dtrsm): " << evaluation_time)
+    VERBOSE("---- Gflop/s: " << flops / 1e9 / evaluation_time)
 
     aData->SetMleIterations(aData->GetMleIterations() + 1);
+    // C now holds the factor at this theta, only an exact one can stand in for a later factorization.
+    if (aConfigurations.GetComputation() == EXACT_DENSE && !is_mixed_precision) {
+        aData->SetFactorTheta(local_theta);
+    } else {
+        aData->SetFactorTheta({});
+    }
 
     // for experiments and benchmarking
     accumulated_executed_time =
-            Results::GetInstance()->GetTotalModelingExecutionTime() + time_facto + logdet_calculate +
-            time_solve;
+            Results::GetInstance()->GetTotalModelingExecutionTime() + evaluation_time;
     Results::GetInstance()->SetTotalModelingExecutionTime(accumulated_executed_time);
     accumulated_flops =
-            Results::GetInstance()->GetTotalModelingFlops() + (flops / 1e9 / (time_facto + time_solve));
+            Results::GetInstance()->GetTotalModelingFlops() + (flops / 1e9 / evaluation_time);
     Results::GetInstance()->SetTotalModelingFlops(accumulated_flops);
 
     Results::GetInstance()->SetMLEIterations(iter_count + 1);
@@ -328,9 +415,187 @@ T ChameleonImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T
 
 template<typename T>
 void ChameleonImplementation<T>::ExaGeoStatLapackCopyTile(const UpperLower &aUpperLower, void *apA, void *apB) {
-    int status = CHAMELEON_dlacpy_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA, (CHAM_desc_t *) apB);
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_slacpy_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA, (CHAM_desc_t *) apB);
+    } else {
+        status = CHAMELEON_dlacpy_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA, (CHAM_desc_t *) apB);
+    }
+    if (status != CHAMELEON_SUCCESS) {
+        throw std::runtime_error("CHAMELEON_lacpy_Tile Failed!");
+    }
+}
+
+template<typename T>
+void ChameleonImplementation<T>::ExaGeoStatMixedPrecisionPotrfTileAsync(const UpperLower &aUpperLower, void *apA,
+                                                                        void *apASingle, void *apPanel,
+                                                                        const int &aBand, void *apSequence,
+                                                                        void *apRequest) {
+
+    if (aUpperLower != EXAGEOSTAT_LOWER) {
+        throw std::runtime_error("Mixed precision Cholesky factorization supports only the lower triangular part.");
+    }
+    CHAM_context_t *chameleon_context;
+    auto sequence = (RUNTIME_sequence_t *) apSequence;
+    RUNTIME_option_t options;
+
+    chameleon_context = chameleon_context_self();
+    if (chameleon_context == nullptr) {
+        throw std::runtime_error("ExaGeoStatMixedPrecisionPotrfTileAsync() Failed, Hardware not Initialized.");
+    }
+    if (sequence->status != CHAMELEON_SUCCESS) {
+        return;
+    }
+    RUNTIME_options_init(&options, chameleon_context, sequence, (RUNTIME_request_t *) apRequest);
+
+    auto A = (CHAM_desc_t *) apA;
+    auto S = (CHAM_desc_t *) apASingle;
+    auto W = (CHAM_desc_t *) apPanel;
+    // The diagonal tiles are always kept in double precision.
+    int band = aBand > 0 ? aBand : 1;
+    int k, m, n;
+    int tempkm, tempmm, tempnn;
+
+    // The off-band tiles are generated in S, where they are updated and factored in single precision, and stay.
+    // The in-band updates read the off-band tiles of the current panel from their double precision copy in W.
+    for (k = 0; k < A->mt; k++) {
+        RUNTIME_iteration_push(chameleon_context, k);
+
+        tempkm = k == A->mt - 1 ? A->m - k * A->mb : A->mb;
+
+        options.priority = 2 * A->mt - 2 * k;
+        INSERT_TASK_dpotrf(&options, ChamLower, tempkm, A->mb, A, k, k, A->nb * k);
+        if (k + band < A->mt) {
+            INSERT_TASK_dlag2s(&options, tempkm, tempkm, A->mb, A, k, k, S, k, k);
+        }
+
+        for (m = k + 1; m < A->mt; m++) {
+            tempmm = m == A->mt - 1 ? A->m - m * A->mb : A->mb;
+
+            options.priority = 2 * A->mt - 2 * k - m;
+            if (m < k + band) {
+                INSERT_TASK_dtrsm(&options, ChamRight, ChamLower, ChamTrans, ChamNonUnit, tempmm, A->mb, A->mb, 1.0, A,
+                                  k, k, A, m, k);
+                // In-band panel tiles also feed the single precision updates of the off-band tiles of their row.
+                if (m + band < A->mt) {
+                    INSERT_TASK_dlag2s(&options, tempmm, A->mb, A->mb, A, m, k, S, m, k);
+                }
+            } else {
+                INSERT_TASK_strsm(&options, ChamRight, ChamLower, ChamTrans, ChamNonUnit, tempmm, A->mb, A->mb, 1.0f,
+                                  S, k, k, S, m, k);
+                INSERT_TASK_slag2d(&options, tempmm, A->mb, A->mb, S, m, k, W, m, 0);
+            }
+        }
+        RUNTIME_data_flush(sequence, A, k, k);
+        RUNTIME_data_flush(sequence, S, k, k);
+
+        for (n = k + 1; n < A->nt; n++) {
+            tempnn = n == A->nt - 1 ? A->n - n * A->nb : A->nb;
+
+            auto *pPanelN = n < k + band ? A : W;
+            int panel_col_n = n < k + band ? k : 0;
+
+            options.priority = 2 * A->mt - 2 * k - n;
+            INSERT_TASK_dsyrk(&options, ChamLower, ChamNoTrans, tempnn, A->nb, A->mb, -1.0, pPanelN, n, panel_col_n,
+                              1.0, A, n, n);
+
+            for (m = n + 1; m < A->mt; m++) {
+                tempmm = m == A->mt - 1 ? A->m - m * A->mb : A->mb;
+
+                options.priority = 2 * A->mt - 2 * k - n - m;
+                if (m < n + band) {
+                    auto *pPanelM = m < k + band ? A : W;
+                    int panel_col_m = m < k + band ? k : 0;
+                    INSERT_TASK_dgemm(&options, ChamNoTrans, ChamTrans, tempmm, tempnn, A->mb, A->mb, -1.0, pPanelM, m,
+                                      panel_col_m, pPanelN, n, panel_col_n, 1.0, A, m, n);
+                } else {
+                    INSERT_TASK_sgemm(&options, ChamNoTrans, ChamTrans, tempmm, tempnn, A->mb, A->mb, -1.0f, S, m, k,
+                                      S, n, k, 1.0f, S, m, n);
+                }
+            }
+            RUNTIME_data_flush(sequence, pPanelN, n, panel_col_n);
+            RUNTIME_data_flush(sequence, S, n, k);
+        }
+        RUNTIME_iteration_pop(chameleon_context);
+    }
+    RUNTIME_options_finalize(&options, chameleon_context);
+}
+
+template<typename T>
+void ChameleonImplementation<T>::ExaGeoStatMixedPrecisionTrsmTileAsync(void *apA, void *apASingle, void *apPanel,
+                                                                       void *apB, const int &aBand, void *apSequence,
+                                                                       void *apRequest) {
+
+    CHAM_context_t *chameleon_context;
+    auto sequence = (RUNTIME_sequence_t *) apSequence;
+    RUNTIME_option_t options;
+
+    chameleon_context = chameleon_context_self();
+    if (chameleon_context == nullptr) {
+        throw std::runtime_error("ExaGeoStatMixedPrecisionTrsmTileAsync() Failed, Hardware not Initialized.");
+    }
+    if (sequence->status != CHAMELEON_SUCCESS) {
+        return;
+    }
+    RUNTIME_options_init(&options, chameleon_context, sequence, (RUNTIME_request_t *) apRequest);
+
+    auto A = (CHAM_desc_t *) apA;
+    auto S = (CHAM_desc_t *) apASingle;
+    auto W = (CHAM_desc_t *) apPanel;
+    auto B = (CHAM_desc_t *) apB;
+    int band = aBand > 0 ? aBand : 1;
+    int k, m, n;
+    int tempkm, tempmm, tempnn;
+
+    for (k = 0; k < B->mt; k++) {
+        tempkm = k == B->mt - 1 ? B->m - k * B->mb : B->mb;
+        for (n = 0; n < B->nt; n++) {
+            tempnn = n == B->nt - 1 ? B->n - n * B->nb : B->nb;
+            INSERT_TASK_dtrsm(&options, ChamLeft, ChamLower, ChamNoTrans, ChamNonUnit, tempkm, tempnn, A->mb, 1.0, A,
+                              k, k, B, k, n);
+        }
+        RUNTIME_data_flush(sequence, A, k, k);
+
+        for (m = k + 1; m < B->mt; m++) {
+            tempmm = m == B->mt - 1 ? B->m - m * B->mb : B->mb;
+            // An off-band factor tile is promoted into the panel, so the solution is still accumulated in double.
+            auto *pFactor = A;
+            int factor_row = m, factor_col = k;
+            if (m >= k + band) {
+                INSERT_TASK_slag2d(&options, tempmm, A->mb, A->mb, S, m, k, W, m, 0);
+                pFactor = W;
+                factor_col = 0;
+            }
+            for (n = 0; n < B->nt; n++) {
+                tempnn = n == B->nt - 1 ? B->n - n * B->nb : B->nb;
+                INSERT_TASK_dgemm(&options, ChamNoTrans, ChamNoTrans, tempmm, tempnn, B->mb, A->mb, -1.0, pFactor,
+                                  factor_row, factor_col, B, k, n, 1.0, B, m, n);
+            }
+            RUNTIME_data_flush(sequence, pFactor, factor_row, factor_col);
+        }
+        for (n = 0; n < B->nt; n++) {
+            RUNTIME_data_flush(sequence, B, k, n);
+        }
+    }
+    RUNTIME_options_finalize(&options, chameleon_context);
+}
+
+template<typename T>
+void ChameleonImplementation<T>::ExaGeoStatTrsmTileAsync(const Side &aSide, const UpperLower &aUpperLower,
+                                                         const Trans &aTrans, const Diag &aDiag, const T &aAlpha,
+                                                         void *apA, void *apB, void *apSequence, void *apRequest) {
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_strsm_Tile_Async((cham_side_t) aSide, (cham_uplo_t) aUpperLower, (cham_trans_t) aTrans,
+                                            (cham_diag_t) aDiag, aAlpha, (CHAM_desc_t *) apA, (CHAM_desc_t *) apB,
+                                            (RUNTIME_sequence_t *) apSequence, (RUNTIME_request_t *) apRequest);
+    } else {
+        status = CHAMELEON_dtrsm_Tile_Async((cham_side_t) aSide, (cham_uplo_t) aUpperLower, (cham_trans_t) aTrans,
+                                            (cham_diag_t) aDiag, aAlpha, (CHAM_desc_t *) apA, (CHAM_desc_t *) apB,
+                                            (RUNTIME_sequence_t *) apSequence, (RUNTIME_request_t *) apRequest);
+    }
     if (status != CHAMELEON_SUCCESS) {
-        throw std::runtime_error("CHAMELEON_dlacpy_Tile Failed!");
+        throw std::runtime_error("CHAMELEON_trsm_Tile_Async Failed!");
     }
 }
 
@@ -339,17 +604,31 @@ void ChameleonImplementation<T>::ExaGeoStatTrsmTile(const Side &aSide, const Upp
                                                     const Trans &aTrans, const Diag &aDiag,
                                                     const T &aAlpha, void *apA, void *apCD, void *apCrk, void *apZ,
                                                     const int &aMaxRank) {
-    int status = CHAMELEON_dtrsm_Tile((cham_side_t) aSide, (cham_uplo_t) aUpperLower, (cham_trans_t) aTrans,
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_strsm_Tile((cham_side_t) aSide, (cham_uplo_t) aUpperLower, (cham_trans_t) aTrans,
                                       (cham_diag_t) aDiag, aAlpha, (CHAM_desc_t *) apA, (CHAM_desc_t *) apZ);
+    } else {
+        status = CHAMELEON_dtrsm_Tile((cham_side_t) aSide, (cham_uplo_t) aUpperLower, (cham_trans_t) aTrans,
+                                      (cham_diag_t) aDiag, aAlpha, (CHAM_desc_t *) apA, (CHAM_desc_t *) apZ);
+    }
     if (status != CHAMELEON_SUCCESS) {
-        throw std::runtime_error("CHAMELEON_dtrsm_Tile Failed!");
+        throw std::runtime_error("CHAMELEON_trsm_Tile Failed!");
     }
 }
 
 template<typename T>
 void ChameleonImplementation<T>::ExaGeoStatSequenceWait(void *apSequence) {
-    int status = CHAMELEON_Sequence_Wait((RUNTIME_sequence_t *) apSequence);
+    auto pSequence = (RUNTIME_sequence_t *) apSequence;
+    int status = CHAMELEON_Sequence_Wait(pSequence);
     if (status != CHAMELEON_SUCCESS) {
+        // A failed task flushes the sequence, which is reused by the next evaluations of the fit, so it is reset.
+        pSequence->status = CHAMELEON_SUCCESS;
+        pSequence->request = nullptr;
+        // A failed factorization reports the order of the leading minor that is not positive definite.
+        if (status > 0) {
+            throw std::runtime_error("CHAMELEON_potrf_Tile Failed, Matrix is not positive definite");
+        }
         throw std::runtime_error("CHAMELEON_Sequence_Wait Failed!");
     }
 }
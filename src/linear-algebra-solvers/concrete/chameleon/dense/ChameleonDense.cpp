@@ -26,12 +26,33 @@ template<typename T>
 void
 ChameleonDense<T>::ExaGeoStatPotrfTile(const common::UpperLower &aUpperLower, void *apA, int aBand,
                                        void *apCD, void *apCrk, const int &aMaxRank, const int &aAcc) {
-    int status = CHAMELEON_dpotrf_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA);
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_spotrf_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA);
+    } else {
+        status = CHAMELEON_dpotrf_Tile((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA);
+    }
     if (status != CHAMELEON_SUCCESS) {
-        throw std::runtime_error("CHAMELEON_dpotrf_Tile Failed, Matrix is not positive definite");
+        throw std::runtime_error("CHAMELEON_potrf_Tile Failed, Matrix is not positive definite");
     }
     // Due to a leak in dense mode in Chameleon, We had to free the buffer manually.
 #ifdef USE_MKL
     mkl_free_buffers();
 #endif
-}
\ No newline at end of file
+}
+
+template<typename T>
+void ChameleonDense<T>::ExaGeoStatPotrfTileAsync(const common::UpperLower &aUpperLower, void *apA, const int &aBand,
+                                                 void *apSequence, void *apRequest) {
+    int status;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        status = CHAMELEON_spotrf_Tile_Async((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA,
+                                             (RUNTIME_sequence_t *) apSequence, (RUNTIME_request_t *) apRequest);
+    } else {
+        status = CHAMELEON_dpotrf_Tile_Async((cham_uplo_t) aUpperLower, (CHAM_desc_t *) apA,
+                                             (RUNTIME_sequence_t *) apSequence, (RUNTIME_request_t *) apRequest);
+    }
+    if (status != CHAMELEON_SUCCESS) {
+        throw std::runtime_error("CHAMELEON_potrf_Tile_Async Failed!");
+    }
+}
@@ -38,6 +38,12 @@ void ChameleonDST<T>::ExaGeoStatPotrfTile(const UpperLower &aUpperLower, void *a
     chameleon_sequence_destroy(chameleon_context, sequence);
 }
 
+template<typename T>
+void ChameleonDST<T>::ExaGeoStatPotrfTileAsync(const UpperLower &aUpperLower, void *apA, const int &aBand,
+                                               void *apSequence, void *apRequest) {
+    ExaGeoStatPotrfDiagonalTileAsync(aUpperLower, apA, aBand, apSequence, apRequest);
+}
+
 template<typename T>
 int ChameleonDST<T>::ExaGeoStatPotrfDiagonalTileAsync(const common::UpperLower &aUpperLower, void *apA,
                                                       int aBand, void *apSequence, void *apRequest) {
@@ -120,15 +126,24 @@ void ChameleonDST<T>::ExaGeoStatParallelPotrfDiagonal(const common::UpperLower &
             ldak = BLKLDD(A, k);
 
             options.priority = 2 * A->mt - 2 * k;
-            INSERT_TASK_dpotrf(&options, ChamLower, tempkm, A->mb, A, k, k, A->nb * k);
+            if (sizeof(T) == SIZE_OF_FLOAT) {
+                INSERT_TASK_spotrf(&options, ChamLower, tempkm, A->mb, A, k, k, A->nb * k);
+            } else {
+                INSERT_TASK_dpotrf(&options, ChamLower, tempkm, A->mb, A, k, k, A->nb * k);
+            }
 
             for (m = k + 1; m < A->mt && m < k + aBand; m++) {
                 tempmm = m == A->mt - 1 ? A->m - m * A->mb : A->mb;
                 ldam = BLKLDD(A, m);
 
                 options.priority = 2 * A->mt - 2 * k - m;
-                INSERT_TASK_dtrsm(&options, ChamRight, ChamLower, ChamTrans, ChamNonUnit, tempmm, A->mb, A->mb, zone, A,
-                                  k, k, A, m, k);
+                if (sizeof(T) == SIZE_OF_FLOAT) {
+                    INSERT_TASK_strsm(&options, ChamRight, ChamLower, ChamTrans, ChamNonUnit, tempmm, A->mb, A->mb,
+                                      zone, A, k, k, A, m, k);
+                } else {
+                    INSERT_TASK_dtrsm(&options, ChamRight, ChamLower, ChamTrans, ChamNonUnit, tempmm, A->mb, A->mb,
+                                      zone, A, k, k, A, m, k);
+                }
             }
             RUNTIME_data_flush((RUNTIME_sequence_t *) apSequence, A, k, k);
 
@@ -137,15 +152,26 @@ void ChameleonDST<T>::ExaGeoStatParallelPotrfDiagonal(const common::UpperLower &
                 ldan = BLKLDD(A, n);
 
                 options.priority = 2 * A->mt - 2 * k - n;
-                INSERT_TASK_dsyrk(&options, ChamLower, ChamNoTrans, tempnn, A->nb, A->mb, -1.0, A, n, k, 1.0, A, n, n);
+                if (sizeof(T) == SIZE_OF_FLOAT) {
+                    INSERT_TASK_ssyrk(&options, ChamLower, ChamNoTrans, tempnn, A->nb, A->mb, -1.0, A, n, k, 1.0, A, n,
+                                      n);
+                } else {
+                    INSERT_TASK_dsyrk(&options, ChamLower, ChamNoTrans, tempnn, A->nb, A->mb, -1.0, A, n, k, 1.0, A, n,
+                                      n);
+                }
 
                 for (m = n + 1; m < A->mt && m < n + aBand; m++) {
                     tempmm = m == A->mt - 1 ? A->m - m * A->mb : A->mb;
                     ldam = BLKLDD(A, m);
 
                     options.priority = 2 * A->mt - 2 * k - n - m;
-                    INSERT_TASK_dgemm(&options, ChamNoTrans, ChamTrans, tempmm, tempnn, A->mb, A->mb, mzone, A, m, k, A,
-                                      n, k, zone, A, m, n);
+                    if (sizeof(T) == SIZE_OF_FLOAT) {
+                        INSERT_TASK_sgemm(&options, ChamNoTrans, ChamTrans, tempmm, tempnn, A->mb, A->mb, mzone, A, m,
+                                          k, A, n, k, zone, A, m, n);
+                    } else {
+                        INSERT_TASK_dgemm(&options, ChamNoTrans, ChamTrans, tempmm, tempnn, A->mb, A->mb, mzone, A, m,
+                                          k, A, n, k, zone, A, m, n);
+                    }
                 }
                 RUNTIME_data_flush((RUNTIME_sequence_t *) apSequence, A, n, k);
             }
@@ -163,14 +189,23 @@ void ChameleonDST<T>::ExaGeoStatParallelPotrfDiagonal(const common::UpperLower &
             ldak = BLKLDD(A, k);
 
             options.priority = 2 * A->nt - 2 * k;
-            INSERT_TASK_dpotrf(&options, ChamUpper, tempkm, A->mb, A, k, k, A->nb * k);
+            if (sizeof(T) == SIZE_OF_FLOAT) {
+                INSERT_TASK_spotrf(&options, ChamUpper, tempkm, A->mb, A, k, k, A->nb * k);
+            } else {
+                INSERT_TASK_dpotrf(&options, ChamUpper, tempkm, A->mb, A, k, k, A->nb * k);
+            }
 
             for (n = k + 1; n < A->nt; n++) {
                 tempnn = n == A->nt - 1 ? A->n - n * A->nb : A->nb;
 
                 options.priority = 2 * A->nt - 2 * k - n;
-                INSERT_TASK_dtrsm(&options, ChamLeft, ChamUpper, ChamTrans, ChamNonUnit, A->mb, tempnn, A->mb, zone, A,
-                                  k, k, A, k, n);
+                if (sizeof(T) == SIZE_OF_FLOAT) {
+                    INSERT_TASK_strsm(&options, ChamLeft, ChamUpper, ChamTrans, ChamNonUnit, A->mb, tempnn, A->mb,
+                                      zone, A, k, k, A, k, n);
+                } else {
+                    INSERT_TASK_dtrsm(&options, ChamLeft, ChamUpper, ChamTrans, ChamNonUnit, A->mb, tempnn, A->mb,
+                                      zone, A, k, k, A, k, n);
+                }
             }
             RUNTIME_data_flush((RUNTIME_sequence_t *) apSequence, A, k, k);
 
@@ -179,14 +214,25 @@ void ChameleonDST<T>::ExaGeoStatParallelPotrfDiagonal(const common::UpperLower &
                 ldam = BLKLDD(A, m);
 
                 options.priority = 2 * A->nt - 2 * k - m;
-                INSERT_TASK_dsyrk(&options, ChamUpper, ChamTrans, tempmm, A->mb, A->mb, -1.0, A, k, m, 1.0, A, m, m);
+                if (sizeof(T) == SIZE_OF_FLOAT) {
+                    INSERT_TASK_ssyrk(&options, ChamUpper, ChamTrans, tempmm, A->mb, A->mb, -1.0, A, k, m, 1.0, A, m,
+                                      m);
+                } else {
+                    INSERT_TASK_dsyrk(&options, ChamUpper, ChamTrans, tempmm, A->mb, A->mb, -1.0, A, k, m, 1.0, A, m,
+                                      m);
+                }
 
                 for (n = m + 1; n < A->nt; n++) {
                     tempnn = n == A->nt - 1 ? A->n - n * A->nb : A->nb;
 
                     options.priority = 2 * A->nt - 2 * k - n - m;
-                    INSERT_TASK_dgemm(&options, ChamTrans, ChamNoTrans, tempmm, tempnn, A->mb, A->mb, mzone, A, k, m, A,
-                                      k, n, zone, A, m, n);
+                    if (sizeof(T) == SIZE_OF_FLOAT) {
+                        INSERT_TASK_sgemm(&options, ChamTrans, ChamNoTrans, tempmm, tempnn, A->mb, A->mb, mzone, A, k,
+                                          m, A, k, n, zone, A, m, n);
+                    } else {
+                        INSERT_TASK_dgemm(&options, ChamTrans, ChamNoTrans, tempmm, tempnn, A->mb, A->mb, mzone, A, k,
+                                          m, A, k, n, zone, A, m, n);
+                    }
                 }
                 RUNTIME_data_flush((RUNTIME_sequence_t *) apSequence, A, k, m);
             }
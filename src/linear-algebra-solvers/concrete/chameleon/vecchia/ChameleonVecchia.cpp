@@ -0,0 +1,164 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ChameleonVecchia.cpp
+ * @brief Vecchia approximation of the likelihood, built from the conditional densities of the locations.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <algorithm>
+#include <cmath>
+
+#include <helpers/SpaceFillingCurve.hpp>
+#include <helpers/SpatialIndex.hpp>
+#include <linear-algebra-solvers/concrete/chameleon/vecchia/ChameleonVecchia.hpp>
+
+using namespace std;
+
+using namespace exageostat::linearAlgebra::vecchia;
+using namespace exageostat::common;
+using namespace exageostat::dataunits;
+using namespace exageostat::runtime;
+using namespace exageostat::results;
+
+template<typename T>
+T ChameleonVecchia<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T>> &aData,
+                                         configurations::Configurations &aConfigurations, const double *theta,
+                                         T *apMeasurementsMatrix, const kernels::Kernel<T> &aKernel) {
+
+    if (aKernel.GetVariablesNumber() != 1) {
+        throw domain_error("The Vecchia approximation supports the univariate kernels only.");
+    }
+    if (aConfigurations.GetIsNonGaussian()) {
+        throw domain_error("The Vecchia approximation does not support the non-Gaussian kernels.");
+    }
+    auto *pDescriptorData = aData->GetDescriptorData();
+    this->InitiateVecchiaDescriptors(aConfigurations, *pDescriptorData, apMeasurementsMatrix);
+    RUNTIME_request_t request_array[2] = {RUNTIME_REQUEST_INITIALIZER, RUNTIME_REQUEST_INITIALIZER};
+    auto pSequence = (RUNTIME_sequence_t *) pDescriptorData->GetSequence();
+
+    int n = aConfigurations.GetProblemSize();
+    int neighbors_number = min(aConfigurations.GetVecchiaNeighborsNumber(), n - 1);
+    int num_params = aKernel.GetParametersNumbers();
+    T evaluation_time, flops;
+
+    // Order the locations and find their conditioning sets once per fit, every evaluation reuses them.
+    if (this->mpSourceLocations != aData->GetLocations() || this->mNeighborsNumber != neighbors_number ||
+        this->mOrderedZ.size() != (size_t) n) {
+        VERBOSE("\tOrder the locations and find their conditioning neighbors...")
+        auto *CHAM_desc_Z = pDescriptorData->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                           DescriptorName::DESCRIPTOR_Z).chameleon_desc;
+        T *z = CHAM_desc_Z != nullptr ? (T *) CHAM_desc_Z->mat : apMeasurementsMatrix;
+        if (z == nullptr) {
+            throw runtime_error("The Vecchia approximation needs the measurements of the locations.");
+        }
+        Locations<T> &locations = *aData->GetLocations();
+        Ordering ordering = aConfigurations.GetOrdering() == HILBERT_ORDERING ? HILBERT_ORDERING : MORTON_ORDERING;
+        vector<int> permutation = helpers::SpaceFillingCurve<T>::GetPermutation(n, locations, ordering,
+                                                                                aConfigurations.GetCoresNumber());
+
+        this->mpOrderedLocations = make_unique<Locations<T>>(n, locations.GetDimension());
+        this->mOrderedZ.resize(n);
+        for (int i = 0; i < n; i++) {
+            this->mpOrderedLocations->GetLocationX()[i] = locations.GetLocationX()[permutation[i]];
+            this->mpOrderedLocations->GetLocationY()[i] = locations.GetLocationY()[permutation[i]];
+            if (locations.GetDimension() != Dimension2D) {
+                this->mpOrderedLocations->GetLocationZ()[i] = locations.GetLocationZ()[permutation[i]];
+            }
+            this->mOrderedZ[i] = z[permutation[i]];
+        }
+        this->mNeighbors = FindNeighbors(*this->mpOrderedLocations, n, neighbors_number,
+                                         aConfigurations.GetDistanceMetric(), aConfigurations.GetCoresNumber());
+        this->mpSourceLocations = aData->GetLocations();
+        this->mNeighborsNumber = neighbors_number;
+        VERBOSE("\tDone.")
+    }
+
+    // The optimizer works in double precision, the kernels in the precision of the descriptors.
+    std::vector<T> local_theta(theta, theta + num_params);
+    auto median_locations = Locations<T>(1, aData->GetLocations()->GetDimension());
+    aData->CalculateMedianLocations(aConfigurations.GetKernelName(), median_locations);
+
+    auto *CHAM_desc_det = pDescriptorData->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                         DescriptorName::DESCRIPTOR_DETERMINANT).chameleon_desc;
+    auto *CHAM_desc_product = pDescriptorData->GetDescriptor(DescriptorType::CHAMELEON_DESCRIPTOR,
+                                                             DescriptorName::DESCRIPTOR_PRODUCT).chameleon_desc;
+    T *determinant = pDescriptorData->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_DETERMINANT);
+    *determinant = 0;
+    T *product = pDescriptorData->GetDescriptorMatrix(CHAMELEON_DESCRIPTOR, DESCRIPTOR_PRODUCT);
+    *product = 0;
+    int iter_count = aData->GetMleIterations();
+
+    VERBOSE("\tSubmit the conditional densities of the locations...")
+    START_TIMING(evaluation_time);
+    RuntimeFunctions<T>::ExaGeoStatVecchiaLogLikelihoodTileAsync(n, neighbors_number, this->mNeighbors.data(),
+                                                                 this->mpOrderedLocations.get(), &median_locations,
+                                                                 this->mOrderedZ.data(), local_theta.data(),
+                                                                 aConfigurations.GetDistanceMetric(), &aKernel,
+                                                                 aConfigurations.GetDenseTileSize(), CHAM_desc_det,
+                                                                 CHAM_desc_product, pSequence, &request_array[0],
+                                                                 aConfigurations.GetIsDeterministic());
+    this->ExaGeoStatSequenceWait(pSequence);
+    STOP_TIMING(evaluation_time);
+    VERBOSE("\tDone.")
+    flops = n * (flops_dpotrf(neighbors_number + 1) + flops_dtrsm(ChamLeft, neighbors_number + 1, 1));
+
+    // The determinant holds the sum of the logarithms of the conditional standard deviations.
+    T loglik = -0.5 * (*product) - (*determinant) - (T) (n / 2.0) * log(2.0 * PI);
+    if (!isfinite(loglik)) {
+        throw runtime_error("The covariance of a conditioning set is not positive definite at this theta.");
+    }
+
+    LOGGER("\t" << iter_count + 1 << " - Model Parameters (", true)
+    if (aConfigurations.GetLogger()) {
+        fprintf(aConfigurations.GetFileLogPath(), "\t %d- Model Parameters (", iter_count + 1);
+    }
+    for (int i = 0; i < num_params; i++) {
+        LOGGER_PRECISION(theta[i])
+        if (i < num_params - 1) {
+            LOGGER_PRECISION(", ")
+        }
+        if (aConfigurations.GetLogger()) {
+            fprintf(aConfigurations.GetFileLogPath(), "%.8f, ", theta[i]);
+        }
+    }
+    LOGGER_PRECISION(")----> LogLi: " << loglik << "\n", 18)
+    if (aConfigurations.GetLogger()) {
+        fprintf(aConfigurations.GetFileLogPath(), ")----> LogLi: %.18f\n", loglik);
+    }
+    VERBOSE("---- Total Time (Conditional densities): " << evaluation_time)
+    VERBOSE("---- Gflop/s: " << flops / 1e9 / evaluation_time)
+
+    aData->SetMleIterations(aData->GetMleIterations() + 1);
+    // No Cholesky factor of the covariance matrix is left for the next stages.
+    aData->SetFactorTheta({});
+
+    // for experiments and benchmarking
+    Results::GetInstance()->SetTotalModelingExecutionTime(
+            Results::GetInstance()->GetTotalModelingExecutionTime() + evaluation_time);
+    Results::GetInstance()->SetTotalModelingFlops(
+            Results::GetInstance()->GetTotalModelingFlops() + (flops / 1e9 / evaluation_time));
+    Results::GetInstance()->SetMLEIterations(iter_count + 1);
+    Results::GetInstance()->SetMaximumTheta(vector<double>(theta, theta + num_params));
+    Results::GetInstance()->SetLogLikValue(loglik);
+
+    return loglik;
+}
+
+template<typename T>
+vector<int> ChameleonVecchia<T>::FindNeighbors(Locations<T> &aLocations, const int &aN, const int &aNeighborsNumber,
+                                               const DistanceMetric &aDistanceMetric, const int &aThreadsNumber) {
+
+    vector<int> neighbors((size_t) aN * aNeighborsNumber, -1);
+    if (aN < 2 || aNeighborsNumber == 0) {
+        return neighbors;
+    }
+    helpers::SpatialIndex<T> index(aLocations, aN, aDistanceMetric, aThreadsNumber);
+    index.KNearestPrecedingNeighbors(aNeighborsNumber, neighbors.data(), aThreadsNumber);
+    return neighbors;
+}
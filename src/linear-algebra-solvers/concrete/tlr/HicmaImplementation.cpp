@@ -182,17 +182,13 @@ T HicmaImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T>> &
     *product = 0;
     T *sum;
 
-    string recovery_file = aConfigurations.GetRecoveryFile();
-    if (recovery_file.empty() ||
-        !(this->Recover((char *) (recovery_file.c_str()), iter_count, (T *) theta, &loglik, num_params))) {
-        if (iter_count == 0) {
-            // Copy dense matrix Z into tile low rank Z.
-            this->CopyDescriptors(CHAM_descZ, HICMA_descZ, N, CHAMELEON_TO_HICMA);
-            // Save a copy of descZ into descZcpy for restoring each iteration
-            this->ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, HICMA_descZ, HICMA_descZcpy);
-            // Save another copy into descZcpy for chameleon, This is in case of other operations after Modeling. ex: Prediction.
-            CHAMELEON_dlacpy_Tile(ChamUpperLower, CHAM_descZ, CHAM_descZcpy);
-        }
+    if (iter_count == 0) {
+        // Copy dense matrix Z into tile low rank Z.
+        this->CopyDescriptors(CHAM_descZ, HICMA_descZ, N, CHAMELEON_TO_HICMA);
+        // Save a copy of descZ into descZcpy for restoring each iteration
+        this->ExaGeoStatLapackCopyTile(EXAGEOSTAT_UPPER_LOWER, HICMA_descZ, HICMA_descZcpy);
+        // Save another copy into descZcpy for chameleon, This is in case of other operations after Modeling. ex: Prediction.
+        CHAMELEON_dlacpy_Tile(ChamUpperLower, CHAM_descZ, CHAM_descZcpy);
     }
     //Matrix generation part.
     VERBOSE("LR:Generate New Covariance Matrix...")
@@ -243,7 +239,8 @@ T HicmaImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T>> &
     VERBOSE("LR:Calculating the log determinant ...")
     START_TIMING(logdet_calculate);
     RuntimeFunctions<T>::ExaGeoStatMeasureDetTileAsync(aConfigurations.GetComputation(), HICMA_descCD, pSequence,
-                                                       &request_array[0], HICMA_desc_det);
+                                                       &request_array[0], HICMA_desc_det,
+                                                       aConfigurations.GetIsDeterministic());
     ExaGeoStatSequenceWait(pSequence);
     logdet = 2 * (*determinant);
     STOP_TIMING(logdet_calculate);
@@ -270,7 +267,8 @@ T HicmaImplementation<T>::ExaGeoStatMLETile(std::unique_ptr<ExaGeoStatData<T>> &
 #endif
         RuntimeFunctions<T>::ExaGeoStatNonGaussianLogLikeTileAsync(aConfigurations.GetComputation(), HICMA_descZ,
                                                                    HICMA_desc_sum, (T *) theta, pSequence,
-                                                                   &request_array[0]);
+                                                                   &request_array[0],
+                                                                   aConfigurations.GetIsDeterministic());
         ExaGeoStatSequenceWait(pSequence);
         VERBOSE(" Done.")
     }
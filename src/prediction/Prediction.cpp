@@ -51,6 +51,16 @@ void Prediction<T>::PredictMissingData(unique_ptr<ExaGeoStatData<T>> &aData, Con
                 "Can't predict without an estimated theta, please either pass --etheta or run the modeling module before prediction");
     }
 
+    // The kriging variance is only returned along with the Gaussian MSPE prediction.
+    if (aConfigurations.GetIsKrigingVariance() &&
+        (!aConfigurations.GetIsMSPE() || aConfigurations.GetIsNonGaussian())) {
+        throw domain_error("The kriging variance needs --mspe, and is not supported by the non-Gaussian kernels.");
+    }
+
+    // The model parameters are kept in double precision, while the solver works in the precision of the data.
+    vector<T> initial_theta(aConfigurations.GetInitialTheta().begin(), aConfigurations.GetInitialTheta().end());
+    vector<T> estimated_theta(aConfigurations.GetEstimatedTheta().begin(), aConfigurations.GetEstimatedTheta().end());
+
     int number_of_mspe = 3;
     int p = aKernel.GetVariablesNumber();
     int z_miss_number, n_z_obs;
@@ -76,7 +86,7 @@ void Prediction<T>::PredictMissingData(unique_ptr<ExaGeoStatData<T>> &aData, Con
         LOGGER("\t---- Using Prediction Function Fisher ----")
         T *fisher_results;
         fisher_results = linear_algebra_solver->ExaGeoStatFisherTile(aConfigurations, aData,
-                                                                     (T *) aConfigurations.GetEstimatedTheta().data(),
+                                                                     estimated_theta.data(),
                                                                      aKernel);
         vector<double> fisher_vector;
         fisher_vector.reserve(num_params * num_params); // Reserve memory in advance for efficiency
@@ -118,6 +128,10 @@ void Prediction<T>::PredictMissingData(unique_ptr<ExaGeoStatData<T>> &aData, Con
     aConfigurations.SetUnknownObservationsNb(z_miss_number);
     T *z_obs = new T[n_z_obs * p];
     T *z_miss = new T[z_miss_number];
+    T *z_miss_variance = nullptr;
+    if (aConfigurations.GetIsKrigingVariance()) {
+        z_miss_variance = new T[z_miss_number];
+    }
 
     vector<T> avg_pred_value(number_of_mspe);
     auto miss_locations = new Locations<T>(z_miss_number, aConfigurations.GetDimension());
@@ -132,8 +146,8 @@ void Prediction<T>::PredictMissingData(unique_ptr<ExaGeoStatData<T>> &aData, Con
     if (aConfigurations.GetIsMLOEMMOM()) {
         LOGGER("---- Using Auxiliary Function MLOE MMOM ----")
         linear_algebra_solver->ExaGeoStatMLETileMLOEMMOM(aConfigurations, aData,
-                                                         (T *) aConfigurations.GetInitialTheta().data(),
-                                                         (T *) aConfigurations.GetEstimatedTheta().data(),
+                                                         initial_theta.data(),
+                                                         estimated_theta.data(),
                                                          *miss_locations, *obs_locations, aKernel);
     }
 
@@ -148,7 +162,7 @@ void Prediction<T>::PredictMissingData(unique_ptr<ExaGeoStatData<T>> &aData, Con
         }
 
         PredictionAuxiliaryFunctions<T>::PredictIDW(z_miss, z_actual, z_obs, z_miss_number, n_z_obs, *miss_locations,
-                                                    *obs_locations, mspe);
+                                                    *obs_locations, mspe, aConfigurations);
 
         vector<double> idw_error;
         idw_error.reserve(number_of_mspe); // Reserve memory in advance for efficiency
@@ -166,7 +180,7 @@ void Prediction<T>::PredictMissingData(unique_ptr<ExaGeoStatData<T>> &aData, Con
         T *prediction_error_mspe;
         if (aConfigurations.GetIsNonGaussian()) {
             prediction_error_mspe = linear_algebra_solver->ExaGeoStatMLENonGaussianPredictTile(aData,
-                                                                                               (T *) aConfigurations.GetEstimatedTheta().data(),
+                                                                                               estimated_theta.data(),
                                                                                                z_miss_number, n_z_obs,
                                                                                                z_obs, z_actual, z_miss,
                                                                                                aConfigurations,
@@ -174,9 +188,10 @@ void Prediction<T>::PredictMissingData(unique_ptr<ExaGeoStatData<T>> &aData, Con
                                                                                                *obs_locations, aKernel);
         } else {
             prediction_error_mspe = linear_algebra_solver->ExaGeoStatMLEPredictTile(aData,
-                                                                                    (T *) aConfigurations.GetEstimatedTheta().data(),
+                                                                                    estimated_theta.data(),
                                                                                     z_miss_number, n_z_obs, z_obs,
-                                                                                    z_actual, z_miss, aConfigurations,
+                                                                                    z_actual, z_miss, z_miss_variance,
+                                                                                    aConfigurations,
                                                                                     *miss_locations, *obs_locations,
                                                                                     aKernel);
         }
@@ -189,6 +204,10 @@ void Prediction<T>::PredictMissingData(unique_ptr<ExaGeoStatData<T>> &aData, Con
             z_miss_vector.push_back(z_miss[idx]);
         }
         Results::GetInstance()->SetPredictedMissedValues(z_miss_vector);
+        if (z_miss_variance) {
+            Results::GetInstance()->SetPredictedVariances(
+                    vector<double>(z_miss_variance, z_miss_variance + z_miss_number));
+        }
         if (z_actual) {
             LOGGER("\t\t- Prediction value: " << avg_pred_value[0])
         }
@@ -203,6 +222,7 @@ void Prediction<T>::PredictMissingData(unique_ptr<ExaGeoStatData<T>> &aData, Con
 
     delete[] z_obs;
     delete[] z_miss;
+    delete[] z_miss_variance;
     delete[] z_actual;
     delete miss_locations;
     delete obs_locations;
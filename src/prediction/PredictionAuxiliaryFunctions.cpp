@@ -12,45 +12,227 @@
  * @date 2023-06-08
 **/
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 #include <prediction/PredictionAuxiliaryFunctions.hpp>
-#include <helpers/DistanceCalculationHelpers.hpp>
+#include <helpers/ParallelBlocks.hpp>
+#include <helpers/SpatialIndex.hpp>
 #include <utilities/Logger.hpp>
 
+using namespace std;
+
 using namespace exageostat::prediction;
 using namespace exageostat::dataunits;
+using namespace exageostat::common;
+using namespace exageostat::configurations;
+using namespace exageostat::helpers;
+
+//// Number of consecutive missing values a thread predicts at once.
+static const int IDW_PREDICTION_BLOCK = 64;
+//// Number of partial sums the weights are accumulated in, so that the compiler can vectorize the accumulation.
+static const int IDW_LANES = 8;
+
+/**
+ * @brief Computes the inverse distance weight of a distance.
+ * @param[in] aDistance The distance, or its square if aIsSquared is set.
+ * @param[in] aPower The power of the weights.
+ * @param[in] aIsSquared Whether aDistance is a squared distance.
+ * @return The weight, 0 for a null distance.
+ *
+ */
+template<typename T>
+static inline T InverseDistanceWeight(const T &aDistance, const T &aPower, const bool &aIsSquared) {
+
+    if (aDistance <= 0) {
+        return 0;
+    }
+    if (aPower == 2) {
+        return aIsSquared ? 1 / aDistance : 1 / (aDistance * aDistance);
+    }
+    return pow(aDistance, aIsSquared ? -aPower / 2 : -aPower);
+}
 
 template<typename T>
 void PredictionAuxiliaryFunctions<T>::PredictIDW(T *apZMiss, T *apZActual, T *apZObs, const int &aZMissNumber,
                                                  const int &aZObsNumber, Locations<T> &aMissLocation,
-                                                 Locations<T> &aObsLocation, T *apMSPE) {
-
-    int i, j;
-    T sigma_1 = 0;
-    T sigma_2 = 0;
-    T error = 0, dij;
-    T error1 = 0, error2 = 0;
-    T x1, y1, x2, y2;
-    int n = 2;
-
-    for (j = 0; j < aZMissNumber; j++) {
-        for (i = 0; i < aZObsNumber; i++) {
-            dij = helpers::DistanceCalculationHelpers<T>::CalculateDistance(aObsLocation, aMissLocation, i, j,
-                                                                            common::EUCLIDEAN_DISTANCE, 0);
-            if (dij != 0) {
-                sigma_1 += apZObs[i] / pow(dij, n);
-                sigma_2 += 1.0 / pow(dij, n);
+                                                 Locations<T> &aObsLocation, T *apMSPE,
+                                                 Configurations &aConfigurations) {
+
+    const int neighbors_number = min(aConfigurations.GetIDWNeighborsNumber(), aZObsNumber);
+    const T radius = aConfigurations.GetIDWRadius();
+    const T power = aConfigurations.GetIDWPower();
+    const DistanceMetric distance_metric = aConfigurations.GetDistanceMetric();
+    const int threads_number = aConfigurations.GetCoresNumber();
+    const bool is_great_circle = distance_metric == GREAT_CIRCLE_DISTANCE;
+    // The weights are spatial, the time of space-time locations is ignored by both the index and the full scan.
+    const bool has_z_axis = aObsLocation.GetDimension() == Dimension3D && !is_great_circle;
+    const T time_scale = 0;
+    const bool use_all_observations = (neighbors_number == 0 && radius == 0) || aZObsNumber == 0;
+    // No radius is the same as an infinite one.
+    const T search_radius = radius > 0 ? radius : numeric_limits<T>::infinity();
+
+    // Neighbor lists, contiguous per missing location.
+    vector<int> offsets, indices, nearest_observations;
+    vector<T> distances;
+    if (!use_all_observations && aZObsNumber > 0) {
+        helpers::SpatialIndex<T> index(aObsLocation, aZObsNumber, distance_metric, threads_number, time_scale);
+        if (neighbors_number > 0) {
+            indices.resize((size_t) aZMissNumber * neighbors_number);
+            distances.resize(indices.size());
+            index.KNearestNeighbors(aMissLocation, aZMissNumber, neighbors_number, indices.data(), distances.data(),
+                                    threads_number);
+            offsets.resize(aZMissNumber + 1);
+            for (int j = 0; j <= aZMissNumber; j++) {
+                offsets[j] = j * neighbors_number;
             }
+        } else {
+            index.RadiusNeighbors(aMissLocation, aZMissNumber, radius, offsets, indices, &distances, threads_number);
         }
-        apZMiss[j] = sigma_1 / sigma_2;
-        if (j % 2 == 0)
-            error1 += pow((apZActual[j] - apZMiss[j]), 2);
-        else
-            error2 += pow((apZActual[j] - apZMiss[j]), 2);
-        error += pow((apZActual[j] - apZMiss[j]), 2);
-        sigma_1 = 0;
-        sigma_2 = 0;
+
+        // A missing location with no observed location in the radius takes the value of the nearest one.
+        vector<int> isolated;
+        for (int j = 0; j < aZMissNumber; j++) {
+            if (offsets[j] == offsets[j + 1] || distances[offsets[j]] > search_radius) {
+                isolated.push_back(j);
+            }
+        }
+        if (!isolated.empty()) {
+            Locations<T> isolated_locations((int) isolated.size(), aMissLocation.GetDimension());
+            for (size_t k = 0; k < isolated.size(); k++) {
+                isolated_locations.GetLocationX()[k] = aMissLocation.GetLocationX()[isolated[k]];
+                isolated_locations.GetLocationY()[k] = aMissLocation.GetLocationY()[isolated[k]];
+                if (aMissLocation.GetDimension() != Dimension2D) {
+                    isolated_locations.GetLocationZ()[k] = aMissLocation.GetLocationZ()[isolated[k]];
+                }
+            }
+            vector<int> nearest(isolated.size());
+            index.KNearestNeighbors(isolated_locations, (int) isolated.size(), 1, nearest.data(), nullptr,
+                                    threads_number);
+            nearest_observations.assign(aZMissNumber, -1);
+            for (size_t k = 0; k < isolated.size(); k++) {
+                nearest_observations[isolated[k]] = nearest[k];
+            }
+        }
+    }
+
+    // Coordinates of the observed locations, converted once for the great-circle distance.
+    vector<T> latitudes, longitudes, cos_latitudes;
+    if (use_all_observations && is_great_circle) {
+        latitudes.resize(aZObsNumber), longitudes.resize(aZObsNumber), cos_latitudes.resize(aZObsNumber);
+        for (int i = 0; i < aZObsNumber; i++) {
+            latitudes[i] = aObsLocation.GetLocationX()[i] * PI / 180;
+            longitudes[i] = aObsLocation.GetLocationY()[i] * PI / 180;
+            cos_latitudes[i] = cos(latitudes[i]);
+        }
+    }
+
+    int blocks_number = (aZMissNumber + IDW_PREDICTION_BLOCK - 1) / IDW_PREDICTION_BLOCK;
+    // The errors of the even and the odd missing values, and of all of them, per block.
+    vector<T> block_errors((size_t) blocks_number * 3, 0);
+    ParallelBlocks::ForEachBlock(aZMissNumber, IDW_PREDICTION_BLOCK, threads_number,
+                                 [&](const int &aBlock, const int &aFirst, const int &aLast) {
+        vector<T> weighted_distances(use_all_observations ? aZObsNumber : 0);
+        for (int j = aFirst; j < aLast; j++) {
+            T sigma_1[IDW_LANES] = {0}, sigma_2[IDW_LANES] = {0};
+            T coincident_sum = 0;
+            int coincident_number = 0;
+
+            if (use_all_observations) {
+                // Squared distances for the Euclidean distance, distances for the great-circle one.
+                const T *x = aObsLocation.GetLocationX(), *y = aObsLocation.GetLocationY();
+                T *pDistances = weighted_distances.data();
+                if (is_great_circle) {
+                    const T latitude = aMissLocation.GetLocationX()[j] * PI / 180;
+                    const T longitude = aMissLocation.GetLocationY()[j] * PI / 180;
+                    const T cos_latitude = cos(latitude);
+                    for (int i = 0; i < aZObsNumber; i++) {
+                        const T u = sin((latitudes[i] - latitude) / 2);
+                        const T v = sin((longitudes[i] - longitude) / 2);
+                        pDistances[i] = 2.0 * EARTH_RADIUS *
+                                        asin(sqrt(u * u + cos_latitudes[i] * cos_latitude * v * v));
+                    }
+                } else {
+                    const T x_miss = aMissLocation.GetLocationX()[j], y_miss = aMissLocation.GetLocationY()[j];
+                    for (int i = 0; i < aZObsNumber; i++) {
+                        const T dx = x[i] - x_miss, dy = y[i] - y_miss;
+                        pDistances[i] = dx * dx + dy * dy;
+                    }
+                    if (has_z_axis) {
+                        const T *z = aObsLocation.GetLocationZ();
+                        const T z_miss = aMissLocation.GetLocationZ()[j];
+                        for (int i = 0; i < aZObsNumber; i++) {
+                            pDistances[i] += (z[i] - z_miss) * (z[i] - z_miss);
+                        }
+                    }
+                }
+                for (int i = 0; i < aZObsNumber; i++) {
+                    coincident_number += pDistances[i] == 0;
+                }
+                if (coincident_number > 0) {
+                    for (int i = 0; i < aZObsNumber; i++) {
+                        coincident_sum += pDistances[i] == 0 ? apZObs[i] : 0;
+                    }
+                }
+                if (power == 2 && !is_great_circle) {
+                    for (int i = 0; i < aZObsNumber; i++) {
+                        pDistances[i] = pDistances[i] > 0 ? 1 / pDistances[i] : 0;
+                    }
+                } else {
+                    for (int i = 0; i < aZObsNumber; i++) {
+                        pDistances[i] = InverseDistanceWeight(pDistances[i], power, !is_great_circle);
+                    }
+                }
+                int i = 0;
+                for (; i + IDW_LANES <= aZObsNumber; i += IDW_LANES) {
+                    for (int lane = 0; lane < IDW_LANES; lane++) {
+                        sigma_1[lane] += pDistances[i + lane] * apZObs[i + lane];
+                        sigma_2[lane] += pDistances[i + lane];
+                    }
+                }
+                for (; i < aZObsNumber; i++) {
+                    sigma_1[0] += pDistances[i] * apZObs[i];
+                    sigma_2[0] += pDistances[i];
+                }
+            } else if (!nearest_observations.empty() && nearest_observations[j] >= 0) {
+                sigma_1[0] = apZObs[nearest_observations[j]];
+                sigma_2[0] = 1;
+            } else {
+                // The neighbors are sorted by distance.
+                for (int k = offsets[j]; k < offsets[j + 1] && distances[k] <= search_radius; k++) {
+                    if (distances[k] == 0) {
+                        coincident_sum += apZObs[indices[k]];
+                        coincident_number++;
+                    }
+                    T weight = InverseDistanceWeight(distances[k], power, false);
+                    sigma_1[0] += weight * apZObs[indices[k]];
+                    sigma_2[0] += weight;
+                }
+            }
+
+            if (coincident_number > 0) {
+                apZMiss[j] = coincident_sum / coincident_number;
+            } else {
+                for (int lane = 1; lane < IDW_LANES; lane++) {
+                    sigma_1[0] += sigma_1[lane];
+                    sigma_2[0] += sigma_2[lane];
+                }
+                apZMiss[j] = sigma_1[0] / sigma_2[0];
+            }
+            T error = (apZActual[j] - apZMiss[j]) * (apZActual[j] - apZMiss[j]);
+            block_errors[(size_t) aBlock * 3 + j % 2] += error;
+            block_errors[(size_t) aBlock * 3 + 2] += error;
+        }
+    });
+
+    // The blocks are reduced in order, so the errors do not depend on the number of threads.
+    T error = 0, error1 = 0, error2 = 0;
+    for (int block = 0; block < blocks_number; block++) {
+        error1 += block_errors[(size_t) block * 3];
+        error2 += block_errors[(size_t) block * 3 + 1];
+        error += block_errors[(size_t) block * 3 + 2];
     }
 
     apMSPE[0] = error / aZMissNumber;
@@ -62,4 +244,4 @@ void PredictionAuxiliaryFunctions<T>::PredictIDW(T *apZMiss, T *apZActual, T *ap
         VERBOSE(" (" << apZActual[index] << ", " << apZMiss[index] << ")")
     }
     VERBOSE("\t\t- Prediction Error (IDW): " << apMSPE[0] << " - " << apMSPE[1] << " - " << apMSPE[2])
-}
\ No newline at end of file
+}
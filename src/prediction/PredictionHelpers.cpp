@@ -15,6 +15,7 @@
 #include <algorithm>
 
 #include <prediction/PredictionHelpers.hpp>
+#include <helpers/SpaceFillingCurve.hpp>
 
 using namespace exageostat::prediction;
 using namespace exageostat::configurations;
@@ -126,8 +127,8 @@ void PredictionHelpers<T>::PickRandomPoints(Configurations &aConfigurations,
     }
 
     if (p == 1) {
-        SortInplace(z_obs_number, aObsLocation, apZObs);
-        SortInplace(z_miss_number, aMissLocation, apZActual);
+        SortInplace(z_obs_number, aObsLocation, apZObs, aConfigurations.GetOrdering());
+        SortInplace(z_miss_number, aMissLocation, apZActual, aConfigurations.GetOrdering());
     }
 
     for (i = 0; i < p; i++) {
@@ -247,80 +248,11 @@ void PredictionHelpers<T>::SortArray(uint32_t *aData, int aCount) {
 }
 
 template<typename T>
-int PredictionHelpers<T>::SortInplace(int aN, Locations<T> &aLocations, T *apZ) {
+int PredictionHelpers<T>::SortInplace(int aN, Locations<T> &aLocations, T *apZ, const common::Ordering &aOrdering) {
 
-    int i;
-    int j;//new_j, tmp_j;
-    int count = aN;
-    int dimension_number = 2;
-    T *point = new T[dimension_number * count];
-    T *ptr1;
-    T *minmax; // min is stored in lower part, max is stored in upper part
-
-    for (i = 0; i < count; i++) {
-        point[i] = aLocations.GetLocationX()[i];
-        point[i + count] = aLocations.GetLocationY()[i];
-    }
-
-    minmax = new T[2 * count];
-
-    for (i = 0; i < dimension_number; i++) {
-        ptr1 = point + i * count; // i-th dimension
-        minmax[i] = ptr1[0];
-        minmax[i + dimension_number] = minmax[i];
-        for (j = 1; j < count; j++) {
-            if (minmax[i] > ptr1[j])
-                minmax[i] = ptr1[j];
-            else if (minmax[i + dimension_number] < ptr1[j])
-                minmax[i + dimension_number] = ptr1[j];
-        }
+    // The default keeps the points in their picking order.
+    if (aOrdering == common::MORTON_ORDERING || aOrdering == common::HILBERT_ORDERING) {
+        helpers::SpaceFillingCurve<T>::Reorder(aN, aLocations, apZ, 1, aOrdering);
     }
-
-    // Now minmax[0:dimension_number] and minmax[dimension_number:2*dimension_number] store minimal and maximal
-    // values of coordinates
-    auto uint_point = new uint32_t[dimension_number * count];
-    uint32_t *uint_ptr1;
-    T min, range;
-
-    for (i = 0; i < dimension_number; i++) {
-        uint_ptr1 = uint_point + i * count;
-        ptr1 = point + i * count;
-        min = minmax[i];
-        range = minmax[i + dimension_number] - min;
-        for (j = 0; j < count; j++)
-            uint_ptr1[j] = (ptr1[j] - min) / range * UINT32_MAX;
-    }
-
-    delete[] minmax;
-
-    // Now uint_ptr1 contains initial coordinates, rescaled to range
-    // [0, UINT32_MAX] and converted to uint32_t type to use special radix sort
-    // Prepare indexes to store sort order
-    auto order = new int[count];
-    for (j = 0; j < count; j++)
-        order[j] = j;
-    SortArray(uint_point, count);
-
-    auto new_point = new T[dimension_number * count];
-    auto new_z = new T[count];
-
-    for (j = 0; j < count; j++) {
-        for (i = 0; i < dimension_number; i++)
-            new_point[count * i + j] = point[count * i + order[j]];
-        new_z[j] = apZ[order[j]];
-    }
-
-    for (i = 0; i < count; i++) {
-        aLocations.GetLocationX()[i] = new_point[i];
-        aLocations.GetLocationY()[i] = new_point[i + count];
-        apZ[i] = new_z[i];
-    }
-
-    delete[] new_point;
-    delete[] point;
-    delete[] new_z;
-    delete[] uint_point;
-    delete[] order;
-
     return 0;
 }
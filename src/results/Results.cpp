@@ -77,6 +77,9 @@ void Results::PrintEndSummary() {
         VERBOSE("#Average Flops per Iteration: " << this->GetAverageModelingFlops())
         VERBOSE("#Total MLE Execution time: " << this->mTotalModelingExecutionTime)
         VERBOSE("#Total MLE GFlop/s: " << this->mTotalModelingFlops)
+        if (this->mMixedPrecisionDeviation >= 0) {
+            LOGGER("#Mixed Precision Log Likelihood Relative Deviation: " << this->mMixedPrecisionDeviation)
+        }
     }
 
     if (this->mZMiss > 0) {
@@ -110,6 +113,9 @@ void Results::PrintEndSummary() {
         LOGGER("#Sd For Nu: " << this->mFisherMatrix[2])
         VERBOSE("#Fisher Execution Time: " << this->mTotalFisherTime)
     }
+    if (this->mTraceEstimatorStandardError >= 0) {
+        LOGGER("#Stochastic Trace Relative Standard Error: " << this->mTraceEstimatorStandardError)
+    }
     LOGGER("*************************************************")
     Configurations::SetVerbosity(temp);
 }
@@ -224,6 +230,18 @@ void Results::SetPredictedMissedValues(vector<double> aPredictedValues) {
     this->mPredictedMissedValues = std::move(aPredictedValues);
 }
 
+void Results::SetPredictedVariances(vector<double> aPredictedVariances) {
+    this->mPredictedVariances = std::move(aPredictedVariances);
+}
+
+void Results::SetMixedPrecisionDeviation(double aDeviation) {
+    this->mMixedPrecisionDeviation = aDeviation;
+}
+
+void Results::SetTraceEstimatorStandardError(double aStandardError) {
+    this->mTraceEstimatorStandardError = aStandardError;
+}
+
 double Results::GetMLOE() const {
     return this->mMLOE;
 }
@@ -240,6 +258,10 @@ double Results::GetMMOM() const {
     return this->mMMOM;
 }
 
+double Results::GetTraceEstimatorStandardError() const {
+    return this->mTraceEstimatorStandardError;
+}
+
 std::vector<double> Results::GetFisherMatrix() const {
     return this->mFisherMatrix;
 }
@@ -248,4 +270,8 @@ std::vector<double> Results::GetPredictedMissedValues() const {
     return this->mPredictedMissedValues;
 }
 
+std::vector<double> Results::GetPredictedVariances() const {
+    return this->mPredictedVariances;
+}
+
 Results *Results::mpInstance = nullptr;
@@ -26,11 +26,32 @@ void RuntimeFunctions<T>::CovarianceMatrix(DescriptorData<T> &aDescriptorData, v
                                            T *apLocalTheta, const int &aDistanceMetric,
                                            const kernels::Kernel<T> *apKernel, void *apContext) {}
 
+template<typename T>
+void RuntimeFunctions<T>::MixedPrecisionCovarianceMatrix(DescriptorData<T> &aDescriptorData, void *apDescriptor,
+                                                         void *apSingleDescriptor, void *apDistanceDescriptor,
+                                                         const int &aBand, Locations<T> *apLocation1,
+                                                         Locations<T> *apLocation2, Locations<T> *apLocation3,
+                                                         T *apLocalTheta, const int &aDistanceMetric,
+                                                         const kernels::Kernel<T> *apKernel) {}
+
+template<typename T>
+void RuntimeFunctions<T>::CovarianceMatrixProduct(DescriptorData<T> &aDescriptorData, void *apDescriptorX,
+                                                  void *apDescriptorY, Locations<T> *apLocation1,
+                                                  Locations<T> *apLocation2, Locations<T> *apLocation3,
+                                                  T *apLocalTheta, const int &aDistanceMetric,
+                                                  const kernels::Kernel<T> *apKernel) {}
+
 template<typename T>
 void RuntimeFunctions<T>::ExaGeoStatMLETileAsyncMLOEMMOM(void *apDescExpr1, void *apDescExpr2, void *apDescExpr3,
-                                                         void *apDescMLOE, void *apDescMMOM, void *apSequence,
+                                                         void *apDescMLOE, void *apDescMMOM,
+                                                         const int &aVariablesNumber, void *apSequence,
                                                          void *apRequest, void *apContext) {}
 
+template<typename T>
+void RuntimeFunctions<T>::ExaGeoStatBlockCrossProductTileAsync(void *apDescA, void *apDescB, void *apDescC,
+                                                               const int &aBlockSize, void *apSequence,
+                                                               void *apRequest, void *apContext) {}
+
 template<typename T>
 void RuntimeFunctions<T>::ExaGeoStatMLEMSPETileAsync(void *apDescZPredict, void *apDescZMiss, void *apDescError,
                                                      void *apSequence, void *apRequest, void *apContext) {}
@@ -39,6 +60,10 @@ template<typename T>
 void RuntimeFunctions<T>::CopyDescriptorZ(DescriptorData<T> &aDescriptorData, void *apDescriptor, T *apDoubleVector,
                                           void *apContext) {}
 
+template<typename T>
+void RuntimeFunctions<T>::GenerateNormalDescriptor(DescriptorData<T> &aDescriptorData, void *apDescriptor,
+                                                   const int &aSeed, void *apContext) {}
+
 template<typename T>
 void
 RuntimeFunctions<T>::ExaGeoStatGaussianToNonTileAsync(DescriptorData<T> &aDescriptorData, void *apDesc, T *apTheta,
@@ -63,6 +88,11 @@ void
 RuntimeFunctions<T>::ExaGeoStatMLETraceTileAsync(void *apDescA, void *apSequence, void *apRequest, void *apDescNum,
                                                  void *apDescTrace, void *apContext) {}
 
+template<typename T>
+void
+RuntimeFunctions<T>::ExaGeoStatFrobeniusProductTileAsync(void *apDescA, void *apDescB, void *apDescProduct,
+                                                         void *apSequence, void *apRequest, void *apContext) {}
+
 template<typename T>
 void
 RuntimeFunctions<T>::ExaGeoStatDoubleDotProduct(void *apDescA, void *apDescProduct, void *apSequence,
@@ -85,3 +115,9 @@ void
 RuntimeFunctions<T>::ExaGeoStatNonGaussianTransformTileAsync(const Computation &aComputation, void *apDescZ,
                                                              const T *apTheta,
                                                              void *apSequence, void *apRequest, void *apContext) {}
+
+template<typename T>
+void
+RuntimeFunctions<T>::ExaGeoStatNonGaussianPredictTileAsync(const Computation &aComputation, void *apDescZMiss,
+                                                           void *apDescExplainedVariance, const T *apTheta,
+                                                           void *apSequence, void *apRequest, void *apContext) {}
@@ -44,17 +44,120 @@ void RuntimeFunctions<T>::CovarianceMatrix(dataunits::DescriptorData<T> &aDescri
 
 }
 
+template<typename T>
+void RuntimeFunctions<T>::CovarianceMatrix(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptor,
+                                           void *apDistanceDescriptor, const int &aTriangularPart,
+                                           dataunits::Locations<T> *apLocation1, dataunits::Locations<T> *apLocation2,
+                                           T *apLocalTheta, const int &aDistanceMetric,
+                                           const kernels::Kernel<T> *apKernel) {
+
+    auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
+    auto *pOptions = starpu_helper->GetOptions();
+    starpu_helper->ExaGeoStatOptionsInit(pOptions, aDescriptorData.GetSequence(),
+                                         aDescriptorData.GetRequest());
+
+    DCMGCodelet<T> cl;
+    cl.InsertTask(apDescriptor, apDistanceDescriptor, aTriangularPart, apLocation1, apLocation2, apLocalTheta,
+                  aDistanceMetric, apKernel);
+
+    starpu_helper->ExaGeoStatOptionsFree(pOptions);
+    starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
+    starpu_helper->DeleteOptions(pOptions);
+}
+
+template<typename T>
+void RuntimeFunctions<T>::MixedPrecisionCovarianceMatrix(dataunits::DescriptorData<T> &aDescriptorData,
+                                                         void *apDescriptor, void *apSingleDescriptor,
+                                                         void *apDistanceDescriptor, const int &aBand,
+                                                         dataunits::Locations<T> *apLocation1,
+                                                         dataunits::Locations<T> *apLocation2,
+                                                         dataunits::Locations<T> *apLocation3, T *apLocalTheta,
+                                                         const int &aDistanceMetric,
+                                                         const kernels::Kernel<T> *apKernel) {
+
+    auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
+    auto *pOptions = starpu_helper->GetOptions();
+    starpu_helper->ExaGeoStatOptionsInit(pOptions, aDescriptorData.GetSequence(),
+                                         aDescriptorData.GetRequest());
+
+    DCMGCodelet<T> cl;
+    cl.InsertMixedPrecisionTask(apDescriptor, apSingleDescriptor, apDistanceDescriptor, aBand, apLocation1,
+                                apLocation2, apLocation3, apLocalTheta, aDistanceMetric, apKernel);
+
+    starpu_helper->ExaGeoStatOptionsFree(pOptions);
+    starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
+    starpu_helper->DeleteOptions(pOptions);
+}
+
+template<typename T>
+void RuntimeFunctions<T>::CovarianceMatrixProduct(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptorX,
+                                                  void *apDescriptorY, dataunits::Locations<T> *apLocation1,
+                                                  dataunits::Locations<T> *apLocation2,
+                                                  dataunits::Locations<T> *apLocation3, T *apLocalTheta,
+                                                  const int &aDistanceMetric, const kernels::Kernel<T> *apKernel) {
+
+    auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
+    auto *pOptions = starpu_helper->GetOptions();
+    starpu_helper->ExaGeoStatOptionsInit(pOptions, aDescriptorData.GetSequence(),
+                                         aDescriptorData.GetRequest());
+
+    DCMMCodelet<T> cl;
+    cl.InsertTask(apDescriptorX, apDescriptorY, apLocation1, apLocation2, apLocation3, apLocalTheta, aDistanceMetric,
+                  apKernel);
+
+    starpu_helper->ExaGeoStatOptionsFree(pOptions);
+    starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
+    starpu_helper->DeleteOptions(pOptions);
+}
+
+template<typename T>
+void RuntimeFunctions<T>::DistanceMatrix(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptor,
+                                         const int &aTriangularPart, dataunits::Locations<T> *apLocation1,
+                                         dataunits::Locations<T> *apLocation2, const int &aDistanceMetric) {
+
+    auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
+    auto *pOptions = starpu_helper->GetOptions();
+    starpu_helper->ExaGeoStatOptionsInit(pOptions, aDescriptorData.GetSequence(),
+                                         aDescriptorData.GetRequest());
+
+    DDISTCodelet<T> cl;
+    cl.InsertTask(apDescriptor, aTriangularPart, apLocation1, apLocation2, aDistanceMetric);
+
+    starpu_helper->ExaGeoStatOptionsFree(pOptions);
+    starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
+    starpu_helper->DeleteOptions(pOptions);
+}
+
 template<typename T>
 void RuntimeFunctions<T>::ExaGeoStatMLETileAsyncMLOEMMOM(void *apDescExpr1, void *apDescExpr2, void *apDescExpr3,
-                                                         void *apDescMLOE,
-                                                         void *apDescMMOM, void *apSequence, void *apRequest) {
+                                                         void *apDescMLOE, void *apDescMMOM,
+                                                         const int &aVariablesNumber, void *apSequence,
+                                                         void *apRequest, const bool &aIsDeterministic) {
 
     auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
     auto *pOptions = starpu_helper->GetOptions();
     starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
 
     DmloeMmomCodelet<T> cl;
-    cl.InsertTask(apDescExpr1, apDescExpr2, apDescExpr3, apDescMLOE, apDescMMOM);
+    cl.InsertTask(apDescExpr1, apDescExpr2, apDescExpr3, apDescMLOE, apDescMMOM, aVariablesNumber, aIsDeterministic);
+
+    starpu_helper->ExaGeoStatOptionsFree(pOptions);
+    starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
+    starpu_helper->DeleteOptions(pOptions);
+
+}
+
+template<typename T>
+void RuntimeFunctions<T>::ExaGeoStatBlockCrossProductTileAsync(void *apDescA, void *apDescB, void *apDescC,
+                                                               const int &aBlockSize, void *apSequence,
+                                                               void *apRequest) {
+
+    auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
+    auto *pOptions = starpu_helper->GetOptions();
+    starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
+
+    DCROSSCodelet<T> cl;
+    cl.InsertTask(apDescA, apDescB, apDescC, aBlockSize);
 
     starpu_helper->ExaGeoStatOptionsFree(pOptions);
     starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
@@ -64,15 +167,15 @@ void RuntimeFunctions<T>::ExaGeoStatMLETileAsyncMLOEMMOM(void *apDescExpr1, void
 
 template<typename T>
 void RuntimeFunctions<T>::ExaGeoStatMLEMSPETileAsync(void *apDescZPredict, void *apDescZMiss, void *apDescError,
-                                                     void *apSequence,
-                                                     void *apRequest) {
+                                                     void *apSequence, void *apRequest,
+                                                     const bool &aIsDeterministic) {
 
     auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
     auto *pOptions = starpu_helper->GetOptions();
     starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
 
     DMSECodelet<T> cl;
-    cl.InsertTask(apDescError, apDescZPredict, apDescZMiss);
+    cl.InsertTask(apDescError, apDescZPredict, apDescZMiss, aIsDeterministic);
 
     starpu_helper->ExaGeoStatOptionsFree(pOptions);
     starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
@@ -98,6 +201,24 @@ void RuntimeFunctions<T>::CopyDescriptorZ(dataunits::DescriptorData<T> &aDescrip
 
 }
 
+template<typename T>
+void RuntimeFunctions<T>::GenerateNormalDescriptor(dataunits::DescriptorData<T> &aDescriptorData, void *apDescriptor,
+                                                   const int &aSeed) {
+
+    auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
+    auto *pOptions = starpu_helper->GetOptions();
+    starpu_helper->ExaGeoStatOptionsInit(pOptions, aDescriptorData.GetSequence(),
+                                         aDescriptorData.GetRequest());
+
+    DNORMALCodelet<T> cl;
+    cl.InsertTask(apDescriptor, aSeed);
+
+    starpu_helper->ExaGeoStatOptionsFree(pOptions);
+    starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
+    starpu_helper->DeleteOptions(pOptions);
+
+}
+
 template<typename T>
 void RuntimeFunctions<T>::ExaGeoStatGaussianToNonTileAsync(dataunits::DescriptorData<T> &aDescriptorData, void *apDesc,
                                                            T *apTheta) {
@@ -120,13 +241,13 @@ template<typename T>
 void
 RuntimeFunctions<T>::ExaGeoStatMeasureDetTileAsync(const common::Computation &aComputation, void *apDescA,
                                                    void *apSequence, void *apRequest,
-                                                   void *apDescDet) {
+                                                   void *apDescDet, const bool &aIsDeterministic) {
     auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(aComputation);
     auto *pOptions = starpu_helper->GetOptions();
     starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
 
     DMDETCodelet<T> cl;
-    cl.InsertTask(aComputation, apDescA, apDescDet, starpu_helper);
+    cl.InsertTask(aComputation, apDescA, apDescDet, starpu_helper, aIsDeterministic);
 
     starpu_helper->ExaGeoStatOptionsFree(pOptions);
     starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
@@ -171,14 +292,56 @@ void RuntimeFunctions<T>::ExaGeoStaStrideVectorTileAsync(void *apDescA, void *ap
 
 template<typename T>
 void RuntimeFunctions<T>::ExaGeoStatMLETraceTileAsync(void *apDescA, void *apSequence, void *apRequest, void *apDescNum,
-                                                      void *apDescTrace) {
+                                                      void *apDescTrace, const bool &aIsDeterministic) {
 
     auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
     auto *pOptions = starpu_helper->GetOptions();
     starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
 
     DTRACECodelet<T> cl;
-    cl.InsertTask(apDescA, apDescNum, apDescTrace);
+    cl.InsertTask(apDescA, apDescNum, apDescTrace, aIsDeterministic);
+
+    starpu_helper->ExaGeoStatOptionsFree(pOptions);
+    starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
+    starpu_helper->DeleteOptions(pOptions);
+
+}
+
+template<typename T>
+void RuntimeFunctions<T>::ExaGeoStatVecchiaLogLikelihoodTileAsync(const int &aN, const int &aNeighborsNumber,
+                                                                  const int *apNeighbors, Locations<T> *apLocations,
+                                                                  Locations<T> *apMedianLocations, T *apZ,
+                                                                  T *apLocalTheta, const int &aDistanceMetric,
+                                                                  const kernels::Kernel<T> *apKernel,
+                                                                  const int &aBlockSize, void *apDescDet,
+                                                                  void *apDescProduct, void *apSequence,
+                                                                  void *apRequest, const bool &aIsDeterministic) {
+
+    auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(VECCHIA_APPROX);
+    auto *pOptions = starpu_helper->GetOptions();
+    starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
+
+    DVECCHIACodelet<T> cl;
+    cl.InsertTask(aN, aNeighborsNumber, apNeighbors, apLocations, apMedianLocations, apZ, apLocalTheta,
+                  aDistanceMetric, apKernel, aBlockSize, apDescDet, apDescProduct, aIsDeterministic);
+
+    starpu_helper->ExaGeoStatOptionsFree(pOptions);
+    starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
+    starpu_helper->DeleteOptions(pOptions);
+
+}
+
+template<typename T>
+void RuntimeFunctions<T>::ExaGeoStatFrobeniusProductTileAsync(void *apDescA, void *apDescB, void *apDescProduct,
+                                                              void *apSequence, void *apRequest,
+                                                              const bool &aIsDeterministic) {
+
+    auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
+    auto *pOptions = starpu_helper->GetOptions();
+    starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
+
+    DFROBENIUSCodelet<T> cl;
+    cl.InsertTask(apDescA, apDescB, apDescProduct, aIsDeterministic);
 
     starpu_helper->ExaGeoStatOptionsFree(pOptions);
     starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
@@ -188,14 +351,15 @@ void RuntimeFunctions<T>::ExaGeoStatMLETraceTileAsync(void *apDescA, void *apSeq
 
 template<typename T>
 void
-RuntimeFunctions<T>::ExaGeoStatDoubleDotProduct(void *apDescA, void *apDescProduct, void *apSequence, void *apRequest) {
+RuntimeFunctions<T>::ExaGeoStatDoubleDotProduct(void *apDescA, void *apDescProduct, void *apSequence, void *apRequest,
+                                                const bool &aIsDeterministic) {
 
     auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
     auto *pOptions = starpu_helper->GetOptions();
     starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
 
     DDOTPCodelet<T> cl;
-    cl.InsertTask(apDescA, apDescProduct);
+    cl.InsertTask(apDescA, apDescProduct, aIsDeterministic);
 
     starpu_helper->ExaGeoStatOptionsFree(pOptions);
     starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
@@ -206,13 +370,14 @@ RuntimeFunctions<T>::ExaGeoStatDoubleDotProduct(void *apDescA, void *apDescProdu
 template<typename T>
 void RuntimeFunctions<T>::ExaGeoStatMLEMSPEBivariateTileAsync(void *apDescZPre, void *apDescZMiss, void *apDescError1,
                                                               void *apDescError2,
-                                                              void *apDescError, void *apSequence, void *apRequest) {
+                                                              void *apDescError, void *apSequence, void *apRequest,
+                                                              const bool &aIsDeterministic) {
     auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(EXACT_DENSE);
     auto *pOptions = starpu_helper->GetOptions();
     starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
 
     DMSEBivariateCodelet<T> cl;
-    cl.InsertTask(apDescZPre, apDescError, apDescError1, apDescError2, apDescZMiss);
+    cl.InsertTask(apDescZPre, apDescError, apDescError1, apDescError2, apDescZMiss, aIsDeterministic);
 
     starpu_helper->ExaGeoStatOptionsFree(pOptions);
     starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
@@ -223,14 +388,15 @@ void RuntimeFunctions<T>::ExaGeoStatMLEMSPEBivariateTileAsync(void *apDescZPre,
 template<typename T>
 void RuntimeFunctions<T>::ExaGeoStatNonGaussianLogLikeTileAsync(const common::Computation &aComputation, void *apDescZ,
                                                                 void *apDescSum,
-                                                                const T *apTheta, void *apSequence, void *apRequest) {
+                                                                const T *apTheta, void *apSequence, void *apRequest,
+                                                                const bool &aIsDeterministic) {
 
     auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(aComputation);
     void *pOptions = starpu_helper->GetOptions();
     starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
 
     NonGaussianLoglike<T> cl;
-    cl.InsertTask(apDescZ, apDescSum, apTheta, starpu_helper);
+    cl.InsertTask(apDescZ, apDescSum, apTheta, starpu_helper, aIsDeterministic);
 
     starpu_helper->ExaGeoStatOptionsFree(pOptions);
     starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
@@ -256,3 +422,22 @@ RuntimeFunctions<T>::ExaGeoStatNonGaussianTransformTileAsync(const common::Compu
     starpu_helper->DeleteOptions(pOptions);
 
 }
+
+template<typename T>
+void
+RuntimeFunctions<T>::ExaGeoStatNonGaussianPredictTileAsync(const common::Computation &aComputation, void *apDescZMiss,
+                                                           void *apDescExplainedVariance, const T *apTheta,
+                                                           void *apSequence, void *apRequest) {
+
+    auto starpu_helper = StarPuHelpersFactory::CreateStarPuHelper(aComputation);
+    void *pOptions = starpu_helper->GetOptions();
+    starpu_helper->ExaGeoStatOptionsInit(pOptions, apSequence, apRequest);
+
+    NonGaussianPredict<T> cl;
+    cl.InsertTask(apDescZMiss, apDescExplainedVariance, apTheta, starpu_helper);
+
+    starpu_helper->ExaGeoStatOptionsFree(pOptions);
+    starpu_helper->ExaGeoStatOptionsFinalize(pOptions);
+    starpu_helper->DeleteOptions(pOptions);
+
+}
@@ -12,6 +12,8 @@
  * @date 2024-02-19
 **/
 
+#include <vector>
+
 #include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
 #include <runtime/starpu/concrete/dcmg-codelet.hpp>
 
@@ -37,6 +39,46 @@ struct starpu_codelet DCMGCodelet<T>::cl_dcmg = {
         .name         = "dcmg"
 };
 
+template<typename T>
+struct starpu_codelet DCMGCodelet<T>::cl_dcmg_distances = {
+#ifdef USE_CUDA
+        .where= STARPU_CPU | STARPU_CUDA,
+        .cpu_funcs={cl_dcmg_distances_function},
+        .cuda_funcs={},
+        .cuda_flags={0},
+#else
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dcmg_distances_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+#endif
+        .nbuffers     = 2,
+        .modes        = {STARPU_W, STARPU_R},
+        .name         = "dcmg_distances"
+};
+
+template<typename T>
+struct starpu_codelet DCMGCodelet<T>::cl_dcmg_single = {
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dcmg_single_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+        .nbuffers     = 1,
+        .modes        = {STARPU_W},
+        .name         = "dcmg_single"
+};
+
+template<typename T>
+struct starpu_codelet DCMGCodelet<T>::cl_dcmg_single_distances = {
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dcmg_single_distances_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+        .nbuffers     = 2,
+        .modes        = {STARPU_W, STARPU_R},
+        .name         = "dcmg_single_distances"
+};
+
 template<typename T>
 void DCMGCodelet<T>::InsertTask(void *apDescriptor, const int &aTriangularPart, Locations<T> *apLocation1,
                                 Locations<T> *apLocation2, Locations<T> *apLocation3, T *apLocalTheta,
@@ -66,7 +108,95 @@ void DCMGCodelet<T>::InsertTask(void *apDescriptor, const int &aTriangularPart,
                                STARPU_VALUE, &apLocation1, sizeof(Locations<T> *),
                                STARPU_VALUE, &apLocation2, sizeof(Locations<T> *),
                                STARPU_VALUE, &apLocation3, sizeof(Locations<T> *),
-                               STARPU_VALUE, &apLocalTheta, sizeof(double *),
+                               STARPU_VALUE, &apLocalTheta, sizeof(T *),
+                               STARPU_VALUE, &aDistanceMetric, sizeof(int),
+                               STARPU_VALUE, &apKernel, sizeof(kernels::Kernel<T> *),
+                               0);
+        }
+    }
+}
+
+template<typename T>
+void DCMGCodelet<T>::InsertTask(void *apDescriptor, void *apDistanceDescriptor, const int &aTriangularPart,
+                                Locations<T> *apLocation1, Locations<T> *apLocation2, T *apLocalTheta,
+                                const int &aDistanceMetric, const Kernel<T> *apKernel) {
+    int rows_num, cols_num, row, col;
+    auto *CHAM_apDescriptor = (CHAM_desc_t *) apDescriptor;
+    auto *CHAM_apDistanceDescriptor = (CHAM_desc_t *) apDistanceDescriptor;
+
+    for (col = 0; col < CHAM_apDescriptor->nt; col++) {
+        cols_num = col == CHAM_apDescriptor->nt - 1 ? CHAM_apDescriptor->n - col * CHAM_apDescriptor->nb
+                                                    : CHAM_apDescriptor->nb;
+        if (aTriangularPart == ChamUpperLower) {
+            row = 0;
+        } else {
+            row = CHAM_apDescriptor->m == CHAM_apDescriptor->n ? col : 0;
+        }
+        for (; row < CHAM_apDescriptor->mt; row++) {
+            rows_num = row == CHAM_apDescriptor->mt - 1 ? CHAM_apDescriptor->m - row * CHAM_apDescriptor->mb
+                                                        : CHAM_apDescriptor->mb;
+            starpu_insert_task(&this->cl_dcmg_distances,
+                               STARPU_VALUE, &rows_num, sizeof(int),
+                               STARPU_VALUE, &cols_num, sizeof(int),
+                               STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr(CHAM_apDescriptor, row, col),
+                               STARPU_R,
+                               (starpu_data_handle_t) RUNTIME_data_getaddr(CHAM_apDistanceDescriptor, row, col),
+                               STARPU_VALUE, &apLocation1, sizeof(Locations<T> *),
+                               STARPU_VALUE, &apLocation2, sizeof(Locations<T> *),
+                               STARPU_VALUE, &apLocalTheta, sizeof(T *),
+                               STARPU_VALUE, &aDistanceMetric, sizeof(int),
+                               STARPU_VALUE, &apKernel, sizeof(kernels::Kernel<T> *),
+                               0);
+        }
+    }
+}
+
+template<typename T>
+void DCMGCodelet<T>::InsertMixedPrecisionTask(void *apDescriptor, void *apSingleDescriptor,
+                                              void *apDistanceDescriptor, const int &aBand,
+                                              Locations<T> *apLocation1, Locations<T> *apLocation2,
+                                              Locations<T> *apLocation3, T *apLocalTheta, const int &aDistanceMetric,
+                                              const Kernel<T> *apKernel) {
+    int rows_num, cols_num, row, col, tile_row, tile_col;
+    auto *CHAM_apDescriptor = (CHAM_desc_t *) apDescriptor;
+    auto *CHAM_apSingleDescriptor = (CHAM_desc_t *) apSingleDescriptor;
+    auto *CHAM_apDistanceDescriptor = (CHAM_desc_t *) apDistanceDescriptor;
+
+    for (col = 0; col < CHAM_apDescriptor->nt; col++) {
+        cols_num = col == CHAM_apDescriptor->nt - 1 ? CHAM_apDescriptor->n - col * CHAM_apDescriptor->nb
+                                                    : CHAM_apDescriptor->nb;
+        for (row = col; row < CHAM_apDescriptor->mt; row++) {
+            rows_num = row == CHAM_apDescriptor->mt - 1 ? CHAM_apDescriptor->m - row * CHAM_apDescriptor->mb
+                                                        : CHAM_apDescriptor->mb;
+            bool is_in_band = row - col < aBand;
+            auto *pTarget = is_in_band ? CHAM_apDescriptor : CHAM_apSingleDescriptor;
+            if (CHAM_apDistanceDescriptor != nullptr) {
+                starpu_insert_task(is_in_band ? &this->cl_dcmg_distances : &this->cl_dcmg_single_distances,
+                                   STARPU_VALUE, &rows_num, sizeof(int),
+                                   STARPU_VALUE, &cols_num, sizeof(int),
+                                   STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr(pTarget, row, col),
+                                   STARPU_R,
+                                   (starpu_data_handle_t) RUNTIME_data_getaddr(CHAM_apDistanceDescriptor, row, col),
+                                   STARPU_VALUE, &apLocation1, sizeof(Locations<T> *),
+                                   STARPU_VALUE, &apLocation2, sizeof(Locations<T> *),
+                                   STARPU_VALUE, &apLocalTheta, sizeof(T *),
+                                   STARPU_VALUE, &aDistanceMetric, sizeof(int),
+                                   STARPU_VALUE, &apKernel, sizeof(kernels::Kernel<T> *),
+                                   0);
+                continue;
+            }
+            tile_row = row * CHAM_apDescriptor->mb;
+            tile_col = col * CHAM_apDescriptor->nb;
+            starpu_insert_task(is_in_band ? &this->cl_dcmg : &this->cl_dcmg_single,
+                               STARPU_VALUE, &rows_num, sizeof(int),
+                               STARPU_VALUE, &cols_num, sizeof(int),
+                               STARPU_VALUE, &tile_row, sizeof(int),
+                               STARPU_VALUE, &tile_col, sizeof(int),
+                               STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr(pTarget, row, col),
+                               STARPU_VALUE, &apLocation1, sizeof(Locations<T> *),
+                               STARPU_VALUE, &apLocation2, sizeof(Locations<T> *),
+                               STARPU_VALUE, &apLocation3, sizeof(Locations<T> *),
+                               STARPU_VALUE, &apLocalTheta, sizeof(T *),
                                STARPU_VALUE, &aDistanceMetric, sizeof(int),
                                STARPU_VALUE, &apKernel, sizeof(kernels::Kernel<T> *),
                                0);
@@ -85,6 +215,63 @@ void DCMGCodelet<T>::cl_dcmg_function(void *apBuffers[], void *apCodeletArgument
     starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num, &tile_row, &tile_col, &pLocation1, &pLocation2,
                                &pLocation3, &pLocal_theta,
                                &distance_metric, &pKernel);
-    pKernel->GenerateCovarianceMatrix(pDescriptor_A, rows_num, cols_num, tile_row, tile_col, *pLocation1, *pLocation2,
-                                      *pLocation3, pLocal_theta, distance_metric);
+    pKernel->GenerateCovarianceTile(pDescriptor_A, rows_num, cols_num, tile_row, tile_col, *pLocation1, *pLocation2,
+                                    *pLocation3, pLocal_theta, distance_metric);
+}
+
+template<typename T>
+void DCMGCodelet<T>::cl_dcmg_distances_function(void *apBuffers[], void *apCodeletArguments) {
+    int rows_num, cols_num, distance_metric;
+    Locations<T> *pLocation1, *pLocation2;
+    T *pLocal_theta, *pDescriptor_A, *pDescriptor_D;
+    Kernel<T> *pKernel;
+
+    pDescriptor_A = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    pDescriptor_D = (T *) STARPU_MATRIX_GET_PTR(apBuffers[1]);
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num, &pLocation1, &pLocation2, &pLocal_theta,
+                               &distance_metric, &pKernel);
+    pKernel->GenerateCovarianceTileFromDistances(pDescriptor_A, pDescriptor_D, rows_num, cols_num, *pLocation1,
+                                                 *pLocation2, pLocal_theta, distance_metric);
+}
+
+template<typename T>
+void DCMGCodelet<T>::cl_dcmg_single_function(void *apBuffers[], void *apCodeletArguments) {
+    int rows_num, cols_num, tile_row, tile_col, distance_metric;
+    Locations<T> *pLocation1, *pLocation2, *pLocation3;
+    T *pLocal_theta;
+    float *pDescriptor_A;
+    Kernel<T> *pKernel;
+    // The tile is generated in the precision of the kernel, only one tile per worker at a time.
+    thread_local std::vector<T> tile;
+
+    pDescriptor_A = (float *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num, &tile_row, &tile_col, &pLocation1, &pLocation2,
+                               &pLocation3, &pLocal_theta, &distance_metric, &pKernel);
+    tile.resize((size_t) rows_num * cols_num);
+    pKernel->GenerateCovarianceTile(tile.data(), rows_num, cols_num, tile_row, tile_col, *pLocation1, *pLocation2,
+                                    *pLocation3, pLocal_theta, distance_metric);
+    for (size_t i = 0; i < tile.size(); i++) {
+        pDescriptor_A[i] = (float) tile[i];
+    }
+}
+
+template<typename T>
+void DCMGCodelet<T>::cl_dcmg_single_distances_function(void *apBuffers[], void *apCodeletArguments) {
+    int rows_num, cols_num, distance_metric;
+    Locations<T> *pLocation1, *pLocation2;
+    T *pLocal_theta, *pDescriptor_D;
+    float *pDescriptor_A;
+    Kernel<T> *pKernel;
+    thread_local std::vector<T> tile;
+
+    pDescriptor_A = (float *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    pDescriptor_D = (T *) STARPU_MATRIX_GET_PTR(apBuffers[1]);
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num, &pLocation1, &pLocation2, &pLocal_theta,
+                               &distance_metric, &pKernel);
+    tile.resize((size_t) rows_num * cols_num);
+    pKernel->GenerateCovarianceTileFromDistances(tile.data(), pDescriptor_D, rows_num, cols_num, *pLocation1,
+                                                 *pLocation2, pLocal_theta, distance_metric);
+    for (size_t i = 0; i < tile.size(); i++) {
+        pDescriptor_A[i] = (float) tile[i];
+    }
 }
@@ -0,0 +1,111 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dcmm-codelet.cpp
+ * @brief A class for starpu codelet dcmm.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <starpu.h>
+
+#include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
+#include <runtime/starpu/concrete/dcmm-codelet.hpp>
+
+using namespace exageostat::runtime;
+using namespace exageostat::dataunits;
+using namespace exageostat::kernels;
+
+template<typename T>
+struct starpu_codelet DCMMCodelet<T>::cl_dcmm = {
+#ifdef USE_CUDA
+        .where= STARPU_CPU | STARPU_CUDA,
+        .cpu_funcs={cl_dcmm_function},
+        .cuda_funcs={},
+        .cuda_flags={0},
+#else
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dcmm_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+#endif
+        .nbuffers     = 2,
+        .modes        = {STARPU_R, STARPU_RW},
+        .name         = "dcmm"
+};
+
+template<typename T>
+void DCMMCodelet<T>::InsertTask(void *apDescX, void *apDescY, Locations<T> *apLocation1, Locations<T> *apLocation2,
+                                Locations<T> *apLocation3, T *apLocalTheta, const int &aDistanceMetric,
+                                const Kernel<T> *apKernel) {
+    int row, inner, col, rows_num, inner_num, cols_num, tile_row, tile_col, is_first;
+    auto pDescriptor_X = (CHAM_desc_t *) apDescX;
+
+    // Each output tile accumulates the products of its tile row of C in order.
+    for (col = 0; col < pDescriptor_X->nt; col++) {
+        cols_num = col == pDescriptor_X->nt - 1 ? pDescriptor_X->n - col * pDescriptor_X->nb : pDescriptor_X->nb;
+        for (row = 0; row < pDescriptor_X->mt; row++) {
+            rows_num = row == pDescriptor_X->mt - 1 ? pDescriptor_X->m - row * pDescriptor_X->mb : pDescriptor_X->mb;
+            for (inner = 0; inner < pDescriptor_X->mt; inner++) {
+                inner_num = inner == pDescriptor_X->mt - 1 ? pDescriptor_X->m - inner * pDescriptor_X->mb
+                                                           : pDescriptor_X->mb;
+                tile_row = row * pDescriptor_X->mb;
+                tile_col = inner * pDescriptor_X->mb;
+                is_first = inner == 0;
+                starpu_insert_task(&this->cl_dcmm,
+                                   STARPU_VALUE, &rows_num, sizeof(int),
+                                   STARPU_VALUE, &inner_num, sizeof(int),
+                                   STARPU_VALUE, &cols_num, sizeof(int),
+                                   STARPU_VALUE, &tile_row, sizeof(int),
+                                   STARPU_VALUE, &tile_col, sizeof(int),
+                                   STARPU_VALUE, &is_first, sizeof(int),
+                                   STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr(pDescriptor_X, inner, col),
+                                   STARPU_RW,
+                                   (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescY, row, col),
+                                   STARPU_VALUE, &apLocation1, sizeof(Locations<T> *),
+                                   STARPU_VALUE, &apLocation2, sizeof(Locations<T> *),
+                                   STARPU_VALUE, &apLocation3, sizeof(Locations<T> *),
+                                   STARPU_VALUE, &apLocalTheta, sizeof(T *),
+                                   STARPU_VALUE, &aDistanceMetric, sizeof(int),
+                                   STARPU_VALUE, &apKernel, sizeof(kernels::Kernel<T> *),
+                                   0);
+            }
+        }
+    }
+}
+
+template<typename T>
+void DCMMCodelet<T>::cl_dcmm_function(void **apBuffers, void *apCodeletArguments) {
+    int rows_num, inner_num, cols_num, tile_row, tile_col, is_first, distance_metric;
+    Locations<T> *pLocation1, *pLocation2, *pLocation3;
+    T *pLocal_theta, *pDescriptor_X, *pDescriptor_Y;
+    Kernel<T> *pKernel;
+
+    pDescriptor_X = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    pDescriptor_Y = (T *) STARPU_MATRIX_GET_PTR(apBuffers[1]);
+    int leading_dim_X = (int) STARPU_MATRIX_GET_LD(apBuffers[0]);
+    int leading_dim_Y = (int) STARPU_MATRIX_GET_LD(apBuffers[1]);
+
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &inner_num, &cols_num, &tile_row, &tile_col, &is_first,
+                               &pLocation1, &pLocation2, &pLocation3, &pLocal_theta, &distance_metric, &pKernel);
+
+    // The covariance tile only lives for the duration of the task.
+    auto *pCovariance = new T[rows_num * inner_num];
+    pKernel->GenerateCovarianceTile(pCovariance, rows_num, inner_num, tile_row, tile_col, *pLocation1, *pLocation2,
+                                    *pLocation3, pLocal_theta, distance_metric);
+    T beta = is_first ? 0 : 1;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, rows_num, cols_num, inner_num, 1,
+                    (float *) pCovariance, rows_num, (float *) pDescriptor_X, leading_dim_X, beta,
+                    (float *) pDescriptor_Y, leading_dim_Y);
+    } else {
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, rows_num, cols_num, inner_num, 1,
+                    (double *) pCovariance, rows_num, (double *) pDescriptor_X, leading_dim_X, beta,
+                    (double *) pDescriptor_Y, leading_dim_Y);
+    }
+    delete[] pCovariance;
+}
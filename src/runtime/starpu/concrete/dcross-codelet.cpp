@@ -0,0 +1,88 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dcross-codelet.cpp
+ * @brief A class for starpu codelet dcross.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <starpu.h>
+
+#include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
+#include <runtime/starpu/concrete/dcross-codelet.hpp>
+
+using namespace exageostat::runtime;
+
+template<typename T>
+struct starpu_codelet DCROSSCodelet<T>::cl_dcross = {
+#ifdef USE_CUDA
+        .where= STARPU_CPU | STARPU_CUDA,
+        .cpu_funcs={cl_dcross_function},
+        .cuda_funcs={},
+        .cuda_flags={0},
+#else
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dcross_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+#endif
+        .nbuffers     = 3,
+        .modes        = {STARPU_R, STARPU_R, STARPU_RW},
+        .name         = "dcross"
+};
+
+template<typename T>
+void DCROSSCodelet<T>::InsertTask(void *apDescA, void *apDescB, void *apDescC, const int &aBlockSize) {
+    int row, col, rows_num, cols_num, is_first;
+    auto pDescriptor_A = (CHAM_desc_t *) apDescA;
+
+    // Each column of tiles owns its output tile, the tile rows are accumulated into it in order.
+    for (col = 0; col < pDescriptor_A->nt; col++) {
+        cols_num = col == pDescriptor_A->nt - 1 ? pDescriptor_A->n - col * pDescriptor_A->nb : pDescriptor_A->nb;
+        for (row = 0; row < pDescriptor_A->mt; row++) {
+            rows_num = row == pDescriptor_A->mt - 1 ? pDescriptor_A->m - row * pDescriptor_A->mb : pDescriptor_A->mb;
+            is_first = row == 0;
+            starpu_insert_task(&this->cl_dcross,
+                               STARPU_VALUE, &rows_num, sizeof(int),
+                               STARPU_VALUE, &cols_num, sizeof(int),
+                               STARPU_VALUE, &aBlockSize, sizeof(int),
+                               STARPU_VALUE, &is_first, sizeof(int),
+                               STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr(pDescriptor_A, row, col),
+                               STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescB, row, col),
+                               STARPU_RW, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescC, 0, col),
+                               0);
+        }
+    }
+}
+
+template<typename T>
+void DCROSSCodelet<T>::cl_dcross_function(void **apBuffers, void *apCodeletArguments) {
+    int rows_num, cols_num, block_size, is_first;
+    T *pDescriptor_A, *pDescriptor_B, *pDescriptor_C;
+
+    pDescriptor_A = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    pDescriptor_B = (T *) STARPU_MATRIX_GET_PTR(apBuffers[1]);
+    pDescriptor_C = (T *) STARPU_MATRIX_GET_PTR(apBuffers[2]);
+    int leading_dim_A = (int) STARPU_MATRIX_GET_LD(apBuffers[0]);
+    int leading_dim_B = (int) STARPU_MATRIX_GET_LD(apBuffers[1]);
+    int leading_dim_C = (int) STARPU_MATRIX_GET_LD(apBuffers[2]);
+
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num, &block_size, &is_first);
+
+    for (int j = 0; j < cols_num; j++) {
+        // First column of the block holding column j.
+        int block_start = j - j % block_size;
+        for (int i = 0; i < block_size; i++) {
+            T sum = is_first ? 0 : pDescriptor_C[i + j * leading_dim_C];
+            for (int k = 0; k < rows_num; k++) {
+                sum += pDescriptor_A[k + (block_start + i) * leading_dim_A] * pDescriptor_B[k + j * leading_dim_B];
+            }
+            pDescriptor_C[i + j * leading_dim_C] = sum;
+        }
+    }
+}
@@ -0,0 +1,84 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file ddist-codelet.cpp
+ * @brief A class for starpu codelet ddist.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
+#include <runtime/starpu/concrete/ddist-codelet.hpp>
+
+using namespace exageostat::runtime;
+using namespace exageostat::dataunits;
+using namespace exageostat::helpers;
+
+template<typename T>
+struct starpu_codelet DDISTCodelet<T>::cl_ddist = {
+#ifdef USE_CUDA
+        .where= STARPU_CPU | STARPU_CUDA,
+        .cpu_funcs={cl_ddist_function},
+        .cuda_funcs={},
+        .cuda_flags={0},
+#else
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_ddist_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+#endif
+        .nbuffers     = 1,
+        .modes        = {STARPU_W},
+        .name         = "ddist"
+};
+
+template<typename T>
+void DDISTCodelet<T>::InsertTask(void *apDescriptor, const int &aTriangularPart, Locations<T> *apLocation1,
+                                 Locations<T> *apLocation2, const int &aDistanceMetric) {
+    int rows_num, cols_num, row, col, tile_row = 0, tile_col = 0;
+    auto *CHAM_apDescriptor = (CHAM_desc_t *) apDescriptor;
+
+    for (col = 0; col < CHAM_apDescriptor->nt; col++) {
+        cols_num = col == CHAM_apDescriptor->nt - 1 ? CHAM_apDescriptor->n - col * CHAM_apDescriptor->nb
+                                                    : CHAM_apDescriptor->nb;
+        if (aTriangularPart == ChamUpperLower) {
+            row = 0;
+        } else {
+            row = CHAM_apDescriptor->m == CHAM_apDescriptor->n ? col : 0;
+        }
+        for (; row < CHAM_apDescriptor->mt; row++) {
+            rows_num = row == CHAM_apDescriptor->mt - 1 ? CHAM_apDescriptor->m - row * CHAM_apDescriptor->mb
+                                                        : CHAM_apDescriptor->mb;
+            tile_row = row * CHAM_apDescriptor->mb;
+            tile_col = col * CHAM_apDescriptor->nb;
+            starpu_insert_task(&this->cl_ddist,
+                               STARPU_VALUE, &rows_num, sizeof(int),
+                               STARPU_VALUE, &cols_num, sizeof(int),
+                               STARPU_VALUE, &tile_row, sizeof(int),
+                               STARPU_VALUE, &tile_col, sizeof(int),
+                               STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr(CHAM_apDescriptor, row, col),
+                               STARPU_VALUE, &apLocation1, sizeof(Locations<T> *),
+                               STARPU_VALUE, &apLocation2, sizeof(Locations<T> *),
+                               STARPU_VALUE, &aDistanceMetric, sizeof(int),
+                               0);
+        }
+    }
+}
+
+template<typename T>
+void DDISTCodelet<T>::cl_ddist_function(void *apBuffers[], void *apCodeletArguments) {
+    int rows_num, cols_num, tile_row, tile_col, distance_metric;
+    Locations<T> *pLocation1, *pLocation2;
+    T *pDescriptor_D;
+
+    pDescriptor_D = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num, &tile_row, &tile_col, &pLocation1, &pLocation2,
+                               &distance_metric);
+    int flag = pLocation1->GetLocationZ() == nullptr ? 0 : 1;
+    DistanceCalculationHelpers<T>::CalculateTileDistances(pDescriptor_D, *pLocation1, *pLocation2, rows_num, cols_num,
+                                                          tile_row, tile_col, distance_metric, flag);
+}
@@ -16,6 +16,7 @@
 
 #include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
 #include <runtime/starpu/concrete/ddotp-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
 
 using namespace exageostat::runtime;
 
@@ -33,12 +34,12 @@ struct starpu_codelet DDOTPCodelet<T>::cl_ddotp = {
         .cuda_flags={(0)},
 #endif
         .nbuffers     = 2,
-        .modes        = {STARPU_W, STARPU_W},
+        .modes        = {STARPU_REDUX, STARPU_R},
         .name         = "ddotp"
 };
 
 template<typename T>
-void DDOTPCodelet<T>::InsertTask(void *apDescA, void *apDescProduct) {
+void DDOTPCodelet<T>::InsertTask(void *apDescA, void *apDescProduct, const bool &aIsDeterministic) {
 
     int row, rows_num;
     auto pDesc_A = (CHAM_desc_t *) apDescA;
@@ -47,16 +48,18 @@ void DDOTPCodelet<T>::InsertTask(void *apDescA, void *apDescProduct) {
     auto desc_mt = pDesc_A->mt;
     auto desc_m = pDesc_A->m;
     auto desc_mb = pDesc_A->mb;
+    DREDUXCodelet<T> product_reduction(RUNTIME_data_getaddr(pDesc_product, 0, 0), desc_mt, aIsDeterministic);
 
     for (row = 0; row < desc_mt; row++) {
         rows_num = row == desc_mt - 1 ? desc_m - row * desc_mb : desc_mb;
 
         starpu_insert_task(&this->cl_ddotp,
                            STARPU_VALUE, &rows_num, sizeof(int),
-                           STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr(pDesc_product, 0, 0),
-                           STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr(pDesc_A, row, 0),
+                           STARPU_REDUX, (starpu_data_handle_t) product_reduction.GetHandle(row),
+                           STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr(pDesc_A, row, 0),
                            0);
     }
+    product_reduction.InsertTask();
 }
 
 template<typename T>
@@ -67,6 +70,11 @@ void DDOTPCodelet<T>::cl_ddotp_function(void *apBuffers[], void *apCodeletArgume
     pDot_product = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
     pDescriptor_A = (T *) STARPU_MATRIX_GET_PTR(apBuffers[1]);
     starpu_codelet_unpack_args(apCodeletArguments, &rows_num);
-    T local_dot = cblas_ddot(rows_num, (double *) pDescriptor_A, 1, (double *) pDescriptor_A, 1);
+    T local_dot;
+    if (sizeof(T) == SIZE_OF_FLOAT) {
+        local_dot = cblas_sdot(rows_num, (float *) pDescriptor_A, 1, (float *) pDescriptor_A, 1);
+    } else {
+        local_dot = cblas_ddot(rows_num, (double *) pDescriptor_A, 1, (double *) pDescriptor_A, 1);
+    }
     *pDot_product += local_dot;
 }
@@ -0,0 +1,94 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dfrobenius-codelet.cpp
+ * @brief A class for starpu codelet dfrobenius.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <starpu.h>
+
+#include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
+#include <runtime/starpu/concrete/dfrobenius-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
+
+using namespace exageostat::runtime;
+
+template<typename T>
+struct starpu_codelet DFROBENIUSCodelet<T>::cl_dfrobenius = {
+#ifdef USE_CUDA
+        .where= STARPU_CPU | STARPU_CUDA,
+        .cpu_funcs={cl_dfrobenius_function},
+        .cuda_funcs={},
+        .cuda_flags={0},
+#else
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dfrobenius_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+#endif
+        .nbuffers     = 3,
+        .modes        = {STARPU_R, STARPU_R, STARPU_REDUX},
+        .name         = "dfrobenius"
+};
+
+template<typename T>
+void DFROBENIUSCodelet<T>::InsertTask(void *apDescA, void *apDescB, void *apDescProduct,
+                                      const bool &aIsDeterministic) {
+    int row, col, rows_num, cols_num, is_diagonal, tile_index = 0;
+    auto pDescriptor_A = (CHAM_desc_t *) apDescA;
+    int tiles_num = pDescriptor_A->mt * (pDescriptor_A->nt + 1) / 2;
+    DREDUXCodelet<T> sum_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescProduct, 0, 0), tiles_num,
+                                   aIsDeterministic);
+
+    for (col = 0; col < pDescriptor_A->nt; col++) {
+        cols_num = col == pDescriptor_A->nt - 1 ? pDescriptor_A->n - col * pDescriptor_A->nb : pDescriptor_A->nb;
+        for (row = col; row < pDescriptor_A->mt; row++) {
+            rows_num = row == pDescriptor_A->mt - 1 ? pDescriptor_A->m - row * pDescriptor_A->mb : pDescriptor_A->mb;
+            is_diagonal = row == col;
+            starpu_insert_task(&this->cl_dfrobenius,
+                               STARPU_VALUE, &rows_num, sizeof(int),
+                               STARPU_VALUE, &cols_num, sizeof(int),
+                               STARPU_VALUE, &is_diagonal, sizeof(int),
+                               STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr(pDescriptor_A, row, col),
+                               STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescB, row, col),
+                               STARPU_REDUX, (starpu_data_handle_t) sum_reduction.GetHandle(tile_index++),
+                               0);
+        }
+    }
+    sum_reduction.InsertTask();
+}
+
+template<typename T>
+void DFROBENIUSCodelet<T>::cl_dfrobenius_function(void **apBuffers, void *apCodeletArguments) {
+    int rows_num, cols_num, is_diagonal;
+    T *pDescriptor_A, *pDescriptor_B, *pProduct;
+
+    pDescriptor_A = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    pDescriptor_B = (T *) STARPU_MATRIX_GET_PTR(apBuffers[1]);
+    pProduct = (T *) STARPU_MATRIX_GET_PTR(apBuffers[2]);
+    int leading_dim_A = (int) STARPU_MATRIX_GET_LD(apBuffers[0]);
+    int leading_dim_B = (int) STARPU_MATRIX_GET_LD(apBuffers[1]);
+
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num, &is_diagonal);
+
+    // Strictly lower elements also stand for their transposed counterparts in the upper part, so diagonal tiles
+    // are only read below their diagonal and may hold anything above it.
+    T diagonal_sum = 0, lower_sum = 0;
+    for (int j = 0; j < cols_num; j++) {
+        int first_row = 0;
+        if (is_diagonal) {
+            diagonal_sum += pDescriptor_A[j + j * leading_dim_A] * pDescriptor_B[j + j * leading_dim_B];
+            first_row = j + 1;
+        }
+        for (int i = first_row; i < rows_num; i++) {
+            lower_sum += pDescriptor_A[i + j * leading_dim_A] * pDescriptor_B[i + j * leading_dim_B];
+        }
+    }
+    *pProduct += diagonal_sum + 2 * lower_sum;
+}
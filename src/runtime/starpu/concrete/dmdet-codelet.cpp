@@ -15,6 +15,7 @@
 #include <starpu.h>
 
 #include <runtime/starpu/concrete/dmdet-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
 
 using namespace exageostat::runtime;
 using namespace exageostat::common;
@@ -33,27 +34,29 @@ struct starpu_codelet DMDETCodelet<T>::cl_dmdet{
         .cuda_flags={(0)},
 #endif
         .nbuffers    = 2,
-        .modes        = {STARPU_W, STARPU_W},
+        .modes        = {STARPU_R, STARPU_REDUX},
         .name        = "dmdet"
 };
 
 template<typename T>
 void DMDETCodelet<T>::InsertTask(const Computation &aComputation, void *apDescA, void *apDescDet,
-                                 std::unique_ptr<StarPuHelpers> &aStarPuHelpers) {
+                                 std::unique_ptr<StarPuHelpers> &aStarPuHelpers, const bool &aIsDeterministic) {
     int row, rows_num;
     auto desc_mt = aStarPuHelpers->GetMT(apDescA);
     auto desc_m = aStarPuHelpers->GetM(apDescA);
     auto desc_mb = aStarPuHelpers->GetMB(apDescA);
+    DREDUXCodelet<T> det_reduction(aStarPuHelpers->ExaGeoStatDataGetAddr(apDescDet, 0, 0), desc_mt, aIsDeterministic);
 
     for (row = 0; row < desc_mt; row++) {
         rows_num = row == desc_mt - 1 ? desc_m - row * desc_mb : desc_mb;
         starpu_insert_task(&this->cl_dmdet,
                            STARPU_VALUE, &rows_num, sizeof(int),
-                           STARPU_W,
+                           STARPU_R,
                            aStarPuHelpers->ExaGeoStatDataGetAddr(apDescA, row, aComputation != TILE_LOW_RANK ? row : 0),
-                           STARPU_W, aStarPuHelpers->ExaGeoStatDataGetAddr(apDescDet, 0, 0),
+                           STARPU_REDUX, det_reduction.GetHandle(row),
                            0);
     }
+    det_reduction.InsertTask();
 }
 
 template<typename T>
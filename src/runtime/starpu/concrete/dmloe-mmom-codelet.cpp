@@ -16,6 +16,7 @@
 
 #include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
 #include <runtime/starpu/concrete/dmloe-mmom-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
 
 using namespace exageostat::runtime;
 
@@ -33,14 +34,20 @@ struct starpu_codelet DmloeMmomCodelet<T>::cl_dmloe_mmom = {
         .cuda_flags={(0)},
 #endif
         .nbuffers    = 5,
-        .modes        = {STARPU_W, STARPU_W, STARPU_W, STARPU_W, STARPU_W},
+        .modes        = {STARPU_R, STARPU_R, STARPU_R, STARPU_REDUX, STARPU_REDUX},
         .name        = "dmloe_mmom"
 };
 
 template<typename T>
 void DmloeMmomCodelet<T>::InsertTask(void *apDescExpr1, void *apDescExpr2, void *apDescExpr3, void *apDescMLOE,
-                                     void *apDescMMOM) {
+                                     void *apDescMMOM, const int &aBlockSize, const bool &aIsDeterministic) {
     int row, col, rows_num, cols_num;
+    int tiles_row_num = ((CHAM_desc_t *) apDescExpr1)->mt;
+    int tiles_num = tiles_row_num * ((CHAM_desc_t *) apDescExpr1)->nt;
+    DREDUXCodelet<T> mloe_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescMLOE, 0, 0), tiles_num,
+                                    aIsDeterministic);
+    DREDUXCodelet<T> mmom_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescMMOM, 0, 0), tiles_num,
+                                    aIsDeterministic);
 
     for (col = 0; col < ((CHAM_desc_t *) apDescExpr1)->nt; col++) {
         cols_num = col == ((CHAM_desc_t *) apDescExpr1)->nt - 1 ? ((CHAM_desc_t *) apDescExpr1)->n -
@@ -54,24 +61,27 @@ void DmloeMmomCodelet<T>::InsertTask(void *apDescExpr1, void *apDescExpr2, void
             starpu_insert_task(&this->cl_dmloe_mmom,
                                STARPU_VALUE, &rows_num, sizeof(int),
                                STARPU_VALUE, &cols_num, sizeof(int),
-                               STARPU_W,
+                               STARPU_VALUE, &aBlockSize, sizeof(int),
+                               STARPU_R,
                                (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescExpr1, row, col),
-                               STARPU_W,
+                               STARPU_R,
                                (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescExpr2, row, col),
-                               STARPU_W,
+                               STARPU_R,
                                (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescExpr3, row, col),
-                               STARPU_W,
-                               (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescMLOE, row, col),
-                               STARPU_W,
-                               (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescMMOM, row, col),
+                               STARPU_REDUX,
+                               (starpu_data_handle_t) mloe_reduction.GetHandle(row + col * tiles_row_num),
+                               STARPU_REDUX,
+                               (starpu_data_handle_t) mmom_reduction.GetHandle(row + col * tiles_row_num),
                                0);
         }
     }
+    mloe_reduction.InsertTask();
+    mmom_reduction.InsertTask();
 }
 
 template<typename T>
 void DmloeMmomCodelet<T>::cl_dmloe_mmom_function(void **apBuffers, void *apCodeletArguments) {
-    int rows_num, cols_num;
+    int rows_num, cols_num, block_size;
     T *pExpr1, *pExpr2, *pExpr3, *pMloe, *pMmom;
 
     pExpr1 = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
@@ -79,25 +89,30 @@ void DmloeMmomCodelet<T>::cl_dmloe_mmom_function(void **apBuffers, void *apCodel
     pExpr3 = (T *) STARPU_MATRIX_GET_PTR(apBuffers[2]);
     pMloe = (T *) STARPU_MATRIX_GET_PTR(apBuffers[3]);
     pMmom = (T *) STARPU_MATRIX_GET_PTR(apBuffers[4]);
+    int leading_dim = (int) STARPU_MATRIX_GET_LD(apBuffers[0]);
 
-    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num);
-    T expr1_ = 0, expr2_ = 0, expr3_ = 0;
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num, &block_size);
 
-    for (int i = 0; i < rows_num * cols_num; i += 2) {
-        expr1_ += pExpr1[i];
-        expr2_ += pExpr2[i];
-        expr3_ += pExpr3[i];
-    }
+    // Every block of block_size columns holds the expressions of one missing location.
+    for (int block_start = 0; block_start < cols_num; block_start += block_size) {
+        T expr1_ = 0, expr2_ = 0, expr3_ = 0;
+        for (int i = 0; i < rows_num * block_size; i += 2) {
+            int index = i % rows_num + (block_start + i / rows_num) * leading_dim;
+            expr1_ += pExpr1[index];
+            expr2_ += pExpr2[index];
+            expr3_ += pExpr3[index];
+        }
 
-    if (expr2_ == 0.0) {
-        *pMloe -= 1.0;
-    } else {
-        *pMloe += (expr1_ / expr2_) - 1.0;
-    }
+        if (expr2_ == 0.0) {
+            *pMloe -= 1.0;
+        } else {
+            *pMloe += (expr1_ / expr2_) - 1.0;
+        }
 
-    if (expr2_ == 0.0) {
-        *pMmom -= 1.0;
-    } else {
-        *pMmom += (expr3_ / expr1_) - 1.0;
+        if (expr2_ == 0.0) {
+            *pMmom -= 1.0;
+        } else {
+            *pMmom += (expr3_ / expr1_) - 1.0;
+        }
     }
 }
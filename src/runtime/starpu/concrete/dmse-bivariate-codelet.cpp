@@ -16,6 +16,7 @@
 
 #include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
 #include <runtime/starpu/concrete/dmse-bivariate-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
 
 using namespace exageostat::runtime;
 
@@ -33,31 +34,40 @@ struct starpu_codelet DMSEBivariateCodelet<T>::cl_dmse_bivariate = {
         .cuda_flags={(0)},
 #endif
         .nbuffers     = 5,
-        .modes        = {STARPU_RW, STARPU_RW, STARPU_RW, STARPU_R, STARPU_R},
+        .modes        = {STARPU_REDUX, STARPU_REDUX, STARPU_REDUX, STARPU_R, STARPU_R},
         .name         = "dmse-bivariate"
 };
 
 template<typename T>
 void DMSEBivariateCodelet<T>::InsertTask(void *apDescZMiss, void *apDescZPre, void *apDescsError, void *apDescsError1,
-                                         void *apDescsError2) {
+                                         void *apDescsError2, const bool &aIsDeterministic) {
     int row, rows_num;
 
     auto pDesc_ZPre = (CHAM_desc_t *) apDescZPre;
     auto desc_mt = pDesc_ZPre->mt;
     auto desc_m = pDesc_ZPre->m;
     auto desc_mb = pDesc_ZPre->mb;
+    DREDUXCodelet<T> error1_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescsError1, 0, 0), desc_mt,
+                                      aIsDeterministic);
+    DREDUXCodelet<T> error2_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescsError2, 0, 0), desc_mt,
+                                      aIsDeterministic);
+    DREDUXCodelet<T> error_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescsError, 0, 0), desc_mt,
+                                     aIsDeterministic);
 
     for (row = 0; row < desc_mt; row++) {
         rows_num = row == desc_mt - 1 ? desc_m - row * desc_mb : desc_mb;
         starpu_insert_task(&this->cl_dmse_bivariate,
                            STARPU_VALUE, &rows_num, sizeof(int),
-                           STARPU_RW, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescsError1, 0, 0),
-                           STARPU_RW, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescsError2, 0, 0),
-                           STARPU_RW, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescsError, 0, 0),
+                           STARPU_REDUX, (starpu_data_handle_t) error1_reduction.GetHandle(row),
+                           STARPU_REDUX, (starpu_data_handle_t) error2_reduction.GetHandle(row),
+                           STARPU_REDUX, (starpu_data_handle_t) error_reduction.GetHandle(row),
                            STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescZPre, row, 0),
                            STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescZMiss, row, 0),
                            0);
     }
+    error1_reduction.InsertTask();
+    error2_reduction.InsertTask();
+    error_reduction.InsertTask();
 }
 
 template<typename T>
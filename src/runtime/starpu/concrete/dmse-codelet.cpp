@@ -16,6 +16,7 @@
 
 #include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
 #include <runtime/starpu/concrete/dmse-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
 
 using namespace exageostat::runtime;
 
@@ -33,26 +34,30 @@ struct starpu_codelet DMSECodelet<T>::cl_dmse = {
         .cuda_flags={(0)},
 #endif
         .nbuffers    = 3,
-        .modes        = {STARPU_W, STARPU_W, STARPU_W},
+        .modes        = {STARPU_REDUX, STARPU_R, STARPU_R},
         .name        = "dmse"
 };
 
 template<typename T>
-void DMSECodelet<T>::InsertTask(void *apDescError, void *apDescZPredict, void *apDescZMiss) {
+void DMSECodelet<T>::InsertTask(void *apDescError, void *apDescZPredict, void *apDescZMiss,
+                                const bool &aIsDeterministic) {
     int row, rows_num;
     auto pDesc_Z_predict = (CHAM_desc_t *) apDescZPredict;
+    DREDUXCodelet<T> error_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescError, 0, 0), pDesc_Z_predict->mt,
+                                     aIsDeterministic);
 
     for (row = 0; row < pDesc_Z_predict->mt; row++) {
         rows_num =
                 row == pDesc_Z_predict->mt - 1 ? pDesc_Z_predict->m - row * pDesc_Z_predict->mb : pDesc_Z_predict->mb;
         starpu_insert_task(&this->cl_dmse,
                            STARPU_VALUE, &rows_num, sizeof(int),
-                           STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescError, 0, 0),
-                           STARPU_W,
+                           STARPU_REDUX, (starpu_data_handle_t) error_reduction.GetHandle(row),
+                           STARPU_R,
                            (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescZPredict, row, 0),
-                           STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescZMiss, row, 0),
+                           STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescZMiss, row, 0),
                            0);
     }
+    error_reduction.InsertTask();
 }
 
 template<typename T>
@@ -0,0 +1,80 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dnormal-codelet.cpp
+ * @brief A class for starpu codelet dnormal.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <starpu.h>
+
+#include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
+#include <runtime/starpu/concrete/dnormal-codelet.hpp>
+#include <helpers/PhiloxRandom.hpp>
+
+using namespace exageostat::runtime;
+using namespace exageostat::helpers;
+
+template<typename T>
+struct starpu_codelet DNORMALCodelet<T>::cl_dnormal = {
+#ifdef USE_CUDA
+        .where= STARPU_CPU | STARPU_CUDA,
+        .cpu_funcs={cl_dnormal_function},
+        .cuda_funcs={},
+        .cuda_flags={0},
+#else
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dnormal_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+#endif
+        .nbuffers     = 1,
+        .modes        = {STARPU_W},
+        .name         = "dnormal"
+};
+
+template<typename T>
+void DNORMALCodelet<T>::InsertTask(void *apDescriptor, const int &aSeed) {
+    int row, col, rows_num, cols_num, tile_row, tile_col;
+    auto pDescriptor_A = (CHAM_desc_t *) apDescriptor;
+
+    for (col = 0; col < pDescriptor_A->nt; col++) {
+        cols_num = col == pDescriptor_A->nt - 1 ? pDescriptor_A->n - col * pDescriptor_A->nb : pDescriptor_A->nb;
+        tile_col = col * pDescriptor_A->nb;
+        for (row = 0; row < pDescriptor_A->mt; row++) {
+            rows_num = row == pDescriptor_A->mt - 1 ? pDescriptor_A->m - row * pDescriptor_A->mb : pDescriptor_A->mb;
+            tile_row = row * pDescriptor_A->mb;
+            starpu_insert_task(&this->cl_dnormal,
+                               STARPU_VALUE, &rows_num, sizeof(int),
+                               STARPU_VALUE, &cols_num, sizeof(int),
+                               STARPU_VALUE, &tile_row, sizeof(int),
+                               STARPU_VALUE, &tile_col, sizeof(int),
+                               STARPU_VALUE, &pDescriptor_A->m, sizeof(int),
+                               STARPU_VALUE, &aSeed, sizeof(int),
+                               STARPU_W, RUNTIME_data_getaddr(pDescriptor_A, row, col),
+                               0);
+        }
+    }
+}
+
+template<typename T>
+void DNORMALCodelet<T>::cl_dnormal_function(void **apBuffers, void *apCodeletArguments) {
+    int rows_num, cols_num, tile_row, tile_col, rows_total, seed;
+    T *pDescriptor_A;
+
+    pDescriptor_A = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    int leading_dim_A = (int) STARPU_MATRIX_GET_LD(apBuffers[0]);
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &cols_num, &tile_row, &tile_col, &rows_total, &seed);
+
+    // Every value is indexed by its position in the whole matrix, whatever the tile it falls in.
+    for (int j = 0; j < cols_num; j++) {
+        PhiloxRandom<T>::NormalVector(seed, PhiloxRandom<T>::OBSERVATIONS_STREAM,
+                                      (uint64_t) (tile_col + j) * rows_total + tile_row, rows_num,
+                                      pDescriptor_A + (size_t) j * leading_dim_A);
+    }
+}
@@ -0,0 +1,127 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dredux-codelet.cpp
+ * @brief A class for the starpu reduction codelets of scalar accumulators.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <starpu.h>
+
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
+
+using namespace exageostat::runtime;
+
+template<typename T>
+struct starpu_codelet DREDUXCodelet<T>::cl_dzero = {
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dzero_function},
+        .nbuffers     = 1,
+        .modes        = {STARPU_W},
+        .name         = "dzero"
+};
+
+template<typename T>
+struct starpu_codelet DREDUXCodelet<T>::cl_dsum = {
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dsum_function},
+        .nbuffers     = 2,
+        .modes        = {STARPU_RW, STARPU_R},
+        .name         = "dsum"
+};
+
+template<typename T>
+DREDUXCodelet<T>::DREDUXCodelet(void *apHandle, const int &aTilesNumber, const bool &aIsDeterministic) {
+    this->mpHandle = apHandle;
+    auto handle = (starpu_data_handle_t) apHandle;
+
+    if (!aIsDeterministic) {
+        starpu_data_set_reduction_methods(handle, &cl_dsum, &cl_dzero);
+        return;
+    }
+    auto rows_num = starpu_matrix_get_nx(handle);
+    auto cols_num = starpu_matrix_get_ny(handle);
+    this->mPartialHandles.resize(aTilesNumber);
+    for (auto &partial_handle: this->mPartialHandles) {
+        starpu_data_handle_t partial;
+        starpu_matrix_data_register(&partial, -1, 0, rows_num, rows_num, cols_num, sizeof(T));
+        starpu_data_set_reduction_methods(partial, &cl_dsum, &cl_dzero);
+        partial_handle = partial;
+    }
+}
+
+template<typename T>
+void *DREDUXCodelet<T>::GetHandle(const int &aTileIndex) {
+    return this->mPartialHandles.empty() ? this->mpHandle : this->mPartialHandles[aTileIndex];
+}
+
+template<typename T>
+void DREDUXCodelet<T>::InsertTask() {
+    auto handle = (starpu_data_handle_t) this->mpHandle;
+
+    if (this->mPartialHandles.empty()) {
+        // Acquiring the accumulator triggers the reduction of the per-worker contributions into it.
+        starpu_data_acquire_cb(handle, STARPU_R, ReleaseHandle, handle);
+        return;
+    }
+    // Merge the private accumulators pairwise, the tree only depends on the number of tiles.
+    int partials_num = static_cast<int>(this->mPartialHandles.size());
+    for (int stride = 1; stride < partials_num; stride *= 2) {
+        for (int i = 0; i + stride < partials_num; i += 2 * stride) {
+            starpu_insert_task(&cl_dsum,
+                               STARPU_RW, (starpu_data_handle_t) this->mPartialHandles[i],
+                               STARPU_R, (starpu_data_handle_t) this->mPartialHandles[i + stride],
+                               0);
+        }
+    }
+    if (partials_num > 0) {
+        starpu_insert_task(&cl_dsum,
+                           STARPU_RW, handle,
+                           STARPU_R, (starpu_data_handle_t) this->mPartialHandles[0],
+                           0);
+    }
+    for (auto &partial_handle: this->mPartialHandles) {
+        starpu_data_unregister_submit((starpu_data_handle_t) partial_handle);
+    }
+    this->mPartialHandles.clear();
+}
+
+template<typename T>
+void DREDUXCodelet<T>::ReleaseHandle(void *apHandle) {
+    starpu_data_release((starpu_data_handle_t) apHandle);
+}
+
+template<typename T>
+void DREDUXCodelet<T>::cl_dzero_function(void **apBuffers, void *apCodeletArguments) {
+    auto *pAccumulator = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    int rows_num = (int) STARPU_MATRIX_GET_NX(apBuffers[0]);
+    int cols_num = (int) STARPU_MATRIX_GET_NY(apBuffers[0]);
+    int leading_dim = (int) STARPU_MATRIX_GET_LD(apBuffers[0]);
+
+    for (int j = 0; j < cols_num; j++) {
+        for (int i = 0; i < rows_num; i++) {
+            pAccumulator[i + j * leading_dim] = 0;
+        }
+    }
+}
+
+template<typename T>
+void DREDUXCodelet<T>::cl_dsum_function(void **apBuffers, void *apCodeletArguments) {
+    auto *pAccumulator = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    auto *pContribution = (T *) STARPU_MATRIX_GET_PTR(apBuffers[1]);
+    int rows_num = (int) STARPU_MATRIX_GET_NX(apBuffers[0]);
+    int cols_num = (int) STARPU_MATRIX_GET_NY(apBuffers[0]);
+    int leading_dim = (int) STARPU_MATRIX_GET_LD(apBuffers[0]);
+    int contribution_leading_dim = (int) STARPU_MATRIX_GET_LD(apBuffers[1]);
+
+    for (int j = 0; j < cols_num; j++) {
+        for (int i = 0; i < rows_num; i++) {
+            pAccumulator[i + j * leading_dim] += pContribution[i + j * contribution_leading_dim];
+        }
+    }
+}
@@ -16,6 +16,7 @@
 
 #include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
 #include <runtime/starpu/concrete/dtrace-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
 
 using namespace exageostat::runtime;
 
@@ -33,24 +34,27 @@ struct starpu_codelet DTRACECodelet<T>::cl_dtrace = {
         .cuda_flags={(0)},
 #endif
         .nbuffers     = 3,
-        .modes        = {STARPU_W, STARPU_W, STARPU_W},
+        .modes        = {STARPU_R, STARPU_REDUX, STARPU_W},
         .name         = "dtrace"
 };
 
 template<typename T>
-void DTRACECodelet<T>::InsertTask(void *apDescA, void *apDescNum, void *apDescTrace) {
+void DTRACECodelet<T>::InsertTask(void *apDescA, void *apDescNum, void *apDescTrace, const bool &aIsDeterministic) {
     int row, rows_num;
     auto pDescriptor_A = (CHAM_desc_t *) apDescA;
+    DREDUXCodelet<T> sum_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescNum, 0, 0), pDescriptor_A->mt,
+                                   aIsDeterministic);
 
     for (row = 0; row < pDescriptor_A->mt; row++) {
         rows_num = row == pDescriptor_A->mt - 1 ? pDescriptor_A->m - row * pDescriptor_A->mb : pDescriptor_A->mb;
         starpu_insert_task(&this->cl_dtrace,
                            STARPU_VALUE, &rows_num, sizeof(int),
-                           STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescA, row, row),
-                           STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescNum, 0, 0),
+                           STARPU_R, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescA, row, row),
+                           STARPU_REDUX, (starpu_data_handle_t) sum_reduction.GetHandle(row),
                            STARPU_W, (starpu_data_handle_t) RUNTIME_data_getaddr((CHAM_desc_t *) apDescTrace, row, 0),
                            0);
     }
+    sum_reduction.InsertTask();
 }
 
 template<typename T>
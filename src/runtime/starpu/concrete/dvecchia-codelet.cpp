@@ -0,0 +1,149 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file dvecchia-codelet.cpp
+ * @brief A class for starpu codelet dvecchia.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <cmath>
+#include <vector>
+
+#include <lapacke.h>
+#include <starpu.h>
+
+#include <linear-algebra-solvers/concrete/ChameleonHeaders.hpp>
+#include <runtime/starpu/concrete/dvecchia-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
+
+using namespace std;
+
+using namespace exageostat::runtime;
+using namespace exageostat::dataunits;
+using namespace exageostat::kernels;
+using namespace exageostat::common;
+
+template<typename T>
+struct starpu_codelet DVECCHIACodelet<T>::cl_dvecchia = {
+#ifdef USE_CUDA
+        .where= STARPU_CPU | STARPU_CUDA,
+        .cpu_funcs={cl_dvecchia_function},
+        .cuda_funcs={},
+        .cuda_flags={0},
+#else
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_dvecchia_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+#endif
+        .nbuffers     = 2,
+        .modes        = {STARPU_REDUX, STARPU_REDUX},
+        .name         = "dvecchia"
+};
+
+template<typename T>
+void DVECCHIACodelet<T>::InsertTask(const int &aN, const int &aNeighborsNumber, const int *apNeighbors,
+                                    Locations<T> *apLocations, Locations<T> *apMedianLocations, T *apZ,
+                                    T *apLocalTheta, const int &aDistanceMetric, const Kernel<T> *apKernel,
+                                    const int &aBlockSize, void *apDescDet, void *apDescProduct,
+                                    const bool &aIsDeterministic) {
+    int block, first_location, locations_num;
+    int blocks_number = (aN + aBlockSize - 1) / aBlockSize;
+    DREDUXCodelet<T> det_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescDet, 0, 0), blocks_number,
+                                   aIsDeterministic);
+    DREDUXCodelet<T> product_reduction(RUNTIME_data_getaddr((CHAM_desc_t *) apDescProduct, 0, 0), blocks_number,
+                                       aIsDeterministic);
+
+    for (block = 0; block < blocks_number; block++) {
+        first_location = block * aBlockSize;
+        locations_num = block == blocks_number - 1 ? aN - first_location : aBlockSize;
+        starpu_insert_task(&this->cl_dvecchia,
+                           STARPU_VALUE, &first_location, sizeof(int),
+                           STARPU_VALUE, &locations_num, sizeof(int),
+                           STARPU_VALUE, &aNeighborsNumber, sizeof(int),
+                           STARPU_VALUE, &apNeighbors, sizeof(int *),
+                           STARPU_VALUE, &apLocations, sizeof(Locations<T> *),
+                           STARPU_VALUE, &apMedianLocations, sizeof(Locations<T> *),
+                           STARPU_VALUE, &apZ, sizeof(T *),
+                           STARPU_VALUE, &apLocalTheta, sizeof(T *),
+                           STARPU_VALUE, &aDistanceMetric, sizeof(int),
+                           STARPU_VALUE, &apKernel, sizeof(kernels::Kernel<T> *),
+                           STARPU_REDUX, (starpu_data_handle_t) det_reduction.GetHandle(block),
+                           STARPU_REDUX, (starpu_data_handle_t) product_reduction.GetHandle(block),
+                           0);
+    }
+    det_reduction.InsertTask();
+    product_reduction.InsertTask();
+}
+
+template<typename T>
+void DVECCHIACodelet<T>::cl_dvecchia_function(void *apBuffers[], void *apCodeletArguments) {
+    int first_location, locations_num, neighbors_number, distance_metric;
+    int *pNeighbors;
+    Locations<T> *pLocations, *pMedian_locations;
+    T *pZ, *pLocal_theta, *pDeterminant, *pProduct;
+    Kernel<T> *pKernel;
+
+    pDeterminant = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    pProduct = (T *) STARPU_MATRIX_GET_PTR(apBuffers[1]);
+    starpu_codelet_unpack_args(apCodeletArguments, &first_location, &locations_num, &neighbors_number, &pNeighbors,
+                               &pLocations, &pMedian_locations, &pZ, &pLocal_theta, &distance_metric, &pKernel);
+
+    // The conditioning set of a location is followed by the location itself, so the last row of the Cholesky factor
+    // holds the conditional standard deviation, and the last solved value the standardized residual.
+    bool has_z_axis = pLocations->GetDimension() != Dimension2D;
+    Locations<T> subset(neighbors_number + 1, pLocations->GetDimension());
+    vector<T> covariance((size_t) (neighbors_number + 1) * (neighbors_number + 1));
+    vector<T> residuals(neighbors_number + 1);
+    T local_det = 0, local_product = 0;
+
+    for (int i = first_location; i < first_location + locations_num; i++) {
+        const int *pLocation_neighbors = pNeighbors + (size_t) i * neighbors_number;
+        int size = 0;
+        while (size < neighbors_number && pLocation_neighbors[size] >= 0) {
+            size++;
+        }
+        for (int j = 0; j <= size; j++) {
+            int index = j < size ? pLocation_neighbors[j] : i;
+            subset.GetLocationX()[j] = pLocations->GetLocationX()[index];
+            subset.GetLocationY()[j] = pLocations->GetLocationY()[index];
+            if (has_z_axis) {
+                subset.GetLocationZ()[j] = pLocations->GetLocationZ()[index];
+            }
+            residuals[j] = pZ[index];
+        }
+        size++;
+        pKernel->GenerateCovarianceTile(covariance.data(), size, size, 0, 0, subset, subset, *pMedian_locations,
+                                        pLocal_theta, distance_metric);
+
+        int info;
+        if (sizeof(T) == SIZE_OF_FLOAT) {
+            info = LAPACKE_spotrf(LAPACK_COL_MAJOR, 'L', size, (float *) covariance.data(), size);
+            if (info == 0) {
+                cblas_strsv(CblasColMajor, CblasLower, CblasNoTrans, CblasNonUnit, size,
+                            (float *) covariance.data(), size, (float *) residuals.data(), 1);
+            }
+        } else {
+            info = LAPACKE_dpotrf(LAPACK_COL_MAJOR, 'L', size, (double *) covariance.data(), size);
+            if (info == 0) {
+                cblas_dtrsv(CblasColMajor, CblasLower, CblasNoTrans, CblasNonUnit, size,
+                            (double *) covariance.data(), size, (double *) residuals.data(), 1);
+            }
+        }
+        // A covariance that is not positive definite at this theta makes the whole likelihood invalid.
+        if (info != 0) {
+            local_det = NAN;
+            break;
+        }
+        T standardized_residual = residuals[size - 1];
+        local_det += log(covariance[(size_t) (size - 1) * (size + 1)]);
+        local_product += standardized_residual * standardized_residual;
+    }
+    *pDeterminant += local_det;
+    *pProduct += local_product;
+}
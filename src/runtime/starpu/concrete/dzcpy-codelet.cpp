@@ -48,7 +48,7 @@ void DZCPYCodelet<T>::InsertTask(void *apDescriptor, void *apDoubleVector) {
         starpu_insert_task(&this->cl_dzcpy,
                            STARPU_VALUE, &rows_num, sizeof(int),
                            STARPU_VALUE, &tile_row, sizeof(int),
-                           STARPU_VALUE, &apDoubleVector, sizeof(double),
+                           STARPU_VALUE, &apDoubleVector, sizeof(T *),
                            STARPU_W, RUNTIME_data_getaddr(pDescriptor_A, row, 0),
                            0);
     }
@@ -15,6 +15,7 @@
 #include <starpu.h>
 
 #include <runtime/starpu/concrete/non-gaussian-loglike-codelet.hpp>
+#include <runtime/starpu/concrete/dredux-codelet.hpp>
 
 using namespace exageostat::runtime;
 
@@ -32,16 +33,17 @@ struct starpu_codelet NonGaussianLoglike<T>::cl_non_gaussian_loglike = {
         .cuda_flags={(0)},
 #endif
         .nbuffers     = 2,
-        .modes        = {STARPU_R, STARPU_RW},
+        .modes        = {STARPU_R, STARPU_REDUX},
         .name         = "non_gaussian_loglike"
 };
 
 template<typename T>
 void NonGaussianLoglike<T>::InsertTask(void *apDescZ, void *apDescSum, const T *apTheta,
-                                       std::unique_ptr<StarPuHelpers> &aStarPuHelpers) {
+                                       std::unique_ptr<StarPuHelpers> &aStarPuHelpers, const bool &aIsDeterministic) {
     auto desc_mt = aStarPuHelpers->GetMT(apDescZ);
     auto desc_m = aStarPuHelpers->GetM(apDescZ);
     auto desc_mb = aStarPuHelpers->GetMB(apDescZ);
+    DREDUXCodelet<T> sum_reduction(aStarPuHelpers->ExaGeoStatDataGetAddr(apDescSum, 0, 0), desc_mt, aIsDeterministic);
 
     int row, rows_num;
     for (row = 0; row < desc_mt; row++) {
@@ -49,15 +51,16 @@ void NonGaussianLoglike<T>::InsertTask(void *apDescZ, void *apDescSum, const T *
         starpu_insert_task(&this->cl_non_gaussian_loglike,
                            STARPU_VALUE, &rows_num, sizeof(int),
                            STARPU_R, aStarPuHelpers->ExaGeoStatDataGetAddr(apDescZ, row, 0),
-                           STARPU_RW, aStarPuHelpers->ExaGeoStatDataGetAddr(apDescSum, 0, 0),
-                           STARPU_VALUE, &apTheta[0], sizeof(double),
-                           STARPU_VALUE, &apTheta[1], sizeof(double),
-                           STARPU_VALUE, &apTheta[2], sizeof(double),
-                           STARPU_VALUE, &apTheta[3], sizeof(double),
-                           STARPU_VALUE, &apTheta[4], sizeof(double),
-                           STARPU_VALUE, &apTheta[5], sizeof(double),
+                           STARPU_REDUX, sum_reduction.GetHandle(row),
+                           STARPU_VALUE, &apTheta[0], sizeof(T),
+                           STARPU_VALUE, &apTheta[1], sizeof(T),
+                           STARPU_VALUE, &apTheta[2], sizeof(T),
+                           STARPU_VALUE, &apTheta[3], sizeof(T),
+                           STARPU_VALUE, &apTheta[4], sizeof(T),
+                           STARPU_VALUE, &apTheta[5], sizeof(T),
                            0);
     }
+    sum_reduction.InsertTask();
 }
 
 template<typename T>
@@ -0,0 +1,82 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file non-gaussian-predict-codelet.cpp
+ * @brief A class for starpu codelet non-gaussian-predict.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <cmath>
+#include <starpu.h>
+
+#include <runtime/starpu/concrete/non-gaussian-predict-codelet.hpp>
+
+using namespace exageostat::runtime;
+
+template<typename T>
+struct starpu_codelet NonGaussianPredict<T>::cl_non_gaussian_predict = {
+#ifdef USE_CUDA
+        .where= STARPU_CPU | STARPU_CUDA,
+        .cpu_funcs={cl_non_gaussian_predict_function},
+        .cuda_funcs={},
+        .cuda_flags={0},
+#else
+        .where=STARPU_CPU,
+        .cpu_funcs={cl_non_gaussian_predict_function},
+        .cuda_funcs={},
+        .cuda_flags={(0)},
+#endif
+        .nbuffers     = 2,
+        .modes        = {STARPU_RW, STARPU_R},
+        .name         = "non_gaussian_predict"
+};
+
+template<typename T>
+void NonGaussianPredict<T>::InsertTask(void *apDescZMiss, void *apDescExplainedVariance, const T *apTheta,
+                                       std::unique_ptr<StarPuHelpers> &apStarPuHelpers) {
+    int row, rows_num;
+
+    auto desc_mt = apStarPuHelpers->GetMT(apDescZMiss);
+    auto desc_m = apStarPuHelpers->GetM(apDescZMiss);
+    auto desc_mb = apStarPuHelpers->GetMB(apDescZMiss);
+
+    // Tile row k of the predictions matches tile column k of the explained variances.
+    for (row = 0; row < desc_mt; row++) {
+        rows_num = row == desc_mt - 1 ? desc_m - row * desc_mb : desc_mb;
+        starpu_insert_task(&this->cl_non_gaussian_predict,
+                           STARPU_VALUE, &rows_num, sizeof(int),
+                           STARPU_RW, apStarPuHelpers->ExaGeoStatDataGetAddr(apDescZMiss, row, 0),
+                           STARPU_R, apStarPuHelpers->ExaGeoStatDataGetAddr(apDescExplainedVariance, 0, row),
+                           STARPU_VALUE, &apTheta[2], sizeof(T),
+                           STARPU_VALUE, &apTheta[3], sizeof(T),
+                           STARPU_VALUE, &apTheta[4], sizeof(T),
+                           STARPU_VALUE, &apTheta[5], sizeof(T),
+                           0);
+    }
+}
+
+template<typename T>
+void NonGaussianPredict<T>::cl_non_gaussian_predict_function(void **apBuffers, void *apCodeletArguments) {
+    int rows_num;
+    T xi, omega, g, h;
+
+    auto *pDescriptor_Z = (T *) STARPU_MATRIX_GET_PTR(apBuffers[0]);
+    auto *pDescriptor_variance = (T *) STARPU_MATRIX_GET_PTR(apBuffers[1]);
+    int leading_dim_variance = (int) STARPU_MATRIX_GET_LD(apBuffers[1]);
+
+    starpu_codelet_unpack_args(apCodeletArguments, &rows_num, &xi, &omega, &g, &h);
+
+    for (int i = 0; i < rows_num; i++) {
+        T mu = pDescriptor_Z[i];
+        // The Gaussian field has a unit variance, what the observations do not explain is left.
+        T sigma_sq = 1 - pDescriptor_variance[i * leading_dim_variance];
+        T denominator = 1 - h * sigma_sq;
+        pDescriptor_Z[i] = xi + (omega / (g * std::sqrt(denominator))) * std::exp(h * mu * mu / (2 * denominator)) *
+                                (std::exp((g * g * sigma_sq + 2 * g * mu) / (2 * denominator)) - 1);
+    }
+}
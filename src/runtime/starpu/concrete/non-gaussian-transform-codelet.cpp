@@ -51,12 +51,12 @@ NonGaussianTransform<T>::InsertTask(void *apDescZ, const T *apTheta, std::unique
         starpu_insert_task(&this->cl_non_gaussian_transform,
                            STARPU_VALUE, &rows_num, sizeof(int),
                            STARPU_RW, apStarPuHelpers->ExaGeoStatDataGetAddr(apDescZ, row, 0),
-                           STARPU_VALUE, &apTheta[0], sizeof(double),
-                           STARPU_VALUE, &apTheta[1], sizeof(double),
-                           STARPU_VALUE, &apTheta[2], sizeof(double),
-                           STARPU_VALUE, &apTheta[3], sizeof(double),
-                           STARPU_VALUE, &apTheta[4], sizeof(double),
-                           STARPU_VALUE, &apTheta[5], sizeof(double),
+                           STARPU_VALUE, &apTheta[0], sizeof(T),
+                           STARPU_VALUE, &apTheta[1], sizeof(T),
+                           STARPU_VALUE, &apTheta[2], sizeof(T),
+                           STARPU_VALUE, &apTheta[3], sizeof(T),
+                           STARPU_VALUE, &apTheta[4], sizeof(T),
+                           STARPU_VALUE, &apTheta[5], sizeof(T),
                            0);
     }
 }
@@ -25,7 +25,7 @@ using namespace exageostat::common;
 using namespace exageostat::runtime;
 
 unique_ptr<StarPuHelpers> StarPuHelpersFactory::CreateStarPuHelper(const Computation &aComputation) {
-    if (aComputation == EXACT_DENSE || aComputation == DIAGONAL_APPROX) {
+    if (aComputation == EXACT_DENSE || aComputation == DIAGONAL_APPROX || aComputation == VECCHIA_APPROX) {
         return make_unique<ChameleonStarPuHelpers>();
     } else if (aComputation == TILE_LOW_RANK) {
 #ifdef USE_HICMA
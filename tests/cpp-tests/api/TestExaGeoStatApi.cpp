@@ -101,6 +101,10 @@ void TEST_MODEL_DATA(Computation aComputation) {
         expected = -24.0049327;
         configurations.SetLowTileSize(dts);
         configurations.SetMaxRank(500);
+    } else if (aComputation == VECCHIA_APPROX) {
+        // Conditioning every location on all the previous ones gives back the exact likelihood.
+        expected = -24.026000;
+        configurations.SetVecchiaNeighborsNumber(N - 1);
     }
 
     SECTION("Data Modeling")
@@ -257,6 +261,7 @@ TEST_CASE("ExaGeoStat API tests") {
     TEST_GENERATE_DATA();
     TEST_MODEL_DATA(EXACT_DENSE);
     TEST_MODEL_DATA(DIAGONAL_APPROX);
+    TEST_MODEL_DATA(VECCHIA_APPROX);
 #ifdef USE_HICMA
     TEST_MODEL_DATA(TILE_LOW_RANK);
 #endif
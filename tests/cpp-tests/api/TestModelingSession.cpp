@@ -0,0 +1,119 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file TestModelingSession.cpp
+ * @brief Unit tests for the ModelingSession class in the ExaGeoStat software package.
+ * @details This file contains Catch2 unit tests that check that the evaluations of a session, which reuse its
+ * descriptors, sequence and request, match evaluations on fresh descriptors.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <catch2/catch_all.hpp>
+
+#include <api/ModelingSession.hpp>
+#include <hardware/ExaGeoStatHardware.hpp>
+#include <linear-algebra-solvers/LinearAlgebraFactory.hpp>
+
+using namespace std;
+
+using namespace exageostat::api;
+using namespace exageostat::common;
+using namespace exageostat::configurations;
+using namespace exageostat::linearAlgebra;
+
+//// The 16 locations and measurements of the tests.
+static const vector<double> LOCATIONS_X{0.193041886015106440, 0.330556191348134576, 0.181612878614480805,
+                                        0.370473792629892440, 0.652140077821011688, 0.806332494087129037,
+                                        0.553322652018005678, 0.800961318379491916, 0.207324330510414295,
+                                        0.347951476310368490, 0.092042420080872822, 0.465445944914930965,
+                                        0.528267338063630132, 0.974792095826657490, 0.552452887769893985,
+                                        0.877592126344701295};
+static const vector<double> LOCATIONS_Y{0.103883421072709245, 0.135790035858701447, 0.434683756771190977,
+                                        0.400778210116731537, 0.168459601739528508, 0.105195696955825133,
+                                        0.396398870832379624, 0.296757457846952011, 0.564507515068284116,
+                                        0.627679865720607300, 0.928648813611047563, 0.958236057068741931,
+                                        0.573571374074921758, 0.568657969024185528, 0.935835812924391552,
+                                        0.942824444953078489};
+static const vector<double> MEASUREMENTS{-1.272336140360187606, -2.590699695867695773, 0.512142584178685967,
+                                         -0.163880452049749520, 0.313503633252489700, -1.474410682226017677,
+                                         0.161705025505231914, 0.623389205185149065, -1.341858445399783495,
+                                         -1.054282062428600009, -1.669383221392507943, 0.219170645803740793,
+                                         0.971213790000161170, 0.538973474182433021, -0.752828466476077041,
+                                         0.290822066007430102};
+
+/**
+ * @brief Creates the data of the 16 locations of the tests.
+ * @return The data, without descriptors.
+ *
+ */
+unique_ptr<ExaGeoStatData<double>> CreateSessionData() {
+    int N = (int) LOCATIONS_X.size();
+    auto data = make_unique<ExaGeoStatData<double>>(N, Dimension2D);
+    data->GetLocations()->SetLocationX(*LOCATIONS_X.data(), N);
+    data->GetLocations()->SetLocationY(*LOCATIONS_Y.data(), N);
+    return data;
+}
+
+/**
+ * @brief Evaluates the log likelihood on fresh descriptors.
+ * @param[in] aConfigurations The configurations of the evaluation.
+ * @param[in] aTheta The kernel parameters.
+ * @return The log likelihood.
+ *
+ */
+double EvaluateFresh(Configurations &aConfigurations, vector<double> aTheta) {
+    // The solver overwrites the measurements with their solved values, they outlive the descriptors using them.
+    vector<double> measurements = MEASUREMENTS;
+    auto data = CreateSessionData();
+    unique_ptr<exageostat::kernels::Kernel<double>> kernel(
+            exageostat::plugins::PluginRegistry<exageostat::kernels::Kernel<double>>::Create(
+                    aConfigurations.GetKernelName(), aConfigurations.GetTimeSlot()));
+    auto linear_algebra_solver = LinearAlgebraFactory<double>::CreateLinearAlgebraSolver(EXACT_DENSE);
+    return linear_algebra_solver->ExaGeoStatMLETile(data, aConfigurations, aTheta.data(), measurements.data(),
+                                                    *kernel);
+}
+
+void TEST_SESSION_EVALUATIONS() {
+
+    Configurations configurations;
+    configurations.SetProblemSize((int) LOCATIONS_X.size());
+    configurations.SetKernelName("UnivariateMaternStationary");
+    configurations.SetDenseTileSize(5);
+    configurations.SetComputation(EXACT_DENSE);
+    auto hardware = ExaGeoStatHardware(EXACT_DENSE, 2, 0);
+
+    vector<double> first_theta{1, 0.1, 0.5}, second_theta{0.9, 0.09, 0.4};
+    double first_expected = EvaluateFresh(configurations, first_theta);
+    double second_expected = EvaluateFresh(configurations, second_theta);
+
+    vector<double> measurements = MEASUREMENTS;
+    auto data = CreateSessionData();
+    ModelingSession<double> session(configurations, data, measurements.data());
+
+    SECTION("Evaluations reusing the descriptors")
+    {
+        REQUIRE(session.Evaluate(first_theta.data(), nullptr) == Catch::Approx(first_expected).epsilon(1e-12));
+        REQUIRE(session.Evaluate(second_theta.data(), nullptr) == Catch::Approx(second_expected).epsilon(1e-12));
+        // Nothing of the second evaluation is left behind.
+        REQUIRE(session.Evaluate(first_theta.data(), nullptr) == Catch::Approx(first_expected).epsilon(1e-12));
+    }SECTION("Request kept by the descriptor data")
+    {
+        session.Evaluate(first_theta.data(), nullptr);
+        // The request array of the first evaluation lived on its stack, the data must hold its own copy.
+        auto *pDescriptorData = data->GetDescriptorData();
+        auto *pRequest = (char *) pDescriptorData->GetRequest();
+        REQUIRE(pRequest != nullptr);
+        REQUIRE(pRequest >= (char *) pDescriptorData);
+        REQUIRE(pRequest < (char *) pDescriptorData + sizeof(*pDescriptorData));
+        REQUIRE(session.Evaluate(second_theta.data(), nullptr) == Catch::Approx(second_expected).epsilon(1e-12));
+    }
+}
+
+TEST_CASE("Modeling Session") {
+    TEST_SESSION_EVALUATIONS();
+}
@@ -19,15 +19,17 @@
 
 #include <catch2/catch_all.hpp>
 #include <configurations/Configurations.hpp>
+#include <kernels/Kernel.hpp>
 
 using namespace std;
 
 using namespace exageostat::common;
 using namespace exageostat::configurations;
+using namespace exageostat::kernels;
 
 void TEST_ARGUMENT_INITIALIZATION() {
 
-    const int argc = 17;
+    const int argc = 33;
     char *argv[] = {
             const_cast<char *>("program_name"),
             const_cast<char *>("--N=16"),
@@ -43,9 +45,25 @@ void TEST_ARGUMENT_INITIALIZATION() {
             const_cast<char *>("--ZMiss=6"),
             const_cast<char *>("--mspe"),
             const_cast<char *>("--idw"),
+            const_cast<char *>("--idw_neighbors=8"),
+            const_cast<char *>("--idw_radius=0.25"),
+            const_cast<char *>("--idw_power=1.5"),
+            const_cast<char *>("--kriging_variance"),
             const_cast<char *>("--mloe-mmom"),
             const_cast<char *>("--fisher"),
-            const_cast<char *>("--data_path=./dummy-path")
+            const_cast<char *>("--data_path=./dummy-path"),
+            const_cast<char *>("--ordering=hilbert"),
+            const_cast<char *>("--random_generator=philox"),
+            const_cast<char *>("--data_format=binary"),
+            const_cast<char *>("--nu_tolerance=3"),
+            const_cast<char *>("--bessel_tolerance=8"),
+            const_cast<char *>("--distance_cache=64"),
+            const_cast<char *>("--vecchia_neighbors=12"),
+            const_cast<char *>("--optimizer=lbfgs"),
+            const_cast<char *>("--recovery_file=./dummy-checkpoint"),
+            const_cast<char *>("--trace_probes=32"),
+            const_cast<char *>("--deterministic"),
+            const_cast<char *>("--retain_factor")
     };
 
     Configurations configurations;
@@ -57,17 +75,38 @@ void TEST_ARGUMENT_INITIALIZATION() {
     REQUIRE(configurations.GetKernelName() == "UnivariateMaternStationary");
     REQUIRE(configurations.GetDenseTileSize() == 8);
     REQUIRE(configurations.GetPrecision() == DOUBLE);
+    REQUIRE(configurations.GetSmoothnessTolerance() == pow(10, -3));
+    REQUIRE(configurations.GetBesselTableTolerance() == pow(10, -8));
+    REQUIRE(configurations.GetIsDeterministic() == true);
+    REQUIRE(configurations.GetTraceProbesNumber() == 32);
+    REQUIRE(configurations.GetIsRetainFactor() == true);
+
+    // Another configuration must not reset the tolerances shared by the kernels.
+    Configurations default_configurations;
+    REQUIRE(default_configurations.GetSmoothnessTolerance() == 0);
+    REQUIRE(KernelsConfigurations::GetSmoothnessTolerance() == pow(10, -3));
+    REQUIRE(KernelsConfigurations::GetBesselTableTolerance() == pow(10, -8));
 
     // No data generation arguments initialized
     REQUIRE(configurations.GetDataPath() == string(""));
+    REQUIRE(configurations.GetOrdering() == DEFAULT_ORDERING);
+    REQUIRE(configurations.GetRandomGenerator() == LAPACK_GENERATOR);
+    REQUIRE(configurations.GetDataFormat() == CSV_FILE);
 
     // No data modeling arguments initialized
     REQUIRE_THROWS(configurations.GetMaxMleIterations());
     REQUIRE_THROWS(configurations.GetTolerance());
+    REQUIRE(configurations.GetDistanceCacheBudget() == 0);
+    REQUIRE(configurations.GetVecchiaNeighborsNumber() == 30);
+    REQUIRE(configurations.GetOptimizer() == BOBYQA);
 
     // No data prediction arguments initialized
     REQUIRE(configurations.GetIsMSPE() == false);
     REQUIRE(configurations.GetIsIDW() == false);
+    REQUIRE(configurations.GetIDWNeighborsNumber() == 0);
+    REQUIRE(configurations.GetIDWRadius() == 0);
+    REQUIRE(configurations.GetIDWPower() == 2);
+    REQUIRE(configurations.GetIsKrigingVariance() == false);
     REQUIRE(configurations.GetIsFisher() == false);
     REQUIRE(configurations.GetIsMLOEMMOM() == false);
     REQUIRE(configurations.GetUnknownObservationsNb() == 0);
@@ -76,22 +115,67 @@ void TEST_ARGUMENT_INITIALIZATION() {
     configurations.InitializeDataGenerationArguments();
 
     REQUIRE(configurations.GetDataPath() == string("./dummy-path"));
+    REQUIRE(configurations.GetOrdering() == HILBERT_ORDERING);
+    REQUIRE_THROWS_WITH(configurations.ParseOrdering("zorder"),
+                        "Invalid value. Please use morton, hilbert or none values only.");
+    REQUIRE(configurations.GetRandomGenerator() == PHILOX_GENERATOR);
+    REQUIRE_THROWS_WITH(configurations.ParseRandomGenerator("mt19937"),
+                        "Invalid value. Please use lapack or philox values only.");
+    REQUIRE(configurations.GetDataFormat() == BINARY_FILE);
+    REQUIRE_THROWS_WITH(configurations.ParseDataFormat("parquet"),
+                        "Invalid value. Please use csv or binary values only.");
 
     // Data modelling arguments initialized
     configurations.InitializeDataModelingArguments();
 
     REQUIRE(configurations.GetMaxMleIterations() == 5);
     REQUIRE(configurations.GetTolerance() == pow(10, -4));
+    REQUIRE(configurations.GetDistanceCacheBudget() == 64);
+    REQUIRE(configurations.GetVecchiaNeighborsNumber() == 12);
+    REQUIRE(configurations.GetOptimizer() == LBFGS);
+    REQUIRE(configurations.GetRecoveryFile() == "./dummy-checkpoint");
+    REQUIRE_THROWS_WITH(configurations.ParseOptimizer("newton"),
+                        "Invalid value. Please use bobyqa, lbfgs or slsqp values only.");
 
     // Data prediction arguments initialized
     configurations.InitializeDataPredictionArguments();
 
     REQUIRE(configurations.GetIsMSPE() == true);
     REQUIRE(configurations.GetIsIDW() == true);
+    REQUIRE(configurations.GetIDWNeighborsNumber() == 8);
+    REQUIRE(configurations.GetIDWRadius() == 0.25);
+    REQUIRE(configurations.GetIDWPower() == 1.5);
+    REQUIRE_THROWS_WITH(Configurations::CheckDecimalValue("-1"), "Invalid value. Please use positive values");
+    REQUIRE(configurations.GetIsKrigingVariance() == true);
     REQUIRE(configurations.GetIsFisher() == true);
     REQUIRE(configurations.GetIsMLOEMMOM() == true);
     REQUIRE(configurations.GetUnknownObservationsNb() == 6);
 
+    // The kriging variance is only returned along with the MSPE prediction.
+    char *kriging_argv[] = {
+            const_cast<char *>("program_name"),
+            const_cast<char *>("--N=16"),
+            const_cast<char *>("--dts=8"),
+            const_cast<char *>("--kernel=univariate_matern_stationary"),
+            const_cast<char *>("--ZMiss=6"),
+            const_cast<char *>("--kriging_variance")
+    };
+    Configurations kriging_configurations;
+    kriging_configurations.InitializeArguments(6, kriging_argv);
+    REQUIRE_THROWS_AS(kriging_configurations.InitializeDataPredictionArguments(), domain_error);
+
+    // A tolerance of no digits only treats the exact half-integers in closed form.
+    char *exact_nu_argv[] = {
+            const_cast<char *>("program_name"),
+            const_cast<char *>("--N=16"),
+            const_cast<char *>("--dts=8"),
+            const_cast<char *>("--kernel=univariate_matern_stationary"),
+            const_cast<char *>("--nu_tolerance=0")
+    };
+    Configurations exact_nu_configurations;
+    exact_nu_configurations.InitializeArguments(5, exact_nu_argv);
+    REQUIRE(exact_nu_configurations.GetSmoothnessTolerance() == 0);
+    REQUIRE(KernelsConfigurations::GetSmoothnessTolerance() == 0);
 }
 
 void TEST_SYNTHETIC_CONFIGURATIONS() {
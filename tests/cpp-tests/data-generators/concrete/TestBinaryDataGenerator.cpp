@@ -0,0 +1,142 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file TestBinaryDataGenerator.cpp
+ * @brief Unit tests for the BinaryLoader class in the ExaGeoStat software package.
+ * @details This file contains Catch2 unit tests that write binary data files and read them back through their
+ * memory mapping.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+
+#include <catch2/catch_all.hpp>
+#include <configurations/Configurations.hpp>
+#include <data-loader/concrete/BinaryLoader.hpp>
+
+using namespace std;
+
+using namespace exageostat::dataunits;
+using namespace exageostat::common;
+using namespace exageostat::configurations;
+using namespace exageostat::dataLoader::binary;
+
+void TEST_BINARY_ROUND_TRIP() {
+    int N = 5;
+    string root_path = PROJECT_SOURCE_DIR;
+    root_path = root_path + "tests/cpp-tests/data-generators/concrete/binary";
+    string read_path = root_path + "/synthetic_ds/SYN_5_1.bin";
+
+    vector<double> x{0.1, 0.2, 0.3, 0.4, 0.5}, y{0.9, 0.8, 0.7, 0.6, 0.5}, time{1, 1, 2, 2, 3};
+    Configurations configurations;
+    configurations.SetIsSynthetic(false);
+    configurations.SetDataPath(read_path);
+
+    SECTION("2D locations with two variables") {
+        int p = 2;
+        vector<double> measurements{-1.5, 2, 3, -4e2, 5, 6, 7.25, 8, 9, 10};
+        Locations<double> locations(N, Dimension2D);
+        locations.SetLocationX(*x.data(), N);
+        locations.SetLocationY(*y.data(), N);
+        string write_path = root_path;
+        BinaryLoader<double>::GetInstance()->WriteData(*measurements.data(), N * p, p, write_path, locations,
+                                                       HILBERT_ORDERING);
+        REQUIRE(BinaryLoader<double>::IsBinaryFile(read_path));
+
+        configurations.SetDimension(Dimension2D);
+        REQUIRE(BinaryLoader<double>::GetInstance()->CountLocations(configurations, p) == N);
+        REQUIRE(configurations.GetProblemSize() == N * p);
+
+        Locations<double> read_locations(N, Dimension2D);
+        vector<double> read_measurements(N * p);
+        BinaryLoader<double>::GetInstance()->ReadData(configurations, read_locations, read_measurements.data(), p);
+        for (int i = 0; i < N; i++) {
+            REQUIRE(read_locations.GetLocationX()[i] == x[i]);
+            REQUIRE(read_locations.GetLocationY()[i] == y[i]);
+        }
+        for (int i = 0; i < N * p; i++) {
+            REQUIRE(read_measurements[i] == measurements[i]);
+        }
+
+        // A double precision file is converted when read in single precision.
+        Locations<float> float_locations(N, Dimension2D);
+        vector<float> float_measurements(N * p);
+        BinaryLoader<float>::GetInstance()->ReadData(configurations, float_locations, float_measurements.data(), p);
+        for (int i = 0; i < N * p; i++) {
+            REQUIRE(float_measurements[i] == (float) measurements[i]);
+        }
+    }SECTION("Space-time locations carry their time column") {
+        int p = 1;
+        vector<double> measurements{1, 2, 3, 4, 5};
+        Locations<double> locations(N, DimensionST);
+        locations.SetLocationX(*x.data(), N);
+        locations.SetLocationY(*y.data(), N);
+        locations.SetLocationZ(*time.data(), N);
+        string write_path = root_path;
+        BinaryLoader<double>::GetInstance()->WriteData(*measurements.data(), N, p, write_path, locations);
+
+        configurations.SetDimension(DimensionST);
+        configurations.SetTimeSlot(1);
+        REQUIRE(BinaryLoader<double>::GetInstance()->CountLocations(configurations, p) == N);
+
+        Locations<double> read_locations(N, DimensionST);
+        vector<double> read_measurements(N);
+        BinaryLoader<double>::GetInstance()->ReadData(configurations, read_locations, read_measurements.data(), p);
+        for (int i = 0; i < N; i++) {
+            REQUIRE(read_locations.GetLocationZ()[i] == time[i]);
+            REQUIRE(read_measurements[i] == measurements[i]);
+        }
+    }SECTION("Inconsistent files are rejected") {
+        vector<double> measurements{1, 2, 3, 4, 5};
+        Locations<double> locations(N, Dimension2D);
+        locations.SetLocationX(*x.data(), N);
+        locations.SetLocationY(*y.data(), N);
+        string write_path = root_path;
+        BinaryLoader<double>::GetInstance()->WriteData(*measurements.data(), N, 1, write_path, locations);
+
+        configurations.SetDimension(Dimension2D);
+        REQUIRE_THROWS_WITH(BinaryLoader<double>::GetInstance()->CountLocations(configurations, 2),
+                            "The data P in the provided file isn't consistent with the Kernel's P.");
+        configurations.SetDimension(Dimension3D);
+        REQUIRE_THROWS_WITH(BinaryLoader<double>::GetInstance()->CountLocations(configurations, 1),
+                            "The data dimensions in the provided file isn't consistent with the dimensions input.");
+
+        // Store an ordering that does not exist.
+        fstream header_file(read_path, ios::binary | ios::in | ios::out);
+        uint32_t ordering;
+        header_file.seekg(offsetof(BinaryHeader, mOrdering));
+        header_file.read(reinterpret_cast<char *>(&ordering), sizeof(ordering));
+        uint32_t invalid_ordering = HILBERT_ORDERING + 1;
+        header_file.seekp(offsetof(BinaryHeader, mOrdering));
+        header_file.write(reinterpret_cast<const char *>(&invalid_ordering), sizeof(invalid_ordering));
+        header_file.flush();
+        REQUIRE_THROWS_WITH(BinaryLoader<double>::GetInstance()->CountLocations(configurations, 1),
+                            "Invalid binary data file: " + read_path);
+        header_file.seekp(offsetof(BinaryHeader, mOrdering));
+        header_file.write(reinterpret_cast<const char *>(&ordering), sizeof(ordering));
+        header_file.close();
+
+        // Drop the end of the measurements block.
+        filesystem::resize_file(read_path, filesystem::file_size(read_path) - sizeof(double));
+        configurations.SetDimension(Dimension2D);
+        REQUIRE_THROWS_WITH(BinaryLoader<double>::GetInstance()->CountLocations(configurations, 1),
+                            "Truncated binary data file: " + read_path);
+
+        ofstream file(read_path);
+        file << "0.5,0.25,-1.5\n";
+        file.close();
+        REQUIRE_FALSE(BinaryLoader<double>::IsBinaryFile(read_path));
+    }
+    filesystem::remove_all(root_path);
+}
+
+TEST_CASE("Binary Data Generation tests") {
+    TEST_BINARY_ROUND_TRIP();
+}
@@ -14,7 +14,11 @@
  * @date 2023-03-08
 **/
 
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 
 #include <catch2/catch_all.hpp>
 #include <data-generators/DataGenerator.hpp>
@@ -496,9 +500,97 @@ void TEST_CSV_P_3() {
     delete pKernel;
 }
 
+void TEST_CSV_PARSING() {
+    string path = PROJECT_SOURCE_DIR;
+    path = path + "tests/cpp-tests/data-generators/concrete/parsing.csv";
+
+    Configurations configurations;
+    configurations.SetIsSynthetic(false);
+    configurations.SetDimension(Dimension2D);
+    configurations.SetCoresNumber(4);
+    configurations.SetDataPath(path);
+
+    SECTION("Windows line endings, blank lines and a missing final newline.") {
+        ofstream file(path);
+        file << "0.5,0.25,-1.5,2\r\n\n 1e-3,+0.75,3,-4e2\r\n\r\n0,1,5,6";
+        file.close();
+
+        int p = 2;
+        REQUIRE(CSVLoader<double>::GetInstance()->CountLocations(configurations, p) == 3);
+        REQUIRE(configurations.GetProblemSize() == 6);
+
+        Locations<double> locations(3, Dimension2D);
+        vector<double> measurements(6);
+        CSVLoader<double>::GetInstance()->ReadData(configurations, locations, measurements.data(), p);
+
+        vector<double> x{0.5, 1e-3, 0}, y{0.25, 0.75, 1}, z{-1.5, 2, 3, -4e2, 5, 6};
+        for (int i = 0; i < 3; i++) {
+            REQUIRE(locations.GetLocationX()[i] == x[i]);
+            REQUIRE(locations.GetLocationY()[i] == y[i]);
+        }
+        for (int i = 0; i < 6; i++) {
+            REQUIRE(measurements[i] == z[i]);
+        }
+    }
+
+    SECTION("Inconsistent lines are rejected.") {
+        Locations<double> locations(1, Dimension2D);
+        vector<double> measurements(2);
+        configurations.SetProblemSize(2);
+
+        ofstream file(path);
+        file << "0.5,0.25,-1.5\n";
+        file.close();
+        REQUIRE_THROWS_WITH(CSVLoader<double>::GetInstance()->ReadData(configurations, locations,
+                                                                        measurements.data(), 2),
+                            "The data P in the provided file isn't consistent with the Kernel's P.");
+
+        file.open(path);
+        file << "0.5,0.25,-1.5,1,2\n";
+        file.close();
+        REQUIRE_THROWS_WITH(CSVLoader<double>::GetInstance()->ReadData(configurations, locations,
+                                                                        measurements.data(), 2),
+                            "The data dimensions in the provided file isn't consistent with the dimensions input.");
+
+        file.open(path);
+        file << "0.5,north,-1.5,1\n";
+        file.close();
+        REQUIRE_THROWS_WITH(CSVLoader<double>::GetInstance()->ReadData(configurations, locations,
+                                                                        measurements.data(), 2),
+                            "Invalid value in the data file: north");
+    }
+
+    SECTION("Written values keep 15 significant digits.") {
+        int N = 3, p = 2;
+        vector<double> x{0.193041886015106440, 1e-20, 3}, y{0.5, -0.25, 123456789.123456789}, z{1, 2, 3};
+        vector<double> measurements{-1.272336140360187606, 0, 1.0 / 3, -2e15, 7, 0.1};
+        Locations<double> locations(N, Dimension3D);
+        locations.SetLocationX(*x.data(), N);
+        locations.SetLocationY(*y.data(), N);
+        locations.SetLocationZ(*z.data(), N);
+        string written_directory = PROJECT_SOURCE_DIR;
+        written_directory = written_directory + "tests/cpp-tests/data-generators/concrete/written";
+        // The path is completed with the synthetic_ds directory the file is written in.
+        string write_path = written_directory;
+        CSVLoader<double>::GetInstance()->WriteData(*measurements.data(), N * p, p, write_path, locations);
+
+        ostringstream expected;
+        for (int i = 0; i < N; i++) {
+            expected << setprecision(15) << x[i] << ',' << y[i] << ',' << z[i] << ',' << measurements[2 * i] << ','
+                     << measurements[2 * i + 1] << '\n';
+        }
+        ifstream file(write_path + "/SYN_3_1");
+        stringstream written;
+        written << file.rdbuf();
+        REQUIRE(written.str() == expected.str());
+        filesystem::remove_all(written_directory);
+    }
+    remove(path.c_str());
+}
 
 TEST_CASE("CSV Data Generation tests") {
     TEST_CSV_P_1();
     TEST_CSV_P_2();
     TEST_CSV_P_3();
+    TEST_CSV_PARSING();
 }
\ No newline at end of file
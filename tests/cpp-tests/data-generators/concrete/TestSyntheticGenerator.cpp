@@ -335,6 +335,51 @@ void TEST_GENERATION() {
             REQUIRE((data2->GetLocations()->GetLocationY()[i] - y[i]) == Catch::Approx(0.0).margin(1e-6));
         }
         delete pKernel;
+    }SECTION("test counter-based generation")
+    {
+        Configurations synthetic_data_configurations;
+        synthetic_data_configurations.SetDimension(Dimension2D);
+        int N = 16;
+        vector<double> initial_theta{1, 0.1, 0.5};
+        synthetic_data_configurations.SetInitialTheta(initial_theta);
+        synthetic_data_configurations.SetProblemSize(N);
+        synthetic_data_configurations.SetDenseTileSize(1);
+        synthetic_data_configurations.SetKernelName("UnivariateMaternStationary");
+        synthetic_data_configurations.SetComputation(exageostat::common::EXACT_DENSE);
+        synthetic_data_configurations.SetRandomGenerator(PHILOX_GENERATOR);
+        synthetic_data_configurations.SetSeed(3);
+        auto hardware = ExaGeoStatHardware(synthetic_data_configurations.GetComputation(),
+                                           synthetic_data_configurations.GetCoresNumber(),
+                                           synthetic_data_configurations.GetGPUsNumbers());
+
+        Kernel<double> *pKernel = exageostat::plugins::PluginRegistry<Kernel<double>>::Create(
+                synthetic_data_configurations.GetKernelName(), synthetic_data_configurations.GetTimeSlot());
+
+        unique_ptr<DataGenerator<double>> synthetic_generator = DataGenerator<double>::CreateGenerator(
+                synthetic_data_configurations);
+        auto data = synthetic_generator->CreateData(synthetic_data_configurations, *pKernel);
+        auto *z = (double *) data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
+                                                                      DESCRIPTOR_Z).chameleon_desc->mat;
+
+        // The state of rand() and the tile size do not change the generated data.
+        srand(7);
+        synthetic_data_configurations.SetDenseTileSize(5);
+        auto data1 = synthetic_generator->CreateData(synthetic_data_configurations, *pKernel);
+        auto *z1 = (double *) data1->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
+                                                                        DESCRIPTOR_Z).chameleon_desc->mat;
+        for (int i = 0; i < N; i++) {
+            REQUIRE(data1->GetLocations()->GetLocationX()[i] == data->GetLocations()->GetLocationX()[i]);
+            REQUIRE(data1->GetLocations()->GetLocationY()[i] == data->GetLocations()->GetLocationY()[i]);
+            REQUIRE((z1[i] - z[i]) == Catch::Approx(0.0).margin(1e-10));
+        }
+
+        // Another seed gives other data.
+        synthetic_data_configurations.SetSeed(4);
+        auto data2 = synthetic_generator->CreateData(synthetic_data_configurations, *pKernel);
+        for (int i = 0; i < N; i++) {
+            REQUIRE(data2->GetLocations()->GetLocationX()[i] != data->GetLocations()->GetLocationX()[i]);
+        }
+        delete pKernel;
     }
 }
 
@@ -137,8 +137,56 @@ void TEST_DISTANCE_EARTH() {
     }
 }
 
+void TEST_CALCULATE_TILE_DISTANCES() {
+    int size = 4;
+    auto *location_x = new double[size]{10.0, 4.0, 1.5, 22.0};
+    auto *location_y = new double[size]{12.0, 4.0, 7.25, 30.0};
+    auto *location_z = new double[size]{1, 2, 3, 4};
+
+    Locations<double> location1(size, Dimension3D);
+    Locations<double> location2(size, Dimension3D);
+    location1.SetLocationX(*location_x, size);
+    location1.SetLocationY(*location_y, size);
+    location1.SetLocationZ(*location_z, size);
+    location2.SetLocationX(*location_x, size);
+    location2.SetLocationY(*location_y, size);
+    location2.SetLocationZ(*location_z, size);
+
+    // A 3x2 tile starting from row 1 and column 2.
+    int rows = 3, cols = 2, row_offset = 1, column_offset = 2;
+    double distances[6];
+
+    SECTION("Tile distances match the element-wise distances") {
+        for (int flagZ = 0; flagZ <= 1; flagZ++) {
+            for (int distanceMetric = 0; distanceMetric <= 1 - flagZ; distanceMetric++) {
+                DistanceCalculationHelpers<double>::CalculateTileDistances(distances, location1, location2, rows, cols,
+                                                                           row_offset, column_offset, distanceMetric,
+                                                                           flagZ);
+                for (int j = 0; j < cols; j++) {
+                    for (int i = 0; i < rows; i++) {
+                        REQUIRE(distances[i + j * rows] == Catch::Approx(
+                                DistanceCalculationHelpers<double>::CalculateDistance(location1, location2,
+                                                                                      row_offset + i,
+                                                                                      column_offset + j,
+                                                                                      distanceMetric, flagZ)));
+                    }
+                }
+            }
+        }
+    }SECTION("Great Circle distance is rejected for 3D tiles") {
+        REQUIRE_THROWS(DistanceCalculationHelpers<double>::CalculateTileDistances(distances, location1, location2, rows,
+                                                                                  cols, row_offset, column_offset, 1,
+                                                                                  1));
+    }
+
+    delete[] location_x;
+    delete[] location_y;
+    delete[] location_z;
+}
+
 TEST_CASE("Degree to Radian Conversion") {
     TEST_RADIAN_CONVERSION();
     TEST_CALCULATE_DISTANCE();
     TEST_DISTANCE_EARTH();
+    TEST_CALCULATE_TILE_DISTANCES();
 }
\ No newline at end of file
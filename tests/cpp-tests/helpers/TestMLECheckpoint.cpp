@@ -0,0 +1,156 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file TestMLECheckpoint.cpp
+ * @brief Unit tests for the MLECheckpoint.cpp in the ExaGeoStat software package.
+ * @details This file contains Catch2 unit tests that validate the recording and the replay of the MLE evaluations.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <filesystem>
+
+#include <catch2/catch_all.hpp>
+
+#include <helpers/MLECheckpoint.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+
+/**
+ * @brief Creates the description of the fit of the tests.
+ * @param[in] aParametersNumber The number of theta values.
+ * @return The description of the fit.
+ *
+ */
+CheckpointProblem CreateProblem(const int &aParametersNumber) {
+    CheckpointProblem problem;
+    problem.mProblemSize = 16;
+    problem.mKernelName = "UnivariateMaternStationary";
+    problem.mLowerBounds.assign(aParametersNumber, 0.01);
+    problem.mUpperBounds.assign(aParametersNumber, 5);
+    problem.mStartingTheta.assign(aParametersNumber, 0.1);
+    double values[2] = {0.25, -1.5};
+    problem.mDataChecksum = MLECheckpoint::GetChecksum(values, sizeof(values));
+    return problem;
+}
+
+void TEST_CHECKPOINT_REPLAY() {
+
+    string path = PROJECT_SOURCE_DIR "test-checkpoint.bin";
+    filesystem::remove(path);
+    double points[3][2] = {{1, 0.1}, {0.5, 0.2}, {0.8, 0.15}};
+    double logliks[3] = {-120.5, -98.25, -101};
+    double gradients[3][2] = {{1, 2}, {3, 4}, {5, 6}};
+    {
+        MLECheckpoint checkpoint(path, 2, CreateProblem(2), true);
+        for (int i = 0; i < 3; i++) {
+            REQUIRE_FALSE(checkpoint.Replay(points[i], logliks[i], gradients[i]));
+            checkpoint.Save(points[i], logliks[i], gradients[i]);
+        }
+        REQUIRE(checkpoint.GetEvaluationsNumber() == 3);
+    }
+
+    SECTION("Recorded evaluations are replayed in order") {
+        MLECheckpoint checkpoint(path, 2, CreateProblem(2), true);
+        REQUIRE(checkpoint.GetEvaluationsNumber() == 3);
+        REQUIRE(checkpoint.GetBestLogLik() == -98.25);
+        vector<double> best_theta = checkpoint.GetBestTheta();
+        REQUIRE(best_theta.size() == 2);
+        REQUIRE(best_theta[0] == 0.5);
+        REQUIRE(best_theta[1] == 0.2);
+        double loglik, gradient[2];
+        for (int i = 0; i < 3; i++) {
+            REQUIRE(checkpoint.Replay(points[i], loglik, gradient));
+            REQUIRE(loglik == logliks[i]);
+            REQUIRE(gradient[0] == gradients[i][0]);
+            REQUIRE(gradient[1] == gradients[i][1]);
+        }
+        REQUIRE(checkpoint.GetReplayedNumber() == 3);
+        double next[2] = {0.7, 0.18};
+        REQUIRE_FALSE(checkpoint.Replay(next, loglik, gradient));
+        checkpoint.Save(next, -97.5, gradient);
+        REQUIRE(checkpoint.GetEvaluationsNumber() == 4);
+        REQUIRE(checkpoint.GetBestLogLik() == -97.5);
+    }SECTION("A differing point drops the later records") {
+        {
+            MLECheckpoint checkpoint(path, 2, CreateProblem(2), true);
+            double loglik, gradient[2];
+            REQUIRE(checkpoint.Replay(points[0], loglik, gradient));
+            double other[2] = {0.5, 0.3};
+            REQUIRE_FALSE(checkpoint.Replay(other, loglik, gradient));
+            REQUIRE(checkpoint.GetEvaluationsNumber() == 1);
+            REQUIRE(checkpoint.GetBestLogLik() == -120.5);
+            // Later points are computed, even if they were recorded.
+            REQUIRE_FALSE(checkpoint.Replay(points[1], loglik, gradient));
+        }
+        MLECheckpoint checkpoint(path, 2, CreateProblem(2), true);
+        REQUIRE(checkpoint.GetEvaluationsNumber() == 1);
+    }SECTION("An interrupted record is ignored") {
+        filesystem::resize_file(path, filesystem::file_size(path) - sizeof(double));
+        {
+            MLECheckpoint checkpoint(path, 2, CreateProblem(2), true, false);
+            REQUIRE(checkpoint.GetEvaluationsNumber() == 2);
+        }
+        MLECheckpoint checkpoint(path, 2, CreateProblem(2), true);
+        REQUIRE(checkpoint.GetEvaluationsNumber() == 2);
+        checkpoint.Save(points[2], logliks[2], gradients[2]);
+        MLECheckpoint reopened(path, 2, CreateProblem(2), true, false);
+        REQUIRE(reopened.GetEvaluationsNumber() == 3);
+        double loglik, gradient[2];
+        for (int i = 0; i < 3; i++) {
+            REQUIRE(reopened.Replay(points[i], loglik, gradient));
+            REQUIRE(loglik == logliks[i]);
+        }
+    }SECTION("A file of another configuration is rejected") {
+        REQUIRE_THROWS(MLECheckpoint(path, 3, CreateProblem(3), true));
+        REQUIRE_THROWS(MLECheckpoint(path, 2, CreateProblem(2), false));
+    }SECTION("A file of another fit is rejected") {
+        vector<CheckpointProblem> problems(6, CreateProblem(2));
+        problems[0].mProblemSize = 32;
+        problems[1].mKernelName = "UnivariateMaternNuggetsStationary";
+        problems[2].mComputation = 1;
+        problems[3].mLowerBounds[1] = 0.001;
+        problems[4].mStartingTheta[0] = 0.2;
+        double values[2] = {0.25, -1.25};
+        problems[5].mDataChecksum = MLECheckpoint::GetChecksum(values, sizeof(values));
+        for (auto &problem: problems) {
+            REQUIRE_THROWS_AS(MLECheckpoint(path, 2, problem, true), runtime_error);
+        }
+        // The rejected file is left as it was.
+        MLECheckpoint checkpoint(path, 2, CreateProblem(2), true);
+        REQUIRE(checkpoint.GetEvaluationsNumber() == 3);
+    }
+    filesystem::remove(path);
+}
+
+void TEST_CHECKPOINT_WITHOUT_GRADIENT() {
+
+    string path = PROJECT_SOURCE_DIR "test-checkpoint-bobyqa.bin";
+    filesystem::remove(path);
+    double theta[3] = {1, 0.1, 0.5};
+    {
+        MLECheckpoint checkpoint(path, 3, CreateProblem(3), false);
+        REQUIRE(checkpoint.GetBestTheta().empty());
+        checkpoint.Save(theta, -50, nullptr);
+    }
+    SECTION("Records hold the theta values and the log-likelihood only") {
+        // The bounds and the starting point, then the record.
+        REQUIRE(filesystem::file_size(path) == sizeof(CheckpointHeader) + (9 + 4) * sizeof(double));
+        MLECheckpoint checkpoint(path, 3, CreateProblem(3), false);
+        double loglik;
+        REQUIRE(checkpoint.Replay(theta, loglik, nullptr));
+        REQUIRE(loglik == -50);
+    }
+    filesystem::remove(path);
+}
+
+TEST_CASE("MLE Checkpoint") {
+    TEST_CHECKPOINT_REPLAY();
+    TEST_CHECKPOINT_WITHOUT_GRADIENT();
+}
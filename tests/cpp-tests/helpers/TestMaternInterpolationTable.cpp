@@ -0,0 +1,63 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file TestMaternInterpolationTable.cpp
+ * @brief Unit tests for the MaternInterpolationTable.cpp in the ExaGeoStat software package.
+ * @details This file contains Catch2 unit tests that validate the functionality of the class MaternInterpolationTable.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <cmath>
+
+#include <catch2/catch_all.hpp>
+
+extern "C" {
+#include <gsl/gsl_sf_bessel.h>
+}
+
+#include <helpers/MaternInterpolationTable.hpp>
+
+using namespace exageostat::helpers;
+
+void TEST_TABLE_ACCURACY() {
+
+    const double tolerance = 1e-8;
+    const double max_distance = 250;
+
+    for (double nu: {0.3, 1.2, 3.7}) {
+        MaternInterpolationTable<double> table(nu, max_distance, tolerance);
+        REQUIRE(table.IsValid());
+        REQUIRE(table.GetNu() == nu);
+        REQUIRE(table.GetMaxDistance() == max_distance);
+
+        // The error is checked against the tolerance on a sampling much denser than the table grid.
+        for (double distance = 1e-6; distance <= max_distance; distance *= 1.0007) {
+            const double exact = pow(distance, nu) * gsl_sf_bessel_Knu(nu, distance);
+            REQUIRE(fabs(table.Evaluate(distance) - exact) <= tolerance * exact);
+        }
+    }
+}
+
+void TEST_TABLE_TILE_EVALUATION() {
+
+    const double nu = 0.8;
+    MaternInterpolationTable<double> table(nu, 10, 1e-8);
+    double distances[4] = {0, 0.5, 2, 12};
+
+    table.EvaluateTile(distances, 4, 2.0, 3.0);
+    REQUIRE(distances[0] == 3.0);
+    REQUIRE(distances[1] == Catch::Approx(2.0 * pow(0.5, nu) * gsl_sf_bessel_Knu(nu, 0.5)).epsilon(1e-7));
+    REQUIRE(distances[2] == Catch::Approx(2.0 * pow(2, nu) * gsl_sf_bessel_Knu(nu, 2)).epsilon(1e-7));
+    // Outside of the tabulated range the value is computed exactly.
+    REQUIRE(distances[3] == Catch::Approx(2.0 * pow(12, nu) * gsl_sf_bessel_Knu(nu, 12)).epsilon(1e-12));
+}
+
+TEST_CASE("Matern Interpolation Table") {
+    TEST_TABLE_ACCURACY();
+    TEST_TABLE_TILE_EVALUATION();
+}
@@ -0,0 +1,113 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file TestPhiloxRandom.cpp
+ * @brief Unit tests for the PhiloxRandom.cpp in the ExaGeoStat software package.
+ * @details This file contains Catch2 unit tests that validate the counter-based random number generator.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <helpers/PhiloxRandom.hpp>
+
+using namespace std;
+
+using namespace exageostat::helpers;
+
+void TEST_PHILOX_KNOWN_ANSWERS() {
+
+    // Known answers of Philox4x32-10, from the Random123 distribution.
+    uint32_t output[4];
+    SECTION("Zero counter and key") {
+        uint32_t counter[4] = {0, 0, 0, 0};
+        uint32_t key[2] = {0, 0};
+        PhiloxRandom<double>::Philox4x32(counter, key, output);
+        REQUIRE(output[0] == 0x6627e8d5);
+        REQUIRE(output[1] == 0xe169c58d);
+        REQUIRE(output[2] == 0xbc57ac4c);
+        REQUIRE(output[3] == 0x9b00dbd8);
+    }SECTION("Full counter and key") {
+        uint32_t counter[4] = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+        uint32_t key[2] = {0xffffffff, 0xffffffff};
+        PhiloxRandom<double>::Philox4x32(counter, key, output);
+        REQUIRE(output[0] == 0x408f276d);
+        REQUIRE(output[1] == 0x41c83b0e);
+        REQUIRE(output[2] == 0xa20bc7c6);
+        REQUIRE(output[3] == 0x6d5451fd);
+    }SECTION("Digits of pi") {
+        uint32_t counter[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+        uint32_t key[2] = {0xa4093822, 0x299f31d0};
+        PhiloxRandom<double>::Philox4x32(counter, key, output);
+        REQUIRE(output[0] == 0xd16cfe09);
+        REQUIRE(output[1] == 0x94fdcceb);
+        REQUIRE(output[2] == 0x5001e420);
+        REQUIRE(output[3] == 0x24126ea1);
+    }
+}
+
+void TEST_PHILOX_DISTRIBUTIONS() {
+
+    int size = 100000;
+    SECTION("Uniform values lie in [0, 1)") {
+        double mean = 0;
+        for (int i = 0; i < size; i++) {
+            double value = PhiloxRandom<double>::Uniform(1, 0, i);
+            float single_value = PhiloxRandom<float>::Uniform(1, 0, i);
+            REQUIRE(value >= 0);
+            REQUIRE(value < 1);
+            REQUIRE(single_value >= 0);
+            REQUIRE(single_value < 1);
+            mean += value;
+        }
+        REQUIRE(mean / size == Catch::Approx(0.5).margin(1e-2));
+    }SECTION("Normal values are standard") {
+        vector<double> values(size);
+        PhiloxRandom<double>::NormalVector(1, 0, 0, size, values.data());
+        double mean = 0, variance = 0;
+        for (auto value: values) {
+            mean += value;
+            variance += value * value;
+        }
+        mean /= size;
+        variance = variance / size - mean * mean;
+        REQUIRE(mean == Catch::Approx(0.0).margin(1e-2));
+        REQUIRE(variance == Catch::Approx(1.0).margin(2e-2));
+    }
+}
+
+void TEST_PHILOX_INDEPENDENCE() {
+
+    SECTION("Values only depend on seed, stream and index") {
+        int size = 64;
+        vector<double> whole(size), blocks(size);
+        PhiloxRandom<double>::NormalVector(5, 0, 0, size, whole.data());
+        // Draw the same values in uneven blocks, in reverse order.
+        for (int offset = size; offset > 0;) {
+            int block = offset >= 7 ? 7 : offset;
+            offset -= block;
+            PhiloxRandom<double>::NormalVector(5, 0, offset, block, blocks.data() + offset);
+        }
+        for (int i = 0; i < size; i++) {
+            REQUIRE(blocks[i] == whole[i]);
+            REQUIRE(PhiloxRandom<double>::Normal(5, 0, i) == whole[i]);
+        }
+    }SECTION("Seeds and streams draw different values") {
+        REQUIRE(PhiloxRandom<double>::Normal(5, 0, 0) != PhiloxRandom<double>::Normal(6, 0, 0));
+        REQUIRE(PhiloxRandom<double>::Normal(5, 0, 0) != PhiloxRandom<double>::Normal(5, 1, 0));
+        REQUIRE(PhiloxRandom<double>::Uniform(5, 1, 0) != PhiloxRandom<double>::Uniform(5, 2, 0));
+    }
+}
+
+TEST_CASE("Philox Random") {
+    TEST_PHILOX_KNOWN_ANSWERS();
+    TEST_PHILOX_DISTRIBUTIONS();
+    TEST_PHILOX_INDEPENDENCE();
+}
@@ -0,0 +1,169 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file TestSpaceFillingCurve.cpp
+ * @brief Unit tests for the SpaceFillingCurve.cpp in the ExaGeoStat software package.
+ * @details This file contains Catch2 unit tests that validate the Morton and Hilbert reordering of the locations.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <catch2/catch_all.hpp>
+
+#include <helpers/SpaceFillingCurve.hpp>
+
+using namespace std;
+
+using namespace exageostat::common;
+using namespace exageostat::helpers;
+using namespace exageostat::dataunits;
+
+void TEST_MORTON_KEY() {
+
+    SECTION("2D key interleaves the bits") {
+        // x = 0b11 and y = 0b01 give x0 y0 x1 y1 = 1 1 1 0.
+        uint32_t coordinates[2] = {3, 1};
+        REQUIRE(SpaceFillingCurve<double>::MortonKey(coordinates, 2) == 0b0111);
+    }SECTION("3D key interleaves the bits") {
+        uint32_t coordinates[3] = {1, 0, 1};
+        REQUIRE(SpaceFillingCurve<double>::MortonKey(coordinates, 3) == 0b101);
+        coordinates[0] = 0, coordinates[1] = 2, coordinates[2] = 0;
+        REQUIRE(SpaceFillingCurve<double>::MortonKey(coordinates, 3) == 0b010000);
+    }SECTION("21 bits per axis fit in the key") {
+        uint32_t coordinates[3] = {(1u << 21) - 1, (1u << 21) - 1, (1u << 21) - 1};
+        REQUIRE(SpaceFillingCurve<double>::MortonKey(coordinates, 3) == (uint64_t(1) << 63) - 1);
+        REQUIRE(SpaceFillingCurve<double>::MortonKey(coordinates, 2) == (uint64_t(1) << 42) - 1);
+    }
+}
+
+void TEST_HILBERT_KEY() {
+
+    SECTION("2D consecutive cells are neighbours") {
+        int side = 16;
+        vector<pair<uint64_t, int>> keys;
+        for (int i = 0; i < side * side; i++) {
+            uint32_t coordinates[2] = {(uint32_t) (i % side), (uint32_t) (i / side)};
+            keys.emplace_back(SpaceFillingCurve<double>::HilbertKey(coordinates, 2), i);
+        }
+        sort(keys.begin(), keys.end());
+        for (int i = 1; i < side * side; i++) {
+            int previous = keys[i - 1].second, current = keys[i].second;
+            REQUIRE(keys[i].first != keys[i - 1].first);
+            REQUIRE(abs(previous % side - current % side) + abs(previous / side - current / side) == 1);
+        }
+    }SECTION("3D consecutive cells are neighbours") {
+        int side = 8;
+        vector<pair<uint64_t, int>> keys;
+        for (int i = 0; i < side * side * side; i++) {
+            uint32_t coordinates[3] = {(uint32_t) (i % side), (uint32_t) (i / side % side),
+                                       (uint32_t) (i / side / side)};
+            keys.emplace_back(SpaceFillingCurve<double>::HilbertKey(coordinates, 3), i);
+        }
+        sort(keys.begin(), keys.end());
+        for (int i = 1; i < side * side * side; i++) {
+            int previous = keys[i - 1].second, current = keys[i].second;
+            REQUIRE(abs(previous % side - current % side) + abs(previous / side % side - current / side % side) +
+                    abs(previous / side / side - current / side / side) == 1);
+        }
+    }
+}
+
+void TEST_REORDER() {
+
+    SECTION("Hilbert reordering of a 2D grid") {
+        int side = 16;
+        int size = side * side;
+        Locations<double> locations(size, Dimension2D);
+        // The measurements encode the index of their location, two per location.
+        vector<double> measurements(2 * size);
+        for (int i = 0; i < size; i++) {
+            locations.GetLocationX()[i] = (i % side) / (double) (side - 1);
+            locations.GetLocationY()[i] = (i / side) / (double) (side - 1);
+            measurements[2 * i] = i;
+            measurements[2 * i + 1] = -i;
+        }
+        auto permutation = SpaceFillingCurve<double>::Reorder(size, locations, measurements.data(), 2,
+                                                              HILBERT_ORDERING);
+
+        vector<int> sorted_permutation(permutation);
+        sort(sorted_permutation.begin(), sorted_permutation.end());
+        for (int i = 0; i < size; i++) {
+            REQUIRE(sorted_permutation[i] == i);
+            REQUIRE(locations.GetLocationX()[i] == (permutation[i] % side) / (double) (side - 1));
+            REQUIRE(locations.GetLocationY()[i] == (permutation[i] / side) / (double) (side - 1));
+            REQUIRE(measurements[2 * i] == permutation[i]);
+            REQUIRE(measurements[2 * i + 1] == -permutation[i]);
+        }
+        // Consecutive locations stay one grid step apart.
+        double step = 1.0 / (side - 1);
+        for (int i = 1; i < size; i++) {
+            double distance = abs(locations.GetLocationX()[i] - locations.GetLocationX()[i - 1]) +
+                              abs(locations.GetLocationY()[i] - locations.GetLocationY()[i - 1]);
+            REQUIRE(distance == Catch::Approx(step));
+        }
+    }SECTION("Morton reordering of space-time locations") {
+        int size = 4;
+        Locations<double> locations(size, DimensionST);
+        // The same spatial point at decreasing times, the time axis has its own scale.
+        for (int i = 0; i < size; i++) {
+            locations.GetLocationX()[i] = 0.5;
+            locations.GetLocationY()[i] = 0.5;
+            locations.GetLocationZ()[i] = size - i;
+        }
+        auto permutation = SpaceFillingCurve<double>::Reorder(size, locations, nullptr, 1, MORTON_ORDERING);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(permutation[i] == size - 1 - i);
+            REQUIRE(locations.GetLocationZ()[i] == i + 1);
+        }
+    }SECTION("Any number of threads gives the same order") {
+        // Several sorted blocks, the last one partial, with many locations sharing a key.
+        int size = 20011;
+        Locations<double> sequential(size, Dimension3D), parallel(size, Dimension3D);
+        vector<double> sequential_measurements(size), parallel_measurements(size);
+        srand(0);
+        for (int i = 0; i < size; i++) {
+            for (auto *pLocations: {&sequential, &parallel}) {
+                pLocations->GetLocationX()[i] = (i * 7 % 32) / 31.0;
+                pLocations->GetLocationY()[i] = (i * 13 % 32) / 31.0;
+            }
+            sequential.GetLocationZ()[i] = parallel.GetLocationZ()[i] = (rand() % 32) / 31.0;
+            sequential_measurements[i] = parallel_measurements[i] = i;
+        }
+        for (auto ordering: {MORTON_ORDERING, HILBERT_ORDERING}) {
+            auto sequential_permutation = SpaceFillingCurve<double>::Reorder(
+                    size, sequential, sequential_measurements.data(), 1, ordering, 1);
+            auto parallel_permutation = SpaceFillingCurve<double>::Reorder(
+                    size, parallel, parallel_measurements.data(), 1, ordering, 4);
+            for (int i = 0; i < size; i++) {
+                REQUIRE(parallel_permutation[i] == sequential_permutation[i]);
+                REQUIRE(parallel.GetLocationX()[i] == sequential.GetLocationX()[i]);
+                REQUIRE(parallel.GetLocationY()[i] == sequential.GetLocationY()[i]);
+                REQUIRE(parallel.GetLocationZ()[i] == sequential.GetLocationZ()[i]);
+                REQUIRE(parallel_measurements[i] == sequential_measurements[i]);
+            }
+        }
+        // Locations already along the curve stay in place, including the ones sharing a key.
+        auto permutation = SpaceFillingCurve<double>::GetPermutation(size, parallel, HILBERT_ORDERING, 4);
+        for (int i = 0; i < size; i++) {
+            REQUIRE(permutation[i] == i);
+        }
+    }SECTION("Only space-filling curves are accepted") {
+        Locations<double> locations(1, Dimension2D);
+        REQUIRE_THROWS_AS(SpaceFillingCurve<double>::GetPermutation(1, locations, NO_ORDERING), invalid_argument);
+        REQUIRE_THROWS_AS(SpaceFillingCurve<double>::GetPermutation(1, locations, DEFAULT_ORDERING),
+                          invalid_argument);
+    }
+}
+
+TEST_CASE("Space Filling Curve") {
+    TEST_MORTON_KEY();
+    TEST_HILBERT_KEY();
+    TEST_REORDER();
+}
@@ -0,0 +1,215 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file TestSpatialIndex.cpp
+ * @brief Unit tests for the SpatialIndex.cpp in the ExaGeoStat software package.
+ * @details This file contains Catch2 unit tests that compare the k-d tree queries to a brute-force search.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include <catch2/catch_all.hpp>
+
+#include <helpers/SpatialIndex.hpp>
+#include <helpers/DistanceCalculationHelpers.hpp>
+
+using namespace std;
+
+using namespace exageostat::common;
+using namespace exageostat::helpers;
+using namespace exageostat::dataunits;
+
+/**
+ * @brief Fills locations with uniform random coordinates.
+ * @param[in,out] aLocations The locations.
+ * @param[in] aN The number of locations.
+ * @param[in] aScale The coordinates are drawn in [0, aScale].
+ * @return void
+ *
+ */
+void FillLocations(Locations<double> &aLocations, const int &aN, const double &aScale) {
+    for (int i = 0; i < aN; i++) {
+        aLocations.GetLocationX()[i] = aScale * rand() / RAND_MAX;
+        aLocations.GetLocationY()[i] = aScale * rand() / RAND_MAX;
+        if (aLocations.GetDimension() != Dimension2D) {
+            aLocations.GetLocationZ()[i] = aScale * rand() / RAND_MAX;
+        }
+    }
+}
+
+/**
+ * @brief Sorts all the locations by their distance to a query location.
+ * @return The (distance, index) pairs of the locations.
+ *
+ */
+vector<pair<double, int>> BruteForce(Locations<double> &aLocations, const int &aN, Locations<double> &aQueries,
+                                     const int &aQuery, const int &aDistanceMetric) {
+    vector<pair<double, int>> distances;
+    int flag_z = aLocations.GetDimension() == Dimension2D ? 0 : 1;
+    for (int j = 0; j < aN; j++) {
+        distances.emplace_back(
+                DistanceCalculationHelpers<double>::CalculateDistance(aQueries, aLocations, aQuery, j, aDistanceMetric,
+                                                                      flag_z), j);
+    }
+    sort(distances.begin(), distances.end());
+    return distances;
+}
+
+void TEST_K_NEAREST_NEIGHBORS() {
+
+    int N = 3000, queries_number = 200, k = 7;
+    srand(0);
+
+    SECTION("2D locations") {
+        Locations<double> locations(N, Dimension2D), queries(queries_number, Dimension2D);
+        FillLocations(locations, N, 1);
+        FillLocations(queries, queries_number, 1);
+        SpatialIndex<double> index(locations, N, EUCLIDEAN_DISTANCE, 4);
+        REQUIRE(index.GetSize() == N);
+
+        vector<int> indices(queries_number * k);
+        vector<double> distances(queries_number * k);
+        index.KNearestNeighbors(queries, queries_number, k, indices.data(), distances.data(), 3);
+        for (int i = 0; i < queries_number; i++) {
+            auto expected = BruteForce(locations, N, queries, i, 0);
+            for (int j = 0; j < k; j++) {
+                REQUIRE(indices[i * k + j] == expected[j].second);
+                REQUIRE(distances[i * k + j] == Catch::Approx(expected[j].first));
+            }
+        }
+    }SECTION("3D locations") {
+        Locations<double> locations(N, Dimension3D), queries(queries_number, Dimension3D);
+        FillLocations(locations, N, 10);
+        FillLocations(queries, queries_number, 10);
+        SpatialIndex<double> index(locations, N, EUCLIDEAN_DISTANCE, 2);
+
+        vector<int> indices(queries_number * k);
+        index.KNearestNeighbors(queries, queries_number, k, indices.data(), nullptr, 2);
+        for (int i = 0; i < queries_number; i++) {
+            auto expected = BruteForce(locations, N, queries, i, 0);
+            for (int j = 0; j < k; j++) {
+                REQUIRE(indices[i * k + j] == expected[j].second);
+            }
+        }
+    }SECTION("Great Circle distance") {
+        Locations<double> locations(N, Dimension2D), queries(queries_number, Dimension2D);
+        FillLocations(locations, N, 60);
+        FillLocations(queries, queries_number, 60);
+        SpatialIndex<double> index(locations, N, GREAT_CIRCLE_DISTANCE, 4);
+
+        vector<int> indices(queries_number * k);
+        vector<double> distances(queries_number * k);
+        index.KNearestNeighbors(queries, queries_number, k, indices.data(), distances.data(), 4);
+        for (int i = 0; i < queries_number; i++) {
+            auto expected = BruteForce(locations, N, queries, i, 1);
+            for (int j = 0; j < k; j++) {
+                REQUIRE(distances[i * k + j] == Catch::Approx(expected[j].first).epsilon(1e-6));
+            }
+        }
+        Locations<double> locations_3d(N, Dimension3D);
+        REQUIRE_THROWS_AS(SpatialIndex<double>(locations_3d, N, GREAT_CIRCLE_DISTANCE), runtime_error);
+    }SECTION("Fewer locations than neighbors") {
+        Locations<double> locations(3, Dimension2D), queries(1, Dimension2D);
+        FillLocations(locations, 3, 1);
+        FillLocations(queries, 1, 1);
+        SpatialIndex<double> index(locations, 3);
+
+        vector<int> indices(5);
+        vector<double> distances(5);
+        index.KNearestNeighbors(queries, 1, 5, indices.data(), distances.data());
+        REQUIRE(indices[2] >= 0);
+        REQUIRE(indices[3] == -1);
+        REQUIRE(indices[4] == -1);
+        REQUIRE(isinf(distances[4]));
+    }
+}
+
+void TEST_K_NEAREST_PRECEDING_NEIGHBORS() {
+
+    int N = 2000, k = 10;
+    srand(1);
+    Locations<double> locations(N, Dimension2D);
+    FillLocations(locations, N, 1);
+    // Duplicated coordinates must not break the tie order.
+    for (int i = 0; i < N; i += 50) {
+        locations.GetLocationY()[i] = 0.5;
+    }
+
+    SpatialIndex<double> index(locations, N, EUCLIDEAN_DISTANCE, 4);
+    vector<int> neighbors(N * k);
+    index.KNearestPrecedingNeighbors(k, neighbors.data(), 4);
+    for (int i = 0; i < N; i++) {
+        auto expected = BruteForce(locations, i, locations, i, 0);
+        for (int j = 0; j < k; j++) {
+            REQUIRE(neighbors[i * k + j] == (j < i ? expected[j].second : -1));
+        }
+    }
+}
+
+void TEST_RADIUS_NEIGHBORS() {
+
+    int N = 3000, queries_number = 100;
+    double radius = 0.05;
+    srand(2);
+
+    SECTION("Space-time locations") {
+        Locations<double> locations(N, DimensionST), queries(queries_number, DimensionST);
+        FillLocations(locations, N, 1);
+        FillLocations(queries, queries_number, 1);
+        // The time axis is shrunk, so the radius covers a longer time lag.
+        double time_scale = 0.5;
+        SpatialIndex<double> index(locations, N, EUCLIDEAN_DISTANCE, 3, time_scale);
+
+        vector<int> offsets, indices;
+        vector<double> distances;
+        index.RadiusNeighbors(queries, queries_number, radius * 2, offsets, indices, &distances, 3);
+        REQUIRE(offsets.size() == (size_t) queries_number + 1);
+        REQUIRE(offsets[queries_number] == (int) indices.size());
+        for (int i = 0; i < queries_number; i++) {
+            vector<int> expected;
+            for (int j = 0; j < N; j++) {
+                double dx = queries.GetLocationX()[i] - locations.GetLocationX()[j];
+                double dy = queries.GetLocationY()[i] - locations.GetLocationY()[j];
+                double dt = (queries.GetLocationZ()[i] - locations.GetLocationZ()[j]) * time_scale;
+                if (sqrt(dx * dx + dy * dy + dt * dt) <= radius * 2) {
+                    expected.push_back(j);
+                }
+            }
+            vector<int> found(indices.begin() + offsets[i], indices.begin() + offsets[i + 1]);
+            REQUIRE(is_sorted(distances.begin() + offsets[i], distances.begin() + offsets[i + 1]));
+            sort(found.begin(), found.end());
+            REQUIRE(found == expected);
+        }
+    }SECTION("Great Circle distance") {
+        Locations<double> locations(N, Dimension2D), queries(queries_number, Dimension2D);
+        FillLocations(locations, N, 20);
+        FillLocations(queries, queries_number, 20);
+        SpatialIndex<double> index(locations, N, GREAT_CIRCLE_DISTANCE, 2);
+
+        double kilometers = 150;
+        vector<int> offsets, indices;
+        index.RadiusNeighbors(queries, queries_number, kilometers, offsets, indices, nullptr, 2);
+        for (int i = 0; i < queries_number; i++) {
+            auto expected = BruteForce(locations, N, queries, i, 1);
+            int count = 0;
+            while (count < N && expected[count].first <= kilometers) {
+                count++;
+            }
+            REQUIRE(offsets[i + 1] - offsets[i] == count);
+        }
+    }
+}
+
+TEST_CASE("Spatial Index") {
+    TEST_K_NEAREST_NEIGHBORS();
+    TEST_K_NEAREST_PRECEDING_NEIGHBORS();
+    TEST_RADIUS_NEIGHBORS();
+}
@@ -0,0 +1,258 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file TestCovarianceTiles.cpp
+ * @brief Unit tests for the covariance tile generation of the kernels in the ExaGeoStat software package.
+ * @details This file contains Catch2 unit tests that check the kernels overriding GenerateCovarianceTile against
+ * their element-wise GenerateCovarianceMatrix, tile by tile, and the closed forms of the half-integer smoothness against
+ * the Bessel function, for the univariate and multivariate Matern kernels.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+extern "C" {
+#include <gsl/gsl_sf_bessel.h>
+}
+
+#include <kernels/Kernel.hpp>
+
+using namespace std;
+
+using namespace exageostat::common;
+using namespace exageostat::dataunits;
+using namespace exageostat::kernels;
+using namespace exageostat::helpers;
+
+//// Generator of the random locations, seeded by every test.
+static mt19937 TILE_LOCATIONS_GENERATOR;
+
+/**
+ * @brief Fills locations with uniform random coordinates in [0, 1].
+ * @param[in,out] aLocations The locations.
+ * @param[in] aN The number of locations.
+ * @return void
+ *
+ */
+void FillTileLocations(Locations<double> &aLocations, const int &aN) {
+    uniform_real_distribution<double> distribution(0, 1);
+    for (int i = 0; i < aN; i++) {
+        aLocations.GetLocationX()[i] = distribution(TILE_LOCATIONS_GENERATOR);
+        aLocations.GetLocationY()[i] = distribution(TILE_LOCATIONS_GENERATOR);
+        if (aLocations.GetDimension() != Dimension2D) {
+            aLocations.GetLocationZ()[i] = distribution(TILE_LOCATIONS_GENERATOR);
+        }
+    }
+}
+
+/**
+ * @brief Compares the tiles of a kernel to its element-wise covariance matrix, for two different sets of locations.
+ * @param[in] aKernelName The name of the kernel.
+ * @param[in] aTheta The kernel parameters.
+ * @param[in] aDimension The dimension of the locations.
+ * @return void
+ *
+ */
+void CompareTilesToMatrix(const string &aKernelName, vector<double> aTheta, const Dimension &aDimension) {
+
+    // The tile size does not divide the sizes, so the last tiles are partial.
+    const int rows_number = 13, columns_number = 9, tile_size = 4;
+    Locations<double> locations1(rows_number, aDimension), locations2(columns_number, aDimension);
+    FillTileLocations(locations1, rows_number);
+    FillTileLocations(locations2, columns_number);
+
+    unique_ptr<Kernel<double>> kernel(
+            exageostat::plugins::PluginRegistry<Kernel<double>>::Create(aKernelName, 1));
+    REQUIRE(kernel != nullptr);
+
+    vector<double> matrix(rows_number * columns_number);
+    kernel->GenerateCovarianceMatrix(matrix.data(), rows_number, columns_number, 0, 0, locations1, locations2,
+                                     locations1, aTheta.data(), 0);
+
+    for (int row_offset = 0; row_offset < rows_number; row_offset += tile_size) {
+        for (int column_offset = 0; column_offset < columns_number; column_offset += tile_size) {
+            const int rows = min(tile_size, rows_number - row_offset);
+            const int columns = min(tile_size, columns_number - column_offset);
+            vector<double> tile(rows * columns);
+            kernel->GenerateCovarianceTile(tile.data(), rows, columns, row_offset, column_offset, locations1,
+                                           locations2, locations1, aTheta.data(), 0);
+            for (int j = 0; j < columns; j++) {
+                for (int i = 0; i < rows; i++) {
+                    const double expected = matrix[(row_offset + i) + (column_offset + j) * rows_number];
+                    REQUIRE(tile[i + j * rows] == Catch::Approx(expected).epsilon(1e-12));
+                }
+            }
+        }
+    }
+}
+
+void TEST_COVARIANCE_TILES() {
+
+    // The exact Bessel path is compared, without closed forms nor tables.
+    KernelsConfigurations::GetSmoothnessTolerance() = 0;
+    KernelsConfigurations::GetBesselTableTolerance() = 0;
+    TILE_LOCATIONS_GENERATOR.seed(0);
+
+    for (auto dimension: {Dimension2D, Dimension3D}) {
+        CompareTilesToMatrix("UnivariateMaternStationary", {1, 0.1, 0.7}, dimension);
+        CompareTilesToMatrix("UnivariateMaternNuggetsStationary", {1, 0.1, 0.7, 0.2}, dimension);
+        CompareTilesToMatrix("UnivariatePowExpStationary", {1, 0.1, 1.5}, dimension);
+    }
+}
+
+/**
+ * @brief Compares the tiles of a Matern kernel to the Matern function evaluated with the Bessel function.
+ * @param[in] aKernelName The name of the kernel.
+ * @param[in] aTheta The kernel parameters.
+ * @param[in] aReferenceNu The smoothness the Bessel function is evaluated with.
+ * @param[in] aTolerance The relative tolerance of the comparison.
+ * @return void
+ *
+ */
+void CompareTilesToBessel(const string &aKernelName, vector<double> aTheta, const double &aReferenceNu,
+                          const double &aTolerance = 1e-10) {
+
+    const int locations_number = 11, tile_size = 4;
+    Locations<double> locations(locations_number, Dimension2D);
+    FillTileLocations(locations, locations_number);
+
+    unique_ptr<Kernel<double>> kernel(
+            exageostat::plugins::PluginRegistry<Kernel<double>>::Create(aKernelName, 1));
+    const double sigma_square = aTheta[0];
+    const double variance = aTheta.size() > 3 ? sigma_square + aTheta[3] : sigma_square;
+    const double con = sigma_square / (pow(2, aReferenceNu - 1) * tgamma(aReferenceNu));
+
+    for (int row_offset = 0; row_offset < locations_number; row_offset += tile_size) {
+        for (int column_offset = 0; column_offset < locations_number; column_offset += tile_size) {
+            const int rows = min(tile_size, locations_number - row_offset);
+            const int columns = min(tile_size, locations_number - column_offset);
+            vector<double> tile(rows * columns);
+            kernel->GenerateCovarianceTile(tile.data(), rows, columns, row_offset, column_offset, locations,
+                                           locations, locations, aTheta.data(), 0);
+            for (int j = 0; j < columns; j++) {
+                for (int i = 0; i < rows; i++) {
+                    const double distance = DistanceCalculationHelpers<double>::CalculateDistance(
+                            locations, locations, row_offset + i, column_offset + j, 0, 0) / aTheta[1];
+                    const double expected = distance == 0 ? variance : con * pow(distance, aReferenceNu) *
+                                                                       gsl_sf_bessel_Knu(aReferenceNu, distance);
+                    REQUIRE(tile[i + j * rows] == Catch::Approx(expected).epsilon(aTolerance));
+                }
+            }
+        }
+    }
+}
+
+void TEST_HALF_INTEGER_TILES() {
+
+    KernelsConfigurations::GetBesselTableTolerance() = 0;
+    TILE_LOCATIONS_GENERATOR.seed(1);
+
+    SECTION("Exact half-integer smoothness") {
+        // Even a zero tolerance selects the closed form of an exact half-integer.
+        KernelsConfigurations::GetSmoothnessTolerance() = 0;
+        for (double nu: {0.5, 1.5, 2.5}) {
+            CompareTilesToBessel("UnivariateMaternStationary", {1.5, 0.2, nu}, nu);
+            CompareTilesToBessel("UnivariateMaternNuggetsStationary", {1.5, 0.2, nu, 0.3}, nu);
+        }
+    }SECTION("Smoothness within the tolerance") {
+        // The smoothness is snapped to the nearest half-integer.
+        KernelsConfigurations::GetSmoothnessTolerance() = 1e-3;
+        for (double nu: {0.5, 1.5, 2.5}) {
+            CompareTilesToBessel("UnivariateMaternStationary", {1.5, 0.2, nu + 5e-4}, nu);
+            CompareTilesToBessel("UnivariateMaternNuggetsStationary", {1.5, 0.2, nu - 5e-4, 0.3}, nu);
+        }
+    }SECTION("Smoothness outside of the tolerance") {
+        // The Bessel function is evaluated at the given smoothness.
+        KernelsConfigurations::GetSmoothnessTolerance() = 1e-4;
+        for (double nu: {0.5, 1.5, 2.5}) {
+            CompareTilesToBessel("UnivariateMaternStationary", {1.5, 0.2, nu + 5e-4}, nu + 5e-4);
+            CompareTilesToBessel("UnivariateMaternNuggetsStationary", {1.5, 0.2, nu - 5e-4, 0.3}, nu - 5e-4);
+        }
+    }
+    KernelsConfigurations::GetSmoothnessTolerance() = 0;
+}
+
+/**
+ * @brief Compares the covariance of a multivariate Matern kernel at half-integer smoothness values to the Bessel
+ * function evaluated at a smoothness off by 1e-9.
+ * @param[in] aKernelName The name of the kernel.
+ * @param[in] aTheta The kernel parameters, with half-integer smoothness values.
+ * @param[in] aNuIndices The indices of the smoothness parameters in aTheta.
+ * @return void
+ *
+ */
+void CompareMultivariateClosedForms(const string &aKernelName, vector<double> aTheta, const vector<int> &aNuIndices) {
+
+    const int locations_number = 7;
+    Locations<double> locations(locations_number, Dimension2D);
+    FillTileLocations(locations, locations_number);
+
+    unique_ptr<Kernel<double>> kernel(
+            exageostat::plugins::PluginRegistry<Kernel<double>>::Create(aKernelName, 1));
+    REQUIRE(kernel != nullptr);
+    const int size = locations_number * kernel->GetVariablesNumber();
+
+    vector<double> closed_form(size * size), bessel(size * size);
+    kernel->GenerateCovarianceMatrix(closed_form.data(), size, size, 0, 0, locations, locations, locations,
+                                     aTheta.data(), 0);
+    for (int index: aNuIndices) {
+        aTheta[index] += 1e-9;
+    }
+    kernel->GenerateCovarianceMatrix(bessel.data(), size, size, 0, 0, locations, locations, locations,
+                                     aTheta.data(), 0);
+    for (int i = 0; i < size * size; i++) {
+        REQUIRE(closed_form[i] == Catch::Approx(bessel[i]).epsilon(1e-6));
+    }
+}
+
+void TEST_MULTIVARIATE_HALF_INTEGER() {
+
+    // With no tolerance, only the exact half-integers are evaluated in closed form.
+    KernelsConfigurations::GetSmoothnessTolerance() = 0;
+    KernelsConfigurations::GetBesselTableTolerance() = 0;
+    TILE_LOCATIONS_GENERATOR.seed(3);
+
+    // The cross smoothness values, the averages of the marginal ones, are half-integers as well.
+    CompareMultivariateClosedForms("BivariateMaternParsimonious", {1, 0.8, 0.2, 0.5, 2.5, 0.4}, {3, 4});
+    CompareMultivariateClosedForms("BivariateMaternFlexible", {0.2, 0.3, 0.5, 0.5, 0.5, 2.5, 0, 0.5, 1, 1, 0.3},
+                                   {4, 5});
+    CompareMultivariateClosedForms("TrivariateMaternParsimonious", {1, 0.8, 1.2, 0.2, 0.5, 2.5, 0.5, 0.3, 0.2, 0.1},
+                                   {4, 5, 6});
+    // A mix of closed forms, for 1.5, and Bessel functions, for the cross smoothness values 1 and 2.
+    CompareMultivariateClosedForms("TrivariateMaternParsimonious", {1, 0.8, 1.2, 0.2, 0.5, 1.5, 2.5, 0.3, 0.2, 0.1},
+                                   {4, 5, 6});
+}
+
+void TEST_INTERPOLATION_TABLE_TILES() {
+
+    // The tables are built over the whole range of the locations, within the unit square.
+    const double tolerance = 1e-8, range = 0.2;
+    KernelsConfigurations::GetSmoothnessTolerance() = 0;
+    KernelsConfigurations::GetBesselTableTolerance() = tolerance;
+    TILE_LOCATIONS_GENERATOR.seed(2);
+
+    for (double nu: {0.7, 1.3, 3.2}) {
+        // The tolerance is reachable, so the tiles are interpolated rather than computed exactly.
+        REQUIRE(MaternInterpolationTable<double>(nu, sqrt(2.0) / range, tolerance).IsValid());
+        CompareTilesToBessel("UnivariateMaternStationary", {1.5, range, nu}, nu, tolerance);
+        CompareTilesToBessel("UnivariateMaternNuggetsStationary", {1.5, range, nu, 0.3}, nu, tolerance);
+    }
+    KernelsConfigurations::GetBesselTableTolerance() = 0;
+}
+
+TEST_CASE("Kernels Covariance Tiles") {
+    TEST_COVARIANCE_TILES();
+    TEST_HALF_INTEGER_TILES();
+    TEST_MULTIVARIATE_HALF_INTEGER();
+    TEST_INTERPOLATION_TABLE_TILES();
+}
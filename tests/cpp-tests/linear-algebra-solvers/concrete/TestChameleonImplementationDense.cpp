@@ -20,6 +20,8 @@ extern "C" {
 #include <configurations/Configurations.hpp>
 #include <hardware/ExaGeoStatHardware.hpp>
 #include <data-units/DescriptorData.hpp>
+#include <kernels/Kernel.hpp>
+#include <results/Results.hpp>
 
 using namespace std;
 
@@ -27,6 +29,8 @@ using namespace exageostat::linearAlgebra;
 using namespace exageostat::common;
 using namespace exageostat::dataunits;
 using namespace exageostat::configurations;
+using namespace exageostat::kernels;
+using namespace exageostat::results;
 
 //Test that the function initializes the CHAM_descriptorC descriptor correctly.
 void TEST_CHAMELEON_DESCRIPTORS_VALUES() {
@@ -383,7 +387,237 @@ void TEST_CHAMELEON_DESCRIPTORS_VALUES() {
     }
 }
 
+/**
+ * @brief Evaluates the log likelihood of 16 fixed locations, and its gradient, on freshly allocated descriptors.
+ * @param[in] aConfigurations The configurations of the evaluation.
+ * @param[in] aTheta The parameters of the univariate Matern kernel.
+ * @param[in] aMeasurements The 16 measurements.
+ * @param[out] apGradient The gradient of the log likelihood, or nullptr to skip it.
+ * @return The log likelihood.
+ *
+ */
+double EvaluateLikelihood(Configurations &aConfigurations, vector<double> aTheta, vector<double> aMeasurements,
+                          double *apGradient) {
+
+    const int N = 16;
+    vector<double> location_x{0.193041886015106440, 0.330556191348134576, 0.181612878614480805,
+                              0.370473792629892440, 0.652140077821011688, 0.806332494087129037,
+                              0.553322652018005678, 0.800961318379491916, 0.207324330510414295,
+                              0.347951476310368490, 0.092042420080872822, 0.465445944914930965,
+                              0.528267338063630132, 0.974792095826657490, 0.552452887769893985,
+                              0.877592126344701295};
+    vector<double> location_y{0.103883421072709245, 0.135790035858701447, 0.434683756771190977,
+                              0.400778210116731537, 0.168459601739528508, 0.105195696955825133,
+                              0.396398870832379624, 0.296757457846952011, 0.564507515068284116,
+                              0.627679865720607300, 0.928648813611047563, 0.958236057068741931,
+                              0.573571374074921758, 0.568657969024185528, 0.935835812924391552,
+                              0.942824444953078489};
+
+    auto data = std::make_unique<ExaGeoStatData<double>>(N, Dimension2D);
+    data->GetLocations()->SetLocationX(*location_x.data(), N);
+    data->GetLocations()->SetLocationY(*location_y.data(), N);
+
+    unique_ptr<Kernel<double>> kernel(
+            exageostat::plugins::PluginRegistry<Kernel<double>>::Create("UnivariateMaternStationary", 1));
+    auto linear_algebra_solver = LinearAlgebraFactory<double>::CreateLinearAlgebraSolver(EXACT_DENSE);
+    double loglik = linear_algebra_solver->ExaGeoStatMLETile(data, aConfigurations, aTheta.data(),
+                                                             aMeasurements.data(), *kernel);
+    if (apGradient != nullptr) {
+        linear_algebra_solver->ExaGeoStatMLEGradientTile(aConfigurations, data, aTheta.data(), apGradient,
+                                                         *kernel);
+    }
+    return loglik;
+}
+
+//Test that the likelihood gradient matches the central finite differences of the likelihood.
+void TEST_MLE_GRADIENT() {
+
+    Configurations configurations;
+    configurations.SetProblemSize(16);
+    configurations.SetDenseTileSize(5);
+    configurations.SetKernelName("UnivariateMaternStationary");
+    configurations.SetComputation(EXACT_DENSE);
+    auto hardware = ExaGeoStatHardware(EXACT_DENSE, 2, 0);
+    // The smoothness is away from the half-integers, and the Bessel function is evaluated exactly.
+    KernelsConfigurations::GetSmoothnessTolerance() = 0;
+    KernelsConfigurations::GetBesselTableTolerance() = 0;
+
+    vector<double> theta{1.2, 0.15, 0.8};
+    vector<double> measurements{-1.272336140360187606, -2.590699695867695773, 0.512142584178685967,
+                                -0.163880452049749520, 0.313503633252489700, -1.474410682226017677,
+                                0.161705025505231914, 0.623389205185149065, -1.341858445399783495,
+                                -1.054282062428600009, -1.669383221392507943, 0.219170645803740793,
+                                0.971213790000161170, 0.538973474182433021, -0.752828466476077041,
+                                0.290822066007430102};
+
+    vector<double> finite_differences(theta.size());
+    for (size_t j = 0; j < theta.size(); j++) {
+        double step = 1e-6 * theta[j];
+        vector<double> theta_forward = theta, theta_backward = theta;
+        theta_forward[j] += step;
+        theta_backward[j] -= step;
+        finite_differences[j] = (EvaluateLikelihood(configurations, theta_forward, measurements, nullptr) -
+                                 EvaluateLikelihood(configurations, theta_backward, measurements, nullptr)) /
+                                (2 * step);
+    }
+
+    SECTION("Exact traces")
+    {
+        vector<double> gradient(theta.size());
+        EvaluateLikelihood(configurations, theta, measurements, gradient.data());
+        for (size_t j = 0; j < theta.size(); j++) {
+            // The smoothness derivative kernel differentiates the Bessel function numerically.
+            REQUIRE(gradient[j] == Catch::Approx(finite_differences[j]).epsilon(1e-4).margin(1e-6));
+        }
+    }SECTION("Stochastic traces")
+    {
+        // With zero measurements, the gradient is -1/2 * trace(C^-1 * dC_j).
+        vector<double> zero_gradient(theta.size());
+        EvaluateLikelihood(configurations, theta, vector<double>(16, 0), zero_gradient.data());
+
+        configurations.SetTraceProbesNumber(256);
+        vector<double> gradient(theta.size());
+        EvaluateLikelihood(configurations, theta, measurements, gradient.data());
+        double relative_error = Results::GetInstance()->GetTraceEstimatorStandardError();
+        REQUIRE(relative_error > 0);
+        for (size_t j = 0; j < theta.size(); j++) {
+            // The quadratic term is exact, only the trace is estimated, within five of its standard errors.
+            double trace = -2 * zero_gradient[j];
+            double tolerance = 0.5 * 5 * relative_error * fabs(trace) + 1e-4 * fabs(finite_differences[j]);
+            REQUIRE(fabs(gradient[j] - finite_differences[j]) <= tolerance);
+        }
+    }
+}
+
+//Test that the Hutchinson trace estimates converge to the exact traces as the probes are added.
+void TEST_TRACE_ESTIMATOR() {
+
+    Configurations configurations;
+    configurations.SetProblemSize(16);
+    configurations.SetDenseTileSize(5);
+    configurations.SetKernelName("UnivariateMaternStationary");
+    configurations.SetComputation(EXACT_DENSE);
+    auto hardware = ExaGeoStatHardware(EXACT_DENSE, 2, 0);
+    KernelsConfigurations::GetSmoothnessTolerance() = 0;
+    KernelsConfigurations::GetBesselTableTolerance() = 0;
+
+    // With zero measurements, the gradient is -1/2 * trace(C^-1 * dC_j).
+    vector<double> theta{1.2, 0.15, 0.8}, measurements(16, 0);
+    vector<double> exact_traces(theta.size());
+    EvaluateLikelihood(configurations, theta, measurements, exact_traces.data());
+
+    vector<double> relative_errors;
+    for (int probes_number: {64, 1024}) {
+        // The probe descriptors are sized by the probes number, so each count uses fresh descriptors.
+        configurations.SetTraceProbesNumber(probes_number);
+        vector<double> estimated_traces(theta.size());
+        EvaluateLikelihood(configurations, theta, measurements, estimated_traces.data());
+        double relative_error = Results::GetInstance()->GetTraceEstimatorStandardError();
+        REQUIRE(relative_error > 0);
+        REQUIRE(relative_error < 1);
+        for (size_t j = 0; j < theta.size(); j++) {
+            REQUIRE(fabs(estimated_traces[j] - exact_traces[j]) <= 5 * relative_error * fabs(estimated_traces[j]));
+        }
+        relative_errors.push_back(relative_error);
+        configurations.SetTraceProbesNumber(0);
+    }
+    // The standard error decreases as one over the square root of the probes number.
+    REQUIRE(relative_errors[1] < relative_errors[0] / 2);
+}
+
+//Test that the likelihood of successive MLE iterations is the same with and without the distance cache.
+void TEST_DISTANCE_CACHE() {
+
+    const int N = 16;
+    Configurations configurations;
+    configurations.SetProblemSize(N);
+    configurations.SetDenseTileSize(5);
+    configurations.SetKernelName("UnivariateMaternStationary");
+    configurations.SetComputation(EXACT_DENSE);
+    auto hardware = ExaGeoStatHardware(EXACT_DENSE, 2, 0);
+    KernelsConfigurations::GetSmoothnessTolerance() = 0;
+    KernelsConfigurations::GetBesselTableTolerance() = 0;
+
+    vector<double> location_x(N), location_y(N);
+    for (int i = 0; i < N; i++) {
+        location_x[i] = 0.05 + 0.9 * (i % 4) / 3 + 0.01 * i;
+        location_y[i] = 0.05 + 0.9 * (i / 4) / 3 - 0.005 * i;
+    }
+    vector<double> measurements{-1.272336140360187606, -2.590699695867695773, 0.512142584178685967,
+                                -0.163880452049749520, 0.313503633252489700, -1.474410682226017677,
+                                0.161705025505231914, 0.623389205185149065, -1.341858445399783495,
+                                -1.054282062428600009, -1.669383221392507943, 0.219170645803740793,
+                                0.971213790000161170, 0.538973474182433021, -0.752828466476077041,
+                                0.290822066007430102};
+    // The thetas an optimizer would visit in successive iterations.
+    vector<vector<double>> thetas{{1.2, 0.15, 0.8},
+                                  {0.9, 0.1,  1.3},
+                                  {1.5, 0.25, 0.5}};
+
+    unique_ptr<Kernel<double>> kernel(
+            exageostat::plugins::PluginRegistry<Kernel<double>>::Create("UnivariateMaternStationary", 1));
+    auto linear_algebra_solver = LinearAlgebraFactory<double>::CreateLinearAlgebraSolver(EXACT_DENSE);
+
+    // The same data is used by all the iterations, as in the modeling, so the cache is computed once.
+    auto uncached_data = std::make_unique<ExaGeoStatData<double>>(N, Dimension2D);
+    auto cached_data = std::make_unique<ExaGeoStatData<double>>(N, Dimension2D);
+    for (auto *pData: {uncached_data.get(), cached_data.get()}) {
+        pData->GetLocations()->SetLocationX(*location_x.data(), N);
+        pData->GetLocations()->SetLocationY(*location_y.data(), N);
+    }
+
+    for (auto &theta: thetas) {
+        configurations.SetDistanceCacheBudget(0);
+        double uncached_loglik = linear_algebra_solver->ExaGeoStatMLETile(uncached_data, configurations, theta.data(),
+                                                                          measurements.data(), *kernel);
+        configurations.SetDistanceCacheBudget(1);
+        double cached_loglik = linear_algebra_solver->ExaGeoStatMLETile(cached_data, configurations, theta.data(),
+                                                                        measurements.data(), *kernel);
+
+        REQUIRE(uncached_data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
+                                                                  DESCRIPTOR_DISTANCE).chameleon_desc == nullptr);
+        REQUIRE(cached_data->GetDescriptorData()->GetDescriptor(CHAMELEON_DESCRIPTOR,
+                                                                DESCRIPTOR_DISTANCE).chameleon_desc != nullptr);
+        REQUIRE(cached_loglik == Catch::Approx(uncached_loglik).epsilon(1e-10));
+    }
+    REQUIRE(cached_data->GetMleIterations() == (int) thetas.size());
+}
+
+//Test that the mixed-precision likelihood, with the tiles away from the diagonal in single precision, stays close to the double precision one.
+void TEST_MIXED_PRECISION() {
+
+    Configurations configurations;
+    configurations.SetProblemSize(16);
+    configurations.SetDenseTileSize(5);
+    configurations.SetKernelName("UnivariateMaternStationary");
+    configurations.SetComputation(EXACT_DENSE);
+    auto hardware = ExaGeoStatHardware(EXACT_DENSE, 2, 0);
+    KernelsConfigurations::GetSmoothnessTolerance() = 0;
+    KernelsConfigurations::GetBesselTableTolerance() = 0;
+
+    vector<double> theta{1.2, 0.15, 0.8}, measurements(16);
+    for (int i = 0; i < 16; i++) {
+        measurements[i] = sin(1.7 * i + 0.3);
+    }
+    double reference_loglik = EvaluateLikelihood(configurations, theta, measurements, nullptr);
+
+    configurations.SetPrecision(MIXED);
+    // Of the 10 tiles of the lower part, 6 are in single precision with one double tile diagonal, and none with four.
+    for (int band: {1, 2, 4}) {
+        configurations.SetBand(band);
+        double loglik = EvaluateLikelihood(configurations, theta, measurements, nullptr);
+        REQUIRE(loglik == Catch::Approx(reference_loglik).epsilon(1e-4));
+        if (band == 4) {
+            REQUIRE(loglik == Catch::Approx(reference_loglik).epsilon(1e-12));
+        }
+    }
+}
+
 TEST_CASE("Chameleon Implementation Dense") {
     TEST_CHAMELEON_DESCRIPTORS_VALUES();
+    TEST_MLE_GRADIENT();
+    TEST_TRACE_ESTIMATOR();
+    TEST_DISTANCE_CACHE();
+    TEST_MIXED_PRECISION();
 
 }
@@ -0,0 +1,127 @@
+
+// Copyright (c) 2017-2024 King Abdullah University of Science and Technology,
+// All rights reserved.
+// ExaGeoStat is a software package, provided by King Abdullah University of Science and Technology (KAUST).
+
+/**
+ * @file TestChameleonImplementationVecchia.cpp
+ * @brief Unit tests for the Vecchia approximation computation in the ExaGeoStat software package.
+ * @version 1.1.0
+ * @author agent
+ * @date 2026-10-16
+**/
+
+#include <algorithm>
+#include <cmath>
+
+#include <catch2/catch_all.hpp>
+#include <linear-algebra-solvers/concrete/chameleon/vecchia/ChameleonVecchia.hpp>
+#include <configurations/Configurations.hpp>
+#include <hardware/ExaGeoStatHardware.hpp>
+#include <data-units/DescriptorData.hpp>
+
+using namespace std;
+
+using namespace exageostat::linearAlgebra::vecchia;
+using namespace exageostat::common;
+using namespace exageostat::dataunits;
+using namespace exageostat::configurations;
+
+//Test that the conditioning neighbors are the nearest previous locations.
+void TEST_VECCHIA_NEIGHBORS() {
+
+    int N = 2000, m = 10;
+    Locations<double> locations(N, Dimension2D);
+    srand(0);
+    for (int i = 0; i < N; i++) {
+        locations.GetLocationX()[i] = (double) rand() / RAND_MAX;
+        locations.GetLocationY()[i] = (double) rand() / RAND_MAX;
+    }
+
+    SECTION("Nearest previous locations")
+    {
+        vector<int> neighbors = ChameleonVecchia<double>::FindNeighbors(locations, N, m, EUCLIDEAN_DISTANCE, 4);
+        REQUIRE(neighbors.size() == (size_t) N * m);
+
+        double *x = locations.GetLocationX(), *y = locations.GetLocationY();
+        for (int i = 0; i < N; i++) {
+            vector<pair<double, int>> candidates;
+            for (int j = 0; j < i; j++) {
+                candidates.emplace_back((x[i] - x[j]) * (x[i] - x[j]) + (y[i] - y[j]) * (y[i] - y[j]), j);
+            }
+            sort(candidates.begin(), candidates.end());
+            for (int k = 0; k < m; k++) {
+                int expected = k < (int) candidates.size() ? candidates[k].second : -1;
+                REQUIRE(neighbors[(size_t) i * m + k] == expected);
+            }
+        }
+    }SECTION("Collinear locations")
+    {
+        for (int i = 0; i < N; i++) {
+            locations.GetLocationY()[i] = 0.5;
+        }
+        vector<int> neighbors = ChameleonVecchia<double>::FindNeighbors(locations, N, m, EUCLIDEAN_DISTANCE, 2);
+        double *x = locations.GetLocationX();
+        for (int i = 1; i < N; i++) {
+            // The first neighbor is the closest previous location.
+            double closest = *min_element(x, x + i, [&](const double &a, const double &b) {
+                return fabs(a - x[i]) < fabs(b - x[i]);
+            });
+            REQUIRE(fabs(x[neighbors[(size_t) i * m]] - x[i]) == fabs(closest - x[i]));
+        }
+    }SECTION("Great-circle distance near the pole and across the antimeridian")
+    {
+        // Latitudes and longitudes in degrees, the closest points in degrees are not the closest on the sphere.
+        for (int i = 0; i < N; i++) {
+            locations.GetLocationX()[i] = 60 + 29.9 * rand() / RAND_MAX;
+            locations.GetLocationY()[i] = -180 + 360.0 * rand() / RAND_MAX;
+        }
+        vector<int> neighbors = ChameleonVecchia<double>::FindNeighbors(locations, N, m, GREAT_CIRCLE_DISTANCE, 4);
+
+        double *latitudes = locations.GetLocationX(), *longitudes = locations.GetLocationY();
+        auto haversine = [&](const int &i, const int &j) {
+            double u = sin((latitudes[i] - latitudes[j]) * M_PI / 360);
+            double v = sin((longitudes[i] - longitudes[j]) * M_PI / 360);
+            return u * u + cos(latitudes[i] * M_PI / 180) * cos(latitudes[j] * M_PI / 180) * v * v;
+        };
+        for (int i = 0; i < N; i++) {
+            vector<pair<double, int>> candidates;
+            for (int j = 0; j < i; j++) {
+                candidates.emplace_back(haversine(i, j), j);
+            }
+            sort(candidates.begin(), candidates.end());
+            for (int k = 0; k < m; k++) {
+                int expected = k < (int) candidates.size() ? candidates[k].second : -1;
+                REQUIRE(neighbors[(size_t) i * m + k] == expected);
+            }
+        }
+    }
+}
+
+//Test that the Vecchia descriptors do not include the covariance matrix.
+void TEST_VECCHIA_DESCRIPTORS() {
+
+    Configurations configurations;
+    configurations.SetProblemSize(64);
+    configurations.SetDenseTileSize(16);
+    configurations.SetComputation(VECCHIA_APPROX);
+    auto hardware = ExaGeoStatHardware(VECCHIA_APPROX, 1, 0);
+
+    ChameleonVecchia<double> linear_algebra_solver;
+    DescriptorData<double> descriptor_data;
+    linear_algebra_solver.InitiateVecchiaDescriptors(configurations, descriptor_data);
+
+    REQUIRE(descriptor_data.GetDescriptor(CHAMELEON_DESCRIPTOR, DESCRIPTOR_C).chameleon_desc == nullptr);
+    auto *CHAM_desc_Z = descriptor_data.GetDescriptor(CHAMELEON_DESCRIPTOR, DESCRIPTOR_Z).chameleon_desc;
+    REQUIRE(CHAM_desc_Z != nullptr);
+    REQUIRE(CHAM_desc_Z->m == 64);
+    REQUIRE(CHAM_desc_Z->n == 1);
+    REQUIRE(descriptor_data.GetDescriptor(CHAMELEON_DESCRIPTOR, DESCRIPTOR_DETERMINANT).chameleon_desc != nullptr);
+    REQUIRE(descriptor_data.GetDescriptor(CHAMELEON_DESCRIPTOR, DESCRIPTOR_PRODUCT).chameleon_desc != nullptr);
+    REQUIRE(descriptor_data.GetSequence() != nullptr);
+}
+
+TEST_CASE("Chameleon Implementation Vecchia") {
+    TEST_VECCHIA_NEIGHBORS();
+    TEST_VECCHIA_DESCRIPTORS();
+}
@@ -15,6 +15,7 @@
 #include <catch2/catch_all.hpp>
 
 #include <prediction/Prediction.hpp>
+#include <linear-algebra-solvers/LinearAlgebraFactory.hpp>
 
 using namespace std;
 
@@ -22,6 +23,80 @@ using namespace exageostat::common;
 using namespace exageostat::prediction;
 using namespace exageostat::results;
 using namespace exageostat::configurations;
+using namespace exageostat::dataunits;
+
+/**
+ * @brief Generates a dense covariance matrix between two sets of locations, in column-major order.
+ * @return The covariance matrix, with a row per location of the first set.
+ *
+ */
+vector<double> DenseCovariance(exageostat::kernels::Kernel<double> &aKernel, Locations<double> &aLocations1,
+                               Locations<double> &aLocations2, vector<double> aTheta) {
+    vector<double> covariance(aLocations1.GetSize() * aLocations2.GetSize());
+    aKernel.GenerateCovarianceMatrix(covariance.data(), aLocations1.GetSize(), aLocations2.GetSize(), 0, 0,
+                                     aLocations1, aLocations2, aLocations1, aTheta.data(), 0);
+    return covariance;
+}
+
+/**
+ * @brief Solves Sigma X = B densely through the Cholesky factorization of Sigma.
+ * @param[in] aSigma The symmetric positive definite n-by-n matrix, in column-major order.
+ * @param[in] aB The n-by-columns right hand sides, in column-major order.
+ * @return The solution X.
+ *
+ */
+vector<double> DenseSolve(vector<double> aSigma, vector<double> aB, const int &aN, const int &aColumns) {
+    for (int j = 0; j < aN; j++) {
+        for (int k = 0; k < j; k++) {
+            aSigma[j + j * aN] -= aSigma[j + k * aN] * aSigma[j + k * aN];
+        }
+        aSigma[j + j * aN] = sqrt(aSigma[j + j * aN]);
+        for (int i = j + 1; i < aN; i++) {
+            for (int k = 0; k < j; k++) {
+                aSigma[i + j * aN] -= aSigma[i + k * aN] * aSigma[j + k * aN];
+            }
+            aSigma[i + j * aN] /= aSigma[j + j * aN];
+        }
+    }
+    for (int c = 0; c < aColumns; c++) {
+        double *pX = aB.data() + c * aN;
+        for (int i = 0; i < aN; i++) {
+            for (int k = 0; k < i; k++) {
+                pX[i] -= aSigma[i + k * aN] * pX[k];
+            }
+            pX[i] /= aSigma[i + i * aN];
+        }
+        for (int i = aN - 1; i >= 0; i--) {
+            for (int k = i + 1; k < aN; k++) {
+                pX[i] -= aSigma[k + i * aN] * pX[k];
+            }
+            pX[i] /= aSigma[i + i * aN];
+        }
+    }
+    return aB;
+}
+
+/**
+ * @brief Computes the dot product of two columns of length n.
+ * @return The dot product.
+ *
+ */
+double DenseDot(const double *apX, const double *apY, const int &aN) {
+    double dot = 0;
+    for (int i = 0; i < aN; i++) {
+        dot += apX[i] * apY[i];
+    }
+    return dot;
+}
+
+/**
+ * @brief Applies the Tukey g-and-h transformation to a Gaussian value.
+ * @return The transformed value.
+ *
+ */
+double TukeyGH(const double &aValue, const double &aXi, const double &aOmega, const double &aG, const double &aH) {
+    return aXi + aOmega * (exp(aG * aValue) - 1) / aG * exp(aH * aValue * aValue / 2);
+}
 
 void TEST_PREDICTION_MISSING_DATA() {
 
@@ -95,6 +170,195 @@ void TEST_PREDICTION_MISSING_DATA() {
 
         REQUIRE(Results::GetInstance()->GetMSPEError() == Catch::Approx(0.552448));
         delete pKernel;
+    }SECTION("Test Prediction - MSPE with the retained factor") {
+        configurations.SetIsIDW(false);
+        configurations.SetIsMLOEMMOM(false);
+        configurations.SetIsFisher(false);
+        configurations.SetIsMSPE(true);
+        configurations.SetIsKrigingVariance(true);
+
+        vector<double> estimated_theta{0.9, 0.09, 0.4};
+        configurations.SetEstimatedTheta(estimated_theta);
+        exageostat::kernels::Kernel<double> *pKernel = exageostat::plugins::PluginRegistry<exageostat::kernels::Kernel<double>>::Create(
+                configurations.GetKernelName(),
+                configurations.GetTimeSlot());
+
+        // The modeling locations are the observations, the missing locations lie between them.
+        int n_miss = 4;
+        Locations<double> miss_locations(n_miss, Dimension2D);
+        for (int i = 0; i < n_miss; i++) {
+            miss_locations.GetLocationX()[i] = (location_x[i] + location_x[i + 1]) / 2;
+            miss_locations.GetLocationY()[i] = (location_y[i] + location_y[i + 1]) / 2;
+        }
+        configurations.InitializeDataPredictionArguments();
+
+        // The likelihood evaluation at the estimated theta leaves its Cholesky factor in C. It solves the
+        // measurements in place, so it is given a copy of them.
+        vector<double> z_modeling(z_matrix, z_matrix + N);
+        auto linear_algebra_solver = exageostat::linearAlgebra::LinearAlgebraFactory<double>::CreateLinearAlgebraSolver(
+                EXACT_DENSE);
+        linear_algebra_solver->ExaGeoStatMLETile(data, configurations, estimated_theta.data(), z_modeling.data(),
+                                                 *pKernel);
+
+        configurations.SetIsRetainFactor(false);
+        Prediction<double>::PredictMissingData(data, configurations, z_matrix, *pKernel, data->GetLocations(),
+                                               &miss_locations);
+        auto regenerated_values = Results::GetInstance()->GetPredictedMissedValues();
+        auto regenerated_variances = Results::GetInstance()->GetPredictedVariances();
+
+        configurations.SetIsRetainFactor(true);
+        REQUIRE(linear_algebra_solver->IsFactorReusable(configurations, data, estimated_theta.data(), 3,
+                                                        *data->GetLocations()));
+        Prediction<double>::PredictMissingData(data, configurations, z_matrix, *pKernel, data->GetLocations(),
+                                               &miss_locations);
+        auto retained_values = Results::GetInstance()->GetPredictedMissedValues();
+        auto retained_variances = Results::GetInstance()->GetPredictedVariances();
+
+        // Both must be the kriging predictor and variance computed densely.
+        auto sigma = DenseCovariance(*pKernel, *data->GetLocations(), *data->GetLocations(), estimated_theta);
+        auto cross = DenseCovariance(*pKernel, *data->GetLocations(), miss_locations, estimated_theta);
+        auto weights = DenseSolve(sigma, cross, N, n_miss);
+        REQUIRE(retained_values.size() == (size_t) n_miss);
+        REQUIRE(retained_variances.size() == (size_t) n_miss);
+        for (int j = 0; j < n_miss; j++) {
+            double value = DenseDot(weights.data() + j * N, z_matrix, N);
+            double variance = estimated_theta[0] - DenseDot(weights.data() + j * N, cross.data() + j * N, N);
+            REQUIRE(regenerated_values[j] == Catch::Approx(value).epsilon(1e-8));
+            REQUIRE(retained_values[j] == Catch::Approx(regenerated_values[j]).epsilon(1e-10));
+            REQUIRE(regenerated_variances[j] == Catch::Approx(variance).epsilon(1e-8).margin(1e-12));
+            REQUIRE(retained_variances[j] == Catch::Approx(regenerated_variances[j]).epsilon(1e-10).margin(1e-12));
+        }
+        delete pKernel;
+    }SECTION("Test Prediction - Great-circle factor is not reused") {
+        configurations.SetIsIDW(false);
+        configurations.SetIsMLOEMMOM(false);
+        configurations.SetIsFisher(false);
+        configurations.SetIsMSPE(true);
+        configurations.SetIsRetainFactor(true);
+        configurations.SetDistanceMetric(GREAT_CIRCLE_DISTANCE);
+
+        vector<double> estimated_theta{0.9, 0.09, 0.4};
+        configurations.SetEstimatedTheta(estimated_theta);
+        exageostat::kernels::Kernel<double> *pKernel = exageostat::plugins::PluginRegistry<exageostat::kernels::Kernel<double>>::Create(
+                configurations.GetKernelName(),
+                configurations.GetTimeSlot());
+        configurations.InitializeDataPredictionArguments();
+
+        // The factor of a great-circle covariance cannot solve against the euclidean cross covariances.
+        vector<double> z_modeling(z_matrix, z_matrix + N);
+        auto linear_algebra_solver = exageostat::linearAlgebra::LinearAlgebraFactory<double>::CreateLinearAlgebraSolver(
+                EXACT_DENSE);
+        linear_algebra_solver->ExaGeoStatMLETile(data, configurations, estimated_theta.data(), z_modeling.data(),
+                                                 *pKernel);
+        REQUIRE(data->GetFactorTheta() == estimated_theta);
+        REQUIRE_FALSE(linear_algebra_solver->IsFactorReusable(configurations, data, estimated_theta.data(), 3,
+                                                              *data->GetLocations()));
+        configurations.SetDistanceMetric(EUCLIDEAN_DISTANCE);
+        delete pKernel;
+    }SECTION("Test Prediction - Kriging variance") {
+        configurations.SetIsIDW(false);
+        configurations.SetIsMLOEMMOM(false);
+        configurations.SetIsFisher(false);
+        configurations.SetIsMSPE(true);
+        configurations.SetIsKrigingVariance(true);
+
+        vector<double> estimated_theta{0.9, 0.09, 0.4};
+        configurations.SetEstimatedTheta(estimated_theta);
+        exageostat::kernels::Kernel<double> *pKernel = exageostat::plugins::PluginRegistry<exageostat::kernels::Kernel<double>>::Create(
+                configurations.GetKernelName(),
+                configurations.GetTimeSlot());
+
+        // The last locations are predicted from the first ones.
+        int n_obs = 12, n_miss = N - n_obs;
+        Locations<double> obs_locations(n_obs, Dimension2D), miss_locations(n_miss, Dimension2D);
+        obs_locations.SetLocationX(*location_x, n_obs);
+        obs_locations.SetLocationY(*location_y, n_obs);
+        miss_locations.SetLocationX(*(location_x + n_obs), n_miss);
+        miss_locations.SetLocationY(*(location_y + n_obs), n_miss);
+        configurations.InitializeDataPredictionArguments();
+        Prediction<double>::PredictMissingData(data, configurations, z_matrix, *pKernel, &obs_locations,
+                                               &miss_locations);
+
+        // sigma^2 - diag(C12^T * C22^-1 * C12), computed densely.
+        auto sigma = DenseCovariance(*pKernel, obs_locations, obs_locations, estimated_theta);
+        auto cross = DenseCovariance(*pKernel, obs_locations, miss_locations, estimated_theta);
+        auto weights = DenseSolve(sigma, cross, n_obs, n_miss);
+        auto variances = Results::GetInstance()->GetPredictedVariances();
+        REQUIRE(variances.size() == (size_t) n_miss);
+        for (int j = 0; j < n_miss; j++) {
+            double variance =
+                    estimated_theta[0] - DenseDot(weights.data() + j * n_obs, cross.data() + j * n_obs, n_obs);
+            REQUIRE(variances[j] == Catch::Approx(variance).epsilon(1e-8).margin(1e-12));
+            REQUIRE(variances[j] >= 0);
+        }
+
+        // The variance is only computed by the Gaussian MSPE prediction.
+        configurations.SetIsMSPE(false);
+        REQUIRE_THROWS_AS(Prediction<double>::PredictMissingData(data, configurations, z_matrix, *pKernel,
+                                                                 &obs_locations, &miss_locations), domain_error);
+        configurations.SetIsMSPE(true);
+        configurations.SetIsNonGaussian(true);
+        REQUIRE_THROWS_AS(Prediction<double>::PredictMissingData(data, configurations, z_matrix, *pKernel,
+                                                                 &obs_locations, &miss_locations), domain_error);
+        delete pKernel;
+    }SECTION("Test Prediction - Non-Gaussian MSPE against the dense predictor") {
+        configurations.SetIsIDW(false);
+        configurations.SetIsMLOEMMOM(false);
+        configurations.SetIsFisher(false);
+        configurations.SetIsMSPE(true);
+        configurations.SetKernelName("UnivariateMaternNonGaussian");
+        configurations.SetIsNonGaussian(true);
+
+        // Range, smoothness, then the location, scale, skewness and kurtosis of the Tukey g-and-h field.
+        vector<double> estimated_theta{1, 0.5, 0.1, 1.2, 0.2, 0.1};
+        configurations.SetEstimatedTheta(estimated_theta);
+        exageostat::kernels::Kernel<double> *pKernel = exageostat::plugins::PluginRegistry<exageostat::kernels::Kernel<double>>::Create(
+                configurations.GetKernelName(),
+                configurations.GetTimeSlot());
+
+        int n_obs = 12, n_miss = N - n_obs;
+        Locations<double> obs_locations(n_obs, Dimension2D), miss_locations(n_miss, Dimension2D);
+        obs_locations.SetLocationX(*location_x, n_obs);
+        obs_locations.SetLocationY(*location_y, n_obs);
+        miss_locations.SetLocationX(*(location_x + n_obs), n_miss);
+        miss_locations.SetLocationY(*(location_y + n_obs), n_miss);
+        configurations.InitializeDataPredictionArguments();
+        Prediction<double>::PredictMissingData(data, configurations, z_matrix, *pKernel, &obs_locations,
+                                               &miss_locations);
+        auto predicted_values = Results::GetInstance()->GetPredictedMissedValues();
+        REQUIRE(predicted_values.size() == (size_t) n_miss);
+
+        // The observations are brought back to the Gaussian field by bisection, as the transformation is increasing.
+        double xi = estimated_theta[2], omega = estimated_theta[3], g = estimated_theta[4], h = estimated_theta[5];
+        vector<double> z_gaussian(n_obs);
+        for (int i = 0; i < n_obs; i++) {
+            double lower = -10, upper = 10;
+            for (int iteration = 0; iteration < 200; iteration++) {
+                double middle = (lower + upper) / 2;
+                (TukeyGH(middle, xi, omega, g, h) < z_matrix[i] ? lower : upper) = middle;
+            }
+            z_gaussian[i] = (lower + upper) / 2;
+        }
+        auto sigma = DenseCovariance(*pKernel, obs_locations, obs_locations, estimated_theta);
+        auto cross = DenseCovariance(*pKernel, obs_locations, miss_locations, estimated_theta);
+        auto weights = DenseSolve(sigma, cross, n_obs, n_miss);
+        for (int j = 0; j < n_miss; j++) {
+            // The Gaussian field is N(mean, variance) given the observations, the prediction is the expectation of
+            // its transformation, integrated numerically.
+            double mean = DenseDot(weights.data() + j * n_obs, z_gaussian.data(), n_obs);
+            double variance = 1 - DenseDot(weights.data() + j * n_obs, cross.data() + j * n_obs, n_obs);
+            double deviation = sqrt(variance), expectation = 0;
+            int points_number = 4000;
+            double step = 24 * deviation / points_number;
+            for (int k = 0; k <= points_number; k++) {
+                double x = mean - 12 * deviation + k * step;
+                double weight = k == 0 || k == points_number ? 0.5 : 1;
+                expectation += weight * TukeyGH(x, xi, omega, g, h) * exp(-(x - mean) * (x - mean) / (2 * variance));
+            }
+            expectation *= step / sqrt(2 * M_PI * variance);
+            REQUIRE(predicted_values[j] == Catch::Approx(expectation).epsilon(1e-6));
+        }
+        delete pKernel;
     }SECTION("Test Prediction - IDW ") {
         configurations.SetIsMLOEMMOM(false);
         configurations.SetIsFisher(false);
@@ -157,6 +421,58 @@ void TEST_PREDICTION_MISSING_DATA() {
         delete pKernel;
     }
 
+    SECTION("Test Prediction - MLOE_MMOM against the per location values") {
+        configurations.SetIsMSPE(false);
+        configurations.SetIsIDW(false);
+        configurations.SetIsMLOEMMOM(true);
+        configurations.SetIsFisher(false);
+
+        vector<double> estimated_theta{0.9, 0.09, 0.4};
+        configurations.SetEstimatedTheta(estimated_theta);
+        exageostat::kernels::Kernel<double> *pKernel = exageostat::plugins::PluginRegistry<exageostat::kernels::Kernel<double>>::Create(
+                configurations.GetKernelName(),
+                configurations.GetTimeSlot());
+
+        // The last locations are predicted from the first ones.
+        int n_obs = 12, n_miss = N - n_obs;
+        Locations<double> obs_locations(n_obs, Dimension2D), miss_locations(n_miss, Dimension2D);
+        obs_locations.SetLocationX(*location_x, n_obs);
+        obs_locations.SetLocationY(*location_y, n_obs);
+        miss_locations.SetLocationX(*(location_x + n_obs), n_miss);
+        miss_locations.SetLocationY(*(location_y + n_obs), n_miss);
+        configurations.InitializeDataPredictionArguments();
+        Prediction<double>::PredictMissingData(data, configurations, z_matrix, *pKernel, &obs_locations,
+                                               &miss_locations);
+
+        // The batched computation must match the losses of every missing location, computed one by one.
+        auto sigma_truth = DenseCovariance(*pKernel, obs_locations, obs_locations, initial_theta);
+        auto sigma_estimated = DenseCovariance(*pKernel, obs_locations, obs_locations, estimated_theta);
+        auto k_truth = DenseCovariance(*pKernel, obs_locations, miss_locations, initial_theta);
+        auto k_estimated = DenseCovariance(*pKernel, obs_locations, miss_locations, estimated_theta);
+        auto weights_truth = DenseSolve(sigma_truth, k_truth, n_obs, n_miss);
+        auto weights_estimated = DenseSolve(sigma_estimated, k_estimated, n_obs, n_miss);
+        double mloe = 0, mmom = 0;
+        for (int j = 0; j < n_miss; j++) {
+            const double *pWeightsEstimated = weights_estimated.data() + j * n_obs;
+            vector<double> sigma_weights(n_obs);
+            for (int i = 0; i < n_obs; i++) {
+                sigma_weights[i] = DenseDot(sigma_truth.data() + i * n_obs, pWeightsEstimated, n_obs);
+            }
+            // Error of the misspecified predictor, of the optimal one, and the error the misspecified model expects.
+            double true_error = initial_theta[0] - 2 * DenseDot(k_truth.data() + j * n_obs, pWeightsEstimated, n_obs) +
+                                DenseDot(pWeightsEstimated, sigma_weights.data(), n_obs);
+            double optimal_error =
+                    initial_theta[0] - DenseDot(k_truth.data() + j * n_obs, weights_truth.data() + j * n_obs, n_obs);
+            double expected_error =
+                    estimated_theta[0] - DenseDot(k_estimated.data() + j * n_obs, pWeightsEstimated, n_obs);
+            mloe += true_error / optimal_error - 1;
+            mmom += expected_error / true_error - 1;
+        }
+        REQUIRE(Results::GetInstance()->GetMLOE() == Catch::Approx(mloe / n_miss).epsilon(1e-8));
+        REQUIRE(Results::GetInstance()->GetMMOM() == Catch::Approx(mmom / n_miss).epsilon(1e-8));
+        delete pKernel;
+    }
+
     SECTION("Test Prediction - FISHER") {
         configurations.SetIsMSPE(false);
         configurations.SetIsIDW(false);
@@ -180,6 +496,59 @@ void TEST_PREDICTION_MISSING_DATA() {
             REQUIRE(diff == Catch::Approx(0.0).margin(1e-6));
         }
         delete pKernel;
+    }SECTION("Test Prediction - FISHER against the dense traces") {
+        configurations.SetIsMSPE(false);
+        configurations.SetIsIDW(false);
+        configurations.SetIsMLOEMMOM(false);
+        configurations.SetIsFisher(true);
+        // The tile size does not divide the problem size, so the last tiles are partial.
+        configurations.SetDenseTileSize(5);
+
+        vector<double> estimated_theta{0.9, 0.09, 0.4};
+        configurations.SetEstimatedTheta(estimated_theta);
+        exageostat::kernels::Kernel<double> *pKernel = exageostat::plugins::PluginRegistry<exageostat::kernels::Kernel<double>>::Create(
+                configurations.GetKernelName(),
+                configurations.GetTimeSlot());
+        configurations.InitializeDataPredictionArguments();
+        Prediction<double>::PredictMissingData(data, configurations, z_matrix, *pKernel);
+
+        // The covariance derivatives are central finite differences of the covariance.
+        auto &locations = *data->GetLocations();
+        auto sigma = DenseCovariance(*pKernel, locations, locations, estimated_theta);
+        vector<vector<double>> solved_derivatives(3);
+        for (int j = 0; j < 3; j++) {
+            double step = 1e-5 * estimated_theta[j];
+            auto theta_plus = estimated_theta, theta_minus = estimated_theta;
+            theta_plus[j] += step;
+            theta_minus[j] -= step;
+            auto derivative = DenseCovariance(*pKernel, locations, locations, theta_plus);
+            auto sigma_minus = DenseCovariance(*pKernel, locations, locations, theta_minus);
+            for (int i = 0; i < N * N; i++) {
+                derivative[i] = (derivative[i] - sigma_minus[i]) / (2 * step);
+            }
+            solved_derivatives[j] = DenseSolve(sigma, derivative, N, N);
+        }
+        vector<double> fisher(9), identity(9, 0);
+        for (int j = 0; j < 3; j++) {
+            identity[j * 4] = 1;
+            for (int k = 0; k < 3; k++) {
+                double trace = 0;
+                for (int a = 0; a < N; a++) {
+                    for (int b = 0; b < N; b++) {
+                        trace += solved_derivatives[j][a + b * N] * solved_derivatives[k][b + a * N];
+                    }
+                }
+                fisher[j + k * 3] = 0.5 * trace;
+            }
+        }
+        // The inverse of the Fisher information is returned. The smoothness derivative kernel approximates the
+        // derivative of the Bessel function, which bounds the agreement.
+        auto inverse_fisher = DenseSolve(fisher, identity, 3, 3);
+        for (int i = 0; i < 9; i++) {
+            REQUIRE(Results::GetInstance()->GetFisherMatrix()[i] ==
+                    Catch::Approx(inverse_fisher[i]).epsilon(1e-5).margin(1e-7));
+        }
+        delete pKernel;
     }SECTION("Test Prediction - Exception") {
         vector<double> new_estimated_theta{-1, -1, -1};
         configurations.SetEstimatedTheta(new_estimated_theta);
@@ -12,6 +12,10 @@
  * @date 2023-12-08
 **/
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
 #include <catch2/catch_all.hpp>
 
 #include <prediction/PredictionHelpers.hpp>
@@ -243,9 +247,120 @@ void TEST_SORT_HELPER_FUNCTION() {
     }
 }
 
+/**
+ * @brief Predicts a missing value with a serial inverse distance weighting of the given observed values.
+ * @return The predicted value.
+ *
+ */
+double ReferenceIDW(Locations<double> &aObsLocations, double *apZObs, const int &aZObsNumber,
+                    Locations<double> &aMissLocations, const int &aMissIndex, const int &aNeighborsNumber,
+                    const double &aRadius, const double &aPower) {
+    std::vector<std::pair<double, int>> distances;
+    for (int i = 0; i < aZObsNumber; i++) {
+        double dx = aObsLocations.GetLocationX()[i] - aMissLocations.GetLocationX()[aMissIndex];
+        double dy = aObsLocations.GetLocationY()[i] - aMissLocations.GetLocationY()[aMissIndex];
+        distances.emplace_back(sqrt(dx * dx + dy * dy), i);
+    }
+    std::sort(distances.begin(), distances.end());
+    int count = aNeighborsNumber > 0 ? aNeighborsNumber : aZObsNumber;
+    double sigma_1 = 0, sigma_2 = 0;
+    for (int k = 0; k < count && (aRadius == 0 || distances[k].first <= aRadius); k++) {
+        sigma_1 += apZObs[distances[k].second] / pow(distances[k].first, aPower);
+        sigma_2 += 1 / pow(distances[k].first, aPower);
+    }
+    return sigma_1 / sigma_2;
+}
+
+void TEST_IDW_AUXILIARY_FUNCTION() {
+
+    int obs_number = 2000, miss_number = 300;
+    srand(0);
+    Locations<double> obs_locations(obs_number, Dimension2D), miss_locations(miss_number, Dimension2D);
+    std::vector<double> z_obs(obs_number), z_actual(miss_number), z_miss(miss_number);
+    for (int i = 0; i < obs_number; i++) {
+        obs_locations.GetLocationX()[i] = (double) rand() / RAND_MAX;
+        obs_locations.GetLocationY()[i] = (double) rand() / RAND_MAX;
+        z_obs[i] = sin(6 * obs_locations.GetLocationX()[i]) + obs_locations.GetLocationY()[i];
+    }
+    for (int j = 0; j < miss_number; j++) {
+        miss_locations.GetLocationX()[j] = (double) rand() / RAND_MAX;
+        miss_locations.GetLocationY()[j] = (double) rand() / RAND_MAX;
+        z_actual[j] = sin(6 * miss_locations.GetLocationX()[j]) + miss_locations.GetLocationY()[j];
+    }
+    exageostat::configurations::Configurations configurations;
+    configurations.SetCoresNumber(4);
+    double mspe[3];
+    Locations<double> *pObsLocations = &obs_locations, *pMissLocations = &miss_locations;
+
+    auto check = [&](const int &aNeighborsNumber, const double &aRadius, const double &aPower) {
+        configurations.SetIDWNeighborsNumber(aNeighborsNumber);
+        configurations.SetIDWRadius(aRadius);
+        configurations.SetIDWPower(aPower);
+        PredictionAuxiliaryFunctions<double>::PredictIDW(z_miss.data(), z_actual.data(), z_obs.data(), miss_number,
+                                                         obs_number, *pMissLocations, *pObsLocations, mspe,
+                                                         configurations);
+        double error = 0;
+        for (int j = 0; j < miss_number; j++) {
+            double expected = ReferenceIDW(*pObsLocations, z_obs.data(), obs_number, *pMissLocations, j,
+                                           aNeighborsNumber, aRadius, aPower);
+            REQUIRE(z_miss[j] == Catch::Approx(expected));
+            error += (z_actual[j] - z_miss[j]) * (z_actual[j] - z_miss[j]);
+        }
+        REQUIRE(mspe[0] == Catch::Approx(error / miss_number));
+    };
+
+    SECTION("All the observed locations") {
+        check(0, 0, 2);
+        check(0, 0, 3);
+    }SECTION("Nearest neighbors") {
+        check(10, 0, 2);
+        check(10, 0.05, 1.5);
+    }SECTION("Search radius") {
+        check(0, 0.1, 2);
+    }SECTION("Space-time locations") {
+        // The time slots are ignored, with or without neighbor options the weights are the spatial ones.
+        Locations<double> obs_st_locations(obs_number, DimensionST), miss_st_locations(miss_number, DimensionST);
+        obs_st_locations.SetLocationX(*obs_locations.GetLocationX(), obs_number);
+        obs_st_locations.SetLocationY(*obs_locations.GetLocationY(), obs_number);
+        miss_st_locations.SetLocationX(*miss_locations.GetLocationX(), miss_number);
+        miss_st_locations.SetLocationY(*miss_locations.GetLocationY(), miss_number);
+        for (int i = 0; i < obs_number; i++) {
+            obs_st_locations.GetLocationZ()[i] = i % 5;
+        }
+        for (int j = 0; j < miss_number; j++) {
+            miss_st_locations.GetLocationZ()[j] = j % 3;
+        }
+        pObsLocations = &obs_st_locations, pMissLocations = &miss_st_locations;
+        check(0, 0, 2);
+        check(10, 0, 2);
+        check(0, 0.1, 2);
+    }SECTION("Coincident and isolated locations") {
+        miss_locations.GetLocationX()[0] = obs_locations.GetLocationX()[5];
+        miss_locations.GetLocationY()[0] = obs_locations.GetLocationY()[5];
+        configurations.SetIDWNeighborsNumber(0);
+        configurations.SetIDWRadius(0);
+        PredictionAuxiliaryFunctions<double>::PredictIDW(z_miss.data(), z_actual.data(), z_obs.data(), miss_number,
+                                                         obs_number, miss_locations, obs_locations, mspe,
+                                                         configurations);
+        REQUIRE(z_miss[0] == z_obs[5]);
+
+        // Nothing is observed within such a small radius, the nearest observed value is taken.
+        configurations.SetIDWRadius(1e-9);
+        PredictionAuxiliaryFunctions<double>::PredictIDW(z_miss.data(), z_actual.data(), z_obs.data(), miss_number,
+                                                         obs_number, miss_locations, obs_locations, mspe,
+                                                         configurations);
+        for (int j = 1; j < miss_number; j++) {
+            double nearest = ReferenceIDW(obs_locations, z_obs.data(), obs_number, miss_locations, j, 1, 0, 2);
+            REQUIRE(z_miss[j] == Catch::Approx(nearest));
+        }
+    }
+}
+
 TEST_CASE("Test Prediction Helpers") {
     TEST_SHUFFLE_HELPER_FUNCTIONS();
 
     TEST_SORT_HELPER_FUNCTION();
+
+    TEST_IDW_AUXILIARY_FUNCTION();
 }
 